@@ -58,6 +58,10 @@ set(MAIN_SOURCE_FILES
 	Game/File/GameFile.cpp
 	Game/File/GameFileFactoryRegistry.h
 	Game/File/GameFileFactoryRegistry.cpp
+	Game/File/JSONFileReader.h
+	Game/File/JSONFileReader.cpp
+	Game/File/JSONFileWriter.h
+	Game/File/JSONFileWriter.cpp
 	Game/File/Animation/Animation.h
 	Game/File/Animation/Animation.cpp
 	Game/File/Animation/ANM/AnimationANM.h
@@ -136,16 +140,40 @@ set(MAIN_SOURCE_FILES
 	Game/File/Sound/WAV/SoundWAV.cpp
 	Game/File/Zip/Zip.h
 	Game/File/Zip/Zip.cpp
+	Manager/DirectorySnapshotService.h
+	Manager/DirectorySnapshotService.cpp
+	Manager/DirectoryWatcher.h
+	Manager/DirectoryWatcher.cpp
+	Manager/FileFingerprintCache.h
+	Manager/FileFingerprintCache.cpp
+	Manager/FileHashService.h
+	Manager/FileHashService.cpp
+	Manager/FileStagingService.h
+	Manager/FileStagingService.cpp
 	Manager/InstalledModInfo.h
 	Manager/InstalledModInfo.cpp
+	Manager/LaunchPlan.h
+	Manager/LaunchPlan.cpp
+	Manager/LaunchStagingService.h
+	Manager/LaunchStagingService.cpp
+	Manager/ModFileExtractionService.h
+	Manager/ModFileExtractionService.cpp
 	Manager/ModManager.h
 	Manager/ModManager.cpp
 	Manager/ModMatch.h
 	Manager/ModMatch.cpp
+	Manager/PhaseProfiler.h
+	Manager/PhaseProfiler.cpp
 	Manager/SettingsManager.h
 	Manager/SettingsManager.cpp
+	Manager/TaskGraph.h
+	Manager/TaskGraph.cpp
+	Mod/BKTree.h
+	Mod/BKTree.cpp
 	Mod/FavouriteModCollection.h
 	Mod/FavouriteModCollection.cpp
+	Mod/InternedString.h
+	Mod/InternedString.cpp
 	Mod/Location.h
 	Mod/Location.cpp
 	Mod/Mod.h
@@ -154,8 +182,12 @@ set(MAIN_SOURCE_FILES
 	Mod/ModAuthorInformation.cpp
 	Mod/ModCollection.h
 	Mod/ModCollection.cpp
+	Mod/ModCollectionDelta.h
+	Mod/ModCollectionDelta.cpp
 	Mod/ModDependency.h
 	Mod/ModDependency.cpp
+	Mod/ModDependencyGraph.h
+	Mod/ModDependencyGraph.cpp
 	Mod/ModDownload.h
 	Mod/ModDownload.cpp
 	Mod/ModFile.h
@@ -168,6 +200,8 @@ set(MAIN_SOURCE_FILES
 	Mod/ModImage.cpp
 	Mod/ModScreenshot.h
 	Mod/ModScreenshot.cpp
+	Mod/ModSearchIndex.h
+	Mod/ModSearchIndex.cpp
 	Mod/ModTeam.h
 	Mod/ModTeam.cpp
 	Mod/ModTeamMember.h
@@ -189,7 +223,12 @@ set(MAIN_SOURCE_FILES
 
 set(MAIN_SOURCE_FILES_WINDOWS
 	Game/Windows/GameLocatorWindows.cpp
+	Manager/Windows/DirectoryWatcherWindows.cpp
+	Manager/Windows/FileFingerprintCacheWindows.cpp
+	Manager/Windows/FileStagingServiceWindows.cpp
+	Manager/Windows/LaunchStagingServiceWindows.cpp
 	Manager/Windows/ModManagerWindows.cpp
+	Manager/Windows/PhaseProfilerWindows.cpp
 )
 
 set(GUI_SOURCE_FILES
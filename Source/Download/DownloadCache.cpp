@@ -3,6 +3,7 @@
 #include "CachedFile.h"
 #include "CachedPackageFile.h"
 #include "Game/GameVersion.h"
+#include "Game/File/JSONFileReader.h"
 #include "Mod/ModDownload.h"
 #include "Mod/ModFile.h"
 #include "Mod/ModGameVersion.h"
@@ -393,23 +394,20 @@ bool DownloadCache::loadFrom(const std::string & filePath) {
 		return false;
 	}
 
-	std::ifstream fileStream(filePath);
+	JSONFileReader fileReader;
 
-	if(!fileStream.is_open()) {
-		spdlog::error("Failed to open download cache file for reading!");
-		return false;
-	}
+	if(!fileReader.load(filePath)) {
+		if(fileReader.getDocument().HasParseError()) {
+			spdlog::error("Invalid download cache JSON file data: {}", fileReader.getParseErrorMessage());
+		}
+		else {
+			spdlog::error("Failed to open download cache file for reading!");
+		}
 
-	rapidjson::Document downloadCacheValue;
-	rapidjson::IStreamWrapper fileStreamWrapper(fileStream);
-	if(downloadCacheValue.ParseStream(fileStreamWrapper).HasParseError()) {
-		spdlog::error("Invalid download cache JSON file data!");
 		return false;
 	}
 
-	fileStream.close();
-
-	std::unique_ptr<DownloadCache> newDownloadCache(parseFrom(downloadCacheValue));
+	std::unique_ptr<DownloadCache> newDownloadCache(parseFrom(fileReader.getDocument()));
 
 	if(!DownloadCache::isValid(newDownloadCache.get())) {
 		spdlog::error("Failed to parse download cache from JSON file '{}'.", filePath);
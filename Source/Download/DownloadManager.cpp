@@ -311,7 +311,7 @@ bool DownloadManager::isModGameVersionDownloaded(const ModGameVersion & modGameV
 			return false;
 		}
 
-		std::shared_ptr<GameVersion> gameVersion(gameVersions->getGameVersionWithID(modGameVersion.getGameVersionID()));
+		std::shared_ptr<GameVersion> gameVersion(gameVersions->getGameVersionWithID(modGameVersion.getInternedGameVersionID()));
 
 		if(gameVersion == nullptr) {
 			return false;
@@ -322,7 +322,7 @@ bool DownloadManager::isModGameVersionDownloaded(const ModGameVersion & modGameV
 		std::shared_ptr<ModGameVersion> compatibleModGameVersion;
 
 		for(std::vector<std::shared_ptr<GameVersion>>::const_reverse_iterator i = compatibleGameVersions.crbegin(); i != compatibleGameVersions.crend(); ++i) {
-			compatibleModGameVersion = modGameVersion.getParentModVersionType()->getGameVersionWithID((*i)->getID());
+			compatibleModGameVersion = modGameVersion.getParentModVersionType()->getGameVersionWithID((*i)->getInternedID());
 
 			if(compatibleModGameVersion == nullptr) {
 				continue;
@@ -473,7 +473,7 @@ bool DownloadManager::downloadModGameVersion(const ModGameVersion & modGameVersi
 				return false;
 			}
 
-			gameVersion = gameVersions.getGameVersionWithID(modGameVersion.getGameVersionID());
+			gameVersion = gameVersions.getGameVersionWithID(modGameVersion.getInternedGameVersionID());
 		}
 
 		if(gameVersion == nullptr) {
@@ -755,7 +755,7 @@ bool DownloadManager::uninstallModGameVersion(const ModGameVersion & modGameVers
 				return false;
 			}
 
-			gameVersion = gameVersions.getGameVersionWithID(modGameVersion.getGameVersionID());
+			gameVersion = gameVersions.getGameVersionWithID(modGameVersion.getInternedGameVersionID());
 		}
 
 		if(gameVersion == nullptr) {
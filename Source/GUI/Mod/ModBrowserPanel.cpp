@@ -35,9 +35,11 @@
 #include <sstream>
 
 wxDECLARE_EVENT(EVENT_LAUNCH_FAILED, LaunchFailedEvent);
+wxDECLARE_EVENT(EVENT_LAUNCH_FINISHED, LaunchFinishedEvent);
 wxDECLARE_EVENT(EVENT_GAME_PROCESS_TERMINATED, GameProcessTerminatedEvent);
 wxDECLARE_EVENT(EVENT_MOD_INSTALL_PROGRESS, ModInstallProgressEvent);
 wxDECLARE_EVENT(EVENT_MOD_INSTALL_DONE, ModInstallDoneEvent);
+wxDECLARE_EVENT(EVENT_MISSING_MOD_FILES_UPDATED, MissingModFilesUpdatedEvent);
 
 class LaunchFailedEvent final : public wxEvent {
 public:
@@ -56,6 +58,23 @@ public:
 
 IMPLEMENT_DYNAMIC_CLASS(LaunchFailedEvent, wxEvent);
 
+class LaunchFinishedEvent final : public wxEvent {
+public:
+	LaunchFinishedEvent()
+		: wxEvent(0, EVENT_LAUNCH_FINISHED) { }
+
+	~LaunchFinishedEvent() override { }
+
+	// wxEvent Virtuals
+	wxEvent * Clone() const override {
+		return new LaunchFinishedEvent(*this);
+	}
+
+	DECLARE_DYNAMIC_CLASS(LaunchFinishedEvent);
+};
+
+IMPLEMENT_DYNAMIC_CLASS(LaunchFinishedEvent, wxEvent);
+
 class GameProcessTerminatedEvent final : public wxEvent {
 public:
 	GameProcessTerminatedEvent()
@@ -137,10 +156,31 @@ private:
 
 IMPLEMENT_DYNAMIC_CLASS(ModInstallDoneEvent, wxEvent);
 
+class MissingModFilesUpdatedEvent final : public wxEvent {
+public:
+	MissingModFilesUpdatedEvent()
+		: wxEvent(0, EVENT_MISSING_MOD_FILES_UPDATED) { }
+
+	~MissingModFilesUpdatedEvent() override { }
+
+	// wxEvent Virtuals
+	wxEvent * Clone() const override {
+		return new MissingModFilesUpdatedEvent(*this);
+	}
+
+	DECLARE_DYNAMIC_CLASS(MissingModFilesUpdatedEvent);
+};
+
+IMPLEMENT_DYNAMIC_CLASS(MissingModFilesUpdatedEvent, wxEvent);
+
 wxDEFINE_EVENT(EVENT_LAUNCH_FAILED, LaunchFailedEvent);
+wxDEFINE_EVENT(EVENT_LAUNCH_FINISHED, LaunchFinishedEvent);
 wxDEFINE_EVENT(EVENT_GAME_PROCESS_TERMINATED, GameProcessTerminatedEvent);
 wxDEFINE_EVENT(EVENT_MOD_INSTALL_PROGRESS, ModInstallProgressEvent);
 wxDEFINE_EVENT(EVENT_MOD_INSTALL_DONE, ModInstallDoneEvent);
+wxDEFINE_EVENT(EVENT_MISSING_MOD_FILES_UPDATED, MissingModFilesUpdatedEvent);
+
+static const std::string MISSING_FILES_SUFFIX(" [Missing Files]");
 
 ModBrowserPanel::ModBrowserPanel(std::shared_ptr<ModManager> modManager, wxWindow * parent, wxWindowID windowID, const wxPoint & position, const wxSize & size, long style)
 	: wxPanel(parent, windowID, position, size, style, "Mod Browser")
@@ -211,11 +251,15 @@ ModBrowserPanel::ModBrowserPanel(std::shared_ptr<ModManager> modManager, wxWindo
 	m_launchStatusConnection = m_modManager->launchStatus.connect(std::bind(&ModBrowserPanel::onLaunchStatus, this, std::placeholders::_1));
 	m_launchErrorConnection = m_modManager->launchError.connect(std::bind(&ModBrowserPanel::onLaunchError, this, std::placeholders::_1));
 	m_gameProcessTerminatedConnection = m_modManager->gameProcessTerminated.connect(std::bind(&ModBrowserPanel::onGameProcessTerminated, this, std::placeholders::_1, std::placeholders::_2));
+	m_integrityVerificationFinishedConnection = m_modManager->integrityVerificationFinished.connect(std::bind(&ModBrowserPanel::onIntegrityVerificationFinished, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
+	m_missingModFilesChangedConnection = m_modManager->missingModFilesChanged.connect(std::bind(&ModBrowserPanel::onMissingModFilesChanged, this));
 
 	Bind(EVENT_LAUNCH_FAILED, &ModBrowserPanel::onLaunchFailed, this);
+	Bind(EVENT_LAUNCH_FINISHED, &ModBrowserPanel::onLaunchFinished, this);
 	Bind(EVENT_GAME_PROCESS_TERMINATED, &ModBrowserPanel::onGameProcessEnded, this);
 	Bind(EVENT_MOD_INSTALL_PROGRESS, &ModBrowserPanel::onModInstallProgress, this);
 	Bind(EVENT_MOD_INSTALL_DONE, &ModBrowserPanel::onModInstallDone, this);
+	Bind(EVENT_MISSING_MOD_FILES_UPDATED, &ModBrowserPanel::onMissingModFilesUpdated, this);
 
 	wxPanel * modListOptionsPanel = new wxPanel(this, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxTAB_TRAVERSAL, "Mod List Options");
 
@@ -486,6 +530,8 @@ ModBrowserPanel::~ModBrowserPanel() {
 	m_launchStatusConnection.disconnect();
 	m_launchErrorConnection.disconnect();
 	m_gameProcessTerminatedConnection.disconnect();
+	m_integrityVerificationFinishedConnection.disconnect();
+	m_missingModFilesChangedConnection.disconnect();
 	m_modSelectionChangedConnection.disconnect();
 	m_gameTypeChangedConnection.disconnect();
 	m_preferredDOSBoxVersionChangedConnection.disconnect();
@@ -574,6 +620,8 @@ void ModBrowserPanel::updateModList() {
 
 		m_modListBox->Set(WXUtilities::createItemWXArrayString(organizedMods->getOrganizedItemDisplayNames()));
 
+		updateMissingModFileMarkers();
+
 		if(mod != nullptr) {
 			m_modListBox->SetSelection(organizedMods->indexOfSelectedItem());
 		}
@@ -589,7 +637,9 @@ void ModBrowserPanel::updateModList() {
 		wxArrayString matchesArrayString;
 
 		if(organizedMods->shouldDisplayMods()) {
-			m_modMatches = ModManager::searchForMod(organizedMods->getOrganizedMods(), m_searchQuery);
+			m_modMatches = ModManager::searchForMod(organizedMods->getOrganizedMods(), m_searchQuery, false, false, &m_modManager->getMods()->getSearchIndex(), [organizedMods](const Mod & mod) {
+				return organizedMods->indexOfOrganizedMod(mod);
+			});
 
 			for(size_t i = 0; i < m_modMatches.size(); i++) {
 				std::stringstream modMatchStringStream;
@@ -617,7 +667,7 @@ void ModBrowserPanel::updateModList() {
 			}
 		}
 		else if(organizedMods->shouldDisplayGameVersions()) {
-			m_gameVersionMatches = ModManager::searchForGameVersion(organizedMods->getOrganizedGameVersions(), m_searchQuery);
+			m_gameVersionMatches = ModManager::searchForGameVersion(organizedMods->getOrganizedGameVersions(), m_searchQuery, m_modManager->getGameVersions().get());
 
 			for(size_t i = 0; i < m_gameVersionMatches.size(); i++) {
 				std::stringstream gameVersionMatchStringStream;
@@ -635,7 +685,7 @@ void ModBrowserPanel::updateModList() {
 			}
 		}
 		else if(organizedMods->shouldDisplayTeams() || organizedMods->shouldDisplayAuthors()) {
-			m_modAuthorMatches = ModManager::searchForAuthor(organizedMods->shouldDisplayTeams() ? organizedMods->getOrganizedTeams() : organizedMods->getOrganizedAuthors(), m_searchQuery);
+			m_modAuthorMatches = ModManager::searchForAuthor(organizedMods->shouldDisplayTeams() ? organizedMods->getOrganizedTeams() : organizedMods->getOrganizedAuthors(), m_searchQuery, &m_modManager->getMods()->getSearchIndex());
 
 			for(size_t i = 0; i < m_modAuthorMatches.size(); i++) {
 				matchesArrayString.Add(wxString::FromUTF8(fmt::format("{}. {} ({})", i + 1, m_modAuthorMatches[i]->getName(), m_modAuthorMatches[i]->getModCount())));
@@ -645,12 +695,49 @@ void ModBrowserPanel::updateModList() {
 		m_modListLabel->SetLabelText("Search Results");
 		m_modListBox->Set(matchesArrayString);
 
+		updateMissingModFileMarkers();
+
 		m_selectRandomModButton->Disable();
 	}
 
 	updateModVersionList();
 }
 
+void ModBrowserPanel::updateMissingModFileMarkers() {
+	std::shared_ptr<OrganizedModCollection> organizedMods(m_modManager->getOrganizedMods());
+
+	if(!organizedMods->shouldDisplayMods()) {
+		return;
+	}
+
+	std::shared_ptr<Mod> mod;
+
+	for(unsigned int i = 0; i < m_modListBox->GetCount(); i++) {
+		if(m_searchQuery.empty()) {
+			mod = organizedMods->getMod(i);
+		}
+		else {
+			mod = i < m_modMatches.size() ? m_modMatches[i].getMod() : nullptr;
+		}
+
+		if(mod == nullptr) {
+			continue;
+		}
+
+		std::string modListItemText(m_modListBox->GetString(i).ToStdString());
+		bool marked = Utilities::endsWith(modListItemText, MISSING_FILES_SUFFIX);
+
+		if(m_modManager->doesModHaveMissingFiles(mod->getID())) {
+			if(!marked) {
+				m_modListBox->SetString(i, wxString::FromUTF8(modListItemText + MISSING_FILES_SUFFIX));
+			}
+		}
+		else if(marked) {
+			m_modListBox->SetString(i, wxString::FromUTF8(modListItemText.substr(0, modListItemText.length() - MISSING_FILES_SUFFIX.length())));
+		}
+	}
+}
+
 void ModBrowserPanel::updateModVersionList() {
 	if(m_searchQuery.empty()) {
 		std::shared_ptr<Mod> mod(m_modManager->getSelectedMod());
@@ -1406,7 +1493,11 @@ bool ModBrowserPanel::launchGame() {
 	m_gameRunningDialog = new ProcessRunningDialog(this, "Game Running", dialogMessageStringStream.str(), "Close Game");
 
 	m_runSelectedModFuture = std::async(std::launch::async, [this, alternateGameVersion, alternateModGameVersion]() {
-		return m_modManager->runSelectedMod(alternateGameVersion, alternateModGameVersion);
+		bool result = m_modManager->runSelectedMod(alternateGameVersion, alternateModGameVersion);
+
+		QueueEvent(new LaunchFinishedEvent());
+
+		return result;
 	});
 
 	int processExitCode = m_gameRunningDialog->ShowModal();
@@ -1862,11 +1953,27 @@ void ModBrowserPanel::onGameProcessTerminated(uint64_t nativeExitCode, bool forc
 	QueueEvent(new GameProcessTerminatedEvent());
 }
 
+void ModBrowserPanel::onIntegrityVerificationFinished(size_t numberOfMissingExecutables, size_t numberOfMissingModFiles, size_t numberOfUnlinkedModFiles, bool cancelled) {
+	QueueEvent(new MissingModFilesUpdatedEvent());
+}
+
+void ModBrowserPanel::onMissingModFilesChanged() {
+	QueueEvent(new MissingModFilesUpdatedEvent());
+}
+
+void ModBrowserPanel::onMissingModFilesUpdated(MissingModFilesUpdatedEvent & event) {
+	updateMissingModFileMarkers();
+}
+
 void ModBrowserPanel::onLaunchFailed(LaunchFailedEvent & launchFailedEvent) {
 	m_gameRunningDialog->Destroy();
 	m_gameRunningDialog = nullptr;
 }
 
+void ModBrowserPanel::onLaunchFinished(LaunchFinishedEvent & launchFinishedEvent) {
+	m_modManager->applyPendingLaunchUpdates();
+}
+
 void ModBrowserPanel::onGameProcessEnded(GameProcessTerminatedEvent & gameProcessTerminatedEvent) { }
 
 void ModBrowserPanel::onModInstallProgress(ModInstallProgressEvent & event) {
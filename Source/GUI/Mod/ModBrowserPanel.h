@@ -30,6 +30,8 @@ class ProcessRunningDialog;
 class GameVersion;
 class GameVersionCollection;
 class LaunchFailedEvent;
+class LaunchFinishedEvent;
+class MissingModFilesUpdatedEvent;
 class Mod;
 class ModAuthorInformation;
 class ModGameVersion;
@@ -50,6 +52,7 @@ public:
 	void updateModListSortType();
 	void updateModListSortDirection();
 	void updateModList();
+	void updateMissingModFileMarkers();
 	void updateModVersionList();
 	void updateModVersionTypeList();
 	void updateModGameVersionList();
@@ -103,7 +106,11 @@ private:
 	void onLaunchStatus(const std::string & statusMessage);
 	void onLaunchError(const std::string & errorMessage);
 	void onGameProcessTerminated(uint64_t nativeExitCode, bool forceTerminated);
+	void onIntegrityVerificationFinished(size_t numberOfMissingExecutables, size_t numberOfMissingModFiles, size_t numberOfUnlinkedModFiles, bool cancelled);
+	void onMissingModFilesChanged();
+	void onMissingModFilesUpdated(MissingModFilesUpdatedEvent & event);
 	void onLaunchFailed(LaunchFailedEvent & launchFailedEvent);
+	void onLaunchFinished(LaunchFinishedEvent & launchFinishedEvent);
 	void onGameProcessEnded(GameProcessTerminatedEvent & gameProcessTerminatedEvent);
 	void onModInstallProgress(ModInstallProgressEvent & event);
 	void onModInstallDone(ModInstallDoneEvent & event);
@@ -142,6 +149,8 @@ private:
 	boost::signals2::connection m_launchStatusConnection;
 	boost::signals2::connection m_launchErrorConnection;
 	boost::signals2::connection m_gameProcessTerminatedConnection;
+	boost::signals2::connection m_integrityVerificationFinishedConnection;
+	boost::signals2::connection m_missingModFilesChangedConnection;
 	boost::signals2::connection m_modSelectionChangedConnection;
 	boost::signals2::connection m_gameTypeChangedConnection;
 	boost::signals2::connection m_preferredDOSBoxVersionChangedConnection;
@@ -59,10 +59,12 @@ SettingsManagerPanel::SettingsManagerPanel(std::shared_ptr<ModManager> modManage
 	m_settingsPanels.push_back(SettingPanel::createStringSettingPanel(settings->gameTempDirectoryName, SettingsManager::DEFAULT_GAME_TEMP_DIRECTORY_NAME, "Game Temp Directory Name", generalSettingsPanel, generalSettingsSizer, 1));
 	m_settingsPanels.push_back(SettingPanel::createStringSettingPanel(settings->tempSymlinkName, SettingsManager::DEFAULT_TEMP_SYMLINK_NAME, "Temp Symbolic Link Name", generalSettingsPanel, generalSettingsSizer, 1));
 	m_settingsPanels.push_back(SettingPanel::createStringSettingPanel(settings->cacheDirectoryPath, SettingsManager::DEFAULT_CACHE_DIRECTORY_PATH, "Cache Directory Path", generalSettingsPanel, generalSettingsSizer, 1));
+	m_settingsPanels.push_back(SettingPanel::createStringSettingPanel(settings->fileFingerprintCacheFileName, SettingsManager::DEFAULT_FILE_FINGERPRINT_CACHE_FILE_NAME, "File Fingerprint Cache File Name", generalSettingsPanel, generalSettingsSizer, 1));
 	m_preferredGameVersionSettingPanel = SettingPanel::createStringChoiceSettingPanel(settings->preferredGameVersionID, SettingsManager::DEFAULT_PREFERRED_GAME_VERSION_ID, "Preferred Game Version", gameVersions->getGameVersionShortNames(false), generalSettingsPanel, generalSettingsSizer, gameVersions->getGameVersionIdentifiers());
 	m_settingsPanels.push_back(m_preferredGameVersionSettingPanel);
 	m_settingsPanels.push_back(SettingPanel::createEnumSettingPanel<GameType>(settings->gameType, SettingsManager::DEFAULT_GAME_TYPE, "Game Type", generalSettingsPanel, generalSettingsSizer));
 	m_settingsPanels.push_back(SettingPanel::createBooleanSettingPanel(settings->demoExtractionEnabled, SettingsManager::DEFAULT_DEMO_EXTRACTION_ENABLED, "Extract Demos", generalSettingsPanel, generalSettingsSizer));
+	m_settingsPanels.push_back(SettingPanel::createBooleanSettingPanel(settings->reuseInstalledModFiles, SettingsManager::DEFAULT_REUSE_INSTALLED_MOD_FILES, "Reuse Installed Mod Files", generalSettingsPanel, generalSettingsSizer));
 
 	wxWrapSizer * downloadsSettingsSizer = new wxWrapSizer(wrapSizerOrientation);
 	wxStaticBox * downloadsSettingsBox = new wxStaticBox(this, wxID_ANY, "Downloads", wxDefaultPosition, wxDefaultSize, wxALIGN_LEFT, "Downloads");
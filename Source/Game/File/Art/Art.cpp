@@ -1,5 +1,7 @@
 #include "Art.h"
 
+#include "../JSONFileWriter.h"
+
 #include <ByteBuffer.h>
 #include <Utilities/FileUtilities.h>
 #include <Utilities/RapidJSONUtilities.h>
@@ -614,6 +616,61 @@ rapidjson::Value Art::toJSON(rapidjson::MemoryPoolAllocator<rapidjson::CrtAlloca
 	return artValue;
 }
 
+bool Art::writeJSON(JSONFileWriter & writer) const {
+	if(!writer.startObject() ||
+	   !writer.writeKey(JSON_VERSION_PROPERTY_NAME) ||
+	   !writer.writeValue(rapidjson::Value(m_version)) ||
+	   !writer.writeKey(JSON_LOCAL_TILE_START_PROPERTY_NAME) ||
+	   !writer.writeValue(rapidjson::Value(m_localTileStart)) ||
+	   !writer.writeKey(JSON_LOCAL_TILE_END_PROPERTY_NAME) ||
+	   !writer.writeValue(rapidjson::Value(m_localTileEnd)) ||
+	   !writer.writeKey(JSON_LEGACY_TILE_COUNT_PROPERTY_NAME) ||
+	   !writer.writeValue(rapidjson::Value(m_legacyTileCount)) ||
+	   !writer.writeKey(JSON_TILES_PROPERTY_NAME) ||
+	   !writer.startArray()) {
+		return false;
+	}
+
+	for(const std::shared_ptr<Tile> & tile : m_tiles) {
+		if(!writer.writeJSONOf(*tile)) {
+			return false;
+		}
+	}
+
+	if(!writer.endArray()) {
+		return false;
+	}
+
+	if(m_trailingData != nullptr && m_trailingData->isNotEmpty()) {
+		if(!writer.writeKey(JSON_TRAILING_DATA_PROPERTY_NAME)) {
+			return false;
+		}
+
+		if(BASE_64_ENCODE_DATA) {
+			if(!writer.writeString(m_trailingData->toBase64())) {
+				return false;
+			}
+		}
+		else {
+			if(!writer.startArray()) {
+				return false;
+			}
+
+			for(size_t i = 0; i < m_trailingData->getSize(); i++) {
+				if(!writer.writeValue(rapidjson::Value((*m_trailingData)[i]))) {
+					return false;
+				}
+			}
+
+			if(!writer.endArray()) {
+				return false;
+			}
+		}
+	}
+
+	return writer.endObject();
+}
+
 bool Art::addToJSONObject(rapidjson::Value & value, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) const {
 	if(!value.IsObject()) {
 		return false;
@@ -875,7 +932,20 @@ bool Art::saveToArt(const std::string & filePath, bool overwrite) const {
 }
 
 bool Art::saveToJSON(const std::string & filePath, bool overwrite) const {
-	return Utilities::saveJSONValueTo(toJSON(), filePath, overwrite);
+	JSONFileWriter fileWriter;
+
+	if(!fileWriter.open(filePath, overwrite)) {
+		return false;
+	}
+
+	if(!writeJSON(fileWriter)) {
+		fileWriter.close();
+
+		spdlog::error("Failed to save art to JSON file '{}'.", filePath);
+		return false;
+	}
+
+	return fileWriter.close();
 }
 
 void Art::addMetadata(std::vector<std::pair<std::string, std::string>> & metadata) const {
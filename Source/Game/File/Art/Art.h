@@ -14,6 +14,7 @@
 #include <vector>
 
 class ByteBuffer;
+class JSONFileWriter;
 
 class Art final : public GameFile {
 public:
@@ -67,6 +68,7 @@ public:
 	static std::unique_ptr<Art> readFrom(const ByteBuffer & byteBuffer);
 
 	rapidjson::Document toJSON() const;
+	bool writeJSON(JSONFileWriter & writer) const;
 	rapidjson::Value toJSON(rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) const;
 	bool addToJSONObject(rapidjson::Value & value, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) const;
 	static std::unique_ptr<Art> parseFrom(const rapidjson::Value & artValue);
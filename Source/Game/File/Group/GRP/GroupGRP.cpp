@@ -6,6 +6,7 @@
 #include <spdlog/spdlog.h>
 
 #include <filesystem>
+#include <fstream>
 
 GroupGRP::GroupGRP(const std::string & filePath)
 	: Group(filePath) { }
@@ -36,6 +37,36 @@ GroupGRP & GroupGRP::operator = (const GroupGRP & group) {
 GroupGRP::~GroupGRP() { }
 
 std::unique_ptr<GroupGRP> GroupGRP::readFrom(const ByteBuffer & byteBuffer) {
+	std::optional<std::vector<DirectoryEntry>> optionalDirectory(readDirectory(byteBuffer));
+
+	if(!optionalDirectory.has_value()) {
+		return nullptr;
+	}
+
+	const std::vector<DirectoryEntry> & directory = optionalDirectory.value();
+	std::vector<std::unique_ptr<GroupFile>> groupFiles;
+
+	for(size_t i = 0; i < directory.size(); i++) {
+		const DirectoryEntry & directoryEntry = directory[i];
+
+		if(byteBuffer.getSize() < byteBuffer.getReadOffset() + directoryEntry.fileSize) {
+			size_t numberOfMissingBytes = directoryEntry.fileSize - (byteBuffer.getSize() - byteBuffer.getReadOffset());
+			size_t numberOfAdditionalFiles = directory.size() - i - 1;
+
+			spdlog::error("Build Engine GRP group is corrupted: missing {} of {} byte{} for file #{} ('{}') data.{}", numberOfMissingBytes, directoryEntry.fileSize, directoryEntry.fileSize == 1 ? "" : "s", i + 1, directoryEntry.fileName, numberOfAdditionalFiles > 0 ? fmt::format(" There is also an additional {} files that are missing data.", numberOfAdditionalFiles) : "");
+
+			return nullptr;
+		}
+
+		groupFiles.push_back(std::make_unique<GroupFile>(directoryEntry.fileName, byteBuffer.readBytes(directoryEntry.fileSize)));
+	}
+
+	spdlog::trace("Build Engine GRP group parsed successfully, {} files loaded into memory.", groupFiles.size());
+
+	return std::make_unique<GroupGRP>(std::move(groupFiles));
+}
+
+std::optional<std::vector<GroupGRP::DirectoryEntry>> GroupGRP::readDirectory(const ByteBuffer & byteBuffer) {
 	byteBuffer.setEndianness(ENDIANNESS);
 
 	bool error = false;
@@ -45,13 +76,13 @@ std::unique_ptr<GroupGRP> GroupGRP::readFrom(const ByteBuffer & byteBuffer) {
 
 	if(error) {
 		spdlog::error("Build Engine GRP group is incomplete or corrupted: missing header text.");
-		return nullptr;
+		return {};
 	}
 
 	// verify that the header text is specified in the header
 	if(!Utilities::areStringsEqual(headerText, HEADER_TEXT)) {
 		spdlog::error("Build Engine GRP group is not a valid format, missing '{}' header text.", HEADER_TEXT);
-		return nullptr;
+		return {};
 	}
 
 	spdlog::trace("Verified Build Engine GRP group file header text.");
@@ -61,59 +92,47 @@ std::unique_ptr<GroupGRP> GroupGRP::readFrom(const ByteBuffer & byteBuffer) {
 
 	if(error) {
 		spdlog::error("Build Engine GRP group is incomplete or corrupted: missing number of files value.");
-		return nullptr;
+		return {};
 	}
 
 	spdlog::trace("Detected {} files in group.", numberOfFiles);
 
-	std::vector<std::string> fileNames;
-	std::vector<uint32_t> fileSizes;
-	std::vector<std::shared_ptr<GroupFile>> files;
+	std::vector<DirectoryEntry> directory;
+	directory.reserve(numberOfFiles);
 
 	for(uint32_t i = 0; i < numberOfFiles; i++) {
+		DirectoryEntry directoryEntry;
+
 		// read the file name
-		fileNames.emplace_back(byteBuffer.readString(GroupFile::MAX_FILE_NAME_LENGTH, &error));
+		directoryEntry.fileName = byteBuffer.readString(GroupFile::MAX_FILE_NAME_LENGTH, &error);
 
 		if(error) {
 			spdlog::error("Build Engine GRP group is incomplete or corrupted: missing file #{} name.", i + 1);
-			return nullptr;
+			return {};
 		}
 
 		// read and verify the file size
-		fileSizes.push_back(byteBuffer.readUnsignedInteger(&error));
+		directoryEntry.fileSize = byteBuffer.readUnsignedInteger(&error);
 
 		if(error) {
 			spdlog::error("Build Engine GRP group is incomplete or corrupted: missing file #{} size value.", i + 1);
-			return nullptr;
+			return {};
 		}
-	}
-
-	spdlog::trace("All Build Engine GRP group file information parsed.");
-
-	std::vector<std::unique_ptr<GroupFile>> groupFiles;
 
-	for(uint32_t i = 0; i < numberOfFiles; i++) {
-		if(byteBuffer.getSize() < byteBuffer.getReadOffset() + fileSizes[i]) {
-			size_t numberOfMissingBytes = fileSizes[i] - (byteBuffer.getSize() - byteBuffer.getReadOffset());
-			uint32_t numberOfAdditionalFiles = groupFiles.size() - i - 1;
-
-			spdlog::error("Build Engine GRP group is corrupted: missing {} of {} byte{} for file #{} ('{}') data.{}", numberOfMissingBytes, fileSizes[i], fileSizes[i] == 1 ? "" : "s", i + 1, fileNames[i], numberOfAdditionalFiles > 0 ? fmt::format(" There is also an additional {} files that are missing data.", numberOfAdditionalFiles) : "");
-
-			return nullptr;
-		}
-
-		std::unique_ptr<GroupFile> file(std::make_unique<GroupFile>(fileNames[i], byteBuffer.readBytes(fileSizes[i])));
+		directory.push_back(std::move(directoryEntry));
+	}
 
-		if(error) {
-			spdlog::error("Build Engine GRP group failed to read data bytes for file #{} ('{}').", i + 1, fileNames[i]);
-		}
+	// file data immediately follows the file directory
+	uint64_t dataOffset = byteBuffer.getReadOffset();
 
-		groupFiles.push_back(std::move(file));
+	for(DirectoryEntry & directoryEntry : directory) {
+		directoryEntry.dataOffset = dataOffset;
+		dataOffset += directoryEntry.fileSize;
 	}
 
-	spdlog::trace("Build Engine GRP group parsed successfully, {} files loaded into memory.", groupFiles.size());
+	spdlog::trace("All Build Engine GRP group file information parsed.");
 
-	return std::make_unique<GroupGRP>(std::move(groupFiles));
+	return directory;
 }
 
 bool GroupGRP::writeTo(ByteBuffer & byteBuffer) const {
@@ -194,13 +213,88 @@ std::unique_ptr<GroupGRP> GroupGRP::loadFrom(const std::string & filePath) {
 	return group;
 }
 
+std::optional<std::vector<GroupGRP::DirectoryEntry>> GroupGRP::readDirectoryFrom(const std::string & filePath) {
+	static const size_t HEADER_LENGTH = HEADER_TEXT.length() + NUMBER_OF_FILES_LENGTH;
+	static const size_t GROUP_FILE_HEADER_LENGTH = GroupFile::MAX_FILE_NAME_LENGTH + GROUP_FILE_SIZE_LENGTH;
+
+	std::error_code errorCode;
+	uint64_t groupFileSize = filePath.empty() ? 0 : std::filesystem::file_size(std::filesystem::path(filePath), errorCode);
+
+	if(filePath.empty() || errorCode) {
+		spdlog::error("Build Engine GRP group file does not exist or is not a file: '{}'.", filePath);
+		return {};
+	}
+
+	std::ifstream fileStream(std::filesystem::path(filePath), std::ios::binary);
+
+	if(!fileStream.is_open()) {
+		spdlog::error("Failed to open Build Engine GRP group file: '{}'.", filePath);
+		return {};
+	}
+
+	// the number of files is read ahead of parsing so that only the header and file directory need to be read from the file
+	std::vector<uint8_t> directoryData(HEADER_LENGTH);
+
+	if(!fileStream.read(reinterpret_cast<char *>(directoryData.data()), directoryData.size())) {
+		spdlog::error("Build Engine GRP group file '{}' is incomplete or corrupted: missing header.", filePath);
+		return {};
+	}
+
+	ByteBuffer header(directoryData);
+	header.setEndianness(ENDIANNESS);
+	header.skipReadBytes(HEADER_TEXT.length());
+
+	bool error = false;
+	uint32_t numberOfFiles = header.readUnsignedInteger(&error);
+
+	if(error || groupFileSize < HEADER_LENGTH + static_cast<uint64_t>(numberOfFiles) * GROUP_FILE_HEADER_LENGTH) {
+		spdlog::error("Build Engine GRP group file '{}' is incomplete or corrupted: missing file information.", filePath);
+		return {};
+	}
+
+	directoryData.resize(HEADER_LENGTH + static_cast<size_t>(numberOfFiles) * GROUP_FILE_HEADER_LENGTH);
+
+	if(!fileStream.read(reinterpret_cast<char *>(directoryData.data() + HEADER_LENGTH), directoryData.size() - HEADER_LENGTH)) {
+		spdlog::error("Build Engine GRP group file '{}' is incomplete or corrupted: missing file information.", filePath);
+		return {};
+	}
+
+	std::optional<std::vector<DirectoryEntry>> optionalDirectory(readDirectory(ByteBuffer(directoryData)));
+
+	if(!optionalDirectory.has_value()) {
+		spdlog::error("Failed to read Build Engine GRP group file directory from file: '{}'.", filePath);
+		return {};
+	}
+
+	std::vector<DirectoryEntry> & directory = optionalDirectory.value();
+
+	for(size_t i = 0; i < directory.size(); i++) {
+		DirectoryEntry & directoryEntry = directory[i];
+
+		// file names are validated the same way as group files loaded into memory, since no group files are created from the directory
+		directoryEntry.fileName = GroupFile::formatFileName(directoryEntry.fileName);
+
+		if(directoryEntry.fileName.empty()) {
+			spdlog::error("Build Engine GRP group file '{}' is corrupted: file #{} has no name.", filePath, i + 1);
+			return {};
+		}
+
+		if(groupFileSize < directoryEntry.dataOffset + directoryEntry.fileSize) {
+			spdlog::error("Build Engine GRP group file '{}' is corrupted: missing data for file #{} ('{}').", filePath, i + 1, directoryEntry.fileName);
+			return {};
+		}
+	}
+
+	spdlog::trace("Read Build Engine GRP group file directory with {} files from: '{}'.", directory.size(), filePath);
+
+	return optionalDirectory;
+}
+
 Endianness GroupGRP::getEndianness() const {
 	return ENDIANNESS;
 }
 
 size_t GroupGRP::getSizeInBytes() const {
-	static constexpr size_t NUMBER_OF_FILES_LENGTH = sizeof(uint32_t);
-	static constexpr size_t GROUP_FILE_SIZE_LENGTH = sizeof(uint32_t);
 	static const size_t HEADER_LENGTH = HEADER_TEXT.length() + NUMBER_OF_FILES_LENGTH;
 	static const size_t GROUP_FILE_HEADER_LENGTH = GroupFile::MAX_FILE_NAME_LENGTH + GROUP_FILE_SIZE_LENGTH;
 
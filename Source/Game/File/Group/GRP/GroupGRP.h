@@ -3,8 +3,16 @@
 
 #include "../Group.h"
 
+#include <optional>
+
 class GroupGRP final : public Group {
 public:
+	struct DirectoryEntry {
+		std::string fileName;
+		uint64_t dataOffset;
+		uint32_t fileSize;
+	};
+
 	GroupGRP(const std::string & filePath = {});
 	GroupGRP(std::vector<std::unique_ptr<GroupFile>> groupFiles, const std::string & filePath = {});
 	GroupGRP(GroupGRP && group) noexcept;
@@ -17,6 +25,8 @@ public:
 
 	static std::unique_ptr<GroupGRP> createFrom(const std::string & directoryPath);
 	static std::unique_ptr<GroupGRP> loadFrom(const std::string & filePath);
+	// reads the file directory of a group file without loading any file data into memory
+	static std::optional<std::vector<DirectoryEntry>> readDirectoryFrom(const std::string & filePath);
 
 	// Group Virtuals
 	bool writeTo(ByteBuffer & byteBuffer) const override;
@@ -36,7 +46,10 @@ public:
 	static inline const std::string DUKE_NUKEM_3D_WORLD_TOUR_GROUP_SHA1_FILE_HASH = "d745396afc3e734029ec2b9bd8b20bdb3a11b3a2";
 
 private:
+	static std::optional<std::vector<DirectoryEntry>> readDirectory(const ByteBuffer & byteBuffer);
 
+	static constexpr size_t NUMBER_OF_FILES_LENGTH = sizeof(uint32_t);
+	static constexpr size_t GROUP_FILE_SIZE_LENGTH = sizeof(uint32_t);
 };
 
 #endif // _GROUP_GRP_H_
@@ -0,0 +1,82 @@
+#include "JSONFileReader.h"
+
+#include <fmt/core.h>
+#include <rapidjson/error/en.h>
+
+#include <filesystem>
+#include <fstream>
+
+JSONFileReader::JSONFileReader()
+	: m_fileSize(0)
+	, m_loaded(false) { }
+
+JSONFileReader::~JSONFileReader() = default;
+
+bool JSONFileReader::isLoaded() const {
+	return m_loaded;
+}
+
+size_t JSONFileReader::getFileSize() const {
+	return m_fileSize;
+}
+
+const rapidjson::Document & JSONFileReader::getDocument() const {
+	return m_document;
+}
+
+std::string JSONFileReader::getParseErrorMessage() const {
+	if(!m_document.HasParseError()) {
+		return {};
+	}
+
+	return fmt::format("{} (at offset {})", rapidjson::GetParseError_En(m_document.GetParseError()), m_document.GetErrorOffset());
+}
+
+bool JSONFileReader::load(const std::string & filePath) {
+	clear();
+
+	if(filePath.empty()) {
+		return false;
+	}
+
+	std::error_code errorCode;
+	uintmax_t fileSize = std::filesystem::file_size(std::filesystem::path(filePath), errorCode);
+
+	if(errorCode) {
+		return false;
+	}
+
+	std::ifstream fileStream(filePath, std::ios::binary);
+
+	if(!fileStream.is_open()) {
+		return false;
+	}
+
+	m_fileSize = static_cast<size_t>(fileSize);
+	m_buffer = std::make_unique<char[]>(m_fileSize + 1);
+
+	if(!fileStream.read(m_buffer.get(), m_fileSize)) {
+		clear();
+		return false;
+	}
+
+	fileStream.close();
+
+	m_buffer[m_fileSize] = '\0';
+
+	if(m_document.ParseInsitu(m_buffer.get()).HasParseError()) {
+		return false;
+	}
+
+	m_loaded = true;
+
+	return true;
+}
+
+void JSONFileReader::clear() {
+	m_document.SetNull();
+	m_document.GetAllocator().Clear();
+	m_buffer.reset();
+	m_fileSize = 0;
+	m_loaded = false;
+}
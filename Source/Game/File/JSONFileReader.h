@@ -0,0 +1,35 @@
+#ifndef _JSON_FILE_READER_H_
+#define _JSON_FILE_READER_H_
+
+#include <rapidjson/document.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class JSONFileReader final {
+public:
+	JSONFileReader();
+	~JSONFileReader();
+
+	bool isLoaded() const;
+	size_t getFileSize() const;
+	const rapidjson::Document & getDocument() const;
+	std::string getParseErrorMessage() const;
+	bool load(const std::string & filePath);
+	void clear();
+
+private:
+	// string values in the document point directly into this buffer, so it must outlive any use of the document
+	std::unique_ptr<char[]> m_buffer;
+	size_t m_fileSize;
+	rapidjson::Document m_document;
+	bool m_loaded;
+
+	JSONFileReader(const JSONFileReader &) = delete;
+	JSONFileReader(JSONFileReader &&) noexcept = delete;
+	const JSONFileReader & operator = (const JSONFileReader &) = delete;
+	const JSONFileReader & operator = (JSONFileReader &&) noexcept = delete;
+};
+
+#endif // _JSON_FILE_READER_H_
@@ -0,0 +1,128 @@
+#include "JSONFileWriter.h"
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+
+const std::string JSONFileWriter::TEMPORARY_FILE_SUFFIX(".tmp");
+
+JSONFileWriter::JSONFileWriter(size_t bufferSize)
+	: m_file(nullptr)
+	, m_bufferSize(bufferSize == 0 ? DEFAULT_BUFFER_SIZE : bufferSize) { }
+
+JSONFileWriter::~JSONFileWriter() {
+	close();
+}
+
+bool JSONFileWriter::isOpen() const {
+	return m_file != nullptr;
+}
+
+bool JSONFileWriter::open(const std::string & filePath, bool overwrite) {
+	if(isOpen() || filePath.empty()) {
+		return false;
+	}
+
+	if(!overwrite && std::filesystem::exists(std::filesystem::path(filePath))) {
+		spdlog::warn("File '{}' already exists, use overwrite to force write.", filePath);
+		return false;
+	}
+
+	// write to a temporary file first so that a failed or partial write never replaces an existing file
+	std::string temporaryFilePath(filePath + TEMPORARY_FILE_SUFFIX);
+
+	// open in text mode to match the platform newlines written by Utilities::saveJSONValueTo
+	m_file = std::fopen(temporaryFilePath.c_str(), "w");
+
+	if(m_file == nullptr) {
+		spdlog::error("Failed to open temporary JSON file '{}' for writing.", temporaryFilePath);
+		return false;
+	}
+
+	m_filePath = filePath;
+	m_temporaryFilePath = temporaryFilePath;
+
+	if(m_buffer == nullptr) {
+		m_buffer = std::make_unique<char[]>(m_bufferSize);
+	}
+
+	m_fileStream = std::make_unique<rapidjson::FileWriteStream>(m_file, m_buffer.get(), m_bufferSize);
+	m_writer = std::make_unique<rapidjson::PrettyWriter<rapidjson::FileWriteStream>>(*m_fileStream);
+	// same formatting as Utilities::saveJSONValueTo, so streamed files are byte for byte identical to non-streamed ones
+	m_writer->SetIndent('\t', 1);
+
+	return true;
+}
+
+bool JSONFileWriter::close() {
+	if(!isOpen()) {
+		return false;
+	}
+
+	bool complete = m_writer->IsComplete();
+
+	m_fileStream->Flush();
+
+	bool error = std::ferror(m_file) != 0;
+
+	if(std::fclose(m_file) != 0) {
+		error = true;
+	}
+
+	m_file = nullptr;
+	m_writer.reset();
+	m_fileStream.reset();
+	m_allocator.Clear();
+
+	std::error_code errorCode;
+
+	if(error) {
+		spdlog::error("Failed to write JSON file '{}'.", m_filePath);
+		std::filesystem::remove(std::filesystem::path(m_temporaryFilePath), errorCode);
+		return false;
+	}
+
+	if(!complete) {
+		spdlog::error("JSON file '{}' was closed before its root value was fully written.", m_filePath);
+		std::filesystem::remove(std::filesystem::path(m_temporaryFilePath), errorCode);
+		return false;
+	}
+
+	std::filesystem::rename(std::filesystem::path(m_temporaryFilePath), std::filesystem::path(m_filePath), errorCode);
+
+	if(errorCode) {
+		spdlog::error("Failed to move temporary JSON file '{}' to '{}': {}", m_temporaryFilePath, m_filePath, errorCode.message());
+		std::filesystem::remove(std::filesystem::path(m_temporaryFilePath), errorCode);
+		return false;
+	}
+
+	return true;
+}
+
+bool JSONFileWriter::startObject() {
+	return m_writer != nullptr && m_writer->StartObject();
+}
+
+bool JSONFileWriter::endObject() {
+	return m_writer != nullptr && m_writer->EndObject();
+}
+
+bool JSONFileWriter::startArray() {
+	return m_writer != nullptr && m_writer->StartArray();
+}
+
+bool JSONFileWriter::endArray() {
+	return m_writer != nullptr && m_writer->EndArray();
+}
+
+bool JSONFileWriter::writeKey(std::string_view key) {
+	return m_writer != nullptr && m_writer->Key(key.data(), static_cast<rapidjson::SizeType>(key.length()));
+}
+
+bool JSONFileWriter::writeString(std::string_view value) {
+	return m_writer != nullptr && m_writer->String(value.data(), static_cast<rapidjson::SizeType>(value.length()));
+}
+
+bool JSONFileWriter::writeValue(const rapidjson::Value & value) {
+	return m_writer != nullptr && value.Accept(*m_writer);
+}
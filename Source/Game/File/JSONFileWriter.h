@@ -0,0 +1,64 @@
+#ifndef _JSON_FILE_WRITER_H_
+#define _JSON_FILE_WRITER_H_
+
+#include <rapidjson/document.h>
+#include <rapidjson/filewritestream.h>
+#include <rapidjson/prettywriter.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+
+class JSONFileWriter final {
+public:
+	JSONFileWriter(size_t bufferSize = DEFAULT_BUFFER_SIZE);
+	~JSONFileWriter();
+
+	bool isOpen() const;
+	bool open(const std::string & filePath, bool overwrite = true);
+	bool close();
+
+	bool startObject();
+	bool endObject();
+	bool startArray();
+	bool endArray();
+	bool writeKey(std::string_view key);
+	bool writeString(std::string_view value);
+	bool writeValue(const rapidjson::Value & value);
+
+	template <typename T>
+	bool writeJSONOf(const T & object) {
+		if(m_writer == nullptr) {
+			return false;
+		}
+
+		bool result = object.toJSON(m_allocator).Accept(*m_writer);
+
+		// the serialized value is no longer needed, so reuse the same memory for the next one
+		m_allocator.Clear();
+
+		return result;
+	}
+
+	static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+	static const std::string TEMPORARY_FILE_SUFFIX;
+
+private:
+	std::string m_filePath;
+	std::string m_temporaryFilePath;
+	std::FILE * m_file;
+	std::unique_ptr<char[]> m_buffer;
+	size_t m_bufferSize;
+	std::unique_ptr<rapidjson::FileWriteStream> m_fileStream;
+	std::unique_ptr<rapidjson::PrettyWriter<rapidjson::FileWriteStream>> m_writer;
+	rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> m_allocator;
+
+	JSONFileWriter(const JSONFileWriter &) = delete;
+	JSONFileWriter(JSONFileWriter &&) noexcept = delete;
+	const JSONFileWriter & operator = (const JSONFileWriter &) = delete;
+	const JSONFileWriter & operator = (JSONFileWriter &&) noexcept = delete;
+};
+
+#endif // _JSON_FILE_WRITER_H_
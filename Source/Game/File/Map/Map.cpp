@@ -1,6 +1,7 @@
 #include "Map.h"
 
 #include "BuildConstants.h"
+#include "../JSONFileWriter.h"
 
 #include <ByteBuffer.h>
 #include <Utilities/FileUtilities.h>
@@ -478,6 +479,71 @@ rapidjson::Value Map::toJSON(rapidjson::MemoryPoolAllocator<rapidjson::CrtAlloca
 	return mapValue;
 }
 
+bool Map::writeJSON(JSONFileWriter & writer) const {
+	if(!writer.startObject() ||
+	   !writer.writeKey(JSON_VERSION_PROPERTY_NAME) ||
+	   !writer.writeValue(rapidjson::Value(m_version)) ||
+	   !writer.writeKey(JSON_PLAYER_SPAWN_PROPERTY_NAME) ||
+	   !writer.writeJSONOf(m_playerSpawn) ||
+	   !writer.writeKey(JSON_SECTORS_PROPERTY_NAME) ||
+	   !writer.startArray()) {
+		return false;
+	}
+
+	for(const std::shared_ptr<Sector> & sector : m_sectors) {
+		if(!writer.writeJSONOf(*sector)) {
+			return false;
+		}
+	}
+
+	if(!writer.endArray() ||
+	   !writer.writeKey(JSON_WALLS_PROPERTY_NAME) ||
+	   !writer.startArray()) {
+		return false;
+	}
+
+	for(const std::shared_ptr<Wall> & wall : m_walls) {
+		if(!writer.writeJSONOf(*wall)) {
+			return false;
+		}
+	}
+
+	if(!writer.endArray() ||
+	   !writer.writeKey(JSON_SPRITES_PROPERTY_NAME) ||
+	   !writer.startArray()) {
+		return false;
+	}
+
+	for(const std::shared_ptr<Sprite> & sprite : m_sprites) {
+		if(!writer.writeJSONOf(*sprite)) {
+			return false;
+		}
+	}
+
+	if(!writer.endArray()) {
+		return false;
+	}
+
+	if(!m_trailingData->isEmpty()) {
+		if(!writer.writeKey(JSON_TRAILING_DATA_PROPERTY_NAME) ||
+		   !writer.startArray()) {
+			return false;
+		}
+
+		for(size_t i = 0; i < m_trailingData->getSize(); i++) {
+			if(!writer.writeValue(rapidjson::Value((*m_trailingData)[i]))) {
+				return false;
+			}
+		}
+
+		if(!writer.endArray()) {
+			return false;
+		}
+	}
+
+	return writer.endObject();
+}
+
 bool Map::addToJSONObject(rapidjson::Value & value, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) const {
 	if(!value.IsObject()) {
 		return false;
@@ -758,7 +824,20 @@ bool Map::saveToMap(const std::string & filePath, bool overwrite) const {
 }
 
 bool Map::saveToJSON(const std::string & filePath, bool overwrite) const {
-	return Utilities::saveJSONValueTo(toJSON(), filePath, overwrite);
+	JSONFileWriter fileWriter;
+
+	if(!fileWriter.open(filePath, overwrite)) {
+		return false;
+	}
+
+	if(!writeJSON(fileWriter)) {
+		fileWriter.close();
+
+		spdlog::error("Failed to save map to JSON file '{}'.", filePath);
+		return false;
+	}
+
+	return fileWriter.close();
 }
 
 void Map::addMetadata(std::vector<std::pair<std::string, std::string>> & metadata) const {
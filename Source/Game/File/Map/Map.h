@@ -14,6 +14,8 @@
 #include <cstdint>
 #include <vector>
 
+class JSONFileWriter;
+
 class Map final : public GameFile {
 public:
 	Map(const std::string & filePath = {});
@@ -72,6 +74,7 @@ public:
 	static std::unique_ptr<Map> readFrom(const ByteBuffer & byteBuffer);
 
 	rapidjson::Document toJSON() const;
+	bool writeJSON(JSONFileWriter & writer) const;
 	rapidjson::Value toJSON(rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) const;
 	bool addToJSONObject(rapidjson::Value & value, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) const;
 	static std::unique_ptr<Map> parseFrom(const rapidjson::Value & mapValue);
@@ -9,6 +9,7 @@
 #include "Game/NoCDCracker.h"
 #include "Game/Configuration/GameConfiguration.h"
 #include "Game/File/Group/GRP/GroupGRP.h"
+#include "Manager/FileFingerprintCache.h"
 #include "Manager/SettingsManager.h"
 
 #include <Analytics/Segment/SegmentAnalytics.h>
@@ -2963,7 +2964,7 @@ bool GameManager::installGame(const std::string & gameVersionID, const std::stri
 	else if(isRegularVersion || isBetaVersion || isPlutoniumPakOrAtomicEdition) {
 		std::function<bool(const GameFileInformation &)> gameFileSHA1VerificationFunction([&gameVersion, &destinationDirectoryPath, useFallback](const GameFileInformation & gameFileInfo) {
 			bool gameFileSHA1Verified = false;
-			std::string calculatedGameFileSHA1(Utilities::getFileSHA1Hash(Utilities::joinPaths(destinationDirectoryPath, gameFileInfo.fileName)));
+			std::string calculatedGameFileSHA1(FileFingerprintCache::getInstance()->getFileSHA1Hash(Utilities::joinPaths(destinationDirectoryPath, gameFileInfo.fileName)));
 
 			if(calculatedGameFileSHA1.empty()) {
 				// skip missing files that aren't required
@@ -3336,7 +3337,7 @@ bool GameManager::downloadGroupFile(const std::string & gameVersionID, bool useF
 
 			spdlog::debug("Calculating SHA1 hash of Duke Nukem 3D group file: '{}'...", sourceGroupFilePath);
 
-			std::string groupSHA1(Utilities::getFileSHA1Hash(sourceGroupFilePath));
+			std::string groupSHA1(FileFingerprintCache::getInstance()->getFileSHA1Hash(sourceGroupFilePath));
 
 			if(groupSHA1.empty()) {
 				spdlog::error("Failed to calculate SHA1 hash of Duke Nukem 3D group file: '{}'!", sourceGroupFilePath);
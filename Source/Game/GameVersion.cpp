@@ -497,6 +497,10 @@ const std::string & GameVersion::getID() const {
 	return m_id;
 }
 
+const InternedString & GameVersion::getInternedID() const {
+	return m_id;
+}
+
 bool GameVersion::setID(const std::string & id) {
 	std::string formattedID(Utilities::trimString(id));
 
@@ -504,7 +508,7 @@ bool GameVersion::setID(const std::string & id) {
 		return true;
 	}
 
-	m_id = std::move(formattedID);
+	m_id = formattedID;
 
 	setModified(true);
 
@@ -644,7 +648,7 @@ bool GameVersion::isRemovable() const {
 }
 
 bool GameVersion::hasGroupFile() const {
-	return !Utilities::areStringsEqualIgnoreCase(m_id, LAMEDUKE.getID());
+	return !m_id.equalsIgnoreCase(LAMEDUKE.getInternedID());
 }
 
 bool GameVersion::hasGamePath() const {
@@ -1852,7 +1856,7 @@ void GameVersion::resetDOSBoxConfigurationToDefault() {
 
 std::shared_ptr<const DOSBoxConfiguration> GameVersion::getDefaultDOSBoxConfiguration() const {
 	for(const GameVersion * gameVersion : DEFAULT_GAME_VERSIONS) {
-		if(Utilities::areStringsEqualIgnoreCase(m_id, gameVersion->getID())) {
+		if(m_id.equalsIgnoreCase(gameVersion->getInternedID())) {
 			return gameVersion->getDOSBoxConfiguration();
 		}
 	}
@@ -1862,7 +1866,7 @@ std::shared_ptr<const DOSBoxConfiguration> GameVersion::getDefaultDOSBoxConfigur
 
 std::optional<std::string> GameVersion::evaluateFilePath(const std::string & filePath) const {
 	FilePathVariableEvaluator::VariableMap variableMap({
-		{ "GAMEID", m_id }
+		{ "GAMEID", m_id.get() }
 	});
 
 	if(std::regex_match(filePath, GAME_CFG_VARIABLE_REGEX)) {
@@ -2102,7 +2106,7 @@ const std::vector<std::string> & GameVersion::getCompatibleGameVersionIdentifier
 
 std::shared_ptr<ModGameVersion> GameVersion::getMostCompatibleModGameVersion(const std::vector<std::shared_ptr<ModGameVersion>> & modGameVersions) const {
 	for(std::vector<std::shared_ptr<ModGameVersion>>::const_iterator i = modGameVersions.begin(); i != modGameVersions.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase(m_id, (*i)->getGameVersionID()) || Utilities::areStringsEqualIgnoreCase((*i)->getGameVersionID(), GameVersion::ALL_VERSIONS)) {
+		if(m_id.equalsIgnoreCase((*i)->getInternedGameVersionID()) || (*i)->isForAllGameVersions()) {
 			return *i;
 		}
 	}
@@ -2120,7 +2124,7 @@ std::vector<std::shared_ptr<ModGameVersion>> GameVersion::getCompatibleModGameVe
 	std::vector<std::shared_ptr<ModGameVersion>> compatibleModGameVersions;
 
 	for(std::vector<std::shared_ptr<ModGameVersion>>::const_iterator i = modGameVersions.begin(); i != modGameVersions.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase(m_id, (*i)->getGameVersionID()) || Utilities::areStringsEqualIgnoreCase((*i)->getGameVersionID(), GameVersion::ALL_VERSIONS)) {
+		if(m_id.equalsIgnoreCase((*i)->getInternedGameVersionID()) || (*i)->isForAllGameVersions()) {
 			compatibleModGameVersions.insert(compatibleModGameVersions.begin(), *i);
 			continue;
 		}
@@ -2428,7 +2432,7 @@ const GameVersion * GameVersion::getDefaultGameVersionWithID(const std::string &
 }
 
 void GameVersion::addMetadata(std::map<std::string, std::any> & metadata) const {
-	metadata["gameID"] = m_id;
+	metadata["gameID"] = m_id.get();
 	metadata["longName"] = m_shortName;
 	metadata["shortName"] = m_longName;
 	metadata["installable"] = m_installable;
@@ -3803,7 +3807,7 @@ std::string GameVersion::getDOSBoxConfigurationFileName() const {
 		return {};
 	}
 
-	return m_id + + "." + DOSBoxConfiguration::FILE_EXTENSION;
+	return m_id.get() + "." + DOSBoxConfiguration::FILE_EXTENSION;
 }
 
 bool GameVersion::loadDOSBoxConfigurationFrom(const std::string & directoryPath, bool * loaded) {
@@ -2,6 +2,7 @@
 #define _GAME_VERSION_H_
 
 #include "DOSBox/Configuration/DOSBoxConfiguration.h"
+#include "Mod/InternedString.h"
 
 #include <Platform/DeviceInformationBridge.h>
 
@@ -38,6 +39,7 @@ public:
 	bool isModified() const;
 	bool hasID() const;
 	const std::string & getID() const;
+	const InternedString & getInternedID() const;
 	bool setID(const std::string & id);
 	bool hasLongName() const;
 	const std::string & getLongName() const;
@@ -347,7 +349,7 @@ private:
 	void setModified(bool modified);
 	std::optional<std::string> evaluateFilePath(const std::string & filePath) const;
 
-	std::string m_id;
+	InternedString m_id;
 	std::string m_longName;
 	std::string m_shortName;
 	std::optional<std::chrono::time_point<std::chrono::system_clock>> m_installedTimePoint;
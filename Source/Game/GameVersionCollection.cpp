@@ -40,13 +40,15 @@ GameVersionCollection::GameVersionCollection(const std::vector<std::shared_ptr<G
 }
 
 GameVersionCollection::GameVersionCollection(GameVersionCollection && g) noexcept
-	: m_gameVersions(std::move(g.m_gameVersions)) {
+	: m_gameVersions(std::move(g.m_gameVersions))
+	, m_fuzzyNameTree(std::move(g.m_fuzzyNameTree)) {
 	for(std::shared_ptr<GameVersion> & gameVersion : m_gameVersions) {
 		m_gameVersionConnections.push_back(gameVersion->modified.connect(std::bind(&GameVersionCollection::onGameVersionModified, this, std::placeholders::_1)));
 	}
 }
 
-GameVersionCollection::GameVersionCollection(const GameVersionCollection & g) {
+GameVersionCollection::GameVersionCollection(const GameVersionCollection & g)
+	: m_fuzzyNameTree(g.m_fuzzyNameTree) {
 	for(std::vector<std::shared_ptr<GameVersion>>::const_iterator i = g.m_gameVersions.begin(); i != g.m_gameVersions.end(); ++i) {
 		m_gameVersions.push_back(std::make_shared<GameVersion>(**i));
 		m_gameVersionConnections.push_back(m_gameVersions.back()->modified.connect(std::bind(&GameVersionCollection::onGameVersionModified, this, std::placeholders::_1)));
@@ -62,6 +64,7 @@ GameVersionCollection & GameVersionCollection::operator = (GameVersionCollection
 		m_gameVersionConnections.clear();
 
 		m_gameVersions = std::move(g.m_gameVersions);
+		m_fuzzyNameTree = std::move(g.m_fuzzyNameTree);
 
 		for(std::shared_ptr<GameVersion> & gameVersion : m_gameVersions) {
 			m_gameVersionConnections.push_back(gameVersion->modified.connect(std::bind(&GameVersionCollection::onGameVersionModified, this, std::placeholders::_1)));
@@ -79,6 +82,8 @@ GameVersionCollection & GameVersionCollection::operator = (const GameVersionColl
 		m_gameVersionConnections.push_back(m_gameVersions.back()->modified.connect(std::bind(&GameVersionCollection::onGameVersionModified, this, std::placeholders::_1)));
 	}
 
+	m_fuzzyNameTree = g.m_fuzzyNameTree;
+
 	return *this;
 }
 
@@ -128,6 +133,22 @@ size_t GameVersionCollection::indexOfGameVersionWithID(const std::string & gameV
 	return gameVersionIterator - m_gameVersions.cbegin();
 }
 
+size_t GameVersionCollection::indexOfGameVersionWithID(const InternedString & gameVersionID) const {
+	if(gameVersionID.empty()) {
+		return std::numeric_limits<size_t>::max();
+	}
+
+	auto gameVersionIterator = std::find_if(m_gameVersions.cbegin(), m_gameVersions.cend(), [&gameVersionID](const std::shared_ptr<GameVersion> & currentGameVersion) {
+		return gameVersionID.equalsIgnoreCase(currentGameVersion->getInternedID());
+	});
+
+	if(gameVersionIterator == m_gameVersions.cend()) {
+		return std::numeric_limits<size_t>::max();
+	}
+
+	return gameVersionIterator - m_gameVersions.cbegin();
+}
+
 std::shared_ptr<GameVersion> GameVersionCollection::getGameVersion(size_t index) const {
 	if(index >= m_gameVersions.size()) {
 		return nullptr;
@@ -140,6 +161,10 @@ std::shared_ptr<GameVersion> GameVersionCollection::getGameVersionWithID(const s
 	return getGameVersion(indexOfGameVersionWithID(gameVersionID));
 }
 
+std::shared_ptr<GameVersion> GameVersionCollection::getGameVersionWithID(const InternedString & gameVersionID) const {
+	return getGameVersion(indexOfGameVersionWithID(gameVersionID));
+}
+
 std::string GameVersionCollection::getLongNameOfGameVersionWithID(const std::string & gameVersionID) const {
 	if(Utilities::areStringsEqualIgnoreCase(gameVersionID, GameVersion::ALL_VERSIONS)) {
 		return GameVersion::ALL_VERSIONS_LONG_NAME;
@@ -273,6 +298,20 @@ std::vector<std::shared_ptr<GameVersion>> GameVersionCollection::getUnconfigured
 	return unconfiguredGameVersions;
 }
 
+std::vector<std::pair<std::shared_ptr<GameVersion>, size_t>> GameVersionCollection::getFuzzyMatchingGameVersions(std::string_view formattedQuery) const {
+	std::vector<std::pair<std::shared_ptr<GameVersion>, size_t>> fuzzyMatchingGameVersions;
+
+	for(const BKTree::ValueMatch & match : m_fuzzyNameTree.searchNames(formattedQuery)) {
+		if(match.value >= m_gameVersions.size()) {
+			continue;
+		}
+
+		fuzzyMatchingGameVersions.emplace_back(m_gameVersions[match.value], match.distance);
+	}
+
+	return fuzzyMatchingGameVersions;
+}
+
 std::vector<std::string> GameVersionCollection::getGameVersionIdentifiers() const {
 	return getGameVersionIdentifiersFrom(m_gameVersions);
 }
@@ -386,6 +425,7 @@ std::shared_ptr<GameVersion> GameVersionCollection::addGameVersion(const GameVer
 
 	m_gameVersions.push_back(newGameVersion);
 	m_gameVersionConnections.push_back(m_gameVersions.back()->modified.connect(std::bind(&GameVersionCollection::onGameVersionModified, this, std::placeholders::_1)));
+	addFuzzyNames(m_gameVersions.size() - 1);
 
 	sizeChanged(*this);
 
@@ -399,6 +439,7 @@ std::shared_ptr<GameVersion> GameVersionCollection::addGameVersion(std::shared_p
 
 	m_gameVersions.push_back(gameVersion);
 	m_gameVersionConnections.push_back(m_gameVersions.back()->modified.connect(std::bind(&GameVersionCollection::onGameVersionModified, this, std::placeholders::_1)));
+	addFuzzyNames(m_gameVersions.size() - 1);
 
 	sizeChanged(*this);
 
@@ -453,6 +494,7 @@ bool GameVersionCollection::removeGameVersion(size_t index) {
 	m_gameVersionConnections[index].disconnect();
 	m_gameVersionConnections.erase(m_gameVersionConnections.begin() + index);
 	m_gameVersions.erase(m_gameVersions.begin() + index);
+	rebuildFuzzyNameTree();
 
 	sizeChanged(*this);
 
@@ -474,6 +516,7 @@ void GameVersionCollection::clearGameVersions() {
 
 	m_gameVersionConnections.clear();
 	m_gameVersions.clear();
+	m_fuzzyNameTree.clear();
 
 	sizeChanged(*this);
 }
@@ -595,6 +638,8 @@ std::unique_ptr<GameVersionCollection> GameVersionCollection::parseFrom(const ra
 		newGameVersionCollection->m_gameVersions.emplace_back(std::move(newGameVersion));
 	}
 
+	newGameVersionCollection->rebuildFuzzyNameTree();
+
 	return newGameVersionCollection;
 }
 
@@ -655,6 +700,7 @@ bool GameVersionCollection::loadFromJSON(const std::string & filePath, bool auto
 	}
 
 	m_gameVersions = gameVersionCollection->m_gameVersions;
+	m_fuzzyNameTree = std::move(gameVersionCollection->m_fuzzyNameTree);
 
 	sizeChanged(*this);
 
@@ -789,5 +835,20 @@ bool GameVersionCollection::operator != (const GameVersionCollection & gameVersi
 }
 
 void GameVersionCollection::onGameVersionModified(GameVersion & gameVersion) {
+	rebuildFuzzyNameTree();
+
 	itemModified(*this, gameVersion);
 }
+
+void GameVersionCollection::addFuzzyNames(size_t index) {
+	m_fuzzyNameTree.insertName(Utilities::toLowerCase(m_gameVersions[index]->getLongName()), index);
+	m_fuzzyNameTree.insertName(Utilities::toLowerCase(m_gameVersions[index]->getShortName()), index);
+}
+
+void GameVersionCollection::rebuildFuzzyNameTree() {
+	m_fuzzyNameTree.clear();
+
+	for(size_t i = 0; i < m_gameVersions.size(); i++) {
+		addFuzzyNames(i);
+	}
+}
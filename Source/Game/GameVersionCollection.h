@@ -2,6 +2,7 @@
 #define _GAME_VERSION_COLLECTION_H_
 
 #include "GameVersion.h"
+#include "Mod/BKTree.h"
 
 #include <boost/signals2.hpp>
 #include <rapidjson/document.h>
@@ -10,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class ModGameVersion;
@@ -31,8 +33,10 @@ public:
 	bool hasGameVersionWithID(const std::string & gameVersionID) const;
 	size_t indexOfGameVersion(const GameVersion & gameVersion) const;
 	size_t indexOfGameVersionWithID(const std::string & gameVersionID) const;
+	size_t indexOfGameVersionWithID(const InternedString & gameVersionID) const;
 	std::shared_ptr<GameVersion> getGameVersion(size_t index) const;
 	std::shared_ptr<GameVersion> getGameVersionWithID(const std::string & gameVersionID) const;
+	std::shared_ptr<GameVersion> getGameVersionWithID(const InternedString & gameVersionID) const;
 	std::string getLongNameOfGameVersionWithID(const std::string & gameVersionID) const;
 	std::string getShortNameOfGameVersionWithID(const std::string & gameVersionID) const;
 	const std::vector<std::shared_ptr<GameVersion>> & getGameVersions() const;
@@ -42,6 +46,7 @@ public:
 	std::vector<std::pair<std::shared_ptr<GameVersion>, std::vector<std::shared_ptr<ModGameVersion>>>> getGameVersionsCompatibleWith(const std::vector<std::shared_ptr<ModGameVersion>> & modGameVersions, bool includeSupported = false, std::optional<bool> configured = {}) const;
 	std::vector<std::shared_ptr<GameVersion>> getConfiguredGameVersions() const;
 	std::vector<std::shared_ptr<GameVersion>> getUnconfiguredGameVersions() const;
+	std::vector<std::pair<std::shared_ptr<GameVersion>, size_t>> getFuzzyMatchingGameVersions(std::string_view formattedQuery) const;
 	std::vector<std::string> getGameVersionIdentifiers() const;
 	static std::vector<std::string> getGameVersionIdentifiersFrom(const std::vector<std::shared_ptr<GameVersion>> & gameVersions);
 	static std::vector<std::string> getGameVersionIdentifiersFrom(const std::vector<const GameVersion *> & gameVersions);
@@ -89,8 +94,11 @@ public:
 
 private:
 	void onGameVersionModified(GameVersion & gameVersion);
+	void addFuzzyNames(size_t index);
+	void rebuildFuzzyNameTree();
 
 	std::vector<std::shared_ptr<GameVersion>> m_gameVersions;
+	BKTree m_fuzzyNameTree;
 	std::vector<boost::signals2::connection> m_gameVersionConnections;
 };
 
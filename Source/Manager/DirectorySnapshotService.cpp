@@ -0,0 +1,151 @@
+#include "DirectorySnapshotService.h"
+
+#include <Utilities/FileUtilities.h>
+#include <Utilities/StringUtilities.h>
+
+#include <spdlog/spdlog.h>
+
+DirectorySnapshotService::DirectorySnapshotService(bool caseSensitive)
+	: m_caseSensitive(caseSensitive) { }
+
+DirectorySnapshotService::~DirectorySnapshotService() = default;
+
+bool DirectorySnapshotService::isCaseSensitive() const {
+	return m_caseSensitive;
+}
+
+size_t DirectorySnapshotService::numberOfSnapshots() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_snapshots.size();
+}
+
+bool DirectorySnapshotService::hasSnapshot(const std::string & directoryPath) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_snapshots.find(directoryPath) != m_snapshots.cend();
+}
+
+bool DirectorySnapshotService::isDirectory(const std::string & directoryPath) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return getSnapshot(directoryPath).exists;
+}
+
+bool DirectorySnapshotService::hasFile(const std::string & directoryPath, const std::string & fileName) {
+	if(fileName.empty()) {
+		return false;
+	}
+
+	// only direct children of the directory are captured in the snapshot
+	if(fileName.find_first_of("/\\") != std::string::npos) {
+		return std::filesystem::is_regular_file(std::filesystem::path(Utilities::joinPaths(directoryPath, fileName)));
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	const DirectorySnapshot & snapshot = getSnapshot(directoryPath);
+
+	return snapshot.exists && snapshot.fileNames.find(formatFileName(fileName)) != snapshot.fileNames.cend();
+}
+
+size_t DirectorySnapshotService::numberOfFilesInDirectory(const std::string & directoryPath) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return getSnapshot(directoryPath).fileNames.size();
+}
+
+size_t DirectorySnapshotService::refreshModifiedSnapshots() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	size_t numberOfRefreshedSnapshots = 0;
+	std::error_code errorCode;
+
+	for(std::unordered_map<std::string, DirectorySnapshot>::iterator i = m_snapshots.begin(); i != m_snapshots.end(); ++i) {
+		bool exists = std::filesystem::is_directory(std::filesystem::path(i->first), errorCode);
+		std::filesystem::file_time_type lastWriteTime;
+
+		if(exists) {
+			lastWriteTime = std::filesystem::last_write_time(std::filesystem::path(i->first), errorCode);
+
+			if(errorCode) {
+				exists = false;
+			}
+		}
+
+		if(exists == i->second.exists && (!exists || lastWriteTime == i->second.lastWriteTime)) {
+			continue;
+		}
+
+		i->second = createSnapshot(i->first);
+		numberOfRefreshedSnapshots++;
+	}
+
+	return numberOfRefreshedSnapshots;
+}
+
+bool DirectorySnapshotService::invalidate(const std::string & directoryPath) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_snapshots.erase(directoryPath) != 0;
+}
+
+void DirectorySnapshotService::clear() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_snapshots.clear();
+}
+
+const DirectorySnapshotService::DirectorySnapshot & DirectorySnapshotService::getSnapshot(const std::string & directoryPath) {
+	std::unordered_map<std::string, DirectorySnapshot>::const_iterator snapshotIterator(m_snapshots.find(directoryPath));
+
+	if(snapshotIterator != m_snapshots.cend()) {
+		return snapshotIterator->second;
+	}
+
+	return m_snapshots.emplace(directoryPath, createSnapshot(directoryPath)).first->second;
+}
+
+DirectorySnapshotService::DirectorySnapshot DirectorySnapshotService::createSnapshot(const std::string & directoryPath) const {
+	DirectorySnapshot snapshot;
+	snapshot.exists = false;
+
+	std::error_code errorCode;
+	std::filesystem::path directory(directoryPath);
+
+	if(!std::filesystem::is_directory(directory, errorCode)) {
+		return snapshot;
+	}
+
+	snapshot.lastWriteTime = std::filesystem::last_write_time(directory, errorCode);
+
+	if(errorCode) {
+		return snapshot;
+	}
+
+	std::filesystem::directory_iterator directoryIterator(directory, errorCode);
+
+	if(errorCode) {
+		spdlog::warn("Failed to list contents of directory '{}': {}", directoryPath, errorCode.message());
+		return snapshot;
+	}
+
+	snapshot.exists = true;
+
+	for(std::filesystem::directory_iterator i = std::filesystem::begin(directoryIterator); i != std::filesystem::end(directoryIterator); i.increment(errorCode)) {
+		if(errorCode) {
+			spdlog::warn("Failed to list all contents of directory '{}': {}", directoryPath, errorCode.message());
+			break;
+		}
+
+		if(i->is_regular_file(errorCode)) {
+			snapshot.fileNames.emplace(formatFileName(i->path().filename().string()));
+		}
+	}
+
+	return snapshot;
+}
+
+std::string DirectorySnapshotService::formatFileName(const std::string & fileName) const {
+	return m_caseSensitive ? fileName : Utilities::toLowerCase(fileName);
+}
@@ -0,0 +1,46 @@
+#ifndef _DIRECTORY_SNAPSHOT_SERVICE_H_
+#define _DIRECTORY_SNAPSHOT_SERVICE_H_
+
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+class DirectorySnapshotService final {
+public:
+	DirectorySnapshotService(bool caseSensitive = false);
+	~DirectorySnapshotService();
+
+	bool isCaseSensitive() const;
+	size_t numberOfSnapshots() const;
+	bool hasSnapshot(const std::string & directoryPath) const;
+	bool isDirectory(const std::string & directoryPath);
+	bool hasFile(const std::string & directoryPath, const std::string & fileName);
+	size_t numberOfFilesInDirectory(const std::string & directoryPath);
+	size_t refreshModifiedSnapshots();
+	bool invalidate(const std::string & directoryPath);
+	void clear();
+
+private:
+	struct DirectorySnapshot {
+		bool exists;
+		std::filesystem::file_time_type lastWriteTime;
+		std::unordered_set<std::string> fileNames;
+	};
+
+	const DirectorySnapshot & getSnapshot(const std::string & directoryPath);
+	DirectorySnapshot createSnapshot(const std::string & directoryPath) const;
+	std::string formatFileName(const std::string & fileName) const;
+
+	bool m_caseSensitive;
+	std::unordered_map<std::string, DirectorySnapshot> m_snapshots;
+	mutable std::mutex m_mutex;
+
+	DirectorySnapshotService(const DirectorySnapshotService &) = delete;
+	DirectorySnapshotService(DirectorySnapshotService &&) noexcept = delete;
+	const DirectorySnapshotService & operator = (const DirectorySnapshotService &) = delete;
+	const DirectorySnapshotService & operator = (DirectorySnapshotService &&) noexcept = delete;
+};
+
+#endif // _DIRECTORY_SNAPSHOT_SERVICE_H_
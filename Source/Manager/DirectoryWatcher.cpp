@@ -0,0 +1,175 @@
+#include "DirectoryWatcher.h"
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+
+using namespace std::chrono_literals;
+
+const std::chrono::milliseconds DirectoryWatcher::DEFAULT_COALESCING_DELAY = 250ms;
+
+static constexpr std::chrono::milliseconds POLL_INTERVAL = 100ms;
+
+DirectoryWatcher::DirectoryWatcher()
+	: m_coalescingDelay(DEFAULT_COALESCING_DELAY.count())
+	, m_stopRequested(false) { }
+
+DirectoryWatcher::~DirectoryWatcher() { }
+
+bool DirectoryWatcher::isRunning() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_watcherFuture.valid() && m_watcherFuture.wait_for(0s) != std::future_status::ready;
+}
+
+bool DirectoryWatcher::start() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(isRunning()) {
+		return true;
+	}
+
+	if(m_watchedDirectoryPaths.empty()) {
+		return false;
+	}
+
+	m_stopRequested = false;
+	m_watcherFuture = std::async(std::launch::async, &DirectoryWatcher::run, this);
+
+	spdlog::debug("Watching {} director{} for changes.", m_watchedDirectoryPaths.size(), m_watchedDirectoryPaths.size() == 1 ? "y" : "ies");
+
+	return true;
+}
+
+void DirectoryWatcher::stop() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_watcherFuture.valid()) {
+		return;
+	}
+
+	m_stopRequested = true;
+	m_watcherFuture.wait();
+	m_watcherFuture = {};
+}
+
+size_t DirectoryWatcher::numberOfWatchedDirectories() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_watchedDirectoryPaths.size();
+}
+
+bool DirectoryWatcher::isWatchingDirectory(const std::string & directoryPath) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_watchedDirectoryPaths.find(directoryPath) != m_watchedDirectoryPaths.cend();
+}
+
+std::vector<std::string> DirectoryWatcher::getWatchedDirectories() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return std::vector<std::string>(m_watchedDirectoryPaths.cbegin(), m_watchedDirectoryPaths.cend());
+}
+
+bool DirectoryWatcher::watchDirectory(const std::string & directoryPath) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(directoryPath.empty() || isWatchingDirectory(directoryPath)) {
+		return false;
+	}
+
+	if(!std::filesystem::is_directory(std::filesystem::path(directoryPath))) {
+		spdlog::warn("Cannot watch '{}' for changes, it is not a valid directory.", directoryPath);
+		return false;
+	}
+
+	// platform watches are only modified while the watcher thread is not waiting on them
+	bool wasRunning = isRunning();
+
+	stop();
+
+	bool watchAdded = addPlatformWatch(directoryPath);
+
+	if(watchAdded) {
+		m_watchedDirectoryPaths.insert(directoryPath);
+	}
+	else {
+		spdlog::error("Failed to watch directory '{}' for changes.", directoryPath);
+	}
+
+	if(wasRunning) {
+		start();
+	}
+
+	return watchAdded;
+}
+
+bool DirectoryWatcher::unwatchDirectory(const std::string & directoryPath) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!isWatchingDirectory(directoryPath)) {
+		return false;
+	}
+
+	bool wasRunning = isRunning();
+
+	stop();
+
+	removePlatformWatch(directoryPath);
+	m_watchedDirectoryPaths.erase(directoryPath);
+
+	if(wasRunning) {
+		start();
+	}
+
+	return true;
+}
+
+void DirectoryWatcher::unwatchAllDirectories() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	stop();
+
+	for(const std::string & directoryPath : m_watchedDirectoryPaths) {
+		removePlatformWatch(directoryPath);
+	}
+
+	m_watchedDirectoryPaths.clear();
+}
+
+std::chrono::milliseconds DirectoryWatcher::getCoalescingDelay() const {
+	return std::chrono::milliseconds(m_coalescingDelay);
+}
+
+void DirectoryWatcher::setCoalescingDelay(std::chrono::milliseconds coalescingDelay) {
+	m_coalescingDelay = coalescingDelay.count();
+}
+
+void DirectoryWatcher::run() {
+	std::set<std::string> pendingDirectoryPaths;
+	std::chrono::time_point<std::chrono::steady_clock> lastChangeTimePoint;
+
+	while(!m_stopRequested) {
+		std::vector<std::string> changedDirectoryPaths(waitForPlatformChanges(POLL_INTERVAL));
+
+		if(!changedDirectoryPaths.empty()) {
+			pendingDirectoryPaths.insert(changedDirectoryPaths.begin(), changedDirectoryPaths.end());
+			lastChangeTimePoint = std::chrono::steady_clock::now();
+			continue;
+		}
+
+		// wait for a burst of changes to settle before reporting it
+		if(pendingDirectoryPaths.empty() || std::chrono::steady_clock::now() - lastChangeTimePoint < getCoalescingDelay()) {
+			continue;
+		}
+
+		boost::optional<bool> handled(directoriesChanged(std::vector<std::string>(pendingDirectoryPaths.cbegin(), pendingDirectoryPaths.cend())));
+
+		if(!handled || *handled) {
+			pendingDirectoryPaths.clear();
+		}
+		else {
+			lastChangeTimePoint = std::chrono::steady_clock::now();
+		}
+	}
+}
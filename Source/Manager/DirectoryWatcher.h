@@ -0,0 +1,59 @@
+#ifndef _DIRECTORY_WATCHER_H_
+#define _DIRECTORY_WATCHER_H_
+
+#include <Singleton/Singleton.h>
+
+#include <boost/signals2.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+class DirectoryWatcher : public Singleton<DirectoryWatcher> {
+public:
+	~DirectoryWatcher() override;
+
+	bool isRunning() const;
+	bool start();
+	void stop();
+
+	size_t numberOfWatchedDirectories() const;
+	bool isWatchingDirectory(const std::string & directoryPath) const;
+	std::vector<std::string> getWatchedDirectories() const;
+	bool watchDirectory(const std::string & directoryPath);
+	bool unwatchDirectory(const std::string & directoryPath);
+	void unwatchAllDirectories();
+
+	std::chrono::milliseconds getCoalescingDelay() const;
+	void setCoalescingDelay(std::chrono::milliseconds coalescingDelay);
+
+	// returning false from a slot leaves the directories queued so they are reported again after the next coalescing delay
+	boost::signals2::signal<bool (std::vector<std::string> /* directoryPaths */)> directoriesChanged;
+
+	static const std::chrono::milliseconds DEFAULT_COALESCING_DELAY;
+
+protected:
+	DirectoryWatcher();
+
+	virtual bool addPlatformWatch(const std::string & directoryPath) = 0;
+	virtual void removePlatformWatch(const std::string & directoryPath) = 0;
+	virtual std::vector<std::string> waitForPlatformChanges(std::chrono::milliseconds timeout) = 0;
+
+private:
+	void run();
+
+	std::set<std::string> m_watchedDirectoryPaths;
+	std::atomic<std::chrono::milliseconds::rep> m_coalescingDelay;
+	std::atomic<bool> m_stopRequested;
+	std::future<void> m_watcherFuture;
+	mutable std::recursive_mutex m_mutex;
+
+	DirectoryWatcher(const DirectoryWatcher &) = delete;
+	const DirectoryWatcher & operator = (const DirectoryWatcher &) = delete;
+};
+
+#endif // _DIRECTORY_WATCHER_H_
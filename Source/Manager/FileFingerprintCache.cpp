@@ -0,0 +1,350 @@
+#include "FileFingerprintCache.h"
+
+#include "Game/File/JSONFileReader.h"
+#include "Game/File/JSONFileWriter.h"
+#include "SettingsManager.h"
+
+#include <Utilities/FileUtilities.h>
+#include <Utilities/RapidJSONUtilities.h>
+#include <Utilities/StringUtilities.h>
+
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+
+static constexpr const char * JSON_FILE_FINGERPRINT_CACHE_FILE_TYPE_PROPERTY_NAME = "fileType";
+static constexpr const char * JSON_FILE_FINGERPRINT_CACHE_FILE_FORMAT_VERSION_PROPERTY_NAME = "fileFormatVersion";
+static constexpr const char * JSON_FILE_FINGERPRINT_CACHE_FILES_PROPERTY_NAME = "files";
+static constexpr const char * JSON_FILE_FINGERPRINT_PATH_PROPERTY_NAME = "path";
+static constexpr const char * JSON_FILE_FINGERPRINT_SIZE_PROPERTY_NAME = "size";
+static constexpr const char * JSON_FILE_FINGERPRINT_LAST_WRITE_TIME_PROPERTY_NAME = "lastWriteTime";
+static constexpr const char * JSON_FILE_FINGERPRINT_FILE_IDENTIFIER_PROPERTY_NAME = "fileID";
+static constexpr const char * JSON_FILE_FINGERPRINT_SHA1_PROPERTY_NAME = "sha1";
+
+const std::string FileFingerprintCache::FILE_TYPE("File Fingerprint Cache");
+const uint32_t FileFingerprintCache::FILE_FORMAT_VERSION = 1;
+
+FileFingerprintCache::FileFingerprintCache()
+	: m_modified(false) { }
+
+FileFingerprintCache::~FileFingerprintCache() = default;
+
+bool FileFingerprintCache::FileFingerprint::matches(const FileFingerprint & fingerprint) const {
+	return fileSize == fingerprint.fileSize &&
+		   lastWriteTime == fingerprint.lastWriteTime &&
+		   fileIdentifier == fingerprint.fileIdentifier;
+}
+
+size_t FileFingerprintCache::numberOfFingerprints() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_fingerprints.size();
+}
+
+bool FileFingerprintCache::isModified() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_modified;
+}
+
+std::optional<std::string> FileFingerprintCache::getCachedFileSHA1Hash(const std::string & canonicalFilePath, const FileFingerprint & fingerprint) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::unordered_map<std::string, FileFingerprint>::const_iterator fingerprintIterator(m_fingerprints.find(canonicalFilePath));
+
+	if(fingerprintIterator == m_fingerprints.cend() || !fingerprintIterator->second.matches(fingerprint)) {
+		return {};
+	}
+
+	return fingerprintIterator->second.sha1;
+}
+
+std::string FileFingerprintCache::getFileSHA1Hash(const std::string & filePath) {
+	std::string canonicalFilePath(getCanonicalFilePath(filePath));
+	std::optional<FileFingerprint> optionalFingerprint(createFingerprint(canonicalFilePath));
+
+	if(!optionalFingerprint.has_value()) {
+		return Utilities::getFileSHA1Hash(filePath);
+	}
+
+	std::optional<std::string> optionalCachedSHA1(getCachedFileSHA1Hash(canonicalFilePath, optionalFingerprint.value()));
+
+	if(optionalCachedSHA1.has_value()) {
+		return optionalCachedSHA1.value();
+	}
+
+	std::string sha1(Utilities::getFileSHA1Hash(filePath));
+
+	if(sha1.empty()) {
+		return {};
+	}
+
+	// only remember the hash if the file was not modified while it was being read
+	std::optional<FileFingerprint> optionalUpdatedFingerprint(createFingerprint(canonicalFilePath));
+
+	if(optionalUpdatedFingerprint.has_value() && optionalUpdatedFingerprint->matches(optionalFingerprint.value())) {
+		optionalUpdatedFingerprint->sha1 = sha1;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_fingerprints[canonicalFilePath] = std::move(optionalUpdatedFingerprint.value());
+		m_modified = true;
+	}
+
+	return sha1;
+}
+
+bool FileFingerprintCache::setFileSHA1Hash(const std::string & filePath, const std::string & sha1) {
+	if(sha1.empty()) {
+		return false;
+	}
+
+	std::string canonicalFilePath(getCanonicalFilePath(filePath));
+	std::optional<FileFingerprint> optionalFingerprint(createFingerprint(canonicalFilePath));
+
+	if(!optionalFingerprint.has_value()) {
+		return false;
+	}
+
+	optionalFingerprint->sha1 = sha1;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_fingerprints[canonicalFilePath] = std::move(optionalFingerprint.value());
+	m_modified = true;
+
+	return true;
+}
+
+size_t FileFingerprintCache::removeMissingFiles() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	size_t numberOfFingerprintsRemoved = 0;
+
+	for(std::unordered_map<std::string, FileFingerprint>::const_iterator i = m_fingerprints.cbegin(); i != m_fingerprints.cend();) {
+		std::error_code errorCode;
+
+		if(std::filesystem::is_regular_file(std::filesystem::path(i->first), errorCode)) {
+			++i;
+			continue;
+		}
+
+		i = m_fingerprints.erase(i);
+		numberOfFingerprintsRemoved++;
+	}
+
+	if(numberOfFingerprintsRemoved != 0) {
+		m_modified = true;
+	}
+
+	return numberOfFingerprintsRemoved;
+}
+
+void FileFingerprintCache::clear() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_modified = !m_fingerprints.empty();
+	m_fingerprints.clear();
+}
+
+std::string FileFingerprintCache::getFilePath() const {
+	SettingsManager * settings = SettingsManager::getInstance();
+
+	if(settings->fileFingerprintCacheFileName.empty()) {
+		return {};
+	}
+
+	return Utilities::joinPaths(settings->cacheDirectoryPath, settings->fileFingerprintCacheFileName);
+}
+
+bool FileFingerprintCache::load() {
+	return loadFrom(getFilePath());
+}
+
+bool FileFingerprintCache::save() {
+	return saveTo(getFilePath());
+}
+
+bool FileFingerprintCache::loadFrom(const std::string & filePath) {
+	if(filePath.empty() || !std::filesystem::is_regular_file(std::filesystem::path(filePath))) {
+		return false;
+	}
+
+	JSONFileReader fileReader;
+
+	if(!fileReader.load(filePath)) {
+		spdlog::error("Failed to load file fingerprint cache from file '{}': {}", filePath, fileReader.getParseErrorMessage());
+		return false;
+	}
+
+	const rapidjson::Document & fileFingerprintCacheDocument = fileReader.getDocument();
+
+	if(!fileFingerprintCacheDocument.IsObject() ||
+	   !fileFingerprintCacheDocument.HasMember(JSON_FILE_FINGERPRINT_CACHE_FILE_TYPE_PROPERTY_NAME) ||
+	   !fileFingerprintCacheDocument[JSON_FILE_FINGERPRINT_CACHE_FILE_TYPE_PROPERTY_NAME].IsString() ||
+	   !Utilities::areStringsEqualIgnoreCase(fileFingerprintCacheDocument[JSON_FILE_FINGERPRINT_CACHE_FILE_TYPE_PROPERTY_NAME].GetString(), FILE_TYPE)) {
+		spdlog::error("File '{}' is not a valid file fingerprint cache.", filePath);
+		return false;
+	}
+
+	if(!fileFingerprintCacheDocument.HasMember(JSON_FILE_FINGERPRINT_CACHE_FILE_FORMAT_VERSION_PROPERTY_NAME) ||
+	   !fileFingerprintCacheDocument[JSON_FILE_FINGERPRINT_CACHE_FILE_FORMAT_VERSION_PROPERTY_NAME].IsUint() ||
+	   fileFingerprintCacheDocument[JSON_FILE_FINGERPRINT_CACHE_FILE_FORMAT_VERSION_PROPERTY_NAME].GetUint() != FILE_FORMAT_VERSION) {
+		spdlog::warn("Ignoring file fingerprint cache '{}' with unsupported file format version, only version {} is supported.", filePath, FILE_FORMAT_VERSION);
+		return false;
+	}
+
+	if(!fileFingerprintCacheDocument.HasMember(JSON_FILE_FINGERPRINT_CACHE_FILES_PROPERTY_NAME) || !fileFingerprintCacheDocument[JSON_FILE_FINGERPRINT_CACHE_FILES_PROPERTY_NAME].IsArray()) {
+		spdlog::error("File fingerprint cache is missing '{}' array property.", JSON_FILE_FINGERPRINT_CACHE_FILES_PROPERTY_NAME);
+		return false;
+	}
+
+	const rapidjson::Value & filesValue = fileFingerprintCacheDocument[JSON_FILE_FINGERPRINT_CACHE_FILES_PROPERTY_NAME];
+
+	std::unordered_map<std::string, FileFingerprint> fingerprints;
+	fingerprints.reserve(filesValue.Size());
+
+	size_t numberOfInvalidFingerprints = 0;
+
+	for(rapidjson::Value::ConstValueIterator i = filesValue.Begin(); i != filesValue.End(); ++i) {
+		// a bad entry only costs a rehash of that file, so skip it rather than discarding the whole cache
+		if(!i->IsObject() ||
+		   !i->HasMember(JSON_FILE_FINGERPRINT_PATH_PROPERTY_NAME) || !(*i)[JSON_FILE_FINGERPRINT_PATH_PROPERTY_NAME].IsString() ||
+		   !i->HasMember(JSON_FILE_FINGERPRINT_SIZE_PROPERTY_NAME) || !(*i)[JSON_FILE_FINGERPRINT_SIZE_PROPERTY_NAME].IsUint64() ||
+		   !i->HasMember(JSON_FILE_FINGERPRINT_LAST_WRITE_TIME_PROPERTY_NAME) || !(*i)[JSON_FILE_FINGERPRINT_LAST_WRITE_TIME_PROPERTY_NAME].IsInt64() ||
+		   !i->HasMember(JSON_FILE_FINGERPRINT_SHA1_PROPERTY_NAME) || !(*i)[JSON_FILE_FINGERPRINT_SHA1_PROPERTY_NAME].IsString() ||
+		   (i->HasMember(JSON_FILE_FINGERPRINT_FILE_IDENTIFIER_PROPERTY_NAME) && !(*i)[JSON_FILE_FINGERPRINT_FILE_IDENTIFIER_PROPERTY_NAME].IsUint64())) {
+			numberOfInvalidFingerprints++;
+			continue;
+		}
+
+		FileFingerprint fingerprint;
+		fingerprint.fileSize = (*i)[JSON_FILE_FINGERPRINT_SIZE_PROPERTY_NAME].GetUint64();
+		fingerprint.lastWriteTime = (*i)[JSON_FILE_FINGERPRINT_LAST_WRITE_TIME_PROPERTY_NAME].GetInt64();
+		fingerprint.sha1 = (*i)[JSON_FILE_FINGERPRINT_SHA1_PROPERTY_NAME].GetString();
+
+		if(i->HasMember(JSON_FILE_FINGERPRINT_FILE_IDENTIFIER_PROPERTY_NAME)) {
+			fingerprint.fileIdentifier = (*i)[JSON_FILE_FINGERPRINT_FILE_IDENTIFIER_PROPERTY_NAME].GetUint64();
+		}
+
+		fingerprints[(*i)[JSON_FILE_FINGERPRINT_PATH_PROPERTY_NAME].GetString()] = std::move(fingerprint);
+	}
+
+	if(numberOfInvalidFingerprints != 0) {
+		spdlog::warn("Skipped {} invalid file fingerprint{} in cache file '{}'.", numberOfInvalidFingerprints, numberOfInvalidFingerprints == 1 ? "" : "s", filePath);
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_fingerprints = std::move(fingerprints);
+	m_modified = false;
+
+	spdlog::debug("Loaded {} file fingerprint{} from cache file '{}'.", m_fingerprints.size(), m_fingerprints.size() == 1 ? "" : "s", filePath);
+
+	return true;
+}
+
+bool FileFingerprintCache::saveTo(const std::string & filePath) {
+	if(filePath.empty()) {
+		spdlog::error("Cannot save file fingerprint cache to empty file path.");
+		return false;
+	}
+
+	std::filesystem::path cacheDirectoryPath(std::filesystem::path(filePath).parent_path());
+
+	if(!cacheDirectoryPath.empty() && !std::filesystem::is_directory(cacheDirectoryPath)) {
+		std::error_code errorCode;
+		std::filesystem::create_directories(cacheDirectoryPath, errorCode);
+
+		if(errorCode) {
+			spdlog::error("Failed to create file fingerprint cache directory '{}': {}", cacheDirectoryPath.string(), errorCode.message());
+			return false;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	JSONFileWriter fileWriter;
+
+	if(!fileWriter.open(filePath)) {
+		return false;
+	}
+
+	rapidjson::Document fingerprintDocument(rapidjson::kObjectType);
+	rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator = fingerprintDocument.GetAllocator();
+
+	fileWriter.startObject();
+	fileWriter.writeKey(JSON_FILE_FINGERPRINT_CACHE_FILE_TYPE_PROPERTY_NAME);
+	fileWriter.writeString(FILE_TYPE);
+	fileWriter.writeKey(JSON_FILE_FINGERPRINT_CACHE_FILE_FORMAT_VERSION_PROPERTY_NAME);
+	fileWriter.writeValue(rapidjson::Value(FILE_FORMAT_VERSION));
+	fileWriter.writeKey(JSON_FILE_FINGERPRINT_CACHE_FILES_PROPERTY_NAME);
+	fileWriter.startArray();
+
+	for(std::unordered_map<std::string, FileFingerprint>::const_iterator i = m_fingerprints.cbegin(); i != m_fingerprints.cend(); ++i) {
+		rapidjson::Value fingerprintValue(rapidjson::kObjectType);
+		fingerprintValue.AddMember(rapidjson::StringRef(JSON_FILE_FINGERPRINT_PATH_PROPERTY_NAME), rapidjson::StringRef(i->first.c_str(), i->first.length()), allocator);
+		fingerprintValue.AddMember(rapidjson::StringRef(JSON_FILE_FINGERPRINT_SIZE_PROPERTY_NAME), rapidjson::Value(i->second.fileSize), allocator);
+		fingerprintValue.AddMember(rapidjson::StringRef(JSON_FILE_FINGERPRINT_LAST_WRITE_TIME_PROPERTY_NAME), rapidjson::Value(i->second.lastWriteTime), allocator);
+
+		if(i->second.fileIdentifier.has_value()) {
+			fingerprintValue.AddMember(rapidjson::StringRef(JSON_FILE_FINGERPRINT_FILE_IDENTIFIER_PROPERTY_NAME), rapidjson::Value(i->second.fileIdentifier.value()), allocator);
+		}
+
+		fingerprintValue.AddMember(rapidjson::StringRef(JSON_FILE_FINGERPRINT_SHA1_PROPERTY_NAME), rapidjson::StringRef(i->second.sha1.c_str(), i->second.sha1.length()), allocator);
+
+		fileWriter.writeValue(fingerprintValue);
+		allocator.Clear();
+	}
+
+	fileWriter.endArray();
+	fileWriter.endObject();
+
+	if(!fileWriter.close()) {
+		return false;
+	}
+
+	m_modified = false;
+
+	spdlog::debug("Saved {} file fingerprint{} to cache file '{}'.", m_fingerprints.size(), m_fingerprints.size() == 1 ? "" : "s", filePath);
+
+	return true;
+}
+
+std::string FileFingerprintCache::getCanonicalFilePath(const std::string & filePath) {
+	std::error_code errorCode;
+	std::filesystem::path canonicalFilePath(std::filesystem::weakly_canonical(std::filesystem::path(filePath), errorCode));
+
+	if(errorCode) {
+		return filePath;
+	}
+
+	return canonicalFilePath.string();
+}
+
+std::optional<FileFingerprintCache::FileFingerprint> FileFingerprintCache::createFingerprint(const std::string & filePath) {
+	std::error_code errorCode;
+	std::filesystem::path fileSystemPath(filePath);
+
+	if(!std::filesystem::is_regular_file(fileSystemPath, errorCode)) {
+		return {};
+	}
+
+	FileFingerprint fingerprint;
+	fingerprint.fileSize = std::filesystem::file_size(fileSystemPath, errorCode);
+
+	if(errorCode) {
+		return {};
+	}
+
+	std::filesystem::file_time_type lastWriteTime(std::filesystem::last_write_time(fileSystemPath, errorCode));
+
+	if(errorCode) {
+		return {};
+	}
+
+	fingerprint.lastWriteTime = static_cast<int64_t>(lastWriteTime.time_since_epoch().count());
+	fingerprint.fileIdentifier = getFileIdentifier(filePath);
+
+	return fingerprint;
+}
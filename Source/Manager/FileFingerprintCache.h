@@ -0,0 +1,58 @@
+#ifndef _FILE_FINGERPRINT_CACHE_H_
+#define _FILE_FINGERPRINT_CACHE_H_
+
+#include <Singleton/Singleton.h>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+class FileFingerprintCache final : public Singleton<FileFingerprintCache> {
+public:
+	FileFingerprintCache();
+	~FileFingerprintCache() override;
+
+	size_t numberOfFingerprints() const;
+	bool isModified() const;
+	std::string getFileSHA1Hash(const std::string & filePath);
+	// remembers the hash of a file whose contents are already known, such as a file which was just written, so that it does not need to be read again
+	bool setFileSHA1Hash(const std::string & filePath, const std::string & sha1);
+	size_t removeMissingFiles();
+	void clear();
+
+	std::string getFilePath() const;
+	bool load();
+	bool save();
+	bool loadFrom(const std::string & filePath);
+	bool saveTo(const std::string & filePath);
+
+	static const std::string FILE_TYPE;
+	static const uint32_t FILE_FORMAT_VERSION;
+
+private:
+	struct FileFingerprint {
+		uint64_t fileSize;
+		int64_t lastWriteTime;
+		std::optional<uint64_t> fileIdentifier;
+		std::string sha1;
+
+		bool matches(const FileFingerprint & fingerprint) const;
+	};
+
+	std::optional<std::string> getCachedFileSHA1Hash(const std::string & canonicalFilePath, const FileFingerprint & fingerprint) const;
+
+	static std::string getCanonicalFilePath(const std::string & filePath);
+	static std::optional<FileFingerprint> createFingerprint(const std::string & filePath);
+	static std::optional<uint64_t> getFileIdentifier(const std::string & filePath);
+
+	std::unordered_map<std::string, FileFingerprint> m_fingerprints;
+	bool m_modified;
+	mutable std::mutex m_mutex;
+
+	FileFingerprintCache(const FileFingerprintCache &) = delete;
+	const FileFingerprintCache & operator = (const FileFingerprintCache &) = delete;
+};
+
+#endif // _FILE_FINGERPRINT_CACHE_H_
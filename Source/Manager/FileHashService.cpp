@@ -0,0 +1,167 @@
+#include "FileHashService.h"
+
+#include "FileFingerprintCache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <future>
+#include <thread>
+
+FileHashService::FileHashService(size_t numberOfThreads)
+	: m_numberOfThreads(numberOfThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : numberOfThreads) { }
+
+FileHashService::FileHashService(FileHashService && s) noexcept
+	: m_numberOfThreads(s.m_numberOfThreads)
+	, m_files(std::move(s.m_files))
+	, m_fileIndices(std::move(s.m_fileIndices)) { }
+
+FileHashService::FileHashService(const FileHashService & s)
+	: m_numberOfThreads(s.m_numberOfThreads)
+	, m_files(s.m_files)
+	, m_fileIndices(s.m_fileIndices) { }
+
+FileHashService & FileHashService::operator = (FileHashService && s) noexcept {
+	if(this != &s) {
+		m_numberOfThreads = s.m_numberOfThreads;
+		m_files = std::move(s.m_files);
+		m_fileIndices = std::move(s.m_fileIndices);
+	}
+
+	return *this;
+}
+
+FileHashService & FileHashService::operator = (const FileHashService & s) {
+	m_numberOfThreads = s.m_numberOfThreads;
+	m_files = s.m_files;
+	m_fileIndices = s.m_fileIndices;
+
+	return *this;
+}
+
+FileHashService::~FileHashService() = default;
+
+size_t FileHashService::getNumberOfThreads() const {
+	return m_numberOfThreads;
+}
+
+size_t FileHashService::numberOfFiles() const {
+	return m_files.size();
+}
+
+size_t FileHashService::numberOfHashedFiles() const {
+	return std::count_if(m_files.cbegin(), m_files.cend(), [](const FileHashEntry & file) {
+		return file.hashed;
+	});
+}
+
+uint64_t FileHashService::getTotalFileSize() const {
+	uint64_t totalFileSize = 0;
+
+	for(const FileHashEntry & file : m_files) {
+		totalFileSize += file.fileSize;
+	}
+
+	return totalFileSize;
+}
+
+bool FileHashService::hasFile(const std::string & filePath) const {
+	return m_fileIndices.find(filePath) != m_fileIndices.cend();
+}
+
+bool FileHashService::addFile(const std::string & filePath) {
+	if(filePath.empty() || hasFile(filePath)) {
+		return false;
+	}
+
+	m_fileIndices.emplace(filePath, m_files.size());
+	m_files.push_back({ filePath, 0, {}, false });
+
+	return true;
+}
+
+std::optional<std::string> FileHashService::getFileSHA1(const std::string & filePath) const {
+	std::unordered_map<std::string, size_t>::const_iterator fileIndexIterator(m_fileIndices.find(filePath));
+
+	if(fileIndexIterator == m_fileIndices.cend() || !m_files[fileIndexIterator->second].hashed) {
+		return {};
+	}
+
+	return m_files[fileIndexIterator->second].sha1;
+}
+
+size_t FileHashService::hashFiles() {
+	std::vector<size_t> pendingFileIndices;
+
+	for(size_t i = 0; i < m_files.size(); i++) {
+		if(m_files[i].hashed) {
+			continue;
+		}
+
+		std::error_code errorCode;
+		m_files[i].fileSize = std::filesystem::file_size(std::filesystem::path(m_files[i].filePath), errorCode);
+
+		if(errorCode) {
+			m_files[i].fileSize = 0;
+		}
+
+		pendingFileIndices.push_back(i);
+	}
+
+	if(pendingFileIndices.empty()) {
+		return 0;
+	}
+
+	// start with the largest files so that a single big file does not end up being hashed on its own at the end
+	std::stable_sort(pendingFileIndices.begin(), pendingFileIndices.end(), [this](size_t a, size_t b) {
+		return m_files[a].fileSize > m_files[b].fileSize;
+	});
+
+	FileFingerprintCache * fileFingerprintCache = FileFingerprintCache::getInstance();
+	std::atomic<size_t> nextPendingFileIndex(0);
+	std::vector<std::future<void>> workers;
+	size_t numberOfWorkers = std::min(m_numberOfThreads, pendingFileIndices.size());
+
+	for(size_t i = 0; i < numberOfWorkers; i++) {
+		workers.push_back(std::async(std::launch::async, [this, fileFingerprintCache, &pendingFileIndices, &nextPendingFileIndex]() {
+			size_t pendingFileIndex = 0;
+
+			// each worker only ever writes to the entries it claimed, so no further locking is required
+			while((pendingFileIndex = nextPendingFileIndex++) < pendingFileIndices.size()) {
+				FileHashEntry & file = m_files[pendingFileIndices[pendingFileIndex]];
+
+				// a file which fails to hash is recorded with an empty hash instead of stopping the worker
+				try {
+					file.sha1 = fileFingerprintCache->getFileSHA1Hash(file.filePath);
+				}
+				catch(const std::exception & exception) {
+					spdlog::error("Failed to hash file '{}': {}", file.filePath, exception.what());
+
+					file.sha1.clear();
+				}
+
+				file.hashed = true;
+			}
+		}));
+	}
+
+	for(std::future<void> & worker : workers) {
+		try {
+			worker.get();
+		}
+		catch(const std::exception & exception) {
+			spdlog::error("File hashing worker failed: {}", exception.what());
+		}
+	}
+
+	return std::count_if(pendingFileIndices.cbegin(), pendingFileIndices.cend(), [this](size_t fileIndex) {
+		return !m_files[fileIndex].sha1.empty();
+	});
+}
+
+void FileHashService::clear() {
+	m_files.clear();
+	m_fileIndices.clear();
+}
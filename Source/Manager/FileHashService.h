@@ -0,0 +1,42 @@
+#ifndef _FILE_HASH_SERVICE_H_
+#define _FILE_HASH_SERVICE_H_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class FileHashService final {
+public:
+	FileHashService(size_t numberOfThreads = 0);
+	FileHashService(FileHashService && s) noexcept;
+	FileHashService(const FileHashService & s);
+	FileHashService & operator = (FileHashService && s) noexcept;
+	FileHashService & operator = (const FileHashService & s);
+	~FileHashService();
+
+	size_t getNumberOfThreads() const;
+	size_t numberOfFiles() const;
+	size_t numberOfHashedFiles() const;
+	uint64_t getTotalFileSize() const;
+	bool hasFile(const std::string & filePath) const;
+	bool addFile(const std::string & filePath);
+	std::optional<std::string> getFileSHA1(const std::string & filePath) const;
+	size_t hashFiles();
+	void clear();
+
+private:
+	struct FileHashEntry {
+		std::string filePath;
+		uint64_t fileSize;
+		std::string sha1;
+		bool hashed;
+	};
+
+	size_t m_numberOfThreads;
+	std::vector<FileHashEntry> m_files;
+	std::unordered_map<std::string, size_t> m_fileIndices;
+};
+
+#endif // _FILE_HASH_SERVICE_H_
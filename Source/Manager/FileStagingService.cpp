@@ -0,0 +1,114 @@
+#include "FileStagingService.h"
+
+#include <Utilities/StringUtilities.h>
+
+#include <magic_enum/magic_enum.hpp>
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+
+FileStagingService::FileStagingService() { }
+
+FileStagingService::~FileStagingService() { }
+
+std::optional<FileStagingService::Method> FileStagingService::stageFile(const std::string & sourceFilePath, const std::string & destinationFilePath, std::error_code & errorCode) {
+	errorCode.clear();
+
+	if(sourceFilePath.empty() || destinationFilePath.empty()) {
+		errorCode = std::make_error_code(std::errc::invalid_argument);
+		return {};
+	}
+
+	std::pair<std::string, std::string> volumePairKey(getVolumePairKey(sourceFilePath, destinationFilePath));
+	Method preferredMethod = Method::Clone;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		std::map<std::pair<std::string, std::string>, Method>::const_iterator preferredMethodIterator(m_preferredMethods.find(volumePairKey));
+
+		if(preferredMethodIterator != m_preferredMethods.cend()) {
+			preferredMethod = preferredMethodIterator->second;
+		}
+	}
+
+	// methods which are not supported between the same volumes are skipped, since cloning and hard links depend on the file system rather than the file
+	std::optional<Method> stagingMethod;
+	Method supportedMethod = preferredMethod;
+
+	if(preferredMethod == Method::Clone) {
+		if(cloneFile(sourceFilePath, destinationFilePath, errorCode)) {
+			stagingMethod = Method::Clone;
+		}
+		else if(isUnsupportedMethodError(errorCode)) {
+			supportedMethod = Method::HardLink;
+		}
+	}
+
+	// mod files are only ever read by the game, so it is safe for them to share their data with the source file
+	if(!stagingMethod.has_value() && preferredMethod != Method::Copy) {
+		errorCode.clear();
+		std::filesystem::create_hard_link(std::filesystem::path(sourceFilePath), std::filesystem::path(destinationFilePath), errorCode);
+
+		if(!errorCode) {
+			stagingMethod = Method::HardLink;
+		}
+		else if(isUnsupportedMethodError(errorCode)) {
+			supportedMethod = Method::Copy;
+		}
+	}
+
+	if(!stagingMethod.has_value()) {
+		errorCode.clear();
+		std::filesystem::copy_file(std::filesystem::path(sourceFilePath), std::filesystem::path(destinationFilePath), errorCode);
+
+		if(errorCode) {
+			return {};
+		}
+
+		stagingMethod = Method::Copy;
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::map<std::pair<std::string, std::string>, Method>::iterator preferredMethodIterator(m_preferredMethods.find(volumePairKey));
+
+	if(preferredMethodIterator == m_preferredMethods.end()) {
+		m_preferredMethods.emplace(volumePairKey, supportedMethod);
+
+		spdlog::debug("Using '{}' method to stage files from '{}' to '{}'.", magic_enum::enum_name(supportedMethod), volumePairKey.first, volumePairKey.second);
+	}
+	else if(preferredMethodIterator->second < supportedMethod) {
+		preferredMethodIterator->second = supportedMethod;
+
+		spdlog::debug("Falling back to '{}' method to stage files from '{}' to '{}'.", magic_enum::enum_name(supportedMethod), volumePairKey.first, volumePairKey.second);
+	}
+
+	return stagingMethod;
+}
+
+std::optional<FileStagingService::Method> FileStagingService::getPreferredMethod(const std::string & sourceFilePath, const std::string & destinationFilePath) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::map<std::pair<std::string, std::string>, Method>::const_iterator preferredMethodIterator(m_preferredMethods.find(getVolumePairKey(sourceFilePath, destinationFilePath)));
+
+	if(preferredMethodIterator == m_preferredMethods.cend()) {
+		return {};
+	}
+
+	return preferredMethodIterator->second;
+}
+
+void FileStagingService::clear() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_preferredMethods.clear();
+}
+
+std::pair<std::string, std::string> FileStagingService::getVolumePairKey(const std::string & sourceFilePath, const std::string & destinationFilePath) {
+	std::error_code errorCode;
+	std::filesystem::path absoluteSourceFilePath(std::filesystem::absolute(std::filesystem::path(sourceFilePath), errorCode));
+	std::filesystem::path absoluteDestinationFilePath(std::filesystem::absolute(std::filesystem::path(destinationFilePath), errorCode));
+
+	return std::make_pair(Utilities::toLowerCase(absoluteSourceFilePath.root_name().string()), Utilities::toLowerCase(absoluteDestinationFilePath.root_name().string()));
+}
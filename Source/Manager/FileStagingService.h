@@ -0,0 +1,43 @@
+#ifndef _FILE_STAGING_SERVICE_H_
+#define _FILE_STAGING_SERVICE_H_
+
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+
+class FileStagingService final {
+public:
+	enum class Method {
+		Clone,
+		HardLink,
+		Copy
+	};
+
+	FileStagingService();
+	~FileStagingService();
+
+	// stages the source file at the destination path using the cheapest method which works between the two volumes, the destination file must not already exist
+	std::optional<Method> stageFile(const std::string & sourceFilePath, const std::string & destinationFilePath, std::error_code & errorCode);
+	std::optional<Method> getPreferredMethod(const std::string & sourceFilePath, const std::string & destinationFilePath) const;
+	void clear();
+
+	static bool cloneFile(const std::string & sourceFilePath, const std::string & destinationFilePath, std::error_code & errorCode);
+
+private:
+	// only errors which indicate that a method is not supported between two volumes should prevent it from being used again, other errors are specific to the file
+	static bool isUnsupportedMethodError(const std::error_code & errorCode);
+	static std::pair<std::string, std::string> getVolumePairKey(const std::string & sourceFilePath, const std::string & destinationFilePath);
+
+	std::map<std::pair<std::string, std::string>, Method> m_preferredMethods;
+	mutable std::mutex m_mutex;
+
+	FileStagingService(const FileStagingService &) = delete;
+	FileStagingService(FileStagingService &&) noexcept = delete;
+	const FileStagingService & operator = (const FileStagingService &) = delete;
+	const FileStagingService & operator = (FileStagingService &&) noexcept = delete;
+};
+
+#endif // _FILE_STAGING_SERVICE_H_
@@ -1,6 +1,7 @@
 #include "InstalledModInfo.h"
 
 #include "Game/GameVersion.h"
+#include "Game/File/JSONFileReader.h"
 #include "Mod/Mod.h"
 #include "Mod/ModVersion.h"
 
@@ -35,15 +36,19 @@ static const std::string JSON_GAME_LONG_NAME_PROPERTY_NAME("longName");
 static const std::string JSON_INSTALLED_TIMESTAMP_PROPERTY_NAME("installedTimestamp");
 static const std::string JSON_ORIGINAL_FILES_LIST_PROPERTY_NAME("originalFiles");
 static const std::string JSON_MOD_FILES_LIST_PROPERTY_NAME("modFiles");
+static const std::string JSON_MOD_FILE_CONTENTS_PROPERTY_NAME("modFileContents");
+static const std::string JSON_MOD_FILE_CONTENT_SHA1_PROPERTY_NAME("sha1");
+static const std::string JSON_MOD_FILE_CONTENT_SOURCE_KEY_PROPERTY_NAME("source");
 
-static const std::array<std::string, 7> JSON_INSTALLED_MOD_INFO_PROPERTY_NAMES = {
+static const std::array<std::string, 8> JSON_INSTALLED_MOD_INFO_PROPERTY_NAMES = {
 	JSON_FILE_TYPE_PROPERTY_NAME,
 	JSON_FILE_FORMAT_VERSION_PROPERTY_NAME,
 	JSON_MOD_INFO_CATEGORY_PROPERTY_NAME,
 	JSON_GAME_INFO_CATEGORY_PROPERTY_NAME,
 	JSON_INSTALLED_TIMESTAMP_PROPERTY_NAME,
 	JSON_ORIGINAL_FILES_LIST_PROPERTY_NAME,
-	JSON_MOD_FILES_LIST_PROPERTY_NAME
+	JSON_MOD_FILES_LIST_PROPERTY_NAME,
+	JSON_MOD_FILE_CONTENTS_PROPERTY_NAME
 };
 
 InstalledModInfo::InstalledModInfo(const ModVersion * modVersion, const std::vector<std::string> & originalFiles, const std::vector<std::string> & modFiles)
@@ -66,26 +71,38 @@ InstalledModInfo::InstalledModInfo(InstalledModInfo && i) noexcept
 	: m_modID(std::move(i.m_modID))
 	, m_modName(std::move(i.m_modName))
 	, m_modVersion(std::move(i.m_modVersion))
+	, m_gameID(std::move(i.m_gameID))
+	, m_gameShortName(std::move(i.m_gameShortName))
+	, m_gameLongName(std::move(i.m_gameLongName))
 	, m_installedTimestamp(i.m_installedTimestamp)
 	, m_originalFiles(std::move(i.m_originalFiles))
-	, m_modFiles(std::move(i.m_modFiles)) { }
+	, m_modFiles(std::move(i.m_modFiles))
+	, m_modFileContents(std::move(i.m_modFileContents)) { }
 
 InstalledModInfo::InstalledModInfo(const InstalledModInfo & i)
 	: m_modID(i.m_modID)
 	, m_modName(i.m_modName)
 	, m_modVersion(i.m_modVersion)
+	, m_gameID(i.m_gameID)
+	, m_gameShortName(i.m_gameShortName)
+	, m_gameLongName(i.m_gameLongName)
 	, m_installedTimestamp(i.m_installedTimestamp)
 	, m_originalFiles(i.m_originalFiles)
-	, m_modFiles(i.m_modFiles) { }
+	, m_modFiles(i.m_modFiles)
+	, m_modFileContents(i.m_modFileContents) { }
 
 InstalledModInfo & InstalledModInfo::operator = (InstalledModInfo && i) noexcept {
 	if(this != &i) {
 		m_modID = std::move(i.m_modID);
 		m_modName = std::move(i.m_modName);
 		m_modVersion = std::move(i.m_modVersion);
+		m_gameID = std::move(i.m_gameID);
+		m_gameShortName = std::move(i.m_gameShortName);
+		m_gameLongName = std::move(i.m_gameLongName);
 		m_installedTimestamp = i.m_installedTimestamp;
 		m_originalFiles = std::move(i.m_originalFiles);
 		m_modFiles = std::move(i.m_modFiles);
+		m_modFileContents = std::move(i.m_modFileContents);
 	}
 
 	return *this;
@@ -95,9 +112,13 @@ InstalledModInfo & InstalledModInfo::operator = (const InstalledModInfo & i) {
 	m_modID = i.m_modID;
 	m_modName = i.m_modName;
 	m_modVersion = i.m_modVersion;
+	m_gameID = i.m_gameID;
+	m_gameShortName = i.m_gameShortName;
+	m_gameLongName = i.m_gameLongName;
 	m_installedTimestamp = i.m_installedTimestamp;
 	m_originalFiles = i.m_originalFiles;
 	m_modFiles = i.m_modFiles;
+	m_modFileContents = i.m_modFileContents;
 
 	return *this;
 }
@@ -150,6 +171,39 @@ bool InstalledModInfo::isEmpty() const {
 	return m_originalFiles.empty() && m_modFiles.empty();
 }
 
+bool InstalledModInfo::isSameInstallationAs(const InstalledModInfo & installedModInfo) const {
+	return !m_modID.empty() &&
+		   !m_gameID.empty() &&
+		   Utilities::areStringsEqualIgnoreCase(m_modID, installedModInfo.m_modID) &&
+		   Utilities::areStringsEqual(m_modVersion, installedModInfo.m_modVersion) &&
+		   Utilities::areStringsEqualIgnoreCase(m_gameID, installedModInfo.m_gameID);
+}
+
+std::unique_ptr<InstalledModInfo> InstalledModInfo::createReusableInstallation() const {
+	std::unique_ptr<InstalledModInfo> reusableInstallation(new InstalledModInfo(m_modID, m_modName, m_modVersion, m_installedTimestamp, {}, {}));
+	reusableInstallation->m_gameID = m_gameID;
+	reusableInstallation->m_gameShortName = m_gameShortName;
+	reusableInstallation->m_gameLongName = m_gameLongName;
+
+	// only mod files with recorded content can be verified later, their original files share the same name since they were renamed in place
+	for(const std::string & modFile : m_modFiles) {
+		const ModFileContent * modFileContent = getModFileContent(modFile);
+
+		if(modFileContent == nullptr) {
+			continue;
+		}
+
+		reusableInstallation->addModFile(modFile);
+		reusableInstallation->m_modFileContents[modFile] = *modFileContent;
+
+		if(hasOriginalFile(modFile)) {
+			reusableInstallation->addOriginalFile(getOriginalFile(indexOfOriginalFile(modFile)));
+		}
+	}
+
+	return reusableInstallation;
+}
+
 size_t InstalledModInfo::numberOfOriginalFiles() const {
 	return m_originalFiles.size();
 }
@@ -252,11 +306,38 @@ bool InstalledModInfo::addModFile(const std::string & filePath) {
 	return true;
 }
 
+size_t InstalledModInfo::numberOfModFileContents() const {
+	return m_modFileContents.size();
+}
+
+const InstalledModInfo::ModFileContent * InstalledModInfo::getModFileContent(const std::string & filePath) const {
+	std::map<std::string, ModFileContent>::const_iterator modFileContentIterator(m_modFileContents.find(filePath));
+
+	if(modFileContentIterator == m_modFileContents.cend()) {
+		return nullptr;
+	}
+
+	return &modFileContentIterator->second;
+}
+
+bool InstalledModInfo::setModFileContent(const std::string & filePath, const std::string & sha1, const std::string & sourceKey) {
+	size_t modFileIndex = indexOfModFile(filePath);
+
+	if(modFileIndex == std::numeric_limits<size_t>::max() || sha1.empty() || sourceKey.empty()) {
+		return false;
+	}
+
+	m_modFileContents[m_modFiles[modFileIndex]] = { sha1, sourceKey };
+
+	return true;
+}
+
 bool InstalledModInfo::removeModFile(size_t index) {
 	if(index >= m_modFiles.size()) {
 		return false;
 	}
 
+	m_modFileContents.erase(m_modFiles[index]);
 	m_modFiles.erase(m_modFiles.cbegin() + index);
 
 	return true;
@@ -268,6 +349,7 @@ bool InstalledModInfo::removeModFile(const std::string filePath) {
 
 void InstalledModInfo::clearModFiles() {
 	m_modFiles.clear();
+	m_modFileContents.clear();
 }
 
 rapidjson::Document InstalledModInfo::toJSON() const {
@@ -299,17 +381,17 @@ rapidjson::Document InstalledModInfo::toJSON() const {
 
 	rapidjson::Value gameInfoValue(rapidjson::kObjectType);
 
-	if(m_gameID.empty()) {
+	if(!m_gameID.empty()) {
 		rapidjson::Value gameIDValue(m_gameID.c_str(), allocator);
 		gameInfoValue.AddMember(rapidjson::StringRef(JSON_GAME_ID_PROPERTY_NAME.c_str()), gameIDValue, allocator);
 	}
 
-	if(m_gameShortName.empty()) {
+	if(!m_gameShortName.empty()) {
 		rapidjson::Value gameShortNameValue(m_gameShortName.c_str(), allocator);
 		gameInfoValue.AddMember(rapidjson::StringRef(JSON_GAME_SHORT_NAME_PROPERTY_NAME.c_str()), gameShortNameValue, allocator);
 	}
 
-	if(m_gameLongName.empty()) {
+	if(!m_gameLongName.empty()) {
 		rapidjson::Value gameLongNameValue(m_gameLongName.c_str(), allocator);
 		gameInfoValue.AddMember(rapidjson::StringRef(JSON_GAME_LONG_NAME_PROPERTY_NAME.c_str()), gameLongNameValue, allocator);
 	}
@@ -339,6 +421,22 @@ rapidjson::Document InstalledModInfo::toJSON() const {
 
 	installedModInfoDocument.AddMember(rapidjson::StringRef(JSON_MOD_FILES_LIST_PROPERTY_NAME.c_str()), modFilesValue, allocator);
 
+	if(!m_modFileContents.empty()) {
+		rapidjson::Value modFileContentsValue(rapidjson::kObjectType);
+
+		for(std::map<std::string, ModFileContent>::const_iterator i = m_modFileContents.cbegin(); i != m_modFileContents.cend(); ++i) {
+			rapidjson::Value modFileValue(i->first.c_str(), allocator);
+			rapidjson::Value modFileContentValue(rapidjson::kObjectType);
+			rapidjson::Value sha1Value(i->second.sha1.c_str(), allocator);
+			modFileContentValue.AddMember(rapidjson::StringRef(JSON_MOD_FILE_CONTENT_SHA1_PROPERTY_NAME.c_str()), sha1Value, allocator);
+			rapidjson::Value sourceKeyValue(i->second.sourceKey.c_str(), allocator);
+			modFileContentValue.AddMember(rapidjson::StringRef(JSON_MOD_FILE_CONTENT_SOURCE_KEY_PROPERTY_NAME.c_str()), sourceKeyValue, allocator);
+			modFileContentsValue.AddMember(modFileValue, modFileContentValue, allocator);
+		}
+
+		installedModInfoDocument.AddMember(rapidjson::StringRef(JSON_MOD_FILE_CONTENTS_PROPERTY_NAME.c_str()), modFileContentsValue, allocator);
+	}
+
 	return installedModInfoDocument;
 }
 
@@ -607,6 +705,31 @@ std::unique_ptr<InstalledModInfo> InstalledModInfo::parseFrom(const rapidjson::V
 	installedModInfo->m_gameShortName = gameShortName;
 	installedModInfo->m_gameLongName = gameLongName;
 
+	// parse optional mod file contents, mod files without any cannot be reused by a later installation
+	if(installedModInfoValue.HasMember(JSON_MOD_FILE_CONTENTS_PROPERTY_NAME.c_str())) {
+		const rapidjson::Value & modFileContentsValue = installedModInfoValue[JSON_MOD_FILE_CONTENTS_PROPERTY_NAME.c_str()];
+
+		if(!modFileContentsValue.IsObject()) {
+			spdlog::error("Invalid installed mod info '{}' property type: '{}', expected 'object'.", JSON_MOD_FILE_CONTENTS_PROPERTY_NAME, Utilities::typeToString(modFileContentsValue.GetType()));
+			return nullptr;
+		}
+
+		for(rapidjson::Value::ConstMemberIterator i = modFileContentsValue.MemberBegin(); i != modFileContentsValue.MemberEnd(); ++i) {
+			std::string modFile(i->name.GetString());
+
+			if(!i->value.IsObject() ||
+			   !i->value.HasMember(JSON_MOD_FILE_CONTENT_SHA1_PROPERTY_NAME.c_str()) || !i->value[JSON_MOD_FILE_CONTENT_SHA1_PROPERTY_NAME.c_str()].IsString() ||
+			   !i->value.HasMember(JSON_MOD_FILE_CONTENT_SOURCE_KEY_PROPERTY_NAME.c_str()) || !i->value[JSON_MOD_FILE_CONTENT_SOURCE_KEY_PROPERTY_NAME.c_str()].IsString()) {
+				spdlog::warn("Skipping invalid installed mod info content for mod file '{}'.", modFile);
+				continue;
+			}
+
+			if(!installedModInfo->setModFileContent(modFile, i->value[JSON_MOD_FILE_CONTENT_SHA1_PROPERTY_NAME.c_str()].GetString(), i->value[JSON_MOD_FILE_CONTENT_SOURCE_KEY_PROPERTY_NAME.c_str()].GetString())) {
+				spdlog::warn("Skipping installed mod info content for unknown mod file '{}'.", modFile);
+			}
+		}
+	}
+
 	return installedModInfo;
 }
 
@@ -640,21 +763,13 @@ std::unique_ptr<InstalledModInfo> InstalledModInfo::loadFromJSON(const std::stri
 		return nullptr;
 	}
 
-	std::ifstream fileStream(filePath);
-
-	if(!fileStream.is_open()) {
-		return nullptr;
-	}
+	JSONFileReader fileReader;
 
-	rapidjson::Document modsValue;
-	rapidjson::IStreamWrapper fileStreamWrapper(fileStream);
-	if(modsValue.ParseStream(fileStreamWrapper).HasParseError()) {
+	if(!fileReader.load(filePath)) {
 		return nullptr;
 	}
 
-	fileStream.close();
-
-	std::unique_ptr<InstalledModInfo> installedModInfo(parseFrom(modsValue));
+	std::unique_ptr<InstalledModInfo> installedModInfo(parseFrom(fileReader.getDocument()));
 
 	if(!InstalledModInfo::isValid(installedModInfo.get())) {
 		spdlog::error("Failed to parse installed mod info from JSON file: '{}'.", filePath);
@@ -742,9 +857,19 @@ bool InstalledModInfo::operator == (const InstalledModInfo & installedModInfo) c
 		   Utilities::areStringsEqual(m_modName, installedModInfo.m_modName) &&
 		   Utilities::areStringsEqual(m_modVersion, installedModInfo.m_modVersion) &&
 		   m_originalFiles == installedModInfo.m_originalFiles &&
-		   m_modFiles == installedModInfo.m_modFiles;
+		   m_modFiles == installedModInfo.m_modFiles &&
+		   m_modFileContents == installedModInfo.m_modFileContents;
 }
 
 bool InstalledModInfo::operator != (const InstalledModInfo & installedModInfo) const {
 	return !operator == (installedModInfo);
 }
+
+bool InstalledModInfo::ModFileContent::operator == (const ModFileContent & modFileContent) const {
+	return Utilities::areStringsEqualIgnoreCase(sha1, modFileContent.sha1) &&
+		   Utilities::areStringsEqual(sourceKey, modFileContent.sourceKey);
+}
+
+bool InstalledModInfo::ModFileContent::operator != (const ModFileContent & modFileContent) const {
+	return !operator == (modFileContent);
+}
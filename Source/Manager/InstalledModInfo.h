@@ -4,6 +4,7 @@
 #include <rapidjson/document.h>
 
 #include <chrono>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -13,6 +14,14 @@ class ModVersion;
 
 class InstalledModInfo final {
 public:
+	struct ModFileContent {
+		std::string sha1;
+		std::string sourceKey;
+
+		bool operator == (const ModFileContent & c) const;
+		bool operator != (const ModFileContent & c) const;
+	};
+
 	InstalledModInfo(const ModVersion * modVersion = nullptr, const std::vector<std::string> & originalFiles = {}, const std::vector<std::string> & modFiles = {});
 	InstalledModInfo(InstalledModInfo && i) noexcept;
 	InstalledModInfo(const InstalledModInfo & i);
@@ -30,6 +39,8 @@ public:
 	void setGameInfo(const GameVersion & gameVersion);
 	std::chrono::time_point<std::chrono::system_clock> getInstalledTimestamp() const;
 	bool isEmpty() const;
+	bool isSameInstallationAs(const InstalledModInfo & i) const;
+	std::unique_ptr<InstalledModInfo> createReusableInstallation() const;
 
 	size_t numberOfOriginalFiles() const;
 	bool hasOriginalFile(const std::string & filePath) const;
@@ -47,6 +58,9 @@ public:
 	std::string getModFile(size_t index) const;
 	const std::vector<std::string> getModFiles() const;
 	bool addModFile(const std::string & filePath);
+	size_t numberOfModFileContents() const;
+	const ModFileContent * getModFileContent(const std::string & filePath) const;
+	bool setModFileContent(const std::string & filePath, const std::string & sha1, const std::string & sourceKey);
 	bool removeModFile(size_t index);
 	bool removeModFile(const std::string filePath);
 	void clearModFiles();
@@ -82,6 +96,7 @@ private:
 	std::chrono::time_point<std::chrono::system_clock> m_installedTimestamp;
 	std::vector<std::string> m_originalFiles;
 	std::vector<std::string> m_modFiles;
+	std::map<std::string, ModFileContent> m_modFileContents;
 };
 
 #endif // _INSTALLED_MOD_INFO_H_
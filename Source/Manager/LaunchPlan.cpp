@@ -0,0 +1,159 @@
+#include "LaunchPlan.h"
+
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/prettywriter.h>
+#include <spdlog/spdlog.h>
+
+#include <filesystem>
+#include <fstream>
+
+static const std::string JSON_GAME_VERSION_ID_PROPERTY_NAME("gameVersionID");
+static const std::string JSON_DOSBOX_VERSION_ID_PROPERTY_NAME("dosboxVersionID");
+static const std::string JSON_MOD_NAME_PROPERTY_NAME("modName");
+static const std::string JSON_MOD_GAME_VERSION_ID_PROPERTY_NAME("modGameVersionID");
+static const std::string JSON_GAME_TYPE_PROPERTY_NAME("gameType");
+static const std::string JSON_GAME_PATH_PROPERTY_NAME("gamePath");
+static const std::string JSON_MOD_FILES_INSTALL_PATH_PROPERTY_NAME("modFilesInstallPath");
+static const std::string JSON_SOURCE_CON_FILE_PATHS_PROPERTY_NAME("sourceConFiles");
+static const std::string JSON_TARGET_CON_FILE_PATHS_PROPERTY_NAME("targetConFiles");
+static const std::string JSON_SOURCE_DEF_FILE_PATHS_PROPERTY_NAME("sourceDefFiles");
+static const std::string JSON_TARGET_DEF_FILE_PATHS_PROPERTY_NAME("targetDefFiles");
+static const std::string JSON_SOURCE_GROUP_FILE_PATHS_PROPERTY_NAME("sourceGroupFiles");
+static const std::string JSON_TARGET_GROUP_FILE_PATHS_PROPERTY_NAME("targetGroupFiles");
+static const std::string JSON_CUSTOM_MAP_FILE_PROPERTY_NAME("customMap");
+static const std::string JSON_COMBINED_GROUP_PROPERTY_NAME("combinedGroup");
+static const std::string JSON_COMBINED_GROUP_FILE_NAME_PROPERTY_NAME("fileName");
+static const std::string JSON_COMBINED_GROUP_ORIGINAL_GROUP_FILE_PATH_PROPERTY_NAME("originalGroup");
+static const std::string JSON_COMBINED_GROUP_SOURCE_GROUP_FILE_PATHS_PROPERTY_NAME("sourceGroupFiles");
+static const std::string JSON_COMBINED_GROUP_ZIP_ARCHIVE_PROPERTY_NAME("zipArchive");
+static const std::string JSON_SYMLINKS_PROPERTY_NAME("symlinks");
+static const std::string JSON_SYMLINK_TARGET_PROPERTY_NAME("target");
+static const std::string JSON_SYMLINK_NAME_PROPERTY_NAME("name");
+static const std::string JSON_SYMLINK_DESTINATION_DIRECTORY_PATH_PROPERTY_NAME("directory");
+static const std::string JSON_STAGED_FILES_PROPERTY_NAME("stagedFiles");
+static const std::string JSON_FILE_SOURCE_PATH_PROPERTY_NAME("source");
+static const std::string JSON_FILE_TARGET_PATH_PROPERTY_NAME("target");
+static const std::string JSON_GROUP_FILE_EXTRACTION_REQUIRED_PROPERTY_NAME("groupFileExtractionRequired");
+static const std::string JSON_COMMAND_PROPERTY_NAME("command");
+static const std::string JSON_DOSBOX_CONFIGURATION_FILE_PATH_PROPERTY_NAME("dosboxConfigurationFilePath");
+static const std::string JSON_DOSBOX_CONFIGURATION_PROPERTY_NAME("dosboxConfiguration");
+
+static void addStringMember(rapidjson::Value & value, const std::string & propertyName, const std::string & data, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) {
+	if(data.empty()) {
+		return;
+	}
+
+	rapidjson::Value dataValue(data.c_str(), allocator);
+	value.AddMember(rapidjson::StringRef(propertyName.c_str(), propertyName.length()), dataValue, allocator);
+}
+
+static void addStringArrayMember(rapidjson::Value & value, const std::string & propertyName, const std::vector<std::string> & data, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) {
+	rapidjson::Value dataValue(rapidjson::kArrayType);
+	dataValue.Reserve(data.size(), allocator);
+
+	for(const std::string & entry : data) {
+		dataValue.PushBack(rapidjson::Value(entry.c_str(), allocator), allocator);
+	}
+
+	value.AddMember(rapidjson::StringRef(propertyName.c_str(), propertyName.length()), dataValue, allocator);
+}
+
+static rapidjson::Value fileToJSON(const LaunchPlan::File & file, rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator) {
+	rapidjson::Value fileValue(rapidjson::kObjectType);
+
+	addStringMember(fileValue, JSON_FILE_SOURCE_PATH_PROPERTY_NAME, file.sourceFilePath, allocator);
+	addStringMember(fileValue, JSON_FILE_TARGET_PATH_PROPERTY_NAME, file.targetFilePath, allocator);
+
+	return fileValue;
+}
+
+rapidjson::Document LaunchPlan::toJSON() const {
+	rapidjson::Document launchPlanDocument(rapidjson::kObjectType);
+	rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator = launchPlanDocument.GetAllocator();
+
+	addStringMember(launchPlanDocument, JSON_GAME_VERSION_ID_PROPERTY_NAME, gameVersionID, allocator);
+	addStringMember(launchPlanDocument, JSON_DOSBOX_VERSION_ID_PROPERTY_NAME, dosboxVersionID, allocator);
+	addStringMember(launchPlanDocument, JSON_MOD_NAME_PROPERTY_NAME, modName, allocator);
+	addStringMember(launchPlanDocument, JSON_MOD_GAME_VERSION_ID_PROPERTY_NAME, modGameVersionID, allocator);
+	addStringMember(launchPlanDocument, JSON_GAME_TYPE_PROPERTY_NAME, gameType, allocator);
+	addStringMember(launchPlanDocument, JSON_GAME_PATH_PROPERTY_NAME, gamePath, allocator);
+	addStringMember(launchPlanDocument, JSON_MOD_FILES_INSTALL_PATH_PROPERTY_NAME, modFilesInstallPath, allocator);
+	addStringArrayMember(launchPlanDocument, JSON_SOURCE_CON_FILE_PATHS_PROPERTY_NAME, sourceConFilePaths, allocator);
+	addStringArrayMember(launchPlanDocument, JSON_TARGET_CON_FILE_PATHS_PROPERTY_NAME, targetConFilePaths, allocator);
+	addStringArrayMember(launchPlanDocument, JSON_SOURCE_DEF_FILE_PATHS_PROPERTY_NAME, sourceDefFilePaths, allocator);
+	addStringArrayMember(launchPlanDocument, JSON_TARGET_DEF_FILE_PATHS_PROPERTY_NAME, targetDefFilePaths, allocator);
+	addStringArrayMember(launchPlanDocument, JSON_SOURCE_GROUP_FILE_PATHS_PROPERTY_NAME, sourceGroupFilePaths, allocator);
+	addStringArrayMember(launchPlanDocument, JSON_TARGET_GROUP_FILE_PATHS_PROPERTY_NAME, targetGroupFilePaths, allocator);
+
+	if(customMapFile.has_value()) {
+		launchPlanDocument.AddMember(rapidjson::StringRef(JSON_CUSTOM_MAP_FILE_PROPERTY_NAME.c_str(), JSON_CUSTOM_MAP_FILE_PROPERTY_NAME.length()), fileToJSON(customMapFile.value(), allocator), allocator);
+	}
+
+	if(combinedGroup.has_value()) {
+		rapidjson::Value combinedGroupValue(fileToJSON(File{ combinedGroup->sourceFilePath, combinedGroup->targetFilePath }, allocator));
+
+		addStringMember(combinedGroupValue, JSON_COMBINED_GROUP_FILE_NAME_PROPERTY_NAME, combinedGroup->fileName, allocator);
+		addStringMember(combinedGroupValue, JSON_COMBINED_GROUP_ORIGINAL_GROUP_FILE_PATH_PROPERTY_NAME, combinedGroup->originalGroupFilePath, allocator);
+		addStringArrayMember(combinedGroupValue, JSON_COMBINED_GROUP_SOURCE_GROUP_FILE_PATHS_PROPERTY_NAME, combinedGroup->sourceGroupFilePaths, allocator);
+		combinedGroupValue.AddMember(rapidjson::StringRef(JSON_COMBINED_GROUP_ZIP_ARCHIVE_PROPERTY_NAME.c_str(), JSON_COMBINED_GROUP_ZIP_ARCHIVE_PROPERTY_NAME.length()), rapidjson::Value(combinedGroup->zipArchive), allocator);
+
+		launchPlanDocument.AddMember(rapidjson::StringRef(JSON_COMBINED_GROUP_PROPERTY_NAME.c_str(), JSON_COMBINED_GROUP_PROPERTY_NAME.length()), combinedGroupValue, allocator);
+	}
+
+	rapidjson::Value symlinksValue(rapidjson::kArrayType);
+	symlinksValue.Reserve(symlinks.size(), allocator);
+
+	for(const Symlink & symlink : symlinks) {
+		rapidjson::Value symlinkValue(rapidjson::kObjectType);
+
+		addStringMember(symlinkValue, JSON_SYMLINK_TARGET_PROPERTY_NAME, symlink.target, allocator);
+		addStringMember(symlinkValue, JSON_SYMLINK_NAME_PROPERTY_NAME, symlink.name, allocator);
+		addStringMember(symlinkValue, JSON_SYMLINK_DESTINATION_DIRECTORY_PATH_PROPERTY_NAME, symlink.destinationDirectoryPath, allocator);
+
+		symlinksValue.PushBack(symlinkValue, allocator);
+	}
+
+	launchPlanDocument.AddMember(rapidjson::StringRef(JSON_SYMLINKS_PROPERTY_NAME.c_str(), JSON_SYMLINKS_PROPERTY_NAME.length()), symlinksValue, allocator);
+
+	rapidjson::Value stagedFilesValue(rapidjson::kArrayType);
+	stagedFilesValue.Reserve(stagedFiles.size(), allocator);
+
+	for(const File & stagedFile : stagedFiles) {
+		stagedFilesValue.PushBack(fileToJSON(stagedFile, allocator), allocator);
+	}
+
+	launchPlanDocument.AddMember(rapidjson::StringRef(JSON_STAGED_FILES_PROPERTY_NAME.c_str(), JSON_STAGED_FILES_PROPERTY_NAME.length()), stagedFilesValue, allocator);
+	launchPlanDocument.AddMember(rapidjson::StringRef(JSON_GROUP_FILE_EXTRACTION_REQUIRED_PROPERTY_NAME.c_str(), JSON_GROUP_FILE_EXTRACTION_REQUIRED_PROPERTY_NAME.length()), rapidjson::Value(groupFileExtractionRequired), allocator);
+	addStringMember(launchPlanDocument, JSON_COMMAND_PROPERTY_NAME, command, allocator);
+	addStringMember(launchPlanDocument, JSON_DOSBOX_CONFIGURATION_FILE_PATH_PROPERTY_NAME, dosboxConfigurationFilePath, allocator);
+	addStringMember(launchPlanDocument, JSON_DOSBOX_CONFIGURATION_PROPERTY_NAME, dosboxConfiguration, allocator);
+
+	return launchPlanDocument;
+}
+
+bool LaunchPlan::saveTo(const std::string & filePath, bool overwrite) const {
+	if(filePath.empty()) {
+		return false;
+	}
+
+	if(!overwrite && std::filesystem::exists(std::filesystem::path(filePath))) {
+		spdlog::warn("File '{}' already exists, use overwrite to force write.", filePath);
+		return false;
+	}
+
+	std::ofstream fileStream(filePath);
+
+	if(!fileStream.is_open()) {
+		return false;
+	}
+
+	rapidjson::Document launchPlan(toJSON());
+
+	rapidjson::OStreamWrapper fileStreamWrapper(fileStream);
+	rapidjson::PrettyWriter<rapidjson::OStreamWrapper> fileStreamWriter(fileStreamWrapper);
+	fileStreamWriter.SetIndent('\t', 1);
+	launchPlan.Accept(fileStreamWriter);
+	fileStream.close();
+
+	return true;
+}
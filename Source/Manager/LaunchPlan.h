@@ -0,0 +1,58 @@
+#ifndef _LAUNCH_PLAN_H_
+#define _LAUNCH_PLAN_H_
+
+#include <rapidjson/document.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+struct LaunchPlan final {
+public:
+	struct File {
+		std::string sourceFilePath;
+		std::string targetFilePath;
+	};
+
+	struct Symlink {
+		std::string target;
+		std::string name;
+		std::string destinationDirectoryPath;
+	};
+
+	struct CombinedGroup {
+		std::string fileName;
+		std::string sourceFilePath;
+		std::string targetFilePath;
+		std::string originalGroupFilePath;
+		std::vector<std::string> sourceGroupFilePaths;
+		bool zipArchive;
+	};
+
+	rapidjson::Document toJSON() const;
+	bool saveTo(const std::string & filePath, bool overwrite = true) const;
+
+	std::string gameVersionID;
+	std::string dosboxVersionID;
+	std::string modName;
+	std::string modGameVersionID;
+	std::string gameType;
+	std::string gamePath;
+	std::string modFilesInstallPath;
+	std::vector<std::string> sourceConFilePaths;
+	std::vector<std::string> targetConFilePaths;
+	std::vector<std::string> sourceDefFilePaths;
+	std::vector<std::string> targetDefFilePaths;
+	std::vector<std::string> sourceGroupFilePaths;
+	std::vector<std::string> targetGroupFilePaths;
+	std::optional<File> customMapFile;
+	std::optional<CombinedGroup> combinedGroup;
+	std::vector<Symlink> symlinks;
+	std::vector<File> stagedFiles;
+	bool groupFileExtractionRequired;
+	std::string command;
+	std::string dosboxConfigurationFilePath;
+	std::string dosboxConfiguration;
+};
+
+#endif // _LAUNCH_PLAN_H_
@@ -0,0 +1,435 @@
+#include "LaunchStagingService.h"
+
+#include "Game/File/Group/GroupFile.h"
+#include "Game/File/Group/GRP/GroupGRP.h"
+
+#include <Utilities/FileUtilities.h>
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <sstream>
+
+using namespace std::chrono_literals;
+
+bool LaunchStagingService::FileNameComparator::operator () (const std::string & fileNameA, const std::string & fileNameB) const {
+	return std::lexicographical_compare(fileNameA.begin(), fileNameA.end(), fileNameB.begin(), fileNameB.end(), [](unsigned char a, unsigned char b) {
+		return std::toupper(a) < std::toupper(b);
+	});
+}
+
+LaunchStagingService::LaunchStagingService()
+	: m_stagingCount(0) { }
+
+LaunchStagingService::~LaunchStagingService() {
+	cancel();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	discardCancelledStagingWithoutLocking(true);
+}
+
+bool LaunchStagingService::isStaging() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_stagingFuture.valid() && m_stagingFuture.wait_for(0s) != std::future_status::ready;
+}
+
+void LaunchStagingService::stage(const Request & request) {
+	std::string stagingKey(createStagingKey(request));
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	cancelPlanningWithoutLocking();
+	stageWithoutLocking(request, stagingKey);
+}
+
+void LaunchStagingService::stageWithoutLocking(const Request & request, const std::string & stagingKey) {
+	discardCancelledStagingWithoutLocking(false);
+
+	if(!stagingKey.empty() && stagingKey == m_stagingKey && m_stagingFuture.valid()) {
+		return;
+	}
+
+	cancelWithoutLocking();
+
+	if(stagingKey.empty()) {
+		return;
+	}
+
+	Request stagingRequest(request);
+
+	// cancelled staging may still be writing its combined group, so each staging writes to a separate file
+	if(!stagingRequest.combinedGroupFilePath.empty()) {
+		std::filesystem::path stagingCombinedGroupFilePath(stagingRequest.combinedGroupFilePath);
+		stagingCombinedGroupFilePath.replace_filename(fmt::format("{}-{}", ++m_stagingCount, stagingCombinedGroupFilePath.filename().string()));
+		stagingRequest.combinedGroupFilePath = stagingCombinedGroupFilePath.string();
+	}
+
+	m_stagingKey = stagingKey;
+	m_stagingCancelled = std::make_shared<std::atomic<bool>>(false);
+	m_stagingFuture = std::async(std::launch::async, &LaunchStagingService::runStaging, std::move(stagingRequest), m_stagingCancelled);
+
+	spdlog::debug("Staging launch artifacts from {} group file{} in the background.", request.sourceGroupFilePaths.size(), request.sourceGroupFilePaths.size() == 1 ? "" : "s");
+}
+
+void LaunchStagingService::schedule(RequestFactory createRequest) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	cancelPlanningWithoutLocking();
+
+	m_planningCancelled = std::make_shared<std::atomic<bool>>(false);
+	m_planningFutures.push_back(std::async(std::launch::async, &LaunchStagingService::runPlanning, this, std::move(createRequest), m_planningCancelled));
+}
+
+void LaunchStagingService::runPlanning(RequestFactory createRequest, std::shared_ptr<std::atomic<bool>> cancelled) {
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+
+		// requests are frequently scheduled in quick succession, so only the last one is planned
+		if(m_planningCondition.wait_for(lock, PLANNING_DELAY, [&cancelled]() { return cancelled->load(); })) {
+			return;
+		}
+	}
+
+	std::unique_ptr<Request> request(createRequest(*cancelled));
+	std::string stagingKey(request == nullptr ? std::string() : createStagingKey(*request));
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(*cancelled) {
+		return;
+	}
+
+	if(request == nullptr) {
+		cancelWithoutLocking();
+		return;
+	}
+
+	stageWithoutLocking(*request, stagingKey);
+}
+
+std::unique_ptr<LaunchStagingService::Artifacts> LaunchStagingService::takeStagedArtifacts(const Request & request) {
+	std::string stagingKey(createStagingKey(request));
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	discardCancelledStagingWithoutLocking(false);
+
+	if(!m_stagingFuture.valid()) {
+		return nullptr;
+	}
+
+	if(stagingKey.empty() || stagingKey != m_stagingKey) {
+		spdlog::debug("Discarding staged launch artifacts, launch plan or source files changed since staging began.");
+
+		cancelWithoutLocking();
+
+		return nullptr;
+	}
+
+	if(m_stagingFuture.wait_for(0s) != std::future_status::ready) {
+		spdlog::info("Waiting for launch artifact staging to complete.");
+	}
+
+	std::unique_ptr<Artifacts> artifacts(m_stagingFuture.get());
+	m_stagingKey.clear();
+	m_stagingCancelled.reset();
+
+	return artifacts;
+}
+
+void LaunchStagingService::cancel() {
+	std::vector<std::future<void>> planningFutures;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		cancelPlanningWithoutLocking();
+		cancelWithoutLocking();
+
+		planningFutures = std::move(m_planningFutures);
+		m_planningFutures.clear();
+	}
+
+	// request factories refer to the state of their owner, so planning has to have stopped before cancellation returns
+	for(std::future<void> & planningFuture : planningFutures) {
+		planningFuture.wait();
+	}
+}
+
+void LaunchStagingService::cancelPlanningWithoutLocking() {
+	if(m_planningCancelled != nullptr) {
+		*m_planningCancelled = true;
+		m_planningCancelled.reset();
+
+		m_planningCondition.notify_all();
+	}
+
+	for(std::vector<std::future<void>>::iterator i = m_planningFutures.begin(); i != m_planningFutures.end();) {
+		if(i->wait_for(0s) != std::future_status::ready) {
+			++i;
+			continue;
+		}
+
+		i = m_planningFutures.erase(i);
+	}
+}
+
+void LaunchStagingService::cancelWithoutLocking() {
+	if(m_stagingFuture.valid()) {
+		*m_stagingCancelled = true;
+		m_cancelledStagingFutures.push_back(std::move(m_stagingFuture));
+		m_stagingCancelled.reset();
+		m_stagingKey.clear();
+	}
+
+	discardCancelledStagingWithoutLocking(false);
+}
+
+void LaunchStagingService::discardCancelledStagingWithoutLocking(bool wait) {
+	for(std::vector<std::future<std::unique_ptr<Artifacts>>>::iterator i = m_cancelledStagingFutures.begin(); i != m_cancelledStagingFutures.end();) {
+		if(!wait && i->wait_for(0s) != std::future_status::ready) {
+			++i;
+			continue;
+		}
+
+		discardArtifacts(i->get());
+		i = m_cancelledStagingFutures.erase(i);
+	}
+}
+
+std::unique_ptr<LaunchStagingService::Artifacts> LaunchStagingService::createArtifacts(const Request & request, const std::atomic<bool> * cancelled, std::string * errorMessage) {
+	std::unique_ptr<Artifacts> artifacts(std::make_unique<Artifacts>());
+
+	if(!request.combinedGroupFileName.empty()) {
+		std::unique_ptr<GroupGRP> originalGroup;
+
+		if(!request.originalGroupFilePath.empty()) {
+			originalGroup = GroupGRP::loadFrom(request.originalGroupFilePath);
+
+			if(originalGroup == nullptr) {
+				if(errorMessage != nullptr) {
+					*errorMessage = fmt::format("Failed to load '{}' group for creation of combined group from file path: '{}'.", request.originalGroupGameVersionName, request.originalGroupFilePath);
+				}
+
+				return nullptr;
+			}
+		}
+
+		if(request.combinedZip) {
+			artifacts->combinedZip = ZipArchive::createNew(request.combinedGroupFilePath);
+
+			if(originalGroup != nullptr) {
+				std::shared_ptr<GroupFile> groupFile;
+
+				for(size_t i = 0; i < originalGroup->numberOfFiles(); i++) {
+					groupFile = originalGroup->getFile(i);
+					artifacts->combinedZip->addData(groupFile->transferData(), groupFile->getFileName(), true);
+				}
+
+				spdlog::info("Added {} original '{}' game file{} to combined zip archive file.", originalGroup->numberOfFiles(), request.originalGroupGameVersionName, originalGroup->numberOfFiles() == 1 ? "" : "s");
+
+				originalGroup.reset();
+			}
+		}
+		else {
+			if(originalGroup != nullptr) {
+				artifacts->combinedGroup = std::move(originalGroup);
+
+				spdlog::info("Added {} original '{}' game file{} to combined group file.", artifacts->combinedGroup->numberOfFiles(), request.originalGroupGameVersionName, artifacts->combinedGroup->numberOfFiles() == 1 ? "" : "s");
+			}
+			else {
+				artifacts->combinedGroup = std::make_unique<GroupGRP>();
+			}
+
+			artifacts->combinedGroup->setFilePath(request.combinedGroupFilePath);
+		}
+	}
+
+	for(const std::string & sourceGroupFilePath : request.sourceGroupFilePaths) {
+		if(cancelled != nullptr && *cancelled) {
+			return nullptr;
+		}
+
+		if(Utilities::hasFileExtension(sourceGroupFilePath, "zip")) {
+			std::unique_ptr<ZipArchive> modZip(ZipArchive::readFrom(sourceGroupFilePath));
+
+			if(modZip == nullptr) {
+				if(errorMessage != nullptr) {
+					*errorMessage = fmt::format("Failed to load zip archive from file path: '{}'.", sourceGroupFilePath);
+				}
+
+				return nullptr;
+			}
+
+			size_t addedFileCount = 0;
+			std::shared_ptr<ArchiveEntry> modZipEntry;
+
+			for(size_t i = 0; i < modZip->numberOfEntries(); i++) {
+				if(cancelled != nullptr && *cancelled) {
+					return nullptr;
+				}
+
+				modZipEntry = modZip->getEntry(i);
+
+				if(modZipEntry == nullptr || !modZipEntry->isFile()) {
+					continue;
+				}
+
+				std::unique_ptr<ByteBuffer> modZipEntryData(modZipEntry->getData());
+
+				if(request.collectDemoFiles && Utilities::hasFileExtension(modZipEntry->getPath(), "dmo")) {
+					artifacts->demoFiles.emplace(modZipEntry->getPath(), std::make_unique<ByteBuffer>(*modZipEntryData));
+				}
+
+				if(artifacts->combinedZip != nullptr) {
+					artifacts->combinedZip->addData(std::move(modZipEntryData), modZipEntry->getPath(), true);
+					addedFileCount++;
+				}
+			}
+
+			spdlog::info("Added {} file{} from '{}' to combined zip archive file.", addedFileCount, addedFileCount == 1 ? "" : "s", Utilities::getFileName(sourceGroupFilePath));
+		}
+		else {
+			std::unique_ptr<Group> modGroup(GroupGRP::loadFrom(sourceGroupFilePath));
+
+			if(modGroup == nullptr) {
+				if(errorMessage != nullptr) {
+					*errorMessage = fmt::format("Failed to load group from file path: '{}'.", sourceGroupFilePath);
+				}
+
+				return nullptr;
+			}
+
+			std::shared_ptr<GroupFile> groupFile;
+
+			for(size_t i = 0; i < modGroup->numberOfFiles(); i++) {
+				groupFile = modGroup->getFile(i);
+
+				if(request.collectDemoFiles && Utilities::hasFileExtension(groupFile->getFileName(), "dmo")) {
+					artifacts->demoFiles.emplace(groupFile->getFileName(), std::make_unique<ByteBuffer>(groupFile->getData()));
+				}
+
+				if(artifacts->combinedZip != nullptr) {
+					artifacts->combinedZip->addData(groupFile->transferData(), groupFile->getFileName(), true);
+				}
+				else if(artifacts->combinedGroup != nullptr) {
+					artifacts->combinedGroup->addFile(std::make_unique<GroupFile>(groupFile->getFileName(), groupFile->transferData()), true);
+				}
+			}
+
+			spdlog::info("Added {} file{} from '{}' to combined {} file.", modGroup->numberOfFiles(), modGroup->numberOfFiles() == 1 ? "" : "s", Utilities::getFileName(sourceGroupFilePath), artifacts->combinedZip != nullptr ? "zip archive" : "group");
+		}
+	}
+
+	return artifacts;
+}
+
+std::unique_ptr<LaunchStagingService::Artifacts> LaunchStagingService::runStaging(Request request, std::shared_ptr<std::atomic<bool>> cancelled) {
+	// staging is speculative, so it should not compete with the user for disk or processor time
+	setCurrentThreadBackgroundMode(true);
+
+	std::chrono::time_point<std::chrono::steady_clock> stagingStartTimePoint(std::chrono::steady_clock::now());
+	std::string errorMessage;
+	std::unique_ptr<Artifacts> artifacts(createArtifacts(request, cancelled.get(), &errorMessage));
+
+	if(artifacts != nullptr && !request.combinedGroupFileName.empty() && !*cancelled) {
+		std::error_code errorCode;
+		std::filesystem::create_directories(std::filesystem::path(request.combinedGroupFilePath).parent_path(), errorCode);
+
+		bool combinedGroupOrZipArchiveSaved = false;
+
+		if(!errorCode) {
+			if(artifacts->combinedZip != nullptr) {
+				combinedGroupOrZipArchiveSaved = artifacts->combinedZip->save();
+			}
+			else {
+				combinedGroupOrZipArchiveSaved = artifacts->combinedGroup->save(true);
+			}
+		}
+
+		artifacts->combinedGroup.reset();
+		artifacts->combinedZip.reset();
+
+		if(combinedGroupOrZipArchiveSaved) {
+			artifacts->stagedCombinedGroupFilePath = request.combinedGroupFilePath;
+		}
+		else {
+			errorMessage = fmt::format("Failed to write staged combined group to file: '{}'.", request.combinedGroupFilePath);
+			std::filesystem::remove(std::filesystem::path(request.combinedGroupFilePath), errorCode);
+			artifacts.reset();
+		}
+	}
+
+	if(*cancelled) {
+		discardArtifacts(std::move(artifacts));
+
+		spdlog::debug("Launch artifact staging cancelled.");
+	}
+	else if(artifacts == nullptr) {
+		spdlog::warn("Failed to stage launch artifacts: {}", errorMessage);
+	}
+	else {
+		spdlog::info("Staged launch artifacts in the background after {} ms.", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - stagingStartTimePoint).count());
+	}
+
+	// asynchronous tasks may run on pooled threads, so the thread is always restored to normal priority
+	setCurrentThreadBackgroundMode(false);
+
+	return artifacts;
+}
+
+std::string LaunchStagingService::createStagingKey(const Request & request) {
+	std::stringstream stagingKey;
+
+	stagingKey << request.combinedGroupFileName << '|' << request.combinedZip << '|' << request.collectDemoFiles;
+
+	std::vector<std::string> filePaths(request.sourceGroupFilePaths);
+
+	if(!request.originalGroupFilePath.empty()) {
+		filePaths.insert(filePaths.begin(), request.originalGroupFilePath);
+	}
+
+	if(filePaths.empty()) {
+		return {};
+	}
+
+	// source file sizes and modification times are included so that modified files invalidate staged artifacts
+	for(const std::string & filePath : filePaths) {
+		std::error_code errorCode;
+		std::filesystem::path path(filePath);
+		uintmax_t fileSize = std::filesystem::file_size(path, errorCode);
+
+		if(errorCode) {
+			return {};
+		}
+
+		std::filesystem::file_time_type lastWriteTime(std::filesystem::last_write_time(path, errorCode));
+
+		if(errorCode) {
+			return {};
+		}
+
+		stagingKey << '|' << filePath << ':' << fileSize << ':' << lastWriteTime.time_since_epoch().count();
+	}
+
+	return stagingKey.str();
+}
+
+void LaunchStagingService::discardArtifacts(std::unique_ptr<Artifacts> artifacts) {
+	if(artifacts == nullptr || artifacts->stagedCombinedGroupFilePath.empty()) {
+		return;
+	}
+
+	std::error_code errorCode;
+	std::filesystem::remove(std::filesystem::path(artifacts->stagedCombinedGroupFilePath), errorCode);
+
+	if(errorCode) {
+		spdlog::warn("Failed to delete staged combined group file '{}': {}", artifacts->stagedCombinedGroupFilePath, errorCode.message());
+	}
+}
@@ -0,0 +1,93 @@
+#ifndef _LAUNCH_STAGING_SERVICE_H_
+#define _LAUNCH_STAGING_SERVICE_H_
+
+#include "Game/File/Group/Group.h"
+
+#include <Archive/Zip/ZipArchive.h>
+#include <ByteBuffer.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class LaunchStagingService final {
+public:
+	struct FileNameComparator {
+	public:
+		bool operator () (const std::string & fileNameA, const std::string & fileNameB) const;
+	};
+
+	using DemoFileMap = std::map<std::string, std::unique_ptr<ByteBuffer>, FileNameComparator>;
+
+	struct Request {
+		std::string originalGroupFilePath;
+		std::string originalGroupGameVersionName;
+		std::vector<std::string> sourceGroupFilePaths;
+		std::string combinedGroupFileName;
+		std::string combinedGroupFilePath;
+		bool combinedZip;
+		bool collectDemoFiles;
+	};
+
+	struct Artifacts {
+		std::unique_ptr<Group> combinedGroup;
+		std::unique_ptr<ZipArchive> combinedZip;
+		std::string stagedCombinedGroupFilePath;
+		DemoFileMap demoFiles;
+	};
+
+	// creates the request to stage from a background thread, returns nothing if there is nothing to stage or it was cancelled
+	using RequestFactory = std::function<std::unique_ptr<Request>(const std::atomic<bool> & cancelled)>;
+
+	LaunchStagingService();
+	~LaunchStagingService();
+
+	bool isStaging() const;
+	// staging is skipped if the request matches the artifacts which are already staged or being staged, otherwise any previous staging is cancelled
+	void stage(const Request & request);
+	// the request is created in the background once no other request has been scheduled for the planning delay, and is then staged
+	void schedule(RequestFactory createRequest);
+	// waits for staging to complete if it is still in progress, returns nothing if the request or its source files changed since staging began
+	std::unique_ptr<Artifacts> takeStagedArtifacts(const Request & request);
+	void cancel();
+
+	static std::unique_ptr<Artifacts> createArtifacts(const Request & request, const std::atomic<bool> * cancelled = nullptr, std::string * errorMessage = nullptr);
+
+	static constexpr std::chrono::milliseconds PLANNING_DELAY = std::chrono::milliseconds(250);
+
+private:
+	void stageWithoutLocking(const Request & request, const std::string & stagingKey);
+	void runPlanning(RequestFactory createRequest, std::shared_ptr<std::atomic<bool>> cancelled);
+	static std::unique_ptr<Artifacts> runStaging(Request request, std::shared_ptr<std::atomic<bool>> cancelled);
+	void cancelPlanningWithoutLocking();
+	void cancelWithoutLocking();
+	// cancelled staging is never waited on unless requested, its artifacts are discarded once it has finished
+	void discardCancelledStagingWithoutLocking(bool wait);
+	static std::string createStagingKey(const Request & request);
+	static void discardArtifacts(std::unique_ptr<Artifacts> artifacts);
+	static void setCurrentThreadBackgroundMode(bool backgroundMode);
+
+	std::string m_stagingKey;
+	std::future<std::unique_ptr<Artifacts>> m_stagingFuture;
+	std::shared_ptr<std::atomic<bool>> m_stagingCancelled;
+	std::vector<std::future<std::unique_ptr<Artifacts>>> m_cancelledStagingFutures;
+	size_t m_stagingCount;
+	std::shared_ptr<std::atomic<bool>> m_planningCancelled;
+	std::vector<std::future<void>> m_planningFutures;
+	std::condition_variable m_planningCondition;
+	mutable std::mutex m_mutex;
+
+	LaunchStagingService(const LaunchStagingService &) = delete;
+	LaunchStagingService(LaunchStagingService &&) noexcept = delete;
+	const LaunchStagingService & operator = (const LaunchStagingService &) = delete;
+	const LaunchStagingService & operator = (LaunchStagingService &&) noexcept = delete;
+};
+
+#endif // _LAUNCH_STAGING_SERVICE_H_
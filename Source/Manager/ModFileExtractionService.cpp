@@ -0,0 +1,376 @@
+#include "ModFileExtractionService.h"
+
+#include "FileFingerprintCache.h"
+#include "Game/File/Group/GRP/GroupGRP.h"
+
+#include <Archive/Zip/ZipArchive.h>
+#include <ByteBuffer.h>
+#include <Utilities/FileUtilities.h>
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+bool ModFileExtractionService::FileNameComparator::operator () (const std::string & fileNameA, const std::string & fileNameB) const {
+	return std::lexicographical_compare(fileNameA.begin(), fileNameA.end(), fileNameB.begin(), fileNameB.end(), [](unsigned char a, unsigned char b) {
+		return std::tolower(a) < std::tolower(b);
+	});
+}
+
+ModFileExtractionService::ModFileExtractionService(size_t numberOfThreads)
+	: m_numberOfThreads(numberOfThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : numberOfThreads) { }
+
+ModFileExtractionService::~ModFileExtractionService() = default;
+
+size_t ModFileExtractionService::getNumberOfThreads() const {
+	return m_numberOfThreads;
+}
+
+size_t ModFileExtractionService::numberOfSourceFiles() const {
+	return m_sourceFiles.size();
+}
+
+size_t ModFileExtractionService::numberOfFiles() const {
+	return m_files.size();
+}
+
+uint64_t ModFileExtractionService::getTotalFileSize() const {
+	uint64_t totalFileSize = 0;
+
+	for(std::map<std::string, FileEntry, FileNameComparator>::const_iterator i = m_files.cbegin(); i != m_files.cend(); ++i) {
+		totalFileSize += i->second.fileSize;
+	}
+
+	return totalFileSize;
+}
+
+bool ModFileExtractionService::hasFile(const std::string & fileName) const {
+	return m_files.find(fileName) != m_files.cend();
+}
+
+std::vector<std::string> ModFileExtractionService::getFileNames() const {
+	std::vector<std::string> fileNames;
+	fileNames.reserve(m_files.size());
+
+	for(std::map<std::string, FileEntry, FileNameComparator>::const_iterator i = m_files.cbegin(); i != m_files.cend(); ++i) {
+		fileNames.push_back(i->first);
+	}
+
+	return fileNames;
+}
+
+bool ModFileExtractionService::addSourceFile(const std::string & sourceFilePath) {
+	if(sourceFilePath.empty()) {
+		return false;
+	}
+
+	m_sourceFiles.push_back({ sourceFilePath, Utilities::hasFileExtension(sourceFilePath, "zip"), {} });
+
+	bool sourceFileAdded = m_sourceFiles.back().zipArchive ? addZipArchive(m_sourceFiles.size() - 1) : addGroupFile(m_sourceFiles.size() - 1);
+
+	if(!sourceFileAdded) {
+		m_sourceFiles.pop_back();
+	}
+
+	return sourceFileAdded;
+}
+
+bool ModFileExtractionService::addGroupFile(size_t sourceIndex) {
+	const std::string & groupFilePath = m_sourceFiles[sourceIndex].filePath;
+
+	// only the group file directory is read, file data is streamed directly from the group during extraction
+	std::optional<std::vector<GroupGRP::DirectoryEntry>> optionalGroupDirectory(GroupGRP::readDirectoryFrom(groupFilePath));
+
+	if(!optionalGroupDirectory.has_value()) {
+		spdlog::error("Failed to open group file: '{}'.", groupFilePath);
+		return false;
+	}
+
+	for(const GroupGRP::DirectoryEntry & groupDirectoryEntry : optionalGroupDirectory.value()) {
+		m_files[groupDirectoryEntry.fileName] = { groupDirectoryEntry.fileName, sourceIndex, 0, groupDirectoryEntry.dataOffset, groupDirectoryEntry.fileSize };
+	}
+
+	spdlog::debug("Indexed {} file{} from group file '{}'.", optionalGroupDirectory->size(), optionalGroupDirectory->size() == 1 ? "" : "s", Utilities::getFileName(groupFilePath));
+
+	return true;
+}
+
+bool ModFileExtractionService::addZipArchive(size_t sourceIndex) {
+	const std::string & zipArchiveFilePath = m_sourceFiles[sourceIndex].filePath;
+	std::unique_ptr<ZipArchive> zipArchive(ZipArchive::readFrom(zipArchiveFilePath));
+
+	if(zipArchive == nullptr) {
+		spdlog::error("Failed to open zip archive file: '{}'.", zipArchiveFilePath);
+		return false;
+	}
+
+	size_t numberOfIndexedFiles = 0;
+	std::shared_ptr<ArchiveEntry> zipArchiveEntry;
+
+	for(size_t i = 0; i < zipArchive->numberOfEntries(); i++) {
+		zipArchiveEntry = zipArchive->getEntry(i);
+
+		if(zipArchiveEntry == nullptr || !zipArchiveEntry->isFile()) {
+			continue;
+		}
+
+		m_files[zipArchiveEntry->getName()] = { zipArchiveEntry->getName(), sourceIndex, i, 0, zipArchiveEntry->getUncompressedSize() };
+		numberOfIndexedFiles++;
+	}
+
+	spdlog::debug("Indexed {} file{} from zip archive file '{}'.", numberOfIndexedFiles, numberOfIndexedFiles == 1 ? "" : "s", Utilities::getFileName(zipArchiveFilePath));
+
+	return true;
+}
+
+bool ModFileExtractionService::removeFile(const std::string & fileName) {
+	return m_files.erase(fileName) != 0;
+}
+
+std::string ModFileExtractionService::getFileSourceKey(const std::string & fileName) {
+	std::map<std::string, FileEntry, FileNameComparator>::const_iterator fileIterator(m_files.find(fileName));
+
+	if(fileIterator == m_files.cend()) {
+		return {};
+	}
+
+	const FileEntry & fileEntry = fileIterator->second;
+	SourceFile & sourceFile = m_sourceFiles[fileEntry.sourceIndex];
+
+	// source files are usually already fingerprinted by mod integrity verification, so this rarely needs to read the source file
+	if(sourceFile.sha1.empty()) {
+		sourceFile.sha1 = FileFingerprintCache::getInstance()->getFileSHA1Hash(sourceFile.filePath);
+
+		if(sourceFile.sha1.empty()) {
+			return {};
+		}
+	}
+
+	return fmt::format("{}:{}:{}", sourceFile.sha1, sourceFile.zipArchive ? fileEntry.zipArchiveEntryIndex : fileEntry.dataOffset, fileEntry.fileSize);
+}
+
+std::vector<ModFileExtractionService::ExtractedFile> ModFileExtractionService::extractFiles(const std::string & directoryPath, bool computeSHA1, const ProgressCallback & progressCallback) const {
+	if(directoryPath.empty() || m_files.empty()) {
+		return {};
+	}
+
+	std::vector<std::string> fileNames;
+	std::vector<const FileEntry *> fileEntries;
+
+	for(std::map<std::string, FileEntry, FileNameComparator>::const_iterator i = m_files.cbegin(); i != m_files.cend(); ++i) {
+		fileNames.push_back(i->first);
+		fileEntries.push_back(&i->second);
+	}
+
+	// start with the largest files so that a single big file does not end up being extracted on its own at the end
+	std::vector<size_t> pendingFileIndices(fileEntries.size());
+
+	for(size_t i = 0; i < pendingFileIndices.size(); i++) {
+		pendingFileIndices[i] = i;
+	}
+
+	std::stable_sort(pendingFileIndices.begin(), pendingFileIndices.end(), [&fileEntries](size_t a, size_t b) {
+		return fileEntries[a]->fileSize > fileEntries[b]->fileSize;
+	});
+
+	std::vector<bool> fileExtracted(fileEntries.size(), false);
+	std::vector<std::string> fileSHA1s(fileEntries.size());
+	std::vector<size_t> completedFileIndices;
+	std::mutex completedFilesMutex;
+	std::condition_variable completedFilesCondition;
+	std::atomic<size_t> nextPendingFileIndex(0);
+	uint64_t numberOfHashingBytes = 0;
+	std::mutex hashingBytesMutex;
+	std::condition_variable hashingBytesCondition;
+	std::vector<std::future<void>> workers;
+	size_t numberOfWorkers = std::min(m_numberOfThreads, pendingFileIndices.size());
+
+	for(size_t i = 0; i < numberOfWorkers; i++) {
+		workers.push_back(std::async(std::launch::async, [this, &directoryPath, computeSHA1, &fileNames, &fileEntries, &pendingFileIndices, &nextPendingFileIndex, &fileExtracted, &fileSHA1s, &completedFileIndices, &completedFilesMutex, &completedFilesCondition, &numberOfHashingBytes, &hashingBytesMutex, &hashingBytesCondition]() {
+			// each worker opens its own handle to every source file it reads from, since neither file streams nor zip archives can be shared between threads
+			std::vector<std::unique_ptr<std::ifstream>> groupFileStreams(m_sourceFiles.size());
+			std::vector<std::unique_ptr<ZipArchive>> zipArchives(m_sourceFiles.size());
+			std::vector<char> buffer(STREAM_BUFFER_SIZE);
+			size_t pendingFileIndex = 0;
+
+			while((pendingFileIndex = nextPendingFileIndex++) < pendingFileIndices.size()) {
+				size_t fileIndex = pendingFileIndices[pendingFileIndex];
+				const FileEntry & fileEntry = *fileEntries[fileIndex];
+				const SourceFile & sourceFile = m_sourceFiles[fileEntry.sourceIndex];
+				std::string filePath(Utilities::joinPaths(directoryPath, fileNames[fileIndex]));
+				bool extracted = false;
+				std::string sha1;
+
+				// files larger than the limit are still hashed, but only once no other files are being hashed
+				if(computeSHA1) {
+					std::unique_lock<std::mutex> hashingBytesLock(hashingBytesMutex);
+
+					hashingBytesCondition.wait(hashingBytesLock, [&numberOfHashingBytes, &fileEntry]() {
+						return numberOfHashingBytes == 0 || numberOfHashingBytes + fileEntry.fileSize <= MAXIMUM_NUMBER_OF_HASHING_BYTES;
+					});
+
+					numberOfHashingBytes += fileEntry.fileSize;
+				}
+
+				// a file which fails to extract must still be reported, otherwise the calling thread would wait for it forever
+				try {
+					if(sourceFile.zipArchive) {
+						std::unique_ptr<ZipArchive> & zipArchive = zipArchives[fileEntry.sourceIndex];
+
+						if(zipArchive == nullptr) {
+							zipArchive = ZipArchive::readFrom(sourceFile.filePath);
+						}
+
+						std::shared_ptr<ArchiveEntry> zipArchiveEntry(zipArchive != nullptr ? zipArchive->getEntry(fileEntry.zipArchiveEntryIndex) : nullptr);
+
+						if(computeSHA1) {
+							std::unique_ptr<ByteBuffer> zipArchiveEntryData(zipArchiveEntry != nullptr ? zipArchiveEntry->getData() : nullptr);
+
+							extracted = zipArchiveEntryData != nullptr && zipArchiveEntryData->writeTo(filePath, true);
+
+							if(extracted) {
+								sha1 = zipArchiveEntryData->getSHA1();
+							}
+						}
+						else {
+							extracted = zipArchiveEntry != nullptr && zipArchiveEntry->writeToFile(filePath);
+						}
+					}
+					else {
+						std::unique_ptr<std::ifstream> & groupFileStream = groupFileStreams[fileEntry.sourceIndex];
+
+						if(groupFileStream == nullptr) {
+							groupFileStream = std::make_unique<std::ifstream>(std::filesystem::path(sourceFile.filePath), std::ios::binary);
+						}
+
+						std::ofstream outputFileStream(std::filesystem::path(filePath), std::ios::binary | std::ios::trunc);
+
+						if(groupFileStream->is_open() && outputFileStream.is_open()) {
+							groupFileStream->clear();
+							groupFileStream->seekg(static_cast<std::streamoff>(fileEntry.dataOffset));
+
+							// when hashing, each chunk is also appended to a buffer sized for the whole file, since the file data can only be hashed all at once
+							ByteBuffer fileData;
+
+							if(computeSHA1) {
+								fileData.reserve(static_cast<size_t>(fileEntry.fileSize));
+							}
+
+							uint64_t numberOfBytesRemaining = fileEntry.fileSize;
+
+							while(numberOfBytesRemaining != 0) {
+								size_t chunkSize = static_cast<size_t>(std::min<uint64_t>(numberOfBytesRemaining, buffer.size()));
+
+								if(!groupFileStream->read(buffer.data(), chunkSize) || !outputFileStream.write(buffer.data(), chunkSize)) {
+									break;
+								}
+
+								if(computeSHA1 && !fileData.writeBytes(reinterpret_cast<const uint8_t *>(buffer.data()), chunkSize)) {
+									break;
+								}
+
+								numberOfBytesRemaining -= chunkSize;
+							}
+
+							outputFileStream.close();
+							extracted = numberOfBytesRemaining == 0 && !outputFileStream.fail();
+
+							if(extracted && computeSHA1) {
+								sha1 = fileData.getSHA1();
+							}
+						}
+
+						if(!extracted) {
+							outputFileStream.close();
+
+							std::error_code errorCode;
+							std::filesystem::remove(std::filesystem::path(filePath), errorCode);
+						}
+					}
+				}
+				catch(const std::exception & exception) {
+					spdlog::error("Failed to extract mod file '{}': {}", fileNames[fileIndex], exception.what());
+				}
+				catch(...) {
+					spdlog::error("Failed to extract mod file '{}'.", fileNames[fileIndex]);
+				}
+
+				if(computeSHA1) {
+					std::lock_guard<std::mutex> hashingBytesLock(hashingBytesMutex);
+
+					numberOfHashingBytes -= fileEntry.fileSize;
+					hashingBytesCondition.notify_all();
+				}
+
+				// results are stored under the lock, since neighbouring flags share storage within the bit packed vector
+				std::lock_guard<std::mutex> lock(completedFilesMutex);
+
+				fileExtracted[fileIndex] = extracted;
+				fileSHA1s[fileIndex] = std::move(sha1);
+				completedFileIndices.push_back(fileIndex);
+				completedFilesCondition.notify_one();
+			}
+		}));
+	}
+
+	size_t fileNumber = 0;
+	std::vector<size_t> reportableFileIndices;
+
+	while(fileNumber < fileEntries.size()) {
+		std::vector<bool> reportableFileExtracted;
+
+		{
+			std::unique_lock<std::mutex> lock(completedFilesMutex);
+
+			completedFilesCondition.wait(lock, [&completedFileIndices]() {
+				return !completedFileIndices.empty();
+			});
+
+			reportableFileIndices.swap(completedFileIndices);
+
+			for(size_t fileIndex : reportableFileIndices) {
+				reportableFileExtracted.push_back(fileExtracted[fileIndex]);
+			}
+		}
+
+		for(size_t i = 0; i < reportableFileIndices.size(); i++) {
+			fileNumber++;
+
+			if(progressCallback) {
+				progressCallback(fileNumber, fileEntries.size(), fileNames[reportableFileIndices[i]], reportableFileExtracted[i]);
+			}
+		}
+
+		reportableFileIndices.clear();
+	}
+
+	for(std::future<void> & worker : workers) {
+		worker.wait();
+	}
+
+	std::vector<ExtractedFile> extractedFiles;
+
+	for(size_t i = 0; i < fileNames.size(); i++) {
+		if(fileExtracted[i]) {
+			extractedFiles.push_back({ fileNames[i], std::move(fileSHA1s[i]) });
+		}
+	}
+
+	return extractedFiles;
+}
+
+void ModFileExtractionService::clear() {
+	m_sourceFiles.clear();
+	m_files.clear();
+}
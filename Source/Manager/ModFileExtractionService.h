@@ -0,0 +1,75 @@
+#ifndef _MOD_FILE_EXTRACTION_SERVICE_H_
+#define _MOD_FILE_EXTRACTION_SERVICE_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+class ModFileExtractionService final {
+public:
+	struct ExtractedFile {
+		std::string fileName;
+		std::string sha1;
+	};
+
+	using ProgressCallback = std::function<void(size_t /* fileNumber */, size_t /* numberOfFiles */, const std::string & /* fileName */, bool /* extracted */)>;
+
+	ModFileExtractionService(size_t numberOfThreads = 0);
+	~ModFileExtractionService();
+
+	size_t getNumberOfThreads() const;
+	size_t numberOfSourceFiles() const;
+	size_t numberOfFiles() const;
+	uint64_t getTotalFileSize() const;
+	bool hasFile(const std::string & fileName) const;
+	std::vector<std::string> getFileNames() const;
+	// indexes the files contained within a group or zip archive without loading their data, files from later sources override files with the same name from earlier sources
+	bool addSourceFile(const std::string & sourceFilePath);
+	bool removeFile(const std::string & fileName);
+	// identifies the source content of a file without extracting it, the key only changes when the source file or the location of the file within it changes
+	std::string getFileSourceKey(const std::string & fileName);
+	// progress is always reported on the calling thread, returns the files which were successfully extracted in index order
+	// SHA1 hashes are optionally computed from the file data as it is extracted, so that extracted files never need to be read back
+	std::vector<ExtractedFile> extractFiles(const std::string & directoryPath, bool computeSHA1 = false, const ProgressCallback & progressCallback = nullptr) const;
+	void clear();
+
+	static constexpr size_t STREAM_BUFFER_SIZE = 64 * 1024;
+	// hashed files are held in memory in full, so the combined size of files being hashed at once is limited
+	static constexpr uint64_t MAXIMUM_NUMBER_OF_HASHING_BYTES = 256 * 1024 * 1024;
+
+private:
+	struct FileNameComparator {
+	public:
+		bool operator () (const std::string & fileNameA, const std::string & fileNameB) const;
+	};
+
+	struct FileEntry {
+		std::string fileName;
+		size_t sourceIndex;
+		size_t zipArchiveEntryIndex;
+		uint64_t dataOffset;
+		uint64_t fileSize;
+	};
+
+	struct SourceFile {
+		std::string filePath;
+		bool zipArchive;
+		std::string sha1;
+	};
+
+	bool addGroupFile(size_t sourceIndex);
+	bool addZipArchive(size_t sourceIndex);
+
+	size_t m_numberOfThreads;
+	std::vector<SourceFile> m_sourceFiles;
+	std::map<std::string, FileEntry, FileNameComparator> m_files;
+
+	ModFileExtractionService(const ModFileExtractionService &) = delete;
+	ModFileExtractionService(ModFileExtractionService &&) noexcept = delete;
+	const ModFileExtractionService & operator = (const ModFileExtractionService &) = delete;
+	const ModFileExtractionService & operator = (ModFileExtractionService &&) noexcept = delete;
+};
+
+#endif // _MOD_FILE_EXTRACTION_SERVICE_H_
@@ -3,6 +3,7 @@
 #include "DOSBox/DOSBoxManager.h"
 #include "DOSBox/DOSBoxVersion.h"
 #include "DOSBox/Configuration/DOSBoxConfiguration.h"
+#include "Download/CachedFile.h"
 #include "Download/CachedPackageFile.h"
 #include "Download/DownloadCache.h"
 #include "Download/DownloadManager.h"
@@ -16,30 +17,46 @@
 #include "Game/File/Group/GroupUtilities.h"
 #include "Game/File/Group/GRP/GroupGRP.h"
 #include "Game/File/Map/Map.h"
+#include "DirectorySnapshotService.h"
+#include "DirectoryWatcher.h"
+#include "FileFingerprintCache.h"
+#include "FileHashService.h"
+#include "FileStagingService.h"
 #include "InstalledModInfo.h"
+#include "LaunchPlan.h"
+#include "LaunchStagingService.h"
+#include "ModFileExtractionService.h"
 #include "Manager/ModMatch.h"
 #include "Mod/Mod.h"
 #include "Mod/ModAuthorInformation.h"
 #include "Mod/ModCollection.h"
+#include "Mod/ModCollectionDelta.h"
+#include "Mod/ModDependencyGraph.h"
 #include "Mod/ModDownload.h"
 #include "Mod/ModFile.h"
 #include "Mod/ModGameVersion.h"
 #include "Mod/ModIdentifier.h"
 #include "Mod/ModImage.h"
 #include "Mod/ModScreenshot.h"
+#include "Mod/ModSearchIndex.h"
 #include "Mod/ModVersion.h"
 #include "Mod/ModVersionType.h"
 #include "Mod/FavouriteModCollection.h"
+#include "Mod/BKTree.h"
+#include "Mod/InternedString.h"
 #include "Mod/OrganizedModCollection.h"
 #include "Mod/StandAloneMod.h"
 #include "Mod/StandAloneModCollection.h"
+#include "PhaseProfiler.h"
 #include "SettingsManager.h"
+#include "TaskGraph.h"
 #include "Project.h"
 
 #include <Analytics/Segment/SegmentAnalytics.h>
 #include <Archive/ArchiveFactoryRegistry.h>
 #include <Archive/Zip/ZipArchive.h>
 #include <Arguments/ArgumentParser.h>
+#include <ByteBuffer.h>
 #include <LibraryInformation.h>
 #include <Location/GeoLocationService.h>
 #include <Network/HTTPRequest.h>
@@ -62,6 +79,8 @@
 #include <gcem.hpp>
 #include <jdksmidi/version.h>
 #include <magic_enum/magic_enum.hpp>
+#include <rapidjson/document.h>
+#include <rapidjson/istreamwrapper.h>
 #include <sndfile.h>
 #include <spdlog/spdlog.h>
 #include <tinyxml2.h>
@@ -71,15 +90,20 @@
 #include <errno.h>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <optional>
 #include <regex>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 
 using namespace std::chrono_literals;
 
 static constexpr uint8_t NUMBER_OF_INITIALIZATION_STEPS = 16;
+static constexpr size_t MAXIMUM_NUMBER_OF_FUZZY_SEARCH_MATCHES = 10;
 
 const GameType ModManager::DEFAULT_GAME_TYPE = GameType::Game;
 const std::string ModManager::DEFAULT_PREFERRED_DOSBOX_VERSION_ID(DOSBoxVersion::DOSBOX.getID());
@@ -182,6 +206,21 @@ static std::string filePathsToFileNameList(const std::vector<std::string> & file
 	return fileNames.str();
 }
 
+static bool isModVersionTypeDependencyOf(const ModVersionType & dependency, const ModVersionType & modVersionType, const ModDependencyGraph & modDependencyGraph) {
+	if(dependency.isDependencyOf(modVersionType)) {
+		return true;
+	}
+
+	return modDependencyGraph.hasNode(dependency) && modDependencyGraph.hasNode(modVersionType) && modDependencyGraph.isDependencyOf(dependency, modVersionType, true);
+}
+
+static bool isModFileReadFromGroup(const GameVersion * gameVersion, const ModFile & modFile) {
+	return gameVersion != nullptr &&
+		   gameVersion->areScriptFilesReadFromGroup() &&
+		   !Utilities::areStringsEqualIgnoreCase(modFile.getType(), "zip") &&
+		   !Utilities::areStringsEqualIgnoreCase(modFile.getType(), "grp");
+}
+
 ModManager::ModManager()
 	: Application()
 	, m_initialized(false)
@@ -190,6 +229,7 @@ ModManager::ModManager()
 	, m_argumentHandlingFailed(false)
 	, m_shouldRunSelectedMod(false)
 	, m_demoRecordingEnabled(false)
+	, m_planningLaunch(false)
 	, m_selectedModVersionIndex(std::numeric_limits<size_t>::max())
 	, m_selectedModVersionTypeIndex(std::numeric_limits<size_t>::max())
 	, m_selectedModGameVersionIndex(std::numeric_limits<size_t>::max())
@@ -200,7 +240,13 @@ ModManager::ModManager()
 	, m_standAloneMods(std::make_shared<StandAloneModCollection>())
 	, m_favouriteMods(std::make_shared<FavouriteModCollection>())
 	, m_organizedMods(std::make_shared<OrganizedModCollection>(m_mods, m_favouriteMods, m_gameManager->getGameVersions()))
-	, m_initializationStep(0) {
+	, m_directorySnapshotService(std::make_unique<DirectorySnapshotService>())
+	, m_fileStagingService(std::make_unique<FileStagingService>())
+	, m_phaseProfiler(std::make_unique<PhaseProfiler>())
+	, m_launchStagingService(std::make_unique<LaunchStagingService>())
+	, m_integrityVerificationCancelled(false)
+	, m_initializationStep(0)
+	, m_initializationAborted(false) {
 	assignPlatformFactories();
 
 	FactoryRegistry & factoryRegistry = FactoryRegistry::getInstance();
@@ -230,15 +276,22 @@ ModManager::ModManager()
 }
 
 ModManager::~ModManager() {
+	cancelIntegrityVerification();
+
+	m_launchStagingConnections.disconnect();
+	m_launchStagingService->cancel();
+
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
 	m_selectedModChangedConnection.disconnect();
 	m_selectedFavouriteModChangedConnection.disconnect();
+	m_watchedDirectoriesChangedConnection.disconnect();
 	m_dosboxVersionCollectionSizeChangedConnection.disconnect();
 	m_dosboxVersionCollectionItemModifiedConnection.disconnect();
 	m_gameVersionCollectionSizeChangedConnection.disconnect();
 	m_gameVersionCollectionItemModifiedConnection.disconnect();
 
+	DirectoryWatcher::destroyInstance();
 	SegmentAnalytics::destroyInstance();
 }
 
@@ -255,7 +308,12 @@ uint8_t ModManager::numberOfInitializationSteps() const {
 }
 
 bool ModManager::notifyInitializationProgress(const std::string & description, bool * aborted) {
-	if(!*initializationProgress(m_initializationStep++, NUMBER_OF_INITIALIZATION_STEPS, description)) {
+	std::lock_guard<std::mutex> lock(m_initializationProgressMutex);
+
+	// initialization steps can run concurrently, so any step still in progress after an abort is also told to stop
+	if(m_initializationAborted || !*initializationProgress(m_initializationStep++, NUMBER_OF_INITIALIZATION_STEPS, description)) {
+		m_initializationAborted = true;
+
 		if(aborted != nullptr) {
 			*aborted = true;
 		}
@@ -300,15 +358,18 @@ bool ModManager::initialize(int argc, char * argv[], bool * aborted) {
 }
 
 bool ModManager::initialize(std::shared_ptr<ArgumentParser> arguments, bool * aborted) {
-	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+	std::unique_lock<std::recursive_mutex> lock(m_mutex);
 
 	if(m_initialized || m_initializing) {
 		return false;
 	}
 
 	std::chrono::time_point<std::chrono::steady_clock> initializeSteadyStartTimePoint(std::chrono::steady_clock::now());
+	PhaseProfiler::Span initializationSpan(m_phaseProfiler->beginPhase("Initialization"));
+	PhaseProfiler::Span initializationStepSpan(initializationSpan.beginChildPhase("Parsing Arguments"));
 	m_initializing = true;
 	m_initializationStep = 0;
+	m_initializationAborted = false;
 	m_argumentHandlingFailed = false;
 
 	if(!notifyInitializationProgress("Parsing Arguments", aborted)) {
@@ -331,6 +392,8 @@ bool ModManager::initialize(std::shared_ptr<ArgumentParser> arguments, bool * ab
 		}
 	}
 
+	initializationStepSpan.beginNextPhase("Loading Settings");
+
 	if(!notifyInitializationProgress("Loading Settings", aborted)) {
 		m_initializing = false;
 		return false;
@@ -342,6 +405,8 @@ bool ModManager::initialize(std::shared_ptr<ArgumentParser> arguments, bool * ab
 		settings->load(m_arguments.get());
 	}
 
+	FileFingerprintCache::getInstance()->load();
+
 	if(settings->localMode && !localModeSet) {
 		m_localMode = true;
 	}
@@ -352,272 +417,338 @@ bool ModManager::initialize(std::shared_ptr<ArgumentParser> arguments, bool * ab
 
 	bool skipFileInfoValidation = m_localMode && m_arguments != nullptr && (m_arguments->hasArgument("skip-file-info-validation") || m_arguments->hasArgument("update-new") || m_arguments->hasArgument("update-all"));
 
-	if(!notifyInitializationProgress("Initializing HTTP Service", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+	SegmentAnalytics * segmentAnalytics = SegmentAnalytics::getInstance();
+
+	initializationStepSpan.end();
+
+	// independent steps run concurrently, the only ordering constraints are the declared task dependencies
+	TaskGraph initializationGraph;
 
-	HTTPConfiguration configuration = {
-		Utilities::joinPaths(settings->dataDirectoryPath, settings->curlDataDirectoryName),
-		settings->apiBaseURL,
-		settings->connectionTimeout,
-		settings->networkTimeout,
-		settings->transferTimeout
+	auto addInitializationTask = [&initializationGraph, &initializationSpan](const std::string & taskName, std::function<bool()> function, const std::vector<std::string> & dependencies = {}) {
+		return initializationGraph.addTask(taskName, [&initializationSpan, taskName, function]() {
+			PhaseProfiler::Span taskSpan(initializationSpan.beginChildPhase(taskName));
+
+			return function();
+		}, dependencies);
 	};
 
-	HTTPService * httpService = HTTPService::getInstance();
+	bool certificateAuthorityStoreUpdated = false;
 
-	if(!httpService->initialize(configuration)) {
-		spdlog::error("Failed to initialize HTTP service!");
-		m_initializing = false;
-		return false;
-	}
+	addInitializationTask("HTTP Service", [this, settings, aborted, &certificateAuthorityStoreUpdated]() {
+		if(!notifyInitializationProgress("Initializing HTTP Service", aborted)) {
+			return false;
+		}
 
-	httpService->setUserAgent(HTTP_USER_AGENT);
-	httpService->setVerboseLoggingEnabled(settings->verboseRequestLogging);
+		HTTPConfiguration configuration = {
+			Utilities::joinPaths(settings->dataDirectoryPath, settings->curlDataDirectoryName),
+			settings->apiBaseURL,
+			settings->connectionTimeout,
+			settings->networkTimeout,
+			settings->transferTimeout
+		};
 
-	if(!settings->downloadThrottlingEnabled || !settings->cacertLastDownloadedTimestamp.has_value() || std::chrono::system_clock::now() - settings->cacertLastDownloadedTimestamp.value() > settings->cacertUpdateFrequency) {
-		if(httpService->updateCertificateAuthorityCertificateStoreFileAndWait()) {
-			settings->cacertLastDownloadedTimestamp = std::chrono::system_clock::now();
-			settings->save();
+		HTTPService * httpService = HTTPService::getInstance();
+
+		if(!httpService->initialize(configuration)) {
+			spdlog::error("Failed to initialize HTTP service!");
+			return false;
 		}
-	}
 
-	if(!notifyInitializationProgress("Initializing Time Zone Data Manager", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		httpService->setUserAgent(HTTP_USER_AGENT);
+		httpService->setVerboseLoggingEnabled(settings->verboseRequestLogging);
 
-	TimeZoneDataManager * timeZoneDataManager = TimeZoneDataManager::getInstance();
+		if(!settings->downloadThrottlingEnabled || !settings->cacertLastDownloadedTimestamp.has_value() || std::chrono::system_clock::now() - settings->cacertLastDownloadedTimestamp.value() > settings->cacertUpdateFrequency) {
+			certificateAuthorityStoreUpdated = httpService->updateCertificateAuthorityCertificateStoreFileAndWait();
+		}
+
+		return true;
+	});
 
-	if(timeZoneDataManager->isSupported()) {
-		bool timeZoneDataUpdated = false;
-		bool shouldUpdateTimeZoneData = !settings->downloadThrottlingEnabled || !settings->timeZoneDataLastDownloadedTimestamp.has_value() || std::chrono::system_clock::now() - settings->timeZoneDataLastDownloadedTimestamp.value() > settings->timeZoneDataUpdateFrequency;
+	bool timeZoneDataUpdated = false;
 
-		if(!TimeZoneDataManager::getInstance()->initialize(Utilities::joinPaths(settings->dataDirectoryPath, settings->timeZoneDataDirectoryName), settings->fileETags, shouldUpdateTimeZoneData, false, &timeZoneDataUpdated)) {
-			spdlog::error("Failed to initialize time zone data manager!");
-			m_initializing = false;
+	addInitializationTask("Time Zone Data Manager", [this, settings, aborted, &timeZoneDataUpdated]() {
+		if(!notifyInitializationProgress("Initializing Time Zone Data Manager", aborted)) {
 			return false;
 		}
 
-		if(timeZoneDataUpdated) {
-			settings->timeZoneDataLastDownloadedTimestamp = std::chrono::system_clock::now();
-			settings->save();
+		TimeZoneDataManager * timeZoneDataManager = TimeZoneDataManager::getInstance();
+
+		if(timeZoneDataManager->isSupported()) {
+			bool shouldUpdateTimeZoneData = !settings->downloadThrottlingEnabled || !settings->timeZoneDataLastDownloadedTimestamp.has_value() || std::chrono::system_clock::now() - settings->timeZoneDataLastDownloadedTimestamp.value() > settings->timeZoneDataUpdateFrequency;
+
+			if(!TimeZoneDataManager::getInstance()->initialize(Utilities::joinPaths(settings->dataDirectoryPath, settings->timeZoneDataDirectoryName), settings->fileETags, shouldUpdateTimeZoneData, false, &timeZoneDataUpdated)) {
+				spdlog::error("Failed to initialize time zone data manager!");
+				return false;
+			}
 		}
-	}
 
-	if(!notifyInitializationProgress("Initializing Geo Location Service", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		return true;
+	}, {"HTTP Service"});
 
-	GeoLocationService * geoLocationService = GeoLocationService::getInstance();
+	addInitializationTask("Geo Location Service", [this, aborted]() {
+		if(!notifyInitializationProgress("Initializing Geo Location Service", aborted)) {
+			return false;
+		}
 
-	if(!geoLocationService->initialize(FREE_GEO_IP_API_KEY)) {
-		spdlog::error("Failed to initialize geo location service!");
-		m_initializing = false;
-		return false;
-	}
+		GeoLocationService * geoLocationService = GeoLocationService::getInstance();
 
-	if(!notifyInitializationProgress("Initializing Segment Analytics", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		if(!geoLocationService->initialize(FREE_GEO_IP_API_KEY)) {
+			spdlog::error("Failed to initialize geo location service!");
+			return false;
+		}
 
-	SegmentAnalytics * segmentAnalytics = SegmentAnalytics::getInstance();
+		return true;
+	}, {"HTTP Service"});
 
-	if(settings->segmentAnalyticsEnabled) {
-		SegmentAnalytics::Configuration configuration;
-		configuration.writeKey = SEGMENT_ANALYTICS_WRITE_KEY;
-		configuration.includeIPAddress = false;
-		configuration.includeGeoLocation = true;
-		configuration.dataStorageFilePath = Utilities::joinPaths(settings->cacheDirectoryPath, settings->segmentAnalyticsDataFileName);
-		configuration.applicationName = "Duke Nukem 3D Mod Manager";
-		configuration.applicationVersion = APPLICATION_VERSION;
-		configuration.applicationBuild = APPLICATION_COMMIT_HASH;
-		configuration.applicationPackageName = Utilities::emptyString;
-		configuration.userAgent = HTTP_USER_AGENT;
-
-		if(segmentAnalytics->initialize(configuration)) {
-			if(segmentAnalytics->start()) {
-				spdlog::debug("Segment analytics initialized and started successfully!");
+	addInitializationTask("Segment Analytics", [this, settings, segmentAnalytics, aborted]() {
+		if(!notifyInitializationProgress("Initializing Segment Analytics", aborted)) {
+			return false;
+		}
+
+		if(settings->segmentAnalyticsEnabled) {
+			SegmentAnalytics::Configuration configuration;
+			configuration.writeKey = SEGMENT_ANALYTICS_WRITE_KEY;
+			configuration.includeIPAddress = false;
+			configuration.includeGeoLocation = true;
+			configuration.dataStorageFilePath = Utilities::joinPaths(settings->cacheDirectoryPath, settings->segmentAnalyticsDataFileName);
+			configuration.applicationName = "Duke Nukem 3D Mod Manager";
+			configuration.applicationVersion = APPLICATION_VERSION;
+			configuration.applicationBuild = APPLICATION_COMMIT_HASH;
+			configuration.applicationPackageName = Utilities::emptyString;
+			configuration.userAgent = HTTP_USER_AGENT;
+
+			if(segmentAnalytics->initialize(configuration)) {
+				if(segmentAnalytics->start()) {
+					spdlog::debug("Segment analytics initialized and started successfully!");
+				}
+				else {
+					spdlog::error("Failed to start Segment analytics!");
+				}
 			}
 			else {
-				spdlog::error("Failed to start Segment analytics!");
+				spdlog::error("Failed to initialize Segment analytics!");
 			}
 		}
-		else {
-			spdlog::error("Failed to initialize Segment analytics!");
+
+		return true;
+	}, {"Time Zone Data Manager", "Geo Location Service"});
+
+	addInitializationTask("DOSBox Command Script Files", [this, aborted]() {
+		if(!notifyInitializationProgress("Creating DOSBox Command Script Files", aborted)) {
+			return false;
 		}
-	}
 
-	if(!notifyInitializationProgress("Creating DOSBox Command Script Files", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		createDOSBoxTemplateCommandScriptFiles();
 
-	createDOSBoxTemplateCommandScriptFiles();
+		return true;
+	});
 
-	if(!notifyInitializationProgress("Locating Existing Duke Nukem 3D Game Installations", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+	addInitializationTask("Game Locator", [this, aborted]() {
+		if(!notifyInitializationProgress("Locating Existing Duke Nukem 3D Game Installations", aborted)) {
+			return false;
+		}
 
-	GameLocator::getInstance()->locateGames();
+		GameLocator::getInstance()->locateGames();
 
-	if(!notifyInitializationProgress("Initializing Mod Download Manager", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		return true;
+	});
 
-	if(!m_localMode) {
-		m_downloadManager = std::make_shared<DownloadManager>();
+	addInitializationTask("Mod Download Manager", [this, aborted]() {
+		if(!notifyInitializationProgress("Initializing Mod Download Manager", aborted)) {
+			return false;
+		}
+
+		if(!m_localMode) {
+			m_downloadManager = std::make_shared<DownloadManager>();
+
+			if(!m_downloadManager->initialize()) {
+				spdlog::error("Failed to initialize download manager!");
+				return false;
+			}
+
+			m_organizedMods->setDownloadManager(m_downloadManager);
+		}
+
+		return true;
+	}, {"HTTP Service"});
 
-		if(!m_downloadManager->initialize()) {
-			spdlog::error("Failed to initialize download manager!");
-			m_initializing = false;
+	// the DOSBox manager and game manager update the file ETags stored in the settings and save them, so they only run once every other task which writes to the settings has finished
+	addInitializationTask("DOSBox Manager", [this, settings, aborted]() {
+		if(!notifyInitializationProgress("Initializing DOSBox Manager", aborted)) {
 			return false;
 		}
 
-		m_organizedMods->setDownloadManager(m_downloadManager);
-	}
+		if(!m_dosboxManager->initialize()) {
+			spdlog::error("Failed to initialize DOSBox manager!");
+			return false;
+		}
 
-	if(!notifyInitializationProgress("Initializing DOSBox Manager", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		std::shared_ptr<DOSBoxVersionCollection> dosboxVersions(getDOSBoxVersions());
 
-	if(!m_dosboxManager->initialize()) {
-		spdlog::error("Failed to initialize DOSBox manager!");
-		m_initializing = false;
-		return false;
-	}
+		m_preferredDOSBoxVersion = dosboxVersions->getDOSBoxVersionWithID(settings->preferredDOSBoxVersionID);
 
-	std::shared_ptr<DOSBoxVersionCollection> dosboxVersions(getDOSBoxVersions());
+		if(m_preferredDOSBoxVersion == nullptr) {
+			m_preferredDOSBoxVersion = dosboxVersions->getDOSBoxVersion(0);
 
-	m_preferredDOSBoxVersion = dosboxVersions->getDOSBoxVersionWithID(settings->preferredDOSBoxVersionID);
+			spdlog::warn("DOSBox configuration for version with ID '{}' is missing, changing preferred DOSBox version to '{}'.", settings->preferredDOSBoxVersionID, m_preferredDOSBoxVersion->getLongName());
 
-	if(m_preferredDOSBoxVersion == nullptr) {
-		m_preferredDOSBoxVersion = dosboxVersions->getDOSBoxVersion(0);
+			settings->preferredDOSBoxVersionID = m_preferredDOSBoxVersion->getID();
+		}
 
-		spdlog::warn("DOSBox configuration for version with ID '{}' is missing, changing preferred DOSBox version to '{}'.", settings->preferredDOSBoxVersionID, m_preferredDOSBoxVersion->getLongName());
+		m_dosboxVersionCollectionSizeChangedConnection = dosboxVersions->sizeChanged.connect(std::bind(&ModManager::onDOSBoxVersionCollectionSizeChanged, this, std::placeholders::_1));
+		m_dosboxVersionCollectionItemModifiedConnection = dosboxVersions->itemModified.connect(std::bind(&ModManager::onDOSBoxVersionCollectionItemModified, this, std::placeholders::_1, std::placeholders::_2));
 
-		settings->preferredDOSBoxVersionID = m_preferredDOSBoxVersion->getID();
-	}
+		return true;
+	}, {"Time Zone Data Manager", "Mod Download Manager"});
 
-	m_dosboxVersionCollectionSizeChangedConnection = dosboxVersions->sizeChanged.connect(std::bind(&ModManager::onDOSBoxVersionCollectionSizeChanged, this, std::placeholders::_1));
-	m_dosboxVersionCollectionItemModifiedConnection = dosboxVersions->itemModified.connect(std::bind(&ModManager::onDOSBoxVersionCollectionItemModified, this, std::placeholders::_1, std::placeholders::_2));
+	addInitializationTask("Game Manager", [this, settings, aborted]() {
+		if(!notifyInitializationProgress("Initializing Game Manager", aborted)) {
+			return false;
+		}
 
-	if(!notifyInitializationProgress("Initializing Game Manager", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		if(!m_gameManager->initialize()) {
+			spdlog::error("Failed to initialize game manager!");
+			return false;
+		}
 
-	if(!m_gameManager->initialize()) {
-		spdlog::error("Failed to initialize game manager!");
-		m_initializing = false;
-		return false;
-	}
+		std::shared_ptr<GameVersionCollection> gameVersions(getGameVersions());
 
-	std::shared_ptr<GameVersionCollection> gameVersions(getGameVersions());
+		m_preferredGameVersion = gameVersions->getGameVersionWithID(settings->preferredGameVersionID);
 
-	m_preferredGameVersion = gameVersions->getGameVersionWithID(settings->preferredGameVersionID);
+		if(m_preferredGameVersion == nullptr) {
+			m_preferredGameVersion = gameVersions->getGameVersion(0);
 
-	if(m_preferredGameVersion == nullptr) {
-		m_preferredGameVersion = gameVersions->getGameVersion(0);
+			spdlog::warn("Game configuration for game version '{}' is missing, changing preferred game version to '{}'.", getGameVersions()->getLongNameOfGameVersionWithID(settings->preferredGameVersionID), m_preferredGameVersion->getLongName());
 
-		spdlog::warn("Game configuration for game version '{}' is missing, changing preferred game version to '{}'.", getGameVersions()->getLongNameOfGameVersionWithID(settings->preferredGameVersionID), m_preferredGameVersion->getLongName());
+			settings->preferredGameVersionID = m_preferredGameVersion->getID();
+		}
 
-		settings->preferredGameVersionID = m_preferredGameVersion->getID();
-	}
+		m_gameManager->updateGroupFileSymlinks();
 
-	m_gameManager->updateGroupFileSymlinks();
+		m_gameVersionCollectionSizeChangedConnection = gameVersions->sizeChanged.connect(std::bind(&ModManager::onGameVersionCollectionSizeChanged, this, std::placeholders::_1));
+		m_gameVersionCollectionItemModifiedConnection = gameVersions->itemModified.connect(std::bind(&ModManager::onGameVersionCollectionItemModified, this, std::placeholders::_1, std::placeholders::_2));
 
-	m_gameVersionCollectionSizeChangedConnection = gameVersions->sizeChanged.connect(std::bind(&ModManager::onGameVersionCollectionSizeChanged, this, std::placeholders::_1));
-	m_gameVersionCollectionItemModifiedConnection = gameVersions->itemModified.connect(std::bind(&ModManager::onGameVersionCollectionItemModified, this, std::placeholders::_1, std::placeholders::_2));
+		std::string generalDOSBoxConfigurationFilePath(getGeneralDOSBoxConfigurationFilePath());
 
-	std::string generalDOSBoxConfigurationFilePath(getGeneralDOSBoxConfigurationFilePath());
+		if(generalDOSBoxConfigurationFilePath.empty()) {
+			spdlog::error("Failed to load general DOSBox configuration file!");
+			return false;
+		}
 
-	if(generalDOSBoxConfigurationFilePath.empty()) {
-		spdlog::error("Failed to load general DOSBox configuration file!");
-		m_initializing = false;
-		return false;
-	}
+		m_generalDOSBoxConfiguration->setFilePath(generalDOSBoxConfigurationFilePath);
+
+		if(std::filesystem::is_regular_file(std::filesystem::path(generalDOSBoxConfigurationFilePath))) {
+			std::unique_ptr<DOSBoxConfiguration> generalDOSBoxConfiguration(DOSBoxConfiguration::loadFrom(generalDOSBoxConfigurationFilePath));
+
+			if(generalDOSBoxConfiguration == nullptr) {
+				spdlog::error("Failed to load general DOSBox configuration from file: '{}'.", generalDOSBoxConfigurationFilePath);
+				return false;
+			}
+
+			*m_generalDOSBoxConfiguration = std::move(*generalDOSBoxConfiguration);
+			m_generalDOSBoxConfiguration->setModified(false);
 
-	m_generalDOSBoxConfiguration->setFilePath(generalDOSBoxConfigurationFilePath);
+			size_t sectionCount = m_generalDOSBoxConfiguration->numberOfSections();
+			size_t totalEntryCount = m_generalDOSBoxConfiguration->totalNumberOfEntries();
+
+			spdlog::info("Loaded general DOSBox configuration file with {} section{} and {} {}.", sectionCount, sectionCount == 1 ? "" : "s", totalEntryCount, totalEntryCount == 1 ? "entry" : "entries");
+		}
 
-	if(std::filesystem::is_regular_file(std::filesystem::path(generalDOSBoxConfigurationFilePath))) {
-		std::unique_ptr<DOSBoxConfiguration> generalDOSBoxConfiguration(DOSBoxConfiguration::loadFrom(generalDOSBoxConfigurationFilePath));
+		return true;
+	}, {"DOSBox Manager", "Game Locator"});
 
-		if(generalDOSBoxConfiguration == nullptr) {
-			spdlog::error("Failed to load general DOSBox configuration from file: '{}'.", generalDOSBoxConfigurationFilePath);
-			m_initializing = false;
+	addInitializationTask("Mod List", [this, skipFileInfoValidation, aborted]() {
+		if(!notifyInitializationProgress("Loading Mod List", aborted)) {
 			return false;
 		}
 
-		*m_generalDOSBoxConfiguration = std::move(*generalDOSBoxConfiguration);
-		m_generalDOSBoxConfiguration->setModified(false);
+		if(!m_mods->loadFrom(getModsListFilePath(), getGameVersions().get(), skipFileInfoValidation)) {
+			spdlog::error("Failed to load mod list '{}'!", getModsListFilePath());
+			return false;
+		}
 
-		size_t sectionCount = m_generalDOSBoxConfiguration->numberOfSections();
-		size_t totalEntryCount = m_generalDOSBoxConfiguration->totalNumberOfEntries();
+		if(m_mods->numberOfMods() == 0) {
+			spdlog::error("No mods loaded!");
+			return false;
+		}
 
-		spdlog::info("Loaded general DOSBox configuration file with {} section{} and {} {}.", sectionCount, sectionCount == 1 ? "" : "s", totalEntryCount, totalEntryCount == 1 ? "entry" : "entries");
-	}
+		if(!m_mods->checkGameVersions(*getGameVersions())) {
+			spdlog::error("Found at least one invalid or missing game version.");
+			return false;
+		}
 
-	if(!notifyInitializationProgress("Loading Mod List", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		spdlog::info("Loaded {} mod{} from '{}'.", m_mods->numberOfMods(), m_mods->numberOfMods() == 1 ? "" : "s", getModsListFilePath());
 
-	if(!m_mods->loadFrom(getModsListFilePath(), getGameVersions().get(), skipFileInfoValidation)) {
-		spdlog::error("Failed to load mod list '{}'!", getModsListFilePath());
-		m_initializing = false;
-		return false;
-	}
+		return true;
+	}, {"Mod Download Manager", "Game Manager"});
 
-	if(m_mods->numberOfMods() == 0) {
-		spdlog::error("No mods loaded!");
-		m_initializing = false;
-		return false;
-	}
+	addInitializationTask("Stand-Alone Mod List", [this, settings, aborted]() {
+		if(!notifyInitializationProgress("Loading Installed Stand-Alone Mod List", aborted)) {
+			return false;
+		}
 
-	if(!m_mods->checkGameVersions(*getGameVersions())) {
-		spdlog::error("Found at least one invalid or missing game version.");
-		m_initializing = false;
-		return false;
-	}
+		m_standAloneMods->loadFrom(settings->standAloneModsListFilePath);
 
-	spdlog::info("Loaded {} mod{} from '{}'.", m_mods->numberOfMods(), m_mods->numberOfMods() == 1 ? "" : "s", getModsListFilePath());
+		if(m_standAloneMods->numberOfStandAloneMods() != 0) {
+			spdlog::info("Loaded {} installed stand-alone mod configuration{} from '{}'.", m_standAloneMods->numberOfStandAloneMods(), m_standAloneMods->numberOfStandAloneMods() == 1 ? "" : "s", settings->standAloneModsListFilePath);
+		}
 
-	if(!notifyInitializationProgress("Loading Installed Stand-Alone Mod List", aborted)) {
-		m_initializing = false;
-		return false;
-	}
+		return true;
+	});
 
-	m_standAloneMods->loadFrom(settings->standAloneModsListFilePath);
+	addInitializationTask("Favourite Mod List", [this, settings, aborted]() {
+		if(!notifyInitializationProgress("Loading Favourite Mod List", aborted)) {
+			return false;
+		}
 
-	if(m_standAloneMods->numberOfStandAloneMods() != 0) {
-		spdlog::info("Loaded {} installed stand-alone mod configuration{} from '{}'.", m_standAloneMods->numberOfStandAloneMods(), m_standAloneMods->numberOfStandAloneMods() == 1 ? "" : "s", settings->standAloneModsListFilePath);
-	}
+		m_favouriteMods->loadFrom(settings->favouriteModsListFilePath);
+		m_favouriteMods->checkForMissingFavouriteMods(*m_mods);
+
+		if(m_favouriteMods->numberOfFavourites() != 0) {
+			spdlog::info("Loaded {} favourite mod{} from '{}'.", m_favouriteMods->numberOfFavourites(), m_favouriteMods->numberOfFavourites() == 1 ? "" : "s", settings->favouriteModsListFilePath);
+		}
+
+		return true;
+	}, {"Mod List"});
 
-	if(!notifyInitializationProgress("Loading Favourite Mod List", aborted)) {
+	addInitializationTask("Organize Mods", [this, aborted]() {
+		if(!notifyInitializationProgress("Organizing Mods", aborted)) {
+			return false;
+		}
+
+		m_organizedMods->organize();
+
+		return true;
+	}, {"Favourite Mod List", "Stand-Alone Mod List"});
+
+	// the tasks use the regular locking accessors, re-entry is already prevented by the initializing flag
+	lock.unlock();
+
+	bool initializationGraphSucceeded = initializationGraph.run();
+
+	lock.lock();
+
+	if(!initializationGraphSucceeded) {
 		m_initializing = false;
 		return false;
 	}
 
-	m_favouriteMods->loadFrom(settings->favouriteModsListFilePath);
-	m_favouriteMods->checkForMissingFavouriteMods(*m_mods);
+	initializationStepSpan = initializationSpan.beginChildPhase("Finalization");
 
-	if(m_favouriteMods->numberOfFavourites() != 0) {
-		spdlog::info("Loaded {} favourite mod{} from '{}'.", m_favouriteMods->numberOfFavourites(), m_favouriteMods->numberOfFavourites() == 1 ? "" : "s", settings->favouriteModsListFilePath);
+	// settings written by the initialization tasks are only updated and saved after all of them have completed
+	if(certificateAuthorityStoreUpdated) {
+		settings->cacertLastDownloadedTimestamp = std::chrono::system_clock::now();
 	}
 
-	if(!notifyInitializationProgress("Organizing Mods", aborted)) {
-		m_initializing = false;
-		return false;
+	if(timeZoneDataUpdated) {
+		settings->timeZoneDataLastDownloadedTimestamp = std::chrono::system_clock::now();
 	}
 
-	m_organizedMods->organize();
+	if(certificateAuthorityStoreUpdated || timeZoneDataUpdated) {
+		settings->save();
+	}
+
+	spdlog::info("Initialization steps took {} milliseconds in total, with a critical path of {} milliseconds through: {}.", initializationGraph.getTotalTaskDuration().count(), initializationGraph.getCriticalPathDuration().count(), initializationGraph.getCriticalPathAsString());
 
 	std::filesystem::path mapsDirectoryPath(getMapsDirectoryPath());
 
@@ -641,15 +772,20 @@ bool ModManager::initialize(std::shared_ptr<ArgumentParser> arguments, bool * ab
 		return false;
 	}
 
-	checkForMissingExecutables();
+	verifyIntegrity();
 
-	if(m_localMode) {
-		checkAllModsForMissingFiles();
+	watchModDirectories();
+
+	clearApplicationTemporaryDirectory();
+
+	initializationStepSpan.end();
+	initializationSpan.end();
 
-		checkForUnlinkedModFiles();
+	for(const std::string & summaryLine : m_phaseProfiler->getSummary(initializationSpan)) {
+		spdlog::debug(summaryLine);
 	}
 
-	clearApplicationTemporaryDirectory();
+	savePhaseProfileTrace();
 
 	std::chrono::milliseconds initializationDuration(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - initializeSteadyStartTimePoint));
 
@@ -716,9 +852,40 @@ bool ModManager::initialize(std::shared_ptr<ArgumentParser> arguments, bool * ab
 		segmentAnalytics->track("Application Initialized", properties);
 	}
 
+	m_launchStagingConnections = SignalConnectionGroup(
+		modSelectionChanged.connect([this](std::shared_ptr<Mod> mod, size_t modVersionIndex, size_t modVersionTypeIndex, size_t modGameVersionIndex) {
+			stageSelectedModLaunch();
+		}),
+		preferredGameVersionChanged.connect([this](std::shared_ptr<GameVersion> gameVersion) {
+			stageSelectedModLaunch();
+		}),
+		preferredDOSBoxVersionChanged.connect([this](std::shared_ptr<DOSBoxVersion> dosboxVersion) {
+			stageSelectedModLaunch();
+		})
+	);
+
 	if(!handleArguments(m_arguments.get())) {
 		m_argumentHandlingFailed = true;
 	}
+	else if(m_arguments != nullptr && m_arguments->hasArgument("plan")) {
+		m_shouldRunSelectedMod = false;
+
+		std::string launchPlanFilePath(m_arguments->getFirstValue("plan"));
+
+		if(launchPlanFilePath.empty()) {
+			spdlog::error("Missing launch plan file path argument value.");
+		}
+		else {
+			std::unique_ptr<LaunchPlan> launchPlan(createLaunchPlan());
+
+			if(launchPlan != nullptr && launchPlan->saveTo(launchPlanFilePath)) {
+				spdlog::info("Saved launch plan to file: '{}'.", launchPlanFilePath);
+			}
+			else {
+				spdlog::error("Failed to save launch plan to file: '{}'.", launchPlanFilePath);
+			}
+		}
+	}
 
 	notifyInitializationProgress("Initialization Complete");
 
@@ -732,6 +899,14 @@ bool ModManager::uninitialize() {
 		return false;
 	}
 
+	cancelIntegrityVerification();
+
+	m_launchStagingConnections.disconnect();
+	m_launchStagingService->cancel();
+
+	m_watchedDirectoriesChangedConnection.disconnect();
+	DirectoryWatcher::getInstance()->unwatchAllDirectories();
+
 	SettingsManager * settings = SettingsManager::getInstance();
 
 	settings->save(m_arguments.get());
@@ -764,11 +939,26 @@ bool ModManager::uninitialize() {
 		spdlog::error("Failed to save game version configurations to file: '{}'.", settings->gameVersionsListFilePath);
 	}
 
+	FileFingerprintCache * fileFingerprintCache = FileFingerprintCache::getInstance();
+
+	// drop fingerprints of files which no longer exist so that the cache does not grow without bound
+	size_t numberOfMissingFileFingerprints = fileFingerprintCache->removeMissingFiles();
+
+	if(numberOfMissingFileFingerprints != 0) {
+		spdlog::debug("Removed {} file fingerprint{} for missing files from cache.", numberOfMissingFileFingerprints, numberOfMissingFileFingerprints == 1 ? "" : "s");
+	}
+
+	if(fileFingerprintCache->isModified() && !fileFingerprintCache->save()) {
+		spdlog::error("Failed to save file fingerprint cache to file: '{}'.", fileFingerprintCache->getFilePath());
+	}
+
 	SegmentAnalytics * segmentAnalytics = SegmentAnalytics::getInstance();
 	segmentAnalytics->onApplicationClosed();
 	segmentAnalytics->flush(3s);
 
 	m_selectedMod.reset();
+	m_pendingDownloadStatusMod.reset();
+	m_pendingModListDelta.reset();
 	m_organizedMods->setModCollection(nullptr);
 	m_organizedMods->setFavouriteModCollection(nullptr);
 	m_organizedMods->setGameVersionCollection(nullptr);
@@ -785,41 +975,433 @@ bool ModManager::uninitialize() {
 	return true;
 }
 
-bool ModManager::isUsingLocalMode() const {
+bool ModManager::updateModList(bool force) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_localMode;
-}
+	std::unique_ptr<ModCollectionDelta> modListDelta(createModListDelta(force));
 
-bool ModManager::didArgumentHandlingFail() const {
-	return m_argumentHandlingFailed;
+	if(modListDelta == nullptr) {
+		return false;
+	}
+
+	return applyModListDelta(*modListDelta);
 }
 
-std::shared_ptr<ModCollection> ModManager::getMods() const {
+std::unique_ptr<ModCollectionDelta> ModManager::createModListDelta(bool force) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	return m_mods;
-}
+	if(!m_initialized) {
+		return nullptr;
+	}
 
-std::shared_ptr<StandAloneModCollection> ModManager::getStandAloneMods() const {
-	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+	if(!m_localMode) {
+		std::shared_ptr<CachedFile> previousCachedModListFile(m_downloadManager->getDownloadCache()->getCachedModListFile());
+		std::string previousModListSHA1(previousCachedModListFile == nullptr ? "" : previousCachedModListFile->getSHA1());
 
-	return m_standAloneMods;
-}
+		if(!m_downloadManager->downloadModList(force)) {
+			spdlog::error("Failed to download updated mod list.");
+			return nullptr;
+		}
 
-std::shared_ptr<FavouriteModCollection> ModManager::getFavouriteMods() const {
-	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+		std::shared_ptr<CachedFile> cachedModListFile(m_downloadManager->getDownloadCache()->getCachedModListFile());
 
-	return m_favouriteMods;
-}
+		if(!force && cachedModListFile != nullptr && Utilities::areStringsEqual(cachedModListFile->getSHA1(), previousModListSHA1)) {
+			return std::make_unique<ModCollectionDelta>();
+		}
+	}
 
-std::shared_ptr<OrganizedModCollection> ModManager::getOrganizedMods() const {
-	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+	ModCollection updatedMods;
 
-	return m_organizedMods;
+	if(!updatedMods.loadFrom(getModsListFilePath(), getGameVersions().get())) {
+		spdlog::error("Failed to load updated mod list '{}'!", getModsListFilePath());
+		return nullptr;
+	}
+
+	if(!updatedMods.checkGameVersions(*getGameVersions())) {
+		spdlog::error("Found at least one invalid or missing game version in updated mod list.");
+		return nullptr;
+	}
+
+	return std::make_unique<ModCollectionDelta>(ModCollectionDelta::create(*m_mods, updatedMods));
 }
 
-std::shared_ptr<DOSBoxConfiguration> ModManager::getGeneralDOSBoxConfiguration() const {
+bool ModManager::applyModListDelta(const ModCollectionDelta & modListDelta) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(modListDelta.isEmpty()) {
+		spdlog::info("Mod list is already up to date.");
+		return true;
+	}
+
+	// deltas can be applied after they were created, so make sure that the mod list has not been replaced in the meantime
+	if(modListDelta.getPreviousFileRevision() != m_mods->getFileRevision()) {
+		spdlog::error("Mod list delta was created against revision {}, but the current mod list revision is {}.", modListDelta.getPreviousFileRevision(), m_mods->getFileRevision());
+		return false;
+	}
+
+	std::chrono::time_point<std::chrono::steady_clock> updateStartTimePoint(std::chrono::steady_clock::now());
+
+	bool wasVerifyingIntegrity = isVerifyingIntegrity();
+
+	cancelIntegrityVerification();
+
+	if(!m_mods->applyDelta(modListDelta)) {
+		spdlog::error("Failed to apply updated mod list.");
+		return false;
+	}
+
+	if(wasVerifyingIntegrity) {
+		verifyIntegrity();
+	}
+
+	m_favouriteMods->checkForMissingFavouriteMods(*m_mods);
+
+	if(m_selectedMod != nullptr) {
+		std::shared_ptr<Mod> selectedMod(m_mods->getModWithID(m_selectedMod->getID()));
+
+		if(selectedMod == nullptr) {
+			clearSelectedMod();
+		}
+		else if(selectedMod != m_selectedMod) {
+			std::shared_ptr<ModVersion> selectedModVersion(getSelectedModVersion());
+			std::shared_ptr<ModVersionType> selectedModVersionType(getSelectedModVersionType());
+
+			if(selectedModVersion == nullptr || selectedModVersionType == nullptr || !setSelectedMod(selectedMod->getID(), selectedModVersion->getVersion(), selectedModVersionType->getType())) {
+				setSelectedMod(selectedMod);
+			}
+		}
+	}
+
+	std::chrono::microseconds updateDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - updateStartTimePoint));
+
+	spdlog::info("Updated mod list from revision {} to {} in {} ms with {} added, {} removed, {} changed and {} unchanged mod{}.", modListDelta.getPreviousFileRevision(), modListDelta.getFileRevision(), updateDuration.count() / 1000.0, modListDelta.numberOfAddedMods(), modListDelta.numberOfRemovedMods(), modListDelta.numberOfChangedMods(), modListDelta.numberOfUnchangedMods(), modListDelta.numberOfUnchangedMods() == 1 ? "" : "s");
+
+	return true;
+}
+
+bool ModManager::isVerifyingIntegrity() const {
+	std::lock_guard<std::mutex> lock(m_integrityVerificationMutex);
+
+	return m_integrityVerificationFuture.valid() && m_integrityVerificationFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+bool ModManager::verifyIntegrity() {
+	if(!m_initialized) {
+		return false;
+	}
+
+	cancelIntegrityVerification();
+
+	// the verification runs on a background thread without the global mutex, so it only ever reads from a snapshot taken here
+	IntegrityVerificationSnapshot snapshot;
+
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+		snapshot.mods = m_mods->getMods();
+		snapshot.modDependencyGraph = m_mods->getDependencyGraph();
+		snapshot.dosboxVersions = std::make_shared<DOSBoxVersionCollection>(*getDOSBoxVersions());
+		snapshot.gameVersions = std::make_shared<GameVersionCollection>(*getGameVersions());
+		snapshot.standAloneMods = std::make_shared<StandAloneModCollection>(*m_standAloneMods);
+		snapshot.modsDirectoryPath = SettingsManager::getInstance()->modsDirectoryPath;
+		snapshot.checkModFiles = m_localMode;
+	}
+
+	std::lock_guard<std::mutex> lock(m_integrityVerificationMutex);
+
+	m_modIDsWithMissingFiles.clear();
+	m_integrityVerificationCancelled = false;
+	m_integrityVerificationFuture = std::async(std::launch::async, &ModManager::runIntegrityVerification, this, std::move(snapshot));
+
+	return true;
+}
+
+void ModManager::cancelIntegrityVerification() {
+	std::future<void> integrityVerificationFuture;
+
+	{
+		std::lock_guard<std::mutex> lock(m_integrityVerificationMutex);
+
+		if(!m_integrityVerificationFuture.valid()) {
+			return;
+		}
+
+		m_integrityVerificationCancelled = true;
+		integrityVerificationFuture = std::move(m_integrityVerificationFuture);
+	}
+
+	integrityVerificationFuture.wait();
+}
+
+bool ModManager::doesModHaveMissingFiles(const std::string & modID) const {
+	std::lock_guard<std::mutex> lock(m_integrityVerificationMutex);
+
+	return m_modIDsWithMissingFiles.find(modID) != m_modIDsWithMissingFiles.cend();
+}
+
+size_t ModManager::numberOfModsWithMissingFiles() const {
+	std::lock_guard<std::mutex> lock(m_integrityVerificationMutex);
+
+	return m_modIDsWithMissingFiles.size();
+}
+
+void ModManager::runIntegrityVerification(IntegrityVerificationSnapshot snapshot) {
+	// runs on a background thread, so the global mutex must not be acquired here, otherwise cancelling while holding it would deadlock
+	std::chrono::time_point<std::chrono::steady_clock> verificationStartTimePoint(std::chrono::steady_clock::now());
+
+	size_t numberOfMissingExecutables = 0;
+	size_t numberOfMissingModFiles = 0;
+	size_t numberOfUnlinkedModFiles = 0;
+
+	try {
+		numberOfMissingExecutables = snapshot.dosboxVersions->checkForMissingExecutables() + snapshot.gameVersions->checkForMissingExecutables() + snapshot.standAloneMods->checkForMissingExecutables();
+
+		if(snapshot.checkModFiles) {
+			m_directorySnapshotService->refreshModifiedSnapshots();
+
+			for(const std::shared_ptr<Mod> & mod : snapshot.mods) {
+				if(m_integrityVerificationCancelled) {
+					break;
+				}
+
+				size_t numberOfMissingFiles = checkModForMissingFilesUsingDirectorySnapshots(*mod, *snapshot.gameVersions, snapshot.modsDirectoryPath);
+
+				if(numberOfMissingFiles == 0) {
+					continue;
+				}
+
+				numberOfMissingModFiles += numberOfMissingFiles;
+
+				{
+					std::lock_guard<std::mutex> lock(m_integrityVerificationMutex);
+
+					m_modIDsWithMissingFiles.insert(mod->getID());
+				}
+
+				modMissingFilesDetected(mod, numberOfMissingFiles);
+			}
+
+			if(numberOfMissingModFiles != 0) {
+				spdlog::warn("Found {} missing mod file{} in mods directory.", numberOfMissingModFiles, numberOfMissingModFiles == 1 ? "" : "s");
+			}
+
+			for(size_t i = 0; i < snapshot.gameVersions->numberOfGameVersions(); i++) {
+				if(m_integrityVerificationCancelled) {
+					break;
+				}
+
+				numberOfUnlinkedModFiles += checkForUnlinkedModFilesForGameVersionWithoutLocking(*snapshot.gameVersions->getGameVersion(i), snapshot.mods, *snapshot.modDependencyGraph, snapshot.modsDirectoryPath);
+			}
+		}
+	}
+	catch(const std::exception & exception) {
+		spdlog::error("Integrity verification failed: {}", exception.what());
+	}
+
+	bool cancelled = m_integrityVerificationCancelled;
+
+	if(cancelled) {
+		spdlog::info("Integrity verification cancelled after {} ms.", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - verificationStartTimePoint).count());
+	}
+	else {
+		spdlog::info("Integrity verification completed in {} ms.", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - verificationStartTimePoint).count());
+	}
+
+	integrityVerificationFinished(numberOfMissingExecutables, numberOfMissingModFiles, numberOfUnlinkedModFiles, cancelled);
+}
+
+void ModManager::watchModDirectories() {
+	DirectoryWatcher * directoryWatcher = DirectoryWatcher::getInstance();
+
+	m_watchedDirectoriesChangedConnection.disconnect();
+	directoryWatcher->unwatchAllDirectories();
+
+	std::string modsDirectoryPath(getModsDirectoryPath());
+	std::vector<std::string> directoryPaths({
+		Utilities::joinPaths(modsDirectoryPath, GameVersion::ALL_VERSIONS_DIRECTORY_NAME),
+		getMapsDirectoryPath()
+	});
+
+	for(const std::shared_ptr<GameVersion> & gameVersion : getGameVersions()->getGameVersions()) {
+		directoryPaths.push_back(Utilities::joinPaths(modsDirectoryPath, gameVersion->getModDirectoryName()));
+
+		if(gameVersion->hasGamePath()) {
+			std::optional<std::string> optionalGamePath(gameVersion->getEvaluatedGamePath());
+
+			if(optionalGamePath.has_value()) {
+				directoryPaths.push_back(optionalGamePath.value());
+			}
+		}
+	}
+
+	for(const std::string & directoryPath : directoryPaths) {
+		if(!directoryPath.empty() && std::filesystem::is_directory(std::filesystem::path(directoryPath))) {
+			directoryWatcher->watchDirectory(directoryPath);
+		}
+	}
+
+	m_watchedDirectoriesChangedConnection = directoryWatcher->directoriesChanged.connect(std::bind(&ModManager::onWatchedDirectoriesChanged, this, std::placeholders::_1));
+
+	directoryWatcher->start();
+}
+
+size_t ModManager::updateMissingModFileState() {
+	std::unordered_set<std::string> modIDsWithMissingFiles;
+
+	for(const std::shared_ptr<Mod> & mod : m_mods->getMods()) {
+		if(checkModForMissingFilesUsingDirectorySnapshots(*mod, *getGameVersions(), SettingsManager::getInstance()->modsDirectoryPath, {}, {}, false) != 0) {
+			modIDsWithMissingFiles.insert(mod->getID());
+		}
+	}
+
+	size_t numberOfChangedMods = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(m_integrityVerificationMutex);
+
+		for(const std::string & modID : modIDsWithMissingFiles) {
+			if(m_modIDsWithMissingFiles.find(modID) == m_modIDsWithMissingFiles.cend()) {
+				spdlog::warn("Mod '{}' is now missing files.", m_mods->getModWithID(modID)->getName());
+				numberOfChangedMods++;
+			}
+		}
+
+		for(const std::string & modID : m_modIDsWithMissingFiles) {
+			if(modIDsWithMissingFiles.find(modID) == modIDsWithMissingFiles.cend()) {
+				std::shared_ptr<Mod> mod(m_mods->getModWithID(modID));
+
+				if(mod != nullptr) {
+					spdlog::info("Mod '{}' is no longer missing any files.", mod->getName());
+				}
+
+				numberOfChangedMods++;
+			}
+		}
+
+		m_modIDsWithMissingFiles = std::move(modIDsWithMissingFiles);
+	}
+
+	if(numberOfChangedMods != 0) {
+		missingModFilesChanged();
+	}
+
+	return numberOfChangedMods;
+}
+
+size_t ModManager::removeCachedPackageFilesWithMissingFiles(const std::string & modDirectoryPath) {
+	if(m_downloadManager == nullptr) {
+		return 0;
+	}
+
+	DownloadCache * downloadCache = m_downloadManager->getDownloadCache();
+	std::shared_ptr<GameVersionCollection> gameVersions(getGameVersions());
+	std::string modDirectoryName(Utilities::getFileName(modDirectoryPath));
+	std::shared_ptr<ModVersion> modVersion;
+	std::shared_ptr<ModVersionType> modVersionType;
+	std::shared_ptr<ModGameVersion> modGameVersion;
+	std::shared_ptr<ModDownload> modDownload;
+	std::shared_ptr<CachedPackageFile> cachedPackageFile;
+	std::shared_ptr<GameVersion> gameVersion;
+	size_t numberOfRemovedCachedPackageFiles = 0;
+
+	for(const std::shared_ptr<Mod> & mod : m_mods->getMods()) {
+		for(size_t i = 0; i < mod->numberOfVersions(); i++) {
+			modVersion = mod->getVersion(i);
+
+			for(size_t j = 0; j < modVersion->numberOfTypes(); j++) {
+				modVersionType = modVersion->getType(j);
+
+				for(size_t k = 0; k < modVersionType->numberOfGameVersions(); k++) {
+					modGameVersion = modVersionType->getGameVersion(k);
+
+					if(modGameVersion->isStandAlone()) {
+						continue;
+					}
+
+					modDownload = modGameVersion->getDownload();
+
+					if(modDownload == nullptr) {
+						continue;
+					}
+
+					cachedPackageFile = downloadCache->getCachedPackageFile(*modDownload);
+
+					if(cachedPackageFile == nullptr) {
+						continue;
+					}
+
+					if(modDownload->isForAllGameVersions()) {
+						if(!Utilities::areStringsEqualIgnoreCase(modDirectoryName, GameVersion::ALL_VERSIONS_DIRECTORY_NAME)) {
+							continue;
+						}
+					}
+					else {
+						gameVersion = gameVersions->getGameVersionWithID(modGameVersion->getInternedGameVersionID());
+
+						if(gameVersion == nullptr || !Utilities::areStringsEqualIgnoreCase(modDirectoryName, gameVersion->getModDirectoryName())) {
+							continue;
+						}
+					}
+
+					for(const std::shared_ptr<CachedFile> & cachedFile : cachedPackageFile->getCachedFiles()) {
+						if(m_directorySnapshotService->hasFile(modDirectoryPath, cachedFile->getFileName())) {
+							continue;
+						}
+
+						spdlog::info("Removing '{}' mod download '{}' from download cache, extracted file '{}' no longer exists.", modGameVersion->getFullName(true), modDownload->getFileName(), cachedFile->getFileName());
+
+						downloadCache->removeCachedPackageFile(*cachedPackageFile);
+						numberOfRemovedCachedPackageFiles++;
+
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	if(numberOfRemovedCachedPackageFiles != 0) {
+		m_downloadManager->saveDownloadCache();
+	}
+
+	return numberOfRemovedCachedPackageFiles;
+}
+
+bool ModManager::isUsingLocalMode() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_localMode;
+}
+
+bool ModManager::didArgumentHandlingFail() const {
+	return m_argumentHandlingFailed;
+}
+
+std::shared_ptr<ModCollection> ModManager::getMods() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_mods;
+}
+
+std::shared_ptr<StandAloneModCollection> ModManager::getStandAloneMods() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_standAloneMods;
+}
+
+std::shared_ptr<FavouriteModCollection> ModManager::getFavouriteMods() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_favouriteMods;
+}
+
+std::shared_ptr<OrganizedModCollection> ModManager::getOrganizedMods() const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	return m_organizedMods;
+}
+
+std::shared_ptr<DOSBoxConfiguration> ModManager::getGeneralDOSBoxConfiguration() const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
 	return m_generalDOSBoxConfiguration;
@@ -1911,20 +2493,53 @@ bool ModManager::selectRandomAuthor() {
 	return true;
 }
 
-std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr<Mod>> & mods, const std::string & query, bool autoPopulateVersion, bool autoPopulateVersionType) {
+std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr<Mod>> & mods, const std::string & query, bool autoPopulateVersion, bool autoPopulateVersionType, const ModSearchIndex * searchIndex, std::function<size_t(const Mod &)> indexOfModFunction) {
+	enum class MatchRank : uint8_t {
+		Prefix,
+		Partial,
+		Author
+	};
+
 	std::string formattedQuery(Utilities::toLowerCase(Utilities::trimString(query)));
 
 	if(formattedQuery.empty()) {
 		return {};
 	}
 
+	std::optional<std::vector<const Mod *>> optionalCandidateMods;
+
+	if(searchIndex != nullptr) {
+		optionalCandidateMods = searchIndex->getCandidateMods(formattedQuery);
+	}
+
+	std::vector<size_t> modIndices;
+
+	if(optionalCandidateMods.has_value() && indexOfModFunction != nullptr) {
+		// only visit candidate mods, in the same order as they appear in the mod list
+		modIndices.reserve(optionalCandidateMods->size());
+
+		for(const Mod * candidateMod : optionalCandidateMods.value()) {
+			size_t modIndex = indexOfModFunction(*candidateMod);
+
+			if(modIndex < mods.size() && mods[modIndex].get() == candidateMod) {
+				modIndices.push_back(modIndex);
+			}
+		}
+
+		std::sort(modIndices.begin(), modIndices.end());
+	}
+	else {
+		modIndices.resize(mods.size());
+		std::iota(modIndices.begin(), modIndices.end(), 0);
+	}
+
 	std::vector<ModMatch> matches;
+	std::vector<MatchRank> matchRanks;
 	std::shared_ptr<Mod> mod;
 	std::shared_ptr<ModVersion> modVersion;
 	std::shared_ptr<ModVersionType> modVersionType;
-	std::string formattedModName;
-	std::string formattedModVersion;
-	std::string formattedModVersionType;
+	const ModSearchIndex::Entry * searchEntry = nullptr;
+	ModSearchIndex::Entry unindexedSearchEntry;
 	bool modNameMatches = false;
 	bool modNamePartiallyMatches = false;
 	bool modVersionMatches = false;
@@ -1933,14 +2548,29 @@ std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr
 	bool modVersionTypePartiallyMatches = false;
 	bool exactMatchFound = false;
 
-	for(size_t i = 0; i < mods.size(); i++) {
+	for(size_t i : modIndices) {
 		mod = mods[i];
 
+		if(mod == nullptr || (optionalCandidateMods.has_value() && indexOfModFunction == nullptr && !ModSearchIndex::isCandidate(optionalCandidateMods.value(), *mod))) {
+			continue;
+		}
+
 		if(!Mod::isValid(mod.get(), true)) {
 			continue;
 		}
 
-		formattedModName = Utilities::toLowerCase(mod->getName());
+		searchEntry = searchIndex != nullptr ? searchIndex->getEntry(*mod) : nullptr;
+
+		if(searchEntry != nullptr && !ModSearchIndex::isEntryCurrent(*searchEntry, *mod)) {
+			searchEntry = nullptr;
+		}
+
+		if(searchEntry == nullptr) {
+			unindexedSearchEntry = ModSearchIndex::createEntry(*mod);
+			searchEntry = &unindexedSearchEntry;
+		}
+
+		const std::string & formattedModName = searchEntry->formattedName;
 		modNameMatches = formattedQuery == formattedModName;
 
 		if(modNameMatches && mod->numberOfVersions() == 1 && mod->getVersion(0)->numberOfTypes() == 1) {
@@ -1962,11 +2592,12 @@ std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr
 			break;
 		}
 
-		modNamePartiallyMatches = formattedModName.find(formattedQuery) != std::string::npos;
+		size_t modNameMatchPosition = formattedModName.find(formattedQuery);
+		modNamePartiallyMatches = modNameMatchPosition != std::string::npos;
 
 		for(size_t j = 0; j < mod->numberOfVersions(); j++) {
 			modVersion = mod->getVersion(j);
-			formattedModVersion = Utilities::toLowerCase(modVersion->getFullName());
+			const std::string & formattedModVersion = searchEntry->formattedVersionNames[j];
 			modVersionMatches = formattedQuery == formattedModVersion;
 
 			if((modVersionMatches && modVersion->numberOfTypes() == 1) ||
@@ -1984,11 +2615,12 @@ std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr
 				break;
 			}
 
-			modVersionPartiallyMatches = formattedModVersion.find(formattedQuery) != std::string::npos;
+			size_t modVersionMatchPosition = formattedModVersion.find(formattedQuery);
+			modVersionPartiallyMatches = modVersionMatchPosition != std::string::npos;
 
 			for(size_t k = 0; k < modVersion->numberOfTypes(); k++) {
 				modVersionType = modVersion->getType(k);
-				formattedModVersionType = Utilities::toLowerCase(modVersionType->getFullName());
+				const std::string & formattedModVersionType = searchEntry->formattedVersionTypeNames[j][k];
 				modVersionTypeMatches = formattedQuery == formattedModVersionType;
 
 				if(modVersionTypeMatches) {
@@ -1999,10 +2631,12 @@ std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr
 					break;
 				}
 
-				modVersionTypePartiallyMatches = formattedModVersionType.find(formattedQuery) != std::string::npos;
+				size_t modVersionTypeMatchPosition = formattedModVersionType.find(formattedQuery);
+				modVersionTypePartiallyMatches = modVersionTypeMatchPosition != std::string::npos;
 
 				if(modVersionTypePartiallyMatches && !modNamePartiallyMatches && !modVersionPartiallyMatches) {
 					matches.emplace_back(mod, modVersion, modVersionType, i, j, k);
+					matchRanks.push_back(modVersionTypeMatchPosition == 0 ? MatchRank::Prefix : MatchRank::Partial);
 				}
 			}
 
@@ -2017,6 +2651,8 @@ std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr
 				else {
 					matches.emplace_back(mod, modVersion, i, j);
 				}
+
+				matchRanks.push_back(modVersionMatchPosition == 0 ? MatchRank::Prefix : MatchRank::Partial);
 			}
 		}
 
@@ -2024,7 +2660,18 @@ std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr
 			break;
 		}
 
-		if(modNamePartiallyMatches) {
+		bool modAuthorPartiallyMatches = false;
+
+		if(!modNamePartiallyMatches) {
+			for(const std::string & formattedAuthorName : searchEntry->formattedAuthorNames) {
+				if(formattedAuthorName.find(formattedQuery) != std::string::npos) {
+					modAuthorPartiallyMatches = true;
+					break;
+				}
+			}
+		}
+
+		if(modNamePartiallyMatches || modAuthorPartiallyMatches) {
 			if(mod->numberOfVersions() == 1 && autoPopulateVersion) {
 				if(mod->getVersion(0)->numberOfTypes() == 1 && autoPopulateVersionType) {
 					matches.emplace_back(mod, mod->getVersion(0), mod->getVersion(0)->getType(0), i, 0, 0);
@@ -2036,16 +2683,131 @@ std::vector<ModMatch> ModManager::searchForMod(const std::vector<std::shared_ptr
 			else {
 				matches.emplace_back(mod, i);
 			}
+
+			matchRanks.push_back(modAuthorPartiallyMatches ? MatchRank::Author : (modNameMatchPosition == 0 ? MatchRank::Prefix : MatchRank::Partial));
 		}
 	}
 
-	if(SettingsManager::getInstance()->segmentAnalyticsEnabled) {
-		std::map<std::string, std::any> properties;
-		properties["query"] = formattedQuery;
-		properties["exactMatch"] = exactMatchFound;
-		properties["numberOfMatches"] = matches.size();
+	if(!exactMatchFound && matches.size() > 1) {
+		std::vector<size_t> matchOrder(matches.size());
+		std::iota(matchOrder.begin(), matchOrder.end(), 0);
 
-		if(matches.size() == 1) {
+		std::stable_sort(matchOrder.begin(), matchOrder.end(), [&matchRanks](size_t matchIndexA, size_t matchIndexB) {
+			return matchRanks[matchIndexA] < matchRanks[matchIndexB];
+		});
+
+		std::vector<ModMatch> rankedMatches;
+		rankedMatches.reserve(matches.size());
+
+		for(size_t matchIndex : matchOrder) {
+			rankedMatches.push_back(std::move(matches[matchIndex]));
+		}
+
+		matches = std::move(rankedMatches);
+	}
+
+	bool fuzzyMatchFound = false;
+
+	if(matches.empty()) {
+		// pairs of mod list index and edit distance
+		std::vector<std::pair<size_t, size_t>> fuzzyMatchingModIndices;
+
+		if(searchIndex != nullptr) {
+			std::unordered_map<const Mod *, size_t> modIndicesByMod;
+
+			if(indexOfModFunction == nullptr) {
+				modIndicesByMod.reserve(mods.size());
+
+				for(size_t i = 0; i < mods.size(); i++) {
+					modIndicesByMod.emplace(mods[i].get(), i);
+				}
+			}
+
+			// filter out mods which are not in the mod list before truncating, otherwise they could crowd out ones which are
+			for(const std::pair<const Mod *, size_t> & fuzzyMatchingMod : searchIndex->getFuzzyMatchingMods(formattedQuery, std::numeric_limits<size_t>::max())) {
+				size_t modIndex = std::numeric_limits<size_t>::max();
+
+				if(indexOfModFunction != nullptr) {
+					modIndex = indexOfModFunction(*fuzzyMatchingMod.first);
+				}
+				else {
+					std::unordered_map<const Mod *, size_t>::const_iterator modIndexIterator(modIndicesByMod.find(fuzzyMatchingMod.first));
+
+					if(modIndexIterator != modIndicesByMod.cend()) {
+						modIndex = modIndexIterator->second;
+					}
+				}
+
+				if(modIndex >= mods.size() || mods[modIndex].get() != fuzzyMatchingMod.first || !Mod::isValid(mods[modIndex].get(), true)) {
+					continue;
+				}
+
+				fuzzyMatchingModIndices.emplace_back(modIndex, fuzzyMatchingMod.second);
+
+				if(fuzzyMatchingModIndices.size() >= MAXIMUM_NUMBER_OF_FUZZY_SEARCH_MATCHES) {
+					break;
+				}
+			}
+		}
+		else {
+			size_t maximumEditDistance = BKTree::getMaximumEditDistanceForLength(formattedQuery.length());
+
+			if(maximumEditDistance != 0) {
+				for(size_t i = 0; i < mods.size(); i++) {
+					if(!Mod::isValid(mods[i].get(), true)) {
+						continue;
+					}
+
+					unindexedSearchEntry = ModSearchIndex::createEntry(*mods[i]);
+					size_t editDistance = BKTree::calculateEditDistance(formattedQuery, unindexedSearchEntry.formattedName);
+
+					for(const std::string & formattedAuthorName : unindexedSearchEntry.formattedAuthorNames) {
+						editDistance = std::min(editDistance, BKTree::calculateEditDistance(formattedQuery, formattedAuthorName));
+					}
+
+					if(editDistance <= maximumEditDistance) {
+						fuzzyMatchingModIndices.emplace_back(i, editDistance);
+					}
+				}
+
+				std::stable_sort(fuzzyMatchingModIndices.begin(), fuzzyMatchingModIndices.end(), [](const std::pair<size_t, size_t> & fuzzyMatchingModIndexA, const std::pair<size_t, size_t> & fuzzyMatchingModIndexB) {
+					return fuzzyMatchingModIndexA.second < fuzzyMatchingModIndexB.second;
+				});
+
+				if(fuzzyMatchingModIndices.size() > MAXIMUM_NUMBER_OF_FUZZY_SEARCH_MATCHES) {
+					fuzzyMatchingModIndices.resize(MAXIMUM_NUMBER_OF_FUZZY_SEARCH_MATCHES);
+				}
+			}
+		}
+
+		for(const std::pair<size_t, size_t> & fuzzyMatchingModIndex : fuzzyMatchingModIndices) {
+			size_t i = fuzzyMatchingModIndex.first;
+			mod = mods[i];
+
+			if(mod->numberOfVersions() == 1 && autoPopulateVersion) {
+				if(mod->getVersion(0)->numberOfTypes() == 1 && autoPopulateVersionType) {
+					matches.emplace_back(mod, mod->getVersion(0), mod->getVersion(0)->getType(0), i, 0, 0);
+				}
+				else {
+					matches.emplace_back(mod, mod->getVersion(0), i, 0);
+				}
+			}
+			else {
+				matches.emplace_back(mod, i);
+			}
+		}
+
+		fuzzyMatchFound = !matches.empty();
+	}
+
+	if(SettingsManager::getInstance()->segmentAnalyticsEnabled) {
+		std::map<std::string, std::any> properties;
+		properties["query"] = formattedQuery;
+		properties["exactMatch"] = exactMatchFound;
+		properties["fuzzyMatch"] = fuzzyMatchFound;
+		properties["numberOfMatches"] = matches.size();
+
+		if(matches.size() == 1) {
 			properties["match"] = matches[0].toString();
 		}
 
@@ -2094,7 +2856,7 @@ std::vector<std::shared_ptr<ModIdentifier>> ModManager::searchForFavouriteMod(co
 	return matchingFavouriteMods;
 }
 
-std::vector<std::shared_ptr<GameVersion>> ModManager::searchForGameVersion(const std::vector<std::shared_ptr<GameVersion>> & gameVersions, const std::string & query) {
+std::vector<std::shared_ptr<GameVersion>> ModManager::searchForGameVersion(const std::vector<std::shared_ptr<GameVersion>> & gameVersions, const std::string & query, const GameVersionCollection * gameVersionCollection) {
 	std::string formattedQuery(Utilities::toLowerCase(Utilities::trimString(query)));
 
 	if(formattedQuery.empty()) {
@@ -2139,10 +2901,55 @@ std::vector<std::shared_ptr<GameVersion>> ModManager::searchForGameVersion(const
 		}
 	}
 
+	bool fuzzyMatchFound = false;
+	size_t maximumEditDistance = BKTree::getMaximumEditDistanceForLength(formattedQuery.length());
+
+	if(matchingGameVersions.empty() && maximumEditDistance != 0) {
+		std::vector<std::pair<std::shared_ptr<GameVersion>, size_t>> fuzzyMatchingGameVersions;
+
+		if(gameVersionCollection != nullptr) {
+			std::unordered_set<const GameVersion *> listedGameVersions;
+			listedGameVersions.reserve(gameVersions.size());
+
+			for(const std::shared_ptr<GameVersion> & gameVersion : gameVersions) {
+				listedGameVersions.insert(gameVersion.get());
+			}
+
+			for(const std::pair<std::shared_ptr<GameVersion>, size_t> & fuzzyMatchingGameVersion : gameVersionCollection->getFuzzyMatchingGameVersions(formattedQuery)) {
+				if(listedGameVersions.find(fuzzyMatchingGameVersion.first.get()) != listedGameVersions.cend()) {
+					fuzzyMatchingGameVersions.push_back(fuzzyMatchingGameVersion);
+				}
+			}
+		}
+		else {
+			for(const std::shared_ptr<GameVersion> & gameVersion : gameVersions) {
+				size_t editDistance = std::min(
+					BKTree::calculateEditDistance(formattedQuery, Utilities::toLowerCase(gameVersion->getLongName())),
+					BKTree::calculateEditDistance(formattedQuery, Utilities::toLowerCase(gameVersion->getShortName()))
+				);
+
+				if(editDistance <= maximumEditDistance) {
+					fuzzyMatchingGameVersions.emplace_back(gameVersion, editDistance);
+				}
+			}
+		}
+
+		std::stable_sort(fuzzyMatchingGameVersions.begin(), fuzzyMatchingGameVersions.end(), [](const std::pair<std::shared_ptr<GameVersion>, size_t> & fuzzyMatchingGameVersionA, const std::pair<std::shared_ptr<GameVersion>, size_t> & fuzzyMatchingGameVersionB) {
+			return fuzzyMatchingGameVersionA.second < fuzzyMatchingGameVersionB.second;
+		});
+
+		for(size_t i = 0; i < fuzzyMatchingGameVersions.size() && i < MAXIMUM_NUMBER_OF_FUZZY_SEARCH_MATCHES; i++) {
+			matchingGameVersions.push_back(fuzzyMatchingGameVersions[i].first);
+		}
+
+		fuzzyMatchFound = !matchingGameVersions.empty();
+	}
+
 	if(SettingsManager::getInstance()->segmentAnalyticsEnabled) {
 		std::map<std::string, std::any> properties;
 		properties["query"] = formattedQuery;
 		properties["exactMatch"] = exactMatchFound;
+		properties["fuzzyMatch"] = fuzzyMatchFound;
 		properties["numberOfMatches"] = matchingGameVersions.size();
 
 		SegmentAnalytics::getInstance()->track("Game Version Search", properties);
@@ -2151,7 +2958,7 @@ std::vector<std::shared_ptr<GameVersion>> ModManager::searchForGameVersion(const
 	return matchingGameVersions;
 }
 
-std::vector<std::shared_ptr<ModAuthorInformation>> ModManager::searchForAuthor(const std::vector<std::shared_ptr<ModAuthorInformation>> & authors, const std::string & query) {
+std::vector<std::shared_ptr<ModAuthorInformation>> ModManager::searchForAuthor(const std::vector<std::shared_ptr<ModAuthorInformation>> & authors, const std::string & query, const ModSearchIndex * searchIndex) {
 	std::string formattedQuery(Utilities::toLowerCase(Utilities::trimString(query)));
 
 	if(formattedQuery.empty()) {
@@ -2160,11 +2967,20 @@ std::vector<std::shared_ptr<ModAuthorInformation>> ModManager::searchForAuthor(c
 
 	std::string authorName;
 	std::vector<std::shared_ptr<ModAuthorInformation>> matchingAuthors;
+	std::unordered_map<std::string, std::shared_ptr<ModAuthorInformation>> authorsByFormattedName;
 	bool exactMatchFound = false;
 
+	if(searchIndex != nullptr) {
+		authorsByFormattedName.reserve(authors.size());
+	}
+
 	for(size_t i = 0; i < authors.size(); i++) {
 		authorName = Utilities::toLowerCase(authors[i]->getName());
 
+		if(searchIndex != nullptr) {
+			authorsByFormattedName.emplace(authorName, authors[i]);
+		}
+
 		if(authorName == formattedQuery) {
 			exactMatchFound = true;
 			matchingAuthors.clear();
@@ -2178,10 +2994,54 @@ std::vector<std::shared_ptr<ModAuthorInformation>> ModManager::searchForAuthor(c
 		}
 	}
 
+	bool fuzzyMatchFound = false;
+	size_t maximumEditDistance = BKTree::getMaximumEditDistanceForLength(formattedQuery.length());
+
+	if(matchingAuthors.empty() && maximumEditDistance != 0) {
+		std::vector<std::pair<std::shared_ptr<ModAuthorInformation>, size_t>> fuzzyMatchingAuthors;
+
+		if(searchIndex != nullptr) {
+			// the index holds the team and author names of every mod, so only names which are listed are kept
+			for(const std::pair<std::string_view, size_t> & fuzzyMatchingAuthorName : searchIndex->getFuzzyMatchingAuthorNames(formattedQuery, std::numeric_limits<size_t>::max())) {
+				std::unordered_map<std::string, std::shared_ptr<ModAuthorInformation>>::const_iterator authorIterator(authorsByFormattedName.find(std::string(fuzzyMatchingAuthorName.first)));
+
+				if(authorIterator == authorsByFormattedName.cend()) {
+					continue;
+				}
+
+				fuzzyMatchingAuthors.emplace_back(authorIterator->second, fuzzyMatchingAuthorName.second);
+
+				if(fuzzyMatchingAuthors.size() >= MAXIMUM_NUMBER_OF_FUZZY_SEARCH_MATCHES) {
+					break;
+				}
+			}
+		}
+		else {
+			for(const std::shared_ptr<ModAuthorInformation> & author : authors) {
+				size_t editDistance = BKTree::calculateEditDistance(formattedQuery, Utilities::toLowerCase(author->getName()));
+
+				if(editDistance <= maximumEditDistance) {
+					fuzzyMatchingAuthors.emplace_back(author, editDistance);
+				}
+			}
+		}
+
+		std::stable_sort(fuzzyMatchingAuthors.begin(), fuzzyMatchingAuthors.end(), [](const std::pair<std::shared_ptr<ModAuthorInformation>, size_t> & fuzzyMatchingAuthorA, const std::pair<std::shared_ptr<ModAuthorInformation>, size_t> & fuzzyMatchingAuthorB) {
+			return fuzzyMatchingAuthorA.second < fuzzyMatchingAuthorB.second;
+		});
+
+		for(size_t i = 0; i < fuzzyMatchingAuthors.size() && i < MAXIMUM_NUMBER_OF_FUZZY_SEARCH_MATCHES; i++) {
+			matchingAuthors.push_back(fuzzyMatchingAuthors[i].first);
+		}
+
+		fuzzyMatchFound = !matchingAuthors.empty();
+	}
+
 	if(SettingsManager::getInstance()->segmentAnalyticsEnabled) {
 		std::map<std::string, std::any> properties;
 		properties["query"] = formattedQuery;
 		properties["exactMatch"] = exactMatchFound;
+		properties["fuzzyMatch"] = fuzzyMatchFound;
 		properties["numberOfMatches"] = matchingAuthors.size();
 
 		SegmentAnalytics::getInstance()->track("Author Search", properties);
@@ -2491,22 +3351,54 @@ bool ModManager::shouldRunSelectedMod() const {
 }
 
 bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersion, std::shared_ptr<ModGameVersion> alternateModGameVersion) {
+	return runSelectedMod(alternateGameVersion, alternateModGameVersion, nullptr);
+}
+
+std::unique_ptr<LaunchPlan> ModManager::createLaunchPlan(std::shared_ptr<GameVersion> alternateGameVersion, std::shared_ptr<ModGameVersion> alternateModGameVersion) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::unique_ptr<LaunchPlan> launchPlan(std::make_unique<LaunchPlan>());
+
+	// launch plans are also created speculatively in the background, so they should not report launch status or errors to the user interface
+	m_planningLaunch = true;
+	bool launchPlanned = runSelectedMod(alternateGameVersion, alternateModGameVersion, launchPlan.get());
+	m_planningLaunch = false;
+
+	if(!launchPlanned) {
+		return nullptr;
+	}
+
+	return launchPlan;
+}
+
+bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersion, std::shared_ptr<ModGameVersion> alternateModGameVersion, LaunchPlan * launchPlan) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	launchStatus("Preparing to launch.");
+	notifyLaunchStatus("Preparing to launch.");
 
+	// launch plans are excluded from the phase profile so that planning does not pollute launch traces
 	std::chrono::time_point<std::chrono::steady_clock> runStartTimePoint(std::chrono::steady_clock::now());
 
+	// only the most recent launch is profiled, otherwise the phases and trace file would keep growing with every launch
+	if(launchPlan == nullptr) {
+		m_phaseProfiler->clear();
+	}
+
+	PhaseProfiler::Span launchSpan(launchPlan == nullptr ? m_phaseProfiler->beginPhase("Launch") : PhaseProfiler::Span());
+	PhaseProfiler::Span launchPhaseSpan(launchSpan.beginChildPhase("Preparation"));
+
 	if(!m_initialized) {
 		notifyLaunchError("Mod manager not initialized");
 		return false;
 	}
-	else if(m_gameProcess != nullptr) {
+	else if(launchPlan == nullptr && m_gameProcess != nullptr) {
 		notifyLaunchError("Game process already running.");
 		return false;
 	}
 
-	m_shouldRunSelectedMod = false;
+	if(launchPlan == nullptr) {
+		m_shouldRunSelectedMod = false;
+	}
 
 	SettingsManager * settings = SettingsManager::getInstance();
 
@@ -2526,6 +3418,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		return false;
 	}
 
+	launchSpan.setPhaseName(fmt::format("Launch {}", selectedGameVersion->getLongName()));
+
 	if(!selectedGameVersion->isConfigured()) {
 		notifyLaunchError(fmt::format("Game version '{}' is not configured.", selectedGameVersion->getLongName()));
 		return false;
@@ -2558,11 +3452,15 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	std::shared_ptr<ModGameVersion> selectedModGameVersion;
 
 	if(m_selectedMod != nullptr) {
-		launchStatus("Checking mod for missing files.");
+		// mod files are only required once they would have been downloaded, which does not happen when planning
+		if(launchPlan == nullptr) {
+			notifyLaunchStatus("Checking mod for missing files.");
+			launchPhaseSpan.beginNextPhase("Missing File Check");
 
-		if(checkModForMissingFiles(*m_selectedMod) != 0) {
-			notifyLaunchError("Mod is missing files, aborting execution.");
-			return false;
+			if(checkModForMissingFiles(*m_selectedMod) != 0) {
+				notifyLaunchError("Mod is missing files, aborting execution.");
+				return false;
+			}
 		}
 
 		if(m_selectedModVersionIndex == std::numeric_limits<size_t>::max()) {
@@ -2686,9 +3584,10 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	}
 
 	if(!standAlone && selectedModGameVersion != nullptr) {
-		launchStatus("Collecting list of all mod file paths.");
+		notifyLaunchStatus("Collecting list of all mod file paths.");
+		launchPhaseSpan.beginNextPhase("Mod File Path Collection");
 
-		std::shared_ptr<GameVersion> targetGameVersion(getGameVersions()->getGameVersionWithID(selectedModGameVersion->getGameVersionID()));
+		std::shared_ptr<GameVersion> targetGameVersion(getGameVersions()->getGameVersionWithID(selectedModGameVersion->getInternedGameVersionID()));
 		std::string modDirectoryName;
 
 		if(targetGameVersion != nullptr) {
@@ -2712,8 +3611,12 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 			}
 		}
 
+		PhaseProfiler::Span dependencyResolutionSpan(launchPhaseSpan.beginChildPhase("Dependency Resolution"));
+
 		modDependencyGroupFiles = m_mods->getModDependencyGroupFiles(*selectedModGameVersion, targetGameVersion != nullptr ? *targetGameVersion : *selectedGameVersion, getGameVersions().get(), true, true);
 
+		dependencyResolutionSpan.end();
+
 		modConFiles = selectedModGameVersion->getFilesOfType("con");
 		modDefFiles = selectedModGameVersion->getFilesOfType("def");
 
@@ -2754,7 +3657,7 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		}
 
 		for(const std::shared_ptr<ModFile> & modDependencyGroupFile : modDependencyGroupFiles) {
-			std::shared_ptr<GameVersion> modDependencyGameVersion(getGameVersions()->getGameVersionWithID(modDependencyGroupFile->getParentModGameVersion()->getGameVersionID()));
+			std::shared_ptr<GameVersion> modDependencyGameVersion(getGameVersions()->getGameVersionWithID(modDependencyGroupFile->getParentModGameVersion()->getInternedGameVersionID()));
 			std::string modDependencyFilesBaseDirectoryPath;
 
 			if(selectedGameVersion->doesSupportSubdirectories()) {
@@ -2848,22 +3751,16 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	std::string targetCombinedGroupFilePath;
 	std::unique_ptr<Group> combinedGroup;
 	std::unique_ptr<ZipArchive> combinedZip;
+	std::string stagedCombinedGroupFilePath;
 
-	struct FileNameComparator {
-	public:
-		bool operator () (const std::string & fileNameA, const std::string & fileNameB) const {
-			return std::lexicographical_compare(fileNameA.begin(), fileNameA.end(), fileNameB.begin(), fileNameB.end(), [](unsigned char a, unsigned char b) {
-				return std::toupper(a) < std::toupper(b);
-			});
-		}
-	};
+	if(launchPlan == nullptr && !m_localMode && !standAlone && selectedModGameVersion != nullptr) {
+		launchPhaseSpan.beginNextPhase("Mod Download");
 
-	if(!m_localMode && !standAlone && selectedModGameVersion != nullptr) {
 		if(m_downloadManager->isModGameVersionDownloaded(*selectedModGameVersion, m_mods.get(), getGameVersions().get(), true, true)) {
-			launchStatus("Checking for updates to mod files.");
+			notifyLaunchStatus("Checking for updates to mod files.");
 		}
 		else {
-			launchStatus("Starting mod download.");
+			notifyLaunchStatus("Starting mod download.");
 		}
 
 		SignalConnectionGroup downloadManagerConnectionGroup(connectDownloadManagerSignals());
@@ -2880,42 +3777,33 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 			notifyLaunchError(fmt::format("Failed to download '{}' game version of '{}' mod!", getGameVersions()->getLongNameOfGameVersionWithID(selectedModGameVersion->getGameVersionID()), selectedModGameVersion->getFullName(false)));
 			return false;
 		}
+
+		// the organized mod collection drives the mod list display, so its download status is only updated once control returns to the caller's thread
+		m_pendingDownloadStatusMod = m_selectedMod;
 	}
 
-	std::map<std::string, std::unique_ptr<ByteBuffer>, FileNameComparator> demoFiles;
+	LaunchStagingService::DemoFileMap demoFiles;
 
 	if(doesRequireCombinedGroup || (!m_demoRecordingEnabled && settings->demoExtractionEnabled)) {
-		if(doesRequireCombinedGroup) {
-			launchStatus(fmt::format("Generating combined {} file (this may take some time).", doesRequireCombinedZip ? "zip" : "group"));
-
-			std::string baseCombinedGroupFileName;
-
-			if(!modGroupFiles.empty()) {
-				baseCombinedGroupFileName = Utilities::getFileNameNoExtension(modGroupFiles.back()->getFileName());
-			}
-			else if(!modConFiles.empty()) {
-				baseCombinedGroupFileName = Utilities::getFileNameNoExtension(modConFiles.back()->getFileName());
-			}
-			else if(!modDefFiles.empty()) {
-				baseCombinedGroupFileName = Utilities::getFileNameNoExtension(modDefFiles.back()->getFileName());
-			}
+		launchPhaseSpan.beginNextPhase(doesRequireCombinedGroup ? "Combined Group Generation" : "Demo File Collection");
 
-			if(doesRequireCombinedZip) {
-				if(!selectedGameVersion->areZipArchiveGroupsSupported()) {
-					notifyLaunchError(fmt::format("Zip archive group files are not supported by '{}'.", selectedGameVersion->getLongName()));
+		LaunchStagingService::Request launchStagingRequest;
+		launchStagingRequest.sourceGroupFilePaths = allSourceGroupFilePaths;
+		launchStagingRequest.combinedZip = doesRequireCombinedZip;
+		launchStagingRequest.collectDemoFiles = settings->demoExtractionEnabled;
 
-					return false;
-				}
+		if(doesRequireCombinedGroup) {
+			notifyLaunchStatus(fmt::format("Generating combined {} file (this may take some time).", doesRequireCombinedZip ? "zip" : "group"));
 
-				combinedGroupFileName = fmt::format("{}-Combined.zip", baseCombinedGroupFileName.empty() ? "Mod" : baseCombinedGroupFileName);
+			if(doesRequireCombinedZip && !selectedGameVersion->areZipArchiveGroupsSupported()) {
+				notifyLaunchError(fmt::format("Zip archive group files are not supported by '{}'.", selectedGameVersion->getLongName()));
 
-				spdlog::info("Generating combined zip archive file '{}'...", combinedGroupFileName);
+				return false;
 			}
-			else {
-				combinedGroupFileName = (baseCombinedGroupFileName.empty() ? "MOD" : baseCombinedGroupFileName) + ".CMB";
 
-				spdlog::info("Generating combined group file '{}'...", combinedGroupFileName);
-			}
+			combinedGroupFileName = getCombinedGroupFileName(modGroupFiles, modConFiles, modDefFiles, doesRequireCombinedZip);
+
+			spdlog::info("Generating combined {} file '{}'...", doesRequireCombinedZip ? "zip archive" : "group", combinedGroupFileName);
 
 			if(shouldSymlinkToCombinedGroup) {
 				sourceCombinedGroupFilePath = Utilities::joinPaths(settings->appTempDirectoryPath, combinedGroupFileName);
@@ -2930,119 +3818,64 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 				targetCombinedGroupFilePath = combinedGroupFileName;
 			}
 
-			std::shared_ptr<GameVersion> dukeNukemGroupGameVersion;
-			std::unique_ptr<GroupGRP> dukeNukemGroup;
-
 			if(selectedGameVersion->doesRequireOriginalGameFiles()) {
-				dukeNukemGroupGameVersion = m_gameManager->getGroupGameVersion(selectedGameVersion->getID());
+				std::shared_ptr<GameVersion> dukeNukemGroupGameVersion(m_gameManager->getGroupGameVersion(selectedGameVersion->getID()));
 				std::string dukeNukemGroupPath(m_gameManager->getGroupFilePath(selectedGameVersion->getID()));
 
 				if(dukeNukemGroupGameVersion == nullptr || dukeNukemGroupPath.empty()) {
 					return false;
 				}
 
-				dukeNukemGroup = GroupGRP::loadFrom(dukeNukemGroupPath);
-
-				if(dukeNukemGroup == nullptr) {
-					notifyLaunchError(fmt::format("Failed to load '{}' group for creation of combined group from file path: '{}'.", dukeNukemGroupGameVersion->getLongName(), dukeNukemGroupPath));
-					return false;
-				}
-			}
-
-			if(doesRequireCombinedZip) {
-				combinedZip = ZipArchive::createNew(sourceCombinedGroupFilePath);
-
-				if(selectedGameVersion->doesRequireOriginalGameFiles()) {
-					std::shared_ptr<GroupFile> groupFile;
-
-					for(size_t i = 0; i < dukeNukemGroup->numberOfFiles(); i++) {
-						groupFile = dukeNukemGroup->getFile(i);
-						combinedZip->addData(groupFile->transferData(), groupFile->getFileName(), true);
-					}
-
-					spdlog::info("Added {} original '{}' game file{} to combined zip archive file.", dukeNukemGroup->numberOfFiles(), dukeNukemGroupGameVersion->getLongName(), dukeNukemGroup->numberOfFiles() == 1 ? "" : "s");
-
-					dukeNukemGroup.reset();
-				}
+				launchStagingRequest.originalGroupFilePath = dukeNukemGroupPath;
+				launchStagingRequest.originalGroupGameVersionName = dukeNukemGroupGameVersion->getLongName();
 			}
-			else {
-				if(selectedGameVersion->doesRequireOriginalGameFiles()) {
-					combinedGroup = std::move(dukeNukemGroup);
 
-					spdlog::info("Added {} original '{}' game file{} to combined group file.", combinedGroup->numberOfFiles(), dukeNukemGroupGameVersion->getLongName(), combinedGroup->numberOfFiles() == 1 ? "" : "s");
-				}
-				else {
-					combinedGroup = std::make_unique<GroupGRP>();
-				}
+			launchStagingRequest.combinedGroupFileName = combinedGroupFileName;
+			launchStagingRequest.combinedGroupFilePath = sourceCombinedGroupFilePath;
+		}
 
-				combinedGroup->setFilePath(sourceCombinedGroupFilePath);
+		if(launchPlan != nullptr) {
+			if(doesRequireCombinedGroup) {
+				launchPlan->combinedGroup = LaunchPlan::CombinedGroup{ combinedGroupFileName, sourceCombinedGroupFilePath, targetCombinedGroupFilePath, launchStagingRequest.originalGroupFilePath, allSourceGroupFilePaths, doesRequireCombinedZip };
 			}
 		}
+		else {
+			std::unique_ptr<LaunchStagingService::Artifacts> launchArtifacts(m_launchStagingService->takeStagedArtifacts(launchStagingRequest));
 
-		for(const std::string & sourceGroupFilePath : allSourceGroupFilePaths) {
-			if(Utilities::hasFileExtension(sourceGroupFilePath, "zip")) {
-				std::unique_ptr<ZipArchive> modZip(ZipArchive::readFrom(sourceGroupFilePath));
-
-				if(modZip == nullptr) {
-					notifyLaunchError(fmt::format("Failed to load zip archive from file path: '{}'.", sourceGroupFilePath));
-
-					return false;
-				}
-
-				size_t addedFileCount = 0;
-				std::shared_ptr<ArchiveEntry> modZipEntry;
-
-				for(size_t i = 0; i < modZip->numberOfEntries(); i++) {
-					modZipEntry = modZip->getEntry(i);
-
-					if(modZipEntry == nullptr || !modZipEntry->isFile()) {
-						continue;
-					}
-
-					std::unique_ptr<ByteBuffer> modZipEntryData(modZipEntry->getData());
-
-					if(settings->demoExtractionEnabled && Utilities::hasFileExtension(modZipEntry->getPath(), "dmo")) {
-						demoFiles.emplace(modZipEntry->getPath(), std::make_unique<ByteBuffer>(*modZipEntryData));
-					}
-
-					if(combinedZip != nullptr) {
-						combinedZip->addData(std::move(modZipEntryData), modZipEntry->getPath(), true);
-						addedFileCount++;
-					}
-				}
+			if(launchArtifacts != nullptr) {
+				stagedCombinedGroupFilePath = launchArtifacts->stagedCombinedGroupFilePath;
 
-				spdlog::info("Added {} file{} from '{}' to combined zip archive file.", addedFileCount, addedFileCount == 1 ? "" : "s", Utilities::getFileName(sourceGroupFilePath));
+				spdlog::info("Using launch artifacts which were staged in the background.");
 			}
 			else {
-				std::unique_ptr<Group> modGroup(GroupGRP::loadFrom(sourceGroupFilePath));
-
-				if(modGroup == nullptr) {
-					notifyLaunchError(fmt::format("Failed to load group from file path: '{}'.", sourceGroupFilePath));
+				for(const std::string & sourceGroupFilePath : allSourceGroupFilePaths) {
+					std::error_code fileSizeErrorCode;
+					uintmax_t sourceGroupFileSize = std::filesystem::file_size(std::filesystem::path(sourceGroupFilePath), fileSizeErrorCode);
 
-					return false;
+					if(!fileSizeErrorCode) {
+						launchPhaseSpan.addByteCount(sourceGroupFileSize);
+					}
 				}
 
-				std::shared_ptr<GroupFile> groupFile;
+				std::string launchArtifactsErrorMessage;
+				launchArtifacts = LaunchStagingService::createArtifacts(launchStagingRequest, nullptr, &launchArtifactsErrorMessage);
 
-				for(size_t i = 0; i < modGroup->numberOfFiles(); i++) {
-					groupFile = modGroup->getFile(i);
-
-					if(settings->demoExtractionEnabled && Utilities::hasFileExtension(groupFile->getFileName(), "dmo")) {
-						demoFiles.emplace(groupFile->getFileName(), std::make_unique<ByteBuffer>(groupFile->getData()));
-					}
+				if(launchArtifacts == nullptr) {
+					notifyLaunchError(launchArtifactsErrorMessage);
 
-					if(combinedZip != nullptr) {
-						combinedZip->addData(groupFile->transferData(), groupFile->getFileName(), true);
-					}
-					else if(combinedGroup != nullptr) {
-						combinedGroup->addFile(std::make_unique<GroupFile>(groupFile->getFileName(), groupFile->transferData()), true);
-					}
+					return false;
 				}
 
-				spdlog::info("Added {} file{} from '{}' to combined {} file.", modGroup->numberOfFiles(), modGroup->numberOfFiles() == 1 ? "" : "s", Utilities::getFileName(sourceGroupFilePath), combinedZip != nullptr ? "zip archive" : "group");
+				combinedGroup = std::move(launchArtifacts->combinedGroup);
+				combinedZip = std::move(launchArtifacts->combinedZip);
 			}
+
+			demoFiles = std::move(launchArtifacts->demoFiles);
 		}
 	}
+	else if(launchPlan == nullptr) {
+		m_launchStagingService->cancel();
+	}
 
 	std::string customMap;
 	std::string targetCustomMapFilePath;
@@ -3052,7 +3885,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		customMap = m_arguments->getFirstValue("map");
 
 		if(!customMap.empty()) {
-			launchStatus("Configuring custom map file path.");
+			notifyLaunchStatus("Configuring custom map file path.");
+			launchPhaseSpan.beginNextPhase("Custom Map Configuration");
 
 			std::string targetCustomApplicationBaseDirectoryPath;
 			std::string targetCustomMapsBaseDirectoryPath;
@@ -3095,7 +3929,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		temporaryDirectoryName = settings->tempSymlinkName;
 	}
 
-	launchStatus("Congfiguring script arguments.");
+	notifyLaunchStatus("Congfiguring script arguments.");
+	launchPhaseSpan.beginNextPhase("Script Argument Configuration");
 
 	ScriptArguments scriptArgs;
 
@@ -3198,7 +4033,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	std::string combinedDOSBoxConfigurationFilePath;
 
 	if(selectedGameVersion->doesRequireDOSBox()) {
-		launchStatus("Generating combined DOSBox configuration file.");
+		notifyLaunchStatus("Generating combined DOSBox configuration file.");
+		launchPhaseSpan.beginNextPhase("DOSBox Configuration Merge");
 
 		combinedDOSBoxConfigurationFilePath = Utilities::joinPaths(settings->appTempDirectoryPath, DOSBoxConfiguration::DEFAULT_FILE_NAME);
 		combinedDOSBoxConfiguration = std::make_unique<DOSBoxConfiguration>(combinedDOSBoxConfigurationFilePath);
@@ -3228,7 +4064,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 
 	std::chrono::time_point<std::chrono::steady_clock> commandGenerationStartTimePoint(std::chrono::steady_clock::now());
 
-	launchStatus("Generating game launch command.");
+	notifyLaunchStatus("Generating game launch command.");
+	launchPhaseSpan.beginNextPhase("Command Generation");
 
 	std::string command(generateCommand(selectedGameVersion, evaluatedGamePath, allTargetConFilePaths, allTargetDefFilePaths, allTargetGroupFilePaths, scriptArgs, targetCombinedGroupFilePath, combinedDOSBoxConfigurationFilePath, targetCustomMapFilePath));
 
@@ -3241,9 +4078,65 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 
 	spdlog::trace("Generated command string after {} us.", commandGenerationDuration.count());
 
-	launchStatus("Checking for and removing previous mod files from game directory.");
+	if(launchPlan != nullptr) {
+		launchPlan->gameVersionID = selectedGameVersion->getID();
+
+		if(selectedGameVersion->doesRequireDOSBox()) {
+			launchPlan->dosboxVersionID = selectedDOSBoxVersion->getID();
+		}
+
+		if(m_selectedMod != nullptr) {
+			launchPlan->modName = m_selectedMod->getFullName(m_selectedModVersionIndex, m_selectedModVersionTypeIndex);
+		}
+
+		if(selectedModGameVersion != nullptr) {
+			launchPlan->modGameVersionID = selectedModGameVersion->getGameVersionID();
+		}
+
+		launchPlan->gameType = Utilities::toCapitalCase(magic_enum::enum_name(gameType));
+		launchPlan->gamePath = evaluatedGamePath;
+		launchPlan->modFilesInstallPath = modFilesInstallPath;
+		launchPlan->sourceConFilePaths = allSourceConFilePaths;
+		launchPlan->targetConFilePaths = allTargetConFilePaths;
+		launchPlan->sourceDefFilePaths = allSourceDefFilePaths;
+		launchPlan->targetDefFilePaths = allTargetDefFilePaths;
+		launchPlan->sourceGroupFilePaths = allSourceGroupFilePaths;
+		launchPlan->targetGroupFilePaths = allTargetGroupFilePaths;
+
+		if(!targetCustomMapFilePath.empty()) {
+			launchPlan->customMapFile = LaunchPlan::File{ sourceCustomMapFilePath, targetCustomMapFilePath };
+		}
+
+		launchPlan->groupFileExtractionRequired = m_selectedMod != nullptr && selectedGameVersion->doesRequireGroupFileExtraction();
+		launchPlan->command = command;
+
+		if(combinedDOSBoxConfiguration != nullptr) {
+			ByteBuffer combinedDOSBoxConfigurationData;
+
+			if(combinedDOSBoxConfiguration->writeTo(combinedDOSBoxConfigurationData)) {
+				launchPlan->dosboxConfigurationFilePath = combinedDOSBoxConfigurationFilePath;
+				launchPlan->dosboxConfiguration = std::string(reinterpret_cast<const char *>(combinedDOSBoxConfigurationData.getRawData()), combinedDOSBoxConfigurationData.getSize());
+			}
+		}
+
+		if(!createSymlinksOrCopyTemporaryFiles(*selectedGameVersion, evaluatedGamePath, modFilesInstallPath, shouldUseGameTemporaryDirectory, allSourceConFilePaths, allSourceDefFilePaths, allSourceGroupFilePaths, sourceCustomMapFilePath, doesRequireCombinedGroup, shouldConfigureApplicationTemporaryDirectory, nullptr, launchPlan)) {
+			notifyLaunchError("Failed to plan symbolic links or temporary mod files.");
+			return false;
+		}
+
+		return true;
+	}
+
+	notifyLaunchStatus("Checking for and removing previous mod files from game directory.");
+	launchPhaseSpan.beginNextPhase("Previous Mod File Removal");
 
-	if(!removeModFilesFromDirectory(modFilesInstallPath)) {
+	std::unique_ptr<InstalledModInfo> reusableInstalledModInfo;
+
+	if(settings->reuseInstalledModFiles && m_selectedMod != nullptr && selectedGameVersion->doesRequireGroupFileExtraction()) {
+		reusableInstalledModInfo = reuseModFilesInDirectory(modFilesInstallPath, *selectedModVersion, *selectedGameVersion);
+	}
+
+	if(reusableInstalledModInfo == nullptr && !removeModFilesFromDirectory(modFilesInstallPath)) {
 		notifyLaunchError(fmt::format("Failed to remove existing mod files from '{}' game directory.", selectedGameVersion->getLongName()));
 		return false;
 	}
@@ -3254,7 +4147,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	}
 
 	if(combinedDOSBoxConfiguration != nullptr) {
-		launchStatus("Saving combined DOSBox configuration file to temporary directory.");
+		notifyLaunchStatus("Saving combined DOSBox configuration file to temporary directory.");
+		launchPhaseSpan.beginNextPhase("DOSBox Configuration Save");
 
 		if(combinedDOSBoxConfiguration->save()) {
 			spdlog::info("Saved custom combined DOSBox configuration to file: '{}'.", combinedDOSBoxConfiguration->getFilePath());
@@ -3269,7 +4163,23 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	std::unique_ptr<InstalledModInfo> installedModInfo(std::make_unique<InstalledModInfo>(selectedModVersion.get()));
 	installedModInfo->setGameInfo(*selectedGameVersion);
 
-	launchStatus("Creating symbolic links and copying temporary files.");
+	std::vector<std::string> reusableModFiles;
+
+	if(reusableInstalledModInfo != nullptr) {
+		reusableModFiles = reusableInstalledModInfo->getModFiles();
+
+		// reused mod files are tracked from the start so that they are still cleaned up if the launch fails before extraction
+		for(const std::string & reusableModFile : reusableModFiles) {
+			installedModInfo->addModFile(reusableModFile);
+		}
+
+		for(const std::string & reusableOriginalFile : reusableInstalledModInfo->getOriginalFiles()) {
+			installedModInfo->addOriginalFile(reusableOriginalFile);
+		}
+	}
+
+	notifyLaunchStatus("Creating symbolic links and copying temporary files.");
+	launchPhaseSpan.beginNextPhase("Symlink Creation and File Copying");
 
 	if(!createSymlinksOrCopyTemporaryFiles(*selectedGameVersion, evaluatedGamePath, modFilesInstallPath, shouldUseGameTemporaryDirectory, allSourceConFilePaths, allSourceDefFilePaths, allSourceGroupFilePaths, sourceCustomMapFilePath, doesRequireCombinedGroup, shouldConfigureApplicationTemporaryDirectory, installedModInfo.get())) {
 		if(!removeModFilesFromDirectory(modFilesInstallPath, *installedModInfo)) {
@@ -3282,12 +4192,13 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	}
 
 	if(!standAlone && (hasAnyGroupFiles || selectedGameVersion->hasConflictingGameFiles())) {
-		launchStatus("Backing up conflicting files in game directory.");
+		notifyLaunchStatus("Backing up conflicting files in game directory.");
+		launchPhaseSpan.beginNextPhase("Conflicting File Backup");
 
 		size_t totalNumberOfBackedUpConflictingGameFiles = 0;
 
 		for(const std::string & conflictingGameFileExtension : CONFLICTING_GAME_FILE_EXTENSIONS) {
-			std::vector<std::string> originalRenamedGameFilePaths(ModManager::renameFilesWithSuffixTo(conflictingGameFileExtension, conflictingGameFileExtension + DEFAULT_BACKUP_FILE_RENAME_SUFFIX, modFilesInstallPath));
+			std::vector<std::string> originalRenamedGameFilePaths(ModManager::renameFilesWithSuffixTo(conflictingGameFileExtension, conflictingGameFileExtension + DEFAULT_BACKUP_FILE_RENAME_SUFFIX, modFilesInstallPath, reusableModFiles));
 
 			for(const std::string & originalRenamedGameFilePath : originalRenamedGameFilePaths) {
 				installedModInfo->addOriginalFile(originalRenamedGameFilePath);
@@ -3313,6 +4224,13 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 				continue;
 			}
 
+			// reused mod files are still in place from the previous launch and their original files were already backed up
+			if(std::find_if(reusableModFiles.cbegin(), reusableModFiles.cend(), [&conflictingGameFileName](const std::string & reusableModFile) {
+				return Utilities::areStringsEqualIgnoreCase(conflictingGameFileName, reusableModFile);
+			}) != reusableModFiles.cend()) {
+				continue;
+			}
+
 			std::filesystem::path newGameFilePath(Utilities::replaceFileExtension(originalGameFilePath.string(), std::string(Utilities::getFileExtension(conflictingGameFileName)) + "_"));
 
 			spdlog::info("Renaming conflicting game file: '{}' to '{}'.", originalGameFilePath.string(), newGameFilePath.string());
@@ -3343,14 +4261,16 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	}
 
 	if(!selectedGameVersion->doesRequireGroupFileExtraction() && !m_demoRecordingEnabled && settings->demoExtractionEnabled) {
-		launchStatus("Extracting mod demo files to game directory.");
+		notifyLaunchStatus("Extracting mod demo files to game directory.");
+		launchPhaseSpan.beginNextPhase("Demo Extraction");
 
 		size_t numberOfDemoFilesWritten = 0;
 		size_t demoFileNumber = 1;
 
-		for(std::map<std::string, std::unique_ptr<ByteBuffer>, FileNameComparator>::const_iterator i = demoFiles.cbegin(); i != demoFiles.cend(); ++i) {
+		for(LaunchStagingService::DemoFileMap::const_iterator i = demoFiles.cbegin(); i != demoFiles.cend(); ++i) {
 			if(i->second->writeTo(Utilities::joinPaths(modFilesInstallPath, i->first))) {
 				numberOfDemoFilesWritten++;
+				launchPhaseSpan.addByteCount(i->second->getSize());
 				installedModInfo->addModFile(i->first);
 
 				spdlog::debug("Wrote demo #{}/{} '{}' to directory '{}'.", demoFileNumber++, demoFiles.size(), i->first, modFilesInstallPath);
@@ -3365,12 +4285,28 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		spdlog::info("Wrote {} demo{} to directory '{}'.", numberOfDemoFilesWritten, numberOfDemoFilesWritten == 1 ? "" : "s", modFilesInstallPath);
 	}
 
-	if(combinedGroup != nullptr || combinedZip != nullptr) {
-		launchStatus(fmt::format("Saving combined {} file.", combinedZip != nullptr ? "zip" : "group"));
+	if(combinedGroup != nullptr || combinedZip != nullptr || !stagedCombinedGroupFilePath.empty()) {
+		notifyLaunchStatus(fmt::format("Saving combined {} file.", doesRequireCombinedZip ? "zip" : "group"));
+		launchPhaseSpan.beginNextPhase("Combined Group Save");
 
 		bool combinedGroupOrZipArchiveSaved = false;
 
-		if(combinedZip != nullptr) {
+		if(!stagedCombinedGroupFilePath.empty()) {
+			std::error_code errorCode;
+			std::filesystem::rename(std::filesystem::path(stagedCombinedGroupFilePath), std::filesystem::path(sourceCombinedGroupFilePath), errorCode);
+
+			// the staged file cannot be renamed if the game is installed on a different volume
+			if(errorCode) {
+				errorCode.clear();
+				std::filesystem::copy_file(std::filesystem::path(stagedCombinedGroupFilePath), std::filesystem::path(sourceCombinedGroupFilePath), std::filesystem::copy_options::overwrite_existing, errorCode);
+
+				std::error_code removeErrorCode;
+				std::filesystem::remove(std::filesystem::path(stagedCombinedGroupFilePath), removeErrorCode);
+			}
+
+			combinedGroupOrZipArchiveSaved = !errorCode;
+		}
+		else if(combinedZip != nullptr) {
 			combinedGroupOrZipArchiveSaved = combinedZip->save();
 		}
 		else {
@@ -3378,6 +4314,13 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		}
 
 		if(combinedGroupOrZipArchiveSaved) {
+			std::error_code fileSizeErrorCode;
+			uintmax_t combinedGroupFileSize = std::filesystem::file_size(std::filesystem::path(sourceCombinedGroupFilePath), fileSizeErrorCode);
+
+			if(!fileSizeErrorCode) {
+				launchPhaseSpan.addByteCount(combinedGroupFileSize);
+			}
+
 			if(!shouldSymlinkToCombinedGroup) {
 				std::error_code errorCode;
 				std::filesystem::path relativeCombinedGroupFilePath(std::filesystem::relative(std::filesystem::path(sourceCombinedGroupFilePath), std::filesystem::path(modFilesInstallPath), errorCode));
@@ -3407,9 +4350,10 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	}
 
 	if(m_selectedMod != nullptr && selectedGameVersion->doesRequireGroupFileExtraction()) {
-		launchStatus("Extracting group file contents to game directory.");
+		notifyLaunchStatus("Extracting group file contents to game directory.");
+		launchPhaseSpan.beginNextPhase("Group File Extraction");
 
-		if(!extractModFilesToDirectory(modFilesInstallPath, *selectedModGameVersion, *selectedGameVersion, *selectedGameVersion, installedModInfo.get(), allSourceGroupFilePaths)) {
+		if(!extractModFilesToDirectory(modFilesInstallPath, *selectedModGameVersion, *selectedGameVersion, *selectedGameVersion, installedModInfo.get(), allSourceGroupFilePaths, reusableInstalledModInfo.get())) {
 			if(!removeModFilesFromDirectory(modFilesInstallPath, *installedModInfo)) {
 				spdlog::error("Failed to remove '{}' mod files from '{}' game directory.", selectedModVersionType->getFullName(), selectedGameVersion->getLongName());
 			}
@@ -3421,7 +4365,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 	}
 
 	if(installedModInfo != nullptr && !installedModInfo->isEmpty()) {
-		launchStatus("Saving installed mod info to file in game directory.");
+		notifyLaunchStatus("Saving installed mod info to file in game directory.");
+		launchPhaseSpan.beginNextPhase("Installed Mod Info Save");
 
 		if(installedModInfo->saveToDirectory(modFilesInstallPath)) {
 			spdlog::info("Saved installed mod info to file '{}' in '{}' game directory: '{}'.", InstalledModInfo::DEFAULT_FILE_NAME, selectedGameVersion->getLongName(), modFilesInstallPath);
@@ -3439,6 +4384,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 
 	std::chrono::milliseconds runDelayDuration(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - runStartTimePoint));
 
+	launchPhaseSpan.beginNextPhase("Analytics Tracking");
+
 	std::map<std::string, std::any> properties;
 
 	if(settings->segmentAnalyticsEnabled) {
@@ -3550,7 +4497,8 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 
 	segmentAnalytics->flush();
 
-	launchStatus("Starting game process.");
+	notifyLaunchStatus("Starting game process.");
+	launchPhaseSpan.beginNextPhase("Process Spawn");
 
 	std::string workingDirectory(selectedGameVersion->doesRequireDOSBox() ? selectedDOSBoxVersion->getDirectoryPath() : evaluatedGamePath);
 
@@ -3569,6 +4517,15 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		return false;
 	}
 
+	launchPhaseSpan.end();
+	launchSpan.end();
+
+	for(const std::string & summaryLine : m_phaseProfiler->getSummary(launchSpan)) {
+		spdlog::info(summaryLine);
+	}
+
+	savePhaseProfileTrace();
+
 	boost::signals2::connection terminatedConnection(m_gameProcess->terminated.connect([this, gameTypeName](uint64_t nativeExitCode, bool forceTerminated) {
 		spdlog::info("{} process {} with code: '{}'.", gameTypeName, forceTerminated ? "force terminated" : "exited", nativeExitCode);
 
@@ -3583,13 +4540,18 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 
 	launched();
 
-	launchStatus("Game running.");
+	notifyLaunchStatus("Game running.");
 
 	m_gameProcess->wait();
 	terminatedConnection.disconnect();
 
 	if(installedModInfo != nullptr && !installedModInfo->isEmpty()) {
-		if(!removeModFilesFromDirectory(modFilesInstallPath, *installedModInfo)) {
+		if(settings->reuseInstalledModFiles && installedModInfo->numberOfModFileContents() != 0) {
+			if(!retainReusableModFilesInDirectory(modFilesInstallPath, *installedModInfo)) {
+				spdlog::error("Failed to remove non-reusable '{}' mod files from '{}' game directory.", selectedModVersionType->getFullName(), selectedGameVersion->getLongName());
+			}
+		}
+		else if(!removeModFilesFromDirectory(modFilesInstallPath, *installedModInfo)) {
 			spdlog::error("Failed to remove '{}' mod files from '{}' game directory.", selectedModVersionType->getFullName(), selectedGameVersion->getLongName());
 		}
 	}
@@ -3598,7 +4560,7 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		std::filesystem::path filePath(sourceCombinedGroupFilePath);
 
 		if(std::filesystem::is_regular_file(filePath)) {
-			launchStatus(fmt::format("Deleting generated combined {} file.", doesRequireCombinedZip ? "zip" : "group"));
+			notifyLaunchStatus(fmt::format("Deleting generated combined {} file.", doesRequireCombinedZip ? "zip" : "group"));
 
 			spdlog::info("Deleting temporary combined group file: '{}'.", sourceCombinedGroupFilePath);
 
@@ -3615,7 +4577,7 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		std::filesystem::path filePath(combinedDOSBoxConfigurationFilePath);
 
 		if(std::filesystem::is_regular_file(filePath)) {
-			launchStatus("Deleting generated combined DOSBox configuration file.");
+			notifyLaunchStatus("Deleting generated combined DOSBox configuration file.");
 
 			spdlog::info("Deleting generated combined DOSBox configuration file: '{}'.", combinedDOSBoxConfigurationFilePath);
 
@@ -3628,13 +4590,22 @@ bool ModManager::runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersio
 		}
 	}
 
-	launchStatus("Removing symbolic links.");
+	notifyLaunchStatus("Removing symbolic links.");
 
 	removeSymlinks(*selectedGameVersion, modFilesInstallPath, shouldUseGameTemporaryDirectory);
 
 	m_gameProcess.reset();
 
-	launchStatus("Game process ended.");
+	// the mod list is only downloaded on start up otherwise, so pick up any newer revision once the game has exited
+	// the delta is applied later from the caller's thread, since applying it updates the mod list display
+	if(!m_localMode && m_downloadManager->shouldUpdateModList()) {
+		m_pendingModListDelta = createModListDelta();
+	}
+
+	// the same mod is frequently launched again, so its launch artifacts are staged again once the game has exited
+	stageSelectedModLaunch();
+
+	notifyLaunchStatus("Game process ended.");
 
 	return true;
 }
@@ -3651,17 +4622,34 @@ std::shared_ptr<Process> ModManager::getGameProcess() const {
 	return m_gameProcess;
 }
 
-bool ModManager::terminateGameProcess() {
+void ModManager::applyPendingLaunchUpdates() {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	if(m_gameProcess == nullptr || !m_gameProcess->isRunning()) {
-		return false;
+	if(m_pendingDownloadStatusMod != nullptr) {
+		m_organizedMods->updateModDownloadStatus(*m_pendingDownloadStatusMod);
+		m_pendingDownloadStatusMod.reset();
 	}
 
-	m_gameProcess->terminate();
-	m_gameProcess.reset();
+	if(m_pendingModListDelta != nullptr) {
+		std::unique_ptr<ModCollectionDelta> modListDelta(std::move(m_pendingModListDelta));
 
-	return true;
+		if(!applyModListDelta(*modListDelta)) {
+			spdlog::error("Failed to apply updated mod list after launch.");
+		}
+	}
+}
+
+bool ModManager::terminateGameProcess() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(m_gameProcess == nullptr || !m_gameProcess->isRunning()) {
+		return false;
+	}
+
+	m_gameProcess->terminate();
+	m_gameProcess.reset();
+
+	return true;
 }
 
 SignalConnectionGroup ModManager::connectDownloadManagerSignals() {
@@ -3675,28 +4663,132 @@ SignalConnectionGroup ModManager::connectDownloadManagerSignals() {
 	);
 }
 
+void ModManager::notifyLaunchStatus(const std::string & statusMessage) {
+	if(m_planningLaunch) {
+		return;
+	}
+
+	launchStatus(statusMessage);
+}
+
 void ModManager::notifyLaunchError(const std::string & errorMessage) {
 	spdlog::error(errorMessage);
+
+	if(m_planningLaunch) {
+		return;
+	}
+
 	launchError(errorMessage);
 }
 
+void ModManager::savePhaseProfileTrace() const {
+	if(m_arguments == nullptr || !m_arguments->hasArgument("trace")) {
+		return;
+	}
+
+	std::string traceFilePath(m_arguments->getFirstValue("trace"));
+
+	if(traceFilePath.empty()) {
+		spdlog::error("Missing phase profile trace file path argument value.");
+		return;
+	}
+
+	m_phaseProfiler->saveChromeTraceTo(traceFilePath);
+}
+
+void ModManager::stageSelectedModLaunch() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_initialized || m_gameProcess != nullptr || SettingsManager::getInstance()->appTempDirectoryPath.empty()) {
+		m_launchStagingService->cancel();
+		return;
+	}
+
+	// creating the launch plan touches the file system, so it is deferred to the staging service rather than done on every selection change
+	m_launchStagingService->schedule([this](const std::atomic<bool> & cancelled) -> std::unique_ptr<LaunchStagingService::Request> {
+		// the lock is held for as long as a game is running, so planning gives up once it is cancelled instead of blocking on it
+		std::unique_lock<std::recursive_mutex> lock(m_mutex, std::defer_lock);
+
+		while(!lock.try_lock()) {
+			if(cancelled) {
+				return nullptr;
+			}
+
+			std::this_thread::sleep_for(10ms);
+		}
+
+		SettingsManager * settings = SettingsManager::getInstance();
+
+		if(cancelled || !m_initialized || m_gameProcess != nullptr || settings->appTempDirectoryPath.empty()) {
+			return nullptr;
+		}
+
+		// the staging request is derived from the same launch plan that is used when the selected mod is run, so that the staged artifacts match the launch
+		std::unique_ptr<LaunchPlan> launchPlan(createLaunchPlan());
+
+		if(launchPlan == nullptr || (!launchPlan->combinedGroup.has_value() && (m_demoRecordingEnabled || !settings->demoExtractionEnabled))) {
+			return nullptr;
+		}
+
+		std::unique_ptr<LaunchStagingService::Request> launchStagingRequest(std::make_unique<LaunchStagingService::Request>());
+		launchStagingRequest->collectDemoFiles = settings->demoExtractionEnabled;
+
+		if(launchPlan->combinedGroup.has_value()) {
+			const LaunchPlan::CombinedGroup & combinedGroup = launchPlan->combinedGroup.value();
+
+			if(!combinedGroup.originalGroupFilePath.empty()) {
+				std::shared_ptr<GameVersion> dukeNukemGroupGameVersion(m_gameManager->getGroupGameVersion(launchPlan->gameVersionID));
+
+				if(dukeNukemGroupGameVersion == nullptr) {
+					return nullptr;
+				}
+
+				launchStagingRequest->originalGroupFilePath = combinedGroup.originalGroupFilePath;
+				launchStagingRequest->originalGroupGameVersionName = dukeNukemGroupGameVersion->getLongName();
+			}
+
+			launchStagingRequest->sourceGroupFilePaths = combinedGroup.sourceGroupFilePaths;
+			launchStagingRequest->combinedGroupFileName = combinedGroup.fileName;
+			launchStagingRequest->combinedGroupFilePath = Utilities::joinPaths(settings->appTempDirectoryPath, fmt::format("Staged-{}", combinedGroup.fileName));
+			launchStagingRequest->combinedZip = combinedGroup.zipArchive;
+		}
+		else {
+			launchStagingRequest->sourceGroupFilePaths = launchPlan->sourceGroupFilePaths;
+			launchStagingRequest->combinedZip = false;
+		}
+
+		return launchStagingRequest;
+	});
+}
+
+std::string ModManager::getCombinedGroupFileName(const std::vector<std::shared_ptr<ModFile>> & modGroupFiles, const std::vector<std::shared_ptr<ModFile>> & modConFiles, const std::vector<std::shared_ptr<ModFile>> & modDefFiles, bool combinedZip) {
+	std::string baseCombinedGroupFileName;
+
+	if(!modGroupFiles.empty()) {
+		baseCombinedGroupFileName = Utilities::getFileNameNoExtension(modGroupFiles.back()->getFileName());
+	}
+	else if(!modConFiles.empty()) {
+		baseCombinedGroupFileName = Utilities::getFileNameNoExtension(modConFiles.back()->getFileName());
+	}
+	else if(!modDefFiles.empty()) {
+		baseCombinedGroupFileName = Utilities::getFileNameNoExtension(modDefFiles.back()->getFileName());
+	}
+
+	if(combinedZip) {
+		return fmt::format("{}-Combined.zip", baseCombinedGroupFileName.empty() ? "Mod" : baseCombinedGroupFileName);
+	}
+
+	return (baseCombinedGroupFileName.empty() ? "MOD" : baseCombinedGroupFileName) + ".CMB";
+}
+
 bool ModManager::areModFilesPresentInDirectory(const std::string & modFilesInstallPath) {
 	return !modFilesInstallPath.empty() &&
 		   std::filesystem::is_regular_file(std::filesystem::path(Utilities::joinPaths(modFilesInstallPath, InstalledModInfo::DEFAULT_FILE_NAME)));
 }
 
-bool ModManager::extractModFilesToDirectory(const std::string & modFilesInstallPath, const ModGameVersion & modGameVersion, const GameVersion & selectedGameVersion, const GameVersion & targetGameVersion, InstalledModInfo * installedModInfo, const std::vector<std::string> & groupFilePaths) {
+bool ModManager::extractModFilesToDirectory(const std::string & modFilesInstallPath, const ModGameVersion & modGameVersion, const GameVersion & selectedGameVersion, const GameVersion & targetGameVersion, InstalledModInfo * installedModInfo, const std::vector<std::string> & groupFilePaths, const InstalledModInfo * reusableInstalledModInfo) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	struct FilePathComparator {
-	public:
-		bool operator () (const std::string & filePathA, const std::string & filePathB) const {
-			return std::lexicographical_compare(filePathA.begin(), filePathA.end(), filePathB.begin(), filePathB.end(), [](unsigned char a, unsigned char b) {
-				return std::tolower(a) < std::tolower(b);
-			});
-		}
-	};
-
 	if(modFilesInstallPath.empty()) {
 		spdlog::error("Failed to extract '{}' mod files to '{}' game directory due to empty mod files install path.", modGameVersion.getFullName(true), selectedGameVersion.getLongName());
 		return false;
@@ -3712,63 +4804,109 @@ bool ModManager::extractModFilesToDirectory(const std::string & modFilesInstallP
 		return false;
 	}
 
-	SettingsManager * settings = SettingsManager::getInstance();
-
-	std::map<std::string, std::unique_ptr<ByteBuffer>, FilePathComparator> modFiles;
-	std::string modPath(Utilities::joinPaths(settings->modsDirectoryPath, targetGameVersion.getModDirectoryName()));
+	// only the locations of the mod files within their groups are indexed up front, the file data is streamed straight to disk during extraction
+	ModFileExtractionService modFileExtractionService;
 
 	for(const std::string & groupFilePath : groupFilePaths) {
-		if(Utilities::hasFileExtension(groupFilePath, "zip")) {
-			std::unique_ptr<ZipArchive> zipArchive(ZipArchive::readFrom(groupFilePath));
+		if(!modFileExtractionService.addSourceFile(groupFilePath)) {
+			return false;
+		}
+	}
 
-			if(zipArchive == nullptr) {
-				spdlog::error("Failed to open zip archive file: '{}'.", groupFilePath);
-				return false;
+	if(modFileExtractionService.numberOfFiles() == 0 && reusableInstalledModInfo == nullptr) {
+		spdlog::debug("No mod files to extract to '{}' game directory.", selectedGameVersion.getLongName());
+		return true;
+	}
+
+	bool isRunningNonBetaModOnBetaGameVersion = Utilities::areStringsEqualIgnoreCase(selectedGameVersion.getID(), GameVersion::ORIGINAL_BETA_VERSION.getID()) &&
+												!Utilities::areStringsEqualIgnoreCase(modGameVersion.getGameVersionID(), GameVersion::ORIGINAL_BETA_VERSION.getID());
+
+	if(isRunningNonBetaModOnBetaGameVersion) {
+		for(const std::string & modFileName : modFileExtractionService.getFileNames()) {
+			if(Utilities::hasFileExtension(modFileName, "DMO")) {
+				spdlog::info("Skipping extraction of '{}' demo file '{}' into '{}' game directory.", modGameVersion.getFullName(true), modFileName, selectedGameVersion.getLongName());
+
+				modFileExtractionService.removeFile(modFileName);
 			}
+		}
+	}
 
-			std::vector<std::shared_ptr<ArchiveEntry>> zipArchiveEntries(zipArchive->getEntries());
+	std::vector<std::string> retainedModFileNames;
+
+	if(reusableInstalledModInfo != nullptr && installedModInfo != nullptr) {
+		FileFingerprintCache * fileFingerprintCache = FileFingerprintCache::getInstance();
+		size_t numberOfReusedModFiles = 0;
+
+		for(const std::string & reusableModFile : reusableInstalledModInfo->getModFiles()) {
+			std::string fullReusableModFilePath(Utilities::joinPaths(modFilesInstallPath, reusableModFile));
+
+			if(modFileExtractionService.hasFile(reusableModFile)) {
+				retainedModFileNames.push_back(reusableModFile);
+
+				const InstalledModInfo::ModFileContent * reusableModFileContent = reusableInstalledModInfo->getModFileContent(reusableModFile);
+				std::string sourceKey(modFileExtractionService.getFileSourceKey(reusableModFile));
+
+				// unchanged mod files are left in place from the previous launch, changed ones are replaced by extracting them again
+				if(reusableModFileContent != nullptr &&
+				   !sourceKey.empty() &&
+				   Utilities::areStringsEqual(reusableModFileContent->sourceKey, sourceKey) &&
+				   Utilities::areStringsEqualIgnoreCase(fileFingerprintCache->getFileSHA1Hash(fullReusableModFilePath), reusableModFileContent->sha1)) {
+					modFileExtractionService.removeFile(reusableModFile);
+					installedModInfo->setModFileContent(reusableModFile, reusableModFileContent->sha1, sourceKey);
+					numberOfReusedModFiles++;
 
-			for(const std::shared_ptr<ArchiveEntry> & zipArchiveEntry : zipArchiveEntries) {
-				if(zipArchiveEntry == nullptr || !zipArchiveEntry->isFile()) {
 					continue;
 				}
 
-				modFiles[zipArchiveEntry->getName()] = zipArchiveEntry->getData();
+				spdlog::debug("Replacing changed '{}' mod file '{}' in '{}' game directory.", modGameVersion.getFullName(true), reusableModFile, selectedGameVersion.getLongName());
 			}
-		}
-		else {
-			std::unique_ptr<Group> group(GroupGRP::loadFrom(groupFilePath));
+			else {
+				spdlog::debug("Removing obsolete '{}' mod file '{}' from '{}' game directory.", modGameVersion.getFullName(true), reusableModFile, selectedGameVersion.getLongName());
 
-			if(!Group::isValid(group.get())) {
-				spdlog::error("Failed to open group file: '{}'.", groupFilePath);
-				return false;
+				installedModInfo->removeModFile(reusableModFile);
 			}
 
-			std::shared_ptr<GroupFile> currentGroupFile;
+			std::error_code errorCode;
+			std::filesystem::remove(std::filesystem::path(fullReusableModFilePath), errorCode);
+
+			if(errorCode) {
+				spdlog::error("Failed to remove previous '{}' mod file '{}' from '{}' game directory: {}", modGameVersion.getFullName(true), reusableModFile, selectedGameVersion.getLongName(), errorCode.message());
+			}
 
-			for(size_t i = 0; i < group->numberOfFiles(); i++) {
-				currentGroupFile = group->getFile(i);
+			// original files of obsolete mod files are restored immediately, since nothing else will replace them
+			if(!modFileExtractionService.hasFile(reusableModFile) && reusableInstalledModInfo->hasOriginalFile(reusableModFile)) {
+				std::filesystem::rename(std::filesystem::path(fullReusableModFilePath + DEFAULT_BACKUP_FILE_RENAME_SUFFIX), std::filesystem::path(fullReusableModFilePath), errorCode);
 
-				modFiles[currentGroupFile->getFileName()] = currentGroupFile->transferData();
+				if(errorCode) {
+					spdlog::error("Failed to restore original '{}' file '{}': {}", selectedGameVersion.getLongName(), reusableModFile, errorCode.message());
+				}
+				else {
+					installedModInfo->removeOriginalFile(reusableModFile);
+				}
 			}
 		}
-	}
 
-	if(modFiles.empty()) {
-		spdlog::debug("No mod files to extract to '{}' game directory.", selectedGameVersion.getLongName());
-		return true;
+		spdlog::info("Reusing {} of {} '{}' mod file{} previously installed to '{}' game directory.", numberOfReusedModFiles, reusableInstalledModInfo->numberOfModFiles(), modGameVersion.getFullName(true), reusableInstalledModInfo->numberOfModFiles() == 1 ? "" : "s", selectedGameVersion.getLongName());
 	}
 
+	std::vector<std::string> modFileNames(modFileExtractionService.getFileNames());
 	std::vector<std::string> originalFilePaths;
 
-	for(auto modFilesIterator = modFiles.cbegin(); modFilesIterator != modFiles.cend(); ++modFilesIterator) {
-		if(std::filesystem::is_regular_file(std::filesystem::path(Utilities::joinPaths(modFilesInstallPath, modFilesIterator->first)))) {
-			if(std::filesystem::is_regular_file(std::filesystem::path(Utilities::joinPaths(modFilesInstallPath, modFilesIterator->first) + DEFAULT_BACKUP_FILE_RENAME_SUFFIX))) {
-				spdlog::error("Cannot temporarily rename original '{}' file, original backup file already exists at path: '{}'. Please manually restore or remove this file.", selectedGameVersion.getLongName(), Utilities::joinPaths(modFilesInstallPath, modFilesIterator->first) + DEFAULT_BACKUP_FILE_RENAME_SUFFIX);
+	for(const std::string & modFileName : modFileNames) {
+		// previously installed mod files already had their original files backed up
+		if(std::find_if(retainedModFileNames.cbegin(), retainedModFileNames.cend(), [&modFileName](const std::string & retainedModFileName) {
+			return Utilities::areStringsEqualIgnoreCase(modFileName, retainedModFileName);
+		}) != retainedModFileNames.cend()) {
+			continue;
+		}
+
+		if(std::filesystem::is_regular_file(std::filesystem::path(Utilities::joinPaths(modFilesInstallPath, modFileName)))) {
+			if(std::filesystem::is_regular_file(std::filesystem::path(Utilities::joinPaths(modFilesInstallPath, modFileName) + DEFAULT_BACKUP_FILE_RENAME_SUFFIX))) {
+				spdlog::error("Cannot temporarily rename original '{}' file, original backup file already exists at path: '{}'. Please manually restore or remove this file.", selectedGameVersion.getLongName(), Utilities::joinPaths(modFilesInstallPath, modFileName) + DEFAULT_BACKUP_FILE_RENAME_SUFFIX);
 				return false;
 			}
 
-			originalFilePaths.push_back(modFilesIterator->first);
+			originalFilePaths.push_back(modFileName);
 		}
 	}
 
@@ -3792,29 +4930,29 @@ bool ModManager::extractModFilesToDirectory(const std::string & modFilesInstallP
 		}
 	}
 
-	size_t fileNumber = 1;
+	// recorded contents allow unchanged mod files to be reused by the next launch instead of being extracted again
+	bool shouldRecordModFileContents = installedModInfo != nullptr && SettingsManager::getInstance()->reuseInstalledModFiles;
 
-	bool isRunningNonBetaModOnBetaGameVersion = Utilities::areStringsEqualIgnoreCase(selectedGameVersion.getID(), GameVersion::ORIGINAL_BETA_VERSION.getID()) &&
-												!Utilities::areStringsEqualIgnoreCase(modGameVersion.getGameVersionID(), GameVersion::ORIGINAL_BETA_VERSION.getID());
-
-	for(auto modFilesIterator = modFiles.cbegin(); modFilesIterator != modFiles.cend(); ++modFilesIterator, fileNumber++) {
-		if(isRunningNonBetaModOnBetaGameVersion && Utilities::hasFileExtension(modFilesIterator->first, "DMO")) {
-			spdlog::info("Skipping extraction of '{}' demo file '{}' into '{}' game directory.", modGameVersion.getFullName(true), modFilesIterator->first, selectedGameVersion.getLongName());
-			continue;
+	std::vector<ModFileExtractionService::ExtractedFile> extractedModFiles(modFileExtractionService.extractFiles(modFilesInstallPath, shouldRecordModFileContents, [&selectedGameVersion](size_t fileNumber, size_t numberOfFiles, const std::string & modFileName, bool extracted) {
+		if(extracted) {
+			spdlog::info("Extracted mod file #{} of {} ('{}') to '{}' game directory.", fileNumber, numberOfFiles, modFileName, selectedGameVersion.getLongName());
 		}
+		else {
+			spdlog::error("Failed to write mod file #{} of {} ('{}') to '{}' game directory.", fileNumber, numberOfFiles, modFileName, selectedGameVersion.getLongName());
+		}
+	}));
 
-		std::string fullModFilePath(Utilities::joinPaths(modFilesInstallPath, modFilesIterator->first));
+	if(installedModInfo != nullptr) {
+		for(const ModFileExtractionService::ExtractedFile & extractedModFile : extractedModFiles) {
+			installedModInfo->addModFile(extractedModFile.fileName);
 
-		if(!modFilesIterator->second->writeTo(fullModFilePath)) {
-			spdlog::error("Failed to write mod file #{} of {} ('{}') to '{}' game directory.", fileNumber, modFiles.size(), modFilesIterator->first, selectedGameVersion.getLongName());
-			continue;
-		}
+			if(shouldRecordModFileContents) {
+				installedModInfo->setModFileContent(extractedModFile.fileName, extractedModFile.sha1, modFileExtractionService.getFileSourceKey(extractedModFile.fileName));
 
-		if(installedModInfo != nullptr) {
-			installedModInfo->addModFile(modFilesIterator->first);
+				// the next launch verifies reusable mod files against the fingerprint cache, so the hash computed during extraction is remembered there
+				FileFingerprintCache::getInstance()->setFileSHA1Hash(Utilities::joinPaths(modFilesInstallPath, extractedModFile.fileName), extractedModFile.sha1);
+			}
 		}
-
-		spdlog::info("Extracted mod file #{} of {} ('{}') to '{}' game directory.", fileNumber, modFiles.size(), modFilesIterator->first, selectedGameVersion.getLongName());
 	}
 
 	return true;
@@ -3864,6 +5002,7 @@ bool ModManager::removeModFilesFromDirectory(const std::string & modFilesInstall
 				continue;
 			}
 
+			// hard linked and cloned files share their data with the source mod file, so they are only ever unlinked and never truncated or overwritten
 			std::error_code errorCode;
 			std::filesystem::remove(std::filesystem::path(fullModFilePath), errorCode);
 
@@ -3936,6 +5075,65 @@ bool ModManager::removeModFilesFromDirectory(const std::string & modFilesInstall
 	return true;
 }
 
+bool ModManager::retainReusableModFilesInDirectory(const std::string & modFilesInstallPath, const InstalledModInfo & installedModInfo) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	std::unique_ptr<InstalledModInfo> reusableInstalledModInfo(installedModInfo.createReusableInstallation());
+	InstalledModInfo remainingInstalledModInfo(installedModInfo);
+
+	for(const std::string & reusableModFile : reusableInstalledModInfo->getModFiles()) {
+		remainingInstalledModInfo.removeModFile(reusableModFile);
+		remainingInstalledModInfo.removeOriginalFile(reusableModFile);
+	}
+
+	if(!removeModFilesFromDirectory(modFilesInstallPath, remainingInstalledModInfo)) {
+		return false;
+	}
+
+	if(reusableInstalledModInfo->isEmpty()) {
+		return true;
+	}
+
+	// the reduced installed mod info is saved so that the retained files are still restored if a different mod is launched next
+	if(!reusableInstalledModInfo->saveToDirectory(modFilesInstallPath)) {
+		spdlog::error("Failed to save reusable installed mod info to '{}' game directory.", installedModInfo.getGameLongName());
+		return false;
+	}
+
+	spdlog::info("Retained {} reusable '{}' mod file{} in '{}' game directory.", reusableInstalledModInfo->numberOfModFiles(), installedModInfo.getFullModName(), reusableInstalledModInfo->numberOfModFiles() == 1 ? "" : "s", installedModInfo.getGameLongName());
+
+	return true;
+}
+
+std::unique_ptr<InstalledModInfo> ModManager::reuseModFilesInDirectory(const std::string & modFilesInstallPath, const ModVersion & modVersion, const GameVersion & gameVersion) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!areModFilesPresentInDirectory(modFilesInstallPath)) {
+		return nullptr;
+	}
+
+	std::unique_ptr<InstalledModInfo> previousInstalledModInfo(InstalledModInfo::loadFromDirectory(modFilesInstallPath));
+
+	if(previousInstalledModInfo == nullptr) {
+		return nullptr;
+	}
+
+	InstalledModInfo selectedInstalledModInfo(&modVersion);
+	selectedInstalledModInfo.setGameInfo(gameVersion);
+
+	if(!previousInstalledModInfo->isSameInstallationAs(selectedInstalledModInfo)) {
+		return nullptr;
+	}
+
+	std::unique_ptr<InstalledModInfo> reusableInstalledModInfo(previousInstalledModInfo->createReusableInstallation());
+
+	if(reusableInstalledModInfo->numberOfModFiles() == 0 || !retainReusableModFilesInDirectory(modFilesInstallPath, *previousInstalledModInfo)) {
+		return nullptr;
+	}
+
+	return reusableInstalledModInfo;
+}
+
 std::string ModManager::generateCommand(std::shared_ptr<GameVersion> gameVersion, const std::string & evaluatedGamePath, const std::vector<std::string> & targetConFilePaths, const std::vector<std::string> & targetDefFilePaths, const std::vector<std::string> & targetGroupFilePaths, ScriptArguments & scriptArgs, std::string_view targetCombinedGroupFilePath, std::string_view combinedDOSBoxConfigurationFilePath, std::string_view targetCustomMapFilePath) const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
@@ -4350,6 +5548,22 @@ bool ModManager::handleArguments(const ArgumentParser * args) {
 		testParsing();
 	}
 
+	if(args->hasArgument("benchmark-dependencies")) {
+		benchmarkModDependencyResolution();
+	}
+
+	if(args->hasArgument("benchmark-interning")) {
+		benchmarkInternedStrings();
+	}
+
+	if(args->hasArgument("benchmark-loading")) {
+		benchmarkModListLoading();
+	}
+
+	if(args->hasArgument("benchmark-launch")) {
+		benchmarkLaunchPlanning();
+	}
+
 	if(args->hasArgument("type")) {
 		std::optional<GameType> newGameTypeOptional(magic_enum::enum_cast<GameType>(Utilities::toPascalCase(args->getFirstValue("type"))));
 
@@ -4431,7 +5645,9 @@ bool ModManager::handleArguments(const ArgumentParser * args) {
 			return false;
 		}
 
-		std::vector<ModMatch> modMatches(searchForMod(m_mods->getMods(), args->getFirstValue("search"), true, true));
+		std::vector<ModMatch> modMatches(searchForMod(m_mods->getMods(), args->getFirstValue("search"), true, true, &m_mods->getSearchIndex(), [this](const Mod & mod) {
+			return m_mods->indexOfMod(mod);
+		}));
 
 		if(modMatches.empty()) {
 			spdlog::error("No matches found for specified search query.");
@@ -4518,42 +5734,51 @@ size_t ModManager::checkForUnlinkedModFiles() const {
 size_t ModManager::checkForUnlinkedModFilesForGameVersion(const GameVersion & gameVersion) const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-	if(!m_initialized || !gameVersion.isValid()) {
+	if(!m_initialized) {
 		return 0;
 	}
 
-	SettingsManager * settings = SettingsManager::getInstance();
+	return checkForUnlinkedModFilesForGameVersionWithoutLocking(gameVersion, m_mods->getMods(), *m_mods->getDependencyGraph(), SettingsManager::getInstance()->modsDirectoryPath);
+}
 
-	std::filesystem::path gameModsPath(std::filesystem::path(Utilities::joinPaths(settings->modsDirectoryPath, gameVersion.getModDirectoryName())));
+size_t ModManager::checkForUnlinkedModFilesForGameVersionWithoutLocking(const GameVersion & gameVersion, const std::vector<std::shared_ptr<Mod>> & mods, const ModDependencyGraph & modDependencyGraph, const std::string & modsDirectoryPath) const {
+	if(!m_initialized || !gameVersion.isValid()) {
+		return 0;
+	}
+
+	std::error_code errorCode;
+	std::filesystem::path gameModsPath(std::filesystem::path(Utilities::joinPaths(modsDirectoryPath, gameVersion.getModDirectoryName())));
 
-	if(!std::filesystem::is_directory(gameModsPath)) {
+	if(!std::filesystem::is_directory(gameModsPath, errorCode)) {
 		return 0;
 	}
 
 	std::map<std::string, std::vector<std::shared_ptr<ModFile>>> linkedModFiles;
 
-	for(const std::filesystem::directory_entry & e : std::filesystem::directory_iterator(gameModsPath)) {
-		if(e.is_regular_file()) {
-			linkedModFiles[std::string(Utilities::getFileName(e.path().string()))] = std::vector<std::shared_ptr<ModFile>>();
+	for(std::filesystem::directory_iterator i(gameModsPath, errorCode); !errorCode && i != std::filesystem::directory_iterator(); i.increment(errorCode)) {
+		if(i->is_regular_file(errorCode)) {
+			linkedModFiles[std::string(Utilities::getFileName(i->path().string()))] = std::vector<std::shared_ptr<ModFile>>();
 		}
 	}
 
-	std::shared_ptr<Mod> mod;
+	if(errorCode) {
+		spdlog::error("Failed to list '{}' mods directory '{}': {}", gameVersion.getLongName(), gameModsPath.string(), errorCode.message());
+		return 0;
+	}
+
 	std::shared_ptr<ModVersion> modVersion;
 	std::shared_ptr<ModVersionType> modVersionType;
 	std::shared_ptr<ModGameVersion> modGameVersion;
 	std::shared_ptr<ModFile> modFile;
 	std::string fileName;
 
-	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-		mod = m_mods->getMod(i);
-
+	for(const std::shared_ptr<Mod> & mod : mods) {
 		for(size_t j = 0; j < mod->numberOfVersions(); j++) {
 			modVersion = mod->getVersion(j);
 
 			for(size_t k = 0; k < modVersion->numberOfTypes(); k++) {
 				modVersionType = modVersion->getType(k);
-				modGameVersion = modVersionType->getGameVersionWithID(gameVersion.getID());
+				modGameVersion = modVersionType->getGameVersionWithID(gameVersion.getInternedID());
 
 				if(modGameVersion == nullptr) {
 					continue;
@@ -4564,7 +5789,7 @@ size_t ModManager::checkForUnlinkedModFilesForGameVersion(const GameVersion & ga
 					fileName = modFile->getFileName();
 
 					if(linkedModFiles.find(fileName) != linkedModFiles.end() && linkedModFiles[fileName].size() != 0) {
-						if(gameVersion.areScriptFilesReadFromGroup() && modFile->getType() != "zip" && modFile->getType() != "grp") {
+						if(isModFileReadFromGroup(&gameVersion, *modFile)) {
 							continue;
 						}
 					}
@@ -4599,8 +5824,8 @@ size_t ModManager::checkForUnlinkedModFilesForGameVersion(const GameVersion & ga
 
 				for(std::vector<std::shared_ptr<ModFile>>::const_iterator k = j + 1; k != i->second.end(); ++k) {
 					if((*j)->getParentMod() != (*k)->getParentMod()) {
-						if(!(*j)->getParentModVersionType()->isDependencyOf(*(*k)->getParentModVersionType(), m_mods.get(), true) &&
-						   !(*k)->getParentModVersionType()->isDependencyOf(*(*j)->getParentModVersionType(), m_mods.get(), true)) {
+						if(!isModVersionTypeDependencyOf(*(*j)->getParentModVersionType(), *(*k)->getParentModVersionType(), modDependencyGraph) &&
+						   !isModVersionTypeDependencyOf(*(*k)->getParentModVersionType(), *(*j)->getParentModVersionType(), modDependencyGraph)) {
 							multipleLinkedFile = true;
 
 							break;
@@ -4650,24 +5875,30 @@ size_t ModManager::checkModForMissingFiles(const std::string & modID, std::optio
 size_t ModManager::checkModForMissingFiles(const Mod & mod, std::optional<size_t> versionIndex, std::optional<size_t> versionTypeIndex) const {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
+	if(!m_initialized) {
+		return 0;
+	}
+
+	m_directorySnapshotService->refreshModifiedSnapshots();
+
+	return checkModForMissingFilesUsingDirectorySnapshots(mod, *getGameVersions(), SettingsManager::getInstance()->modsDirectoryPath, versionIndex, versionTypeIndex);
+}
+
+size_t ModManager::checkModForMissingFilesUsingDirectorySnapshots(const Mod & mod, const GameVersionCollection & gameVersions, const std::string & modsDirectoryPath, std::optional<size_t> versionIndex, std::optional<size_t> versionTypeIndex, bool verbose) const {
 	if(!m_initialized ||
 	   mod.numberOfVersions() == 0 ||
 	   (versionIndex >= mod.numberOfVersions() && versionIndex != std::numeric_limits<size_t>::max())) {
 		return 0;
 	}
 
-	SettingsManager * settings = SettingsManager::getInstance();
-
 	size_t numberOfMissingFiles = 0;
 	std::shared_ptr<ModVersion> modVersion;
 	std::shared_ptr<ModVersionType> modVersionType;
 	std::shared_ptr<ModGameVersion> modGameVersion;
 	std::shared_ptr<ModFile> modFile;
 	std::shared_ptr<GameVersion> gameVersion;
-	std::string modFilePath;
-	std::string alternateModFilePath;
 	std::string gameModsPath;
-	std::string allVersionsGameModsPath(Utilities::joinPaths(settings->modsDirectoryPath, GameVersion::ALL_VERSIONS_DIRECTORY_NAME));
+	std::string allVersionsGameModsPath(Utilities::joinPaths(modsDirectoryPath, GameVersion::ALL_VERSIONS_DIRECTORY_NAME));
 	std::string modDirectoryName;
 	bool modFileFound = false;
 
@@ -4696,45 +5927,42 @@ size_t ModManager::checkModForMissingFiles(const Mod & mod, std::optional<size_t
 					modDirectoryName = GameVersion::ALL_VERSIONS_DIRECTORY_NAME;
 				}
 				else {
-					gameVersion = getGameVersions()->getGameVersionWithID(modGameVersion->getGameVersionID());
+					gameVersion = gameVersions.getGameVersionWithID(modGameVersion->getInternedGameVersionID());
 
 					if(!GameVersion::isValid(gameVersion.get())) {
-						spdlog::warn("Skipping checking invalid '{}' mod game version '{}', invalid game configuration.", mod.getFullName(i, j), getGameVersions()->getLongNameOfGameVersionWithID(modGameVersion->getGameVersionID()));
+						if(verbose) {
+							spdlog::warn("Skipping checking invalid '{}' mod game version '{}', invalid game configuration.", mod.getFullName(i, j), gameVersions.getLongNameOfGameVersionWithID(modGameVersion->getGameVersionID()));
+						}
+
 						continue;
 					}
 
 					modDirectoryName = gameVersion->getModDirectoryName();
 				}
 
-				gameModsPath = Utilities::joinPaths(settings->modsDirectoryPath, modDirectoryName);
+				gameModsPath = Utilities::joinPaths(modsDirectoryPath, modDirectoryName);
+
+				if(!m_directorySnapshotService->isDirectory(gameModsPath)) {
+					if(verbose) {
+						spdlog::warn("Skipping checking '{}' mod game version '{}', base directory is missing or not a valid directory: '{}'.", mod.getFullName(i, j), gameVersion->getLongName(), gameModsPath);
+					}
 
-				if(!std::filesystem::is_directory(gameModsPath)) {
-					spdlog::warn("Skipping checking '{}' mod game version '{}', base directory is missing or not a valid directory: '{}'.", mod.getFullName(i, j), gameVersion->getLongName(), gameModsPath);
 					continue;
 				}
 
 				for(size_t l = 0; l < modGameVersion->numberOfFiles(); l++) {
-					modFileFound = false;
 					modFile = modGameVersion->getFile(l);
-					modFilePath = Utilities::joinPaths(gameModsPath, modFile->getFileName());
-
-					if(std::filesystem::is_regular_file(std::filesystem::path(modFilePath))) {
-						modFileFound = true;
-					}
-					else if(std::filesystem::is_directory(allVersionsGameModsPath)) {
-						alternateModFilePath = Utilities::joinPaths(allVersionsGameModsPath, modFile->getFileName());
-
-						if(std::filesystem::is_regular_file(std::filesystem::path(alternateModFilePath))) {
-							modFileFound = true;
-						}
-					}
+					modFileFound = m_directorySnapshotService->hasFile(gameModsPath, modFile->getFileName()) ||
+								   m_directorySnapshotService->hasFile(allVersionsGameModsPath, modFile->getFileName());
 
 					if(!modFileFound) {
-						if(gameVersion->areScriptFilesReadFromGroup() && modFile->getType() != "zip" && modFile->getType() != "grp") {
+						if(isModFileReadFromGroup(gameVersion.get(), *modFile)) {
 							continue;
 						}
 
-						spdlog::warn("Mod '{}' is missing {} {} file: '{}'.", mod.getFullName(i, j), getGameVersions()->getLongNameOfGameVersionWithID(modGameVersion->getGameVersionID()), modFile->getType(), modFile->getFileName());
+						if(verbose) {
+							spdlog::warn("Mod '{}' is missing {} {} file: '{}'.", mod.getFullName(i, j), gameVersions.getLongNameOfGameVersionWithID(modGameVersion->getGameVersionID()), modFile->getType(), modFile->getFileName());
+						}
 
 						numberOfMissingFiles++;
 					}
@@ -4755,8 +5983,10 @@ size_t ModManager::checkAllModsForMissingFiles() const {
 
 	size_t numberOfMissingModFiles = 0;
 
+	m_directorySnapshotService->refreshModifiedSnapshots();
+
 	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-		numberOfMissingModFiles += checkModForMissingFiles(*m_mods->getMod(i));
+		numberOfMissingModFiles += checkModForMissingFilesUsingDirectorySnapshots(*m_mods->getMod(i), *getGameVersions(), SettingsManager::getInstance()->modsDirectoryPath);
 	}
 
 	if(numberOfMissingModFiles != 0) {
@@ -4779,7 +6009,7 @@ size_t ModManager::checkForMissingExecutables() const {
 }
 
 size_t ModManager::updateFileInfoForAllMods(bool save, bool skipPopulatedFiles) {
-	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+	std::unique_lock<std::recursive_mutex> lock(m_mutex);
 
 	if(!m_initialized || !m_localMode) {
 		return 0;
@@ -4801,12 +6031,48 @@ size_t ModManager::updateFileInfoForAllMods(bool save, bool skipPopulatedFiles)
 
 	spdlog::info("Updating info for {} files...", skipPopulatedFiles ? "new" : "all");
 
+	// collect the file paths to hash while locked, hash them in parallel without holding the lock and then apply the results to each mod in order
+	std::unique_ptr<FileHashService> fileHashService(std::make_unique<FileHashService>());
+
+	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
+		addModFilesToHashService(*m_mods->getMod(i), skipPopulatedFiles, *fileHashService);
+	}
+
+	if(fileHashService->numberOfFiles() != 0) {
+		lock.unlock();
+
+		spdlog::info("Hashing {} file{} ({}) using {} thread{}...", fileHashService->numberOfFiles(), fileHashService->numberOfFiles() == 1 ? "" : "s", Utilities::fileSizeToString(fileHashService->getTotalFileSize()), fileHashService->getNumberOfThreads(), fileHashService->getNumberOfThreads() == 1 ? "" : "s");
+
+		std::chrono::time_point<std::chrono::steady_clock> hashStartTimePoint(std::chrono::steady_clock::now());
+
+		fileHashService->hashFiles();
+
+		spdlog::info("Hashed {} file{} in {} ms.", fileHashService->numberOfFiles(), fileHashService->numberOfFiles() == 1 ? "" : "s", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - hashStartTimePoint).count());
+
+		lock.lock();
+
+		if(!m_initialized || !m_localMode) {
+			return 0;
+		}
+	}
+
+	// any files which were added or changed while unlocked are not in the hash service and fall back to being hashed on demand
+	m_fileHashService = std::move(fileHashService);
+
 	size_t numberOfFilesUpdated = 0;
 
 	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
 		numberOfFilesUpdated += updateModFileInfo(*m_mods->getMod(i), skipPopulatedFiles);
 	}
 
+	m_fileHashService.reset();
+
+	FileFingerprintCache * fileFingerprintCache = FileFingerprintCache::getInstance();
+
+	if(fileFingerprintCache->isModified() && !fileFingerprintCache->save()) {
+		spdlog::error("Failed to save file fingerprint cache to file: '{}'.", fileFingerprintCache->getFilePath());
+	}
+
 	if(numberOfFilesUpdated != 0) {
 		spdlog::info("Updated info for {} mod file{}.", numberOfFilesUpdated, numberOfFilesUpdated == 1 ? "" : "s");
 	}
@@ -4847,13 +6113,6 @@ size_t ModManager::updateModFileInfo(Mod & mod, bool skipPopulatedFiles, std::op
 	std::string downloadFilePath;
 	std::string screenshotFilePath;
 	std::string imageFilePath;
-	std::string modFilePath;
-	std::string gameModsPath;
-	std::string groupFilePath;
-	std::unique_ptr<Group> group;
-	std::shared_ptr<GroupFile> groupFile;
-	std::string zipArchiveFilePath;
-	std::unique_ptr<ZipArchive> zipArchive;
 
 	spdlog::info("Updating mod #{}/{} ('{}') file info...", m_mods->indexOfMod(mod) + 1, m_mods->numberOfMods(), mod.getName());
 
@@ -4870,56 +6129,10 @@ size_t ModManager::updateModFileInfo(Mod & mod, bool skipPopulatedFiles, std::op
 			continue;
 		}
 
-		if(modDownload->isModManagerFiles()) {
-			if(settings->modPackageDownloadsDirectoryPath.empty()) {
-				continue;
-			}
-
-			std::string modDirectoryName;
-
-			if(modDownload->isStandAlone()) {
-				modDirectoryName = GameVersion::STANDALONE_DIRECTORY_NAME;
-			}
-			else if(modDownload->isForAllGameVersions()) {
-				modDirectoryName = GameVersion::ALL_VERSIONS_DIRECTORY_NAME;
-			}
-			else {
-				std::shared_ptr<GameVersion> gameVersion(getGameVersions()->getGameVersionWithID(modDownload->getGameVersionID()));
-
-				if(gameVersion == nullptr) {
-					spdlog::warn("Could not find game configuration for game version '{}', skipping update of download file info: '{}'.", getGameVersions()->getLongNameOfGameVersionWithID(modDownload->getGameVersionID()), modDownload->getFileName());
-					continue;
-				}
-
-				modDirectoryName = Utilities::toLowerCase(gameVersion->getModDirectoryName());
-			}
-
-			downloadFilePath = Utilities::joinPaths(settings->modPackageDownloadsDirectoryPath, modDirectoryName, modDownload->getFileName());
-		}
-		else {
-			if(settings->modSourceFilesDirectoryPath.empty()) {
-				continue;
-			}
-
-			std::string downloadFileBasePath(Utilities::joinPaths(settings->modSourceFilesDirectoryPath, Utilities::getSafeDirectoryName(mod.getName())));
-
-			downloadFilePath = Utilities::joinPaths(downloadFileBasePath, Utilities::getSafeDirectoryName(modDownload->getVersion()), modDownload->getFileName());
+		downloadFilePath = getModDownloadFilePath(mod, *modDownload);
 
-			if(modDownload->getVersion().empty() && !std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
-				downloadFilePath = Utilities::joinPaths(downloadFileBasePath, "Full", modDownload->getFileName());
-			}
-
-			if(!modDownload->getVersionType().empty() && !std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
-				downloadFilePath = Utilities::joinPaths(downloadFileBasePath, modDownload->getVersionType(), modDownload->getFileName());
-			}
-
-			if(!modDownload->getVersion().empty() && !modDownload->getVersionType().empty() && !std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
-				downloadFilePath = Utilities::joinPaths(downloadFileBasePath, modDownload->getVersion(), modDownload->getVersionType(), modDownload->getFileName());
-			}
-
-			if(!modDownload->getSpecial().empty() && !std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
-				downloadFilePath = Utilities::joinPaths(downloadFileBasePath, modDownload->getSpecial(), modDownload->getFileName());
-			}
+		if(downloadFilePath.empty()) {
+			continue;
 		}
 
 		if(!std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
@@ -4930,7 +6143,7 @@ size_t ModManager::updateModFileInfo(Mod & mod, bool skipPopulatedFiles, std::op
 		bool fileSHA1Updated = false;
 
 		if(!skipPopulatedFiles || modDownload->getSHA1().empty()) {
-			std::string fileSHA1(Utilities::getFileSHA1Hash(downloadFilePath));
+			std::string fileSHA1(getFileSHA1Hash(downloadFilePath));
 
 			if(fileSHA1.empty()) {
 				spdlog::error("Failed to hash mod '{}' download file '{}'.", mod.getName(), modDownload->getFileName());
@@ -4985,7 +6198,7 @@ size_t ModManager::updateModFileInfo(Mod & mod, bool skipPopulatedFiles, std::op
 				continue;
 			}
 
-			screenshotFilePath = Utilities::joinPaths(settings->modImagesDirectoryPath, mod.getID(), "screenshots", "lg", modScreenshot->getFileName());
+			screenshotFilePath = getModScreenshotFilePath(mod, *modScreenshot);
 
 			if(!std::filesystem::is_regular_file(std::filesystem::path(screenshotFilePath))) {
 				spdlog::warn("Skipping update of missing '{}' mod screenshot file info: '{}'.", mod.getName(), screenshotFilePath);
@@ -4995,7 +6208,7 @@ size_t ModManager::updateModFileInfo(Mod & mod, bool skipPopulatedFiles, std::op
 			bool fileSHA1Updated = false;
 
 			if(!skipPopulatedFiles || modScreenshot->getSHA1().empty()) {
-				std::string fileSHA1(Utilities::getFileSHA1Hash(screenshotFilePath));
+				std::string fileSHA1(getFileSHA1Hash(screenshotFilePath));
 
 				if(fileSHA1.empty()) {
 					spdlog::error("Failed to hash mod '{}' screenshot file '{}'.", mod.getName(), modScreenshot->getFileName());
@@ -5051,13 +6264,7 @@ size_t ModManager::updateModFileInfo(Mod & mod, bool skipPopulatedFiles, std::op
 				continue;
 			}
 
-			imageFilePath = Utilities::joinPaths(settings->modImagesDirectoryPath, mod.getID());
-
-			if(!modImage->getSubfolder().empty()) {
-				imageFilePath = Utilities::joinPaths(imageFilePath, modImage->getSubfolder());
-			}
-
-			imageFilePath = Utilities::joinPaths(imageFilePath, modImage->getFileName());
+			imageFilePath = getModImageFilePath(mod, *modImage);
 
 			if(!std::filesystem::is_regular_file(std::filesystem::path(imageFilePath))) {
 				spdlog::warn("Skipping update of missing '{}' mod image file info: '{}'.", mod.getName(), imageFilePath);
@@ -5067,7 +6274,7 @@ size_t ModManager::updateModFileInfo(Mod & mod, bool skipPopulatedFiles, std::op
 			bool fileSHA1Updated = false;
 
 			if(!skipPopulatedFiles || modImage->getSHA1().empty()) {
-				std::string fileSHA1(Utilities::getFileSHA1Hash(imageFilePath));
+				std::string fileSHA1(getFileSHA1Hash(imageFilePath));
 
 				if(fileSHA1.empty()) {
 					spdlog::error("Failed to hash mod '{}' image file '{}'.", mod.getName(), modImage->getFileName());
@@ -5110,237 +6317,403 @@ size_t ModManager::updateModFileInfo(Mod & mod, bool skipPopulatedFiles, std::op
 	}
 
 	// update mod files info
-	for(size_t i = (versionIndex.has_value() ? versionIndex.value() : 0); i < (versionIndex.has_value() ? versionIndex.value() + 1 : mod.numberOfVersions()); i++) {
-		if(i >= mod.numberOfVersions()) {
-			break;
-		}
-
-		std::shared_ptr<ModVersion> modVersion(mod.getVersion(i));
+	forEachModGameVersion(mod, versionIndex, versionTypeIndex, true, [&numberOfFilesUpdated, &mod, skipPopulatedFiles, this](const ModVersion & modVersion, const ModVersionType & modVersionType, const ModGameVersion & modGameVersion, const std::shared_ptr<GameVersion> & gameVersion, const std::string & gameModsPath) {
+		std::string modFilePath;
+		std::string groupFilePath;
+		std::unique_ptr<Group> group;
+		std::shared_ptr<GroupFile> groupFile;
+		std::string zipArchiveFilePath;
+		std::unique_ptr<ZipArchive> zipArchive;
 
-		for(size_t j = (versionTypeIndex.has_value() ? versionTypeIndex.value() : 0); j < (versionTypeIndex.has_value() ? versionTypeIndex.value() + 1 : modVersion->numberOfTypes()); j++) {
-			if(j >= modVersion->numberOfTypes()) {
-				break;
+		if(!modVersionType.isStandAlone()) {
+			if(!std::filesystem::is_directory(gameModsPath)) {
+				spdlog::warn("Mod '{}' '{}' game version directory '{}' does not exist or is not a valid directory, skipping update of mod files info.", modVersionType.getFullName(), gameVersion == nullptr ? GameVersion::ALL_VERSIONS_LONG_NAME : gameVersion->getLongName(), gameModsPath);
+				return;
 			}
 
-			std::shared_ptr<ModVersionType> modVersionType(modVersion->getType(j));
+			if(gameVersion != nullptr && gameVersion->areZipArchiveGroupsSupported()) {
+				std::shared_ptr<ModFile> modZipFile(modGameVersion.getFirstFileOfType("zip"));
 
-			for(size_t k = 0; k < modVersionType->numberOfGameVersions(); k++) {
-				std::shared_ptr<ModGameVersion> modGameVersion(modVersionType->getGameVersion(k));
-				bool allGameVersions = modGameVersion->isForAllGameVersions();
-				std::shared_ptr<GameVersion> gameVersion;
-				std::string modDirectoryName;
+				if(modZipFile != nullptr) {
+					zipArchiveFilePath = Utilities::joinPaths(gameModsPath, modZipFile->getFileName());
+					zipArchive = ZipArchive::readFrom(zipArchiveFilePath, Utilities::emptyString, true);
 
-				if(allGameVersions) {
-					modDirectoryName = GameVersion::ALL_VERSIONS_DIRECTORY_NAME;
+					if(zipArchive != nullptr) {
+						spdlog::info("Opened '{}' zip file '{}'.", modVersionType.getFullName(), zipArchiveFilePath);
+					}
 				}
 				else {
-					if(modVersionType->isStandAlone()) {
-						gameVersion = modGameVersion->getStandAloneGameVersion();
-					}
-					else {
-						gameVersion = getGameVersions()->getGameVersionWithID(modGameVersion->getGameVersionID());
+					std::shared_ptr<ModFile> modGroupFile(modGameVersion.getFirstFileOfType("grp"));
+
+					if(modGroupFile != nullptr) {
+						groupFilePath = Utilities::joinPaths(gameModsPath, modGroupFile->getFileName());
+
+						group = GroupGRP::loadFrom(groupFilePath);
+
+						if(group == nullptr) {
+							spdlog::error("Failed to open mod group file '{}'.", groupFilePath);
+						}
 					}
+				}
+			}
+		}
 
-					if(!GameVersion::isValid(gameVersion.get())) {
-						spdlog::warn("Mod '{}' game version #{} is not valid, skipping update of mod files info.", mod.getFullName(i, j), k + 1);
+		for(size_t i = 0; i < modGameVersion.numberOfFiles(); i++) {
+			std::shared_ptr<ModFile> modFile(modGameVersion.getFile(i));
+
+			if(skipPopulatedFiles && !modFile->getSHA1().empty() && modFile->getFileSize() != 0) {
+				continue;
+			}
+
+			std::string fileSHA1;
+			uint64_t fileSize = 0;
+
+			if(isModFileReadFromGroup(gameVersion.get(), *modFile)) {
+				if(!zipArchiveFilePath.empty()) {
+					if(zipArchive == nullptr) {
+						spdlog::error("Skipping update of mod file '{}' info since zip archive could not be opened.", zipArchiveFilePath);
 						continue;
 					}
 
-					modDirectoryName = gameVersion->getModDirectoryName();
-				}
+					std::shared_ptr<ArchiveEntry> zipArchiveEntry(zipArchive->getEntry(modFile->getFileName(), false));
 
-				gameModsPath = Utilities::joinPaths(settings->modsDirectoryPath, modDirectoryName);
-
-				if(!modVersionType->isStandAlone()) {
-					if(!std::filesystem::is_directory(gameModsPath)) {
-						spdlog::warn("Mod '{}' '{}' game version directory '{}' does not exist or is not a valid directory, skipping update of mod files info.", mod.getFullName(i, j), allGameVersions ? GameVersion::ALL_VERSIONS_LONG_NAME : gameVersion->getLongName(), gameModsPath);
+					if(zipArchiveEntry == nullptr) {
+						spdlog::error("Mod file '{}' not found in zip file '{}'.", modFile->getFileName(), zipArchiveFilePath);
 						continue;
 					}
 
-					if(gameVersion != nullptr && gameVersion->areZipArchiveGroupsSupported()) {
-						std::shared_ptr<ModFile> modZipFile(modGameVersion->getFirstFileOfType("zip"));
+					if(!zipArchiveEntry->isFile()) {
+						spdlog::error("Mod file '{}' located in zip file '{}' is not a file.", modFile->getFileName(), zipArchiveFilePath);
+						continue;
+					}
 
-						if(modZipFile != nullptr) {
-							zipArchiveFilePath = Utilities::joinPaths(gameModsPath, modZipFile->getFileName());
-							zipArchive = ZipArchive::readFrom(zipArchiveFilePath, Utilities::emptyString, true);
+					if(!skipPopulatedFiles || modFile->getSHA1().empty()) {
+						std::unique_ptr<ByteBuffer> zipArchiveEntryData(zipArchiveEntry->getData());
 
-							if(zipArchive != nullptr) {
-								spdlog::info("Opened '{}' zip file '{}'.", modVersionType->getFullName(), zipArchiveFilePath);
-							}
+						if(zipArchiveEntryData == nullptr) {
+							spdlog::error("Failed to read zip entry '{}' from zip file '{}' into memory.", zipArchiveEntry->getName(), zipArchiveFilePath);
+							continue;
 						}
-						else {
-							std::shared_ptr<ModFile> modGroupFile(modGameVersion->getFirstFileOfType("grp"));
 
-							if(modGroupFile != nullptr) {
-								groupFilePath = Utilities::joinPaths(gameModsPath, modGroupFile->getFileName());
+						fileSHA1 = zipArchiveEntryData->getSHA1();
+					}
 
-								group = GroupGRP::loadFrom(groupFilePath);
+					if(!skipPopulatedFiles || modFile->getFileSize() == 0) {
+						fileSize = zipArchiveEntry->getUncompressedSize();
 
-								if(group == nullptr) {
-									spdlog::error("Failed to open mod group file '{}'.", groupFilePath);
-								}
-							}
+						if(fileSize == 0) {
+							fileSize = zipArchiveEntry->getData()->getSize();
 						}
 					}
 				}
+				else if(!groupFilePath.empty()) {
+					if(group == nullptr) {
+						spdlog::error("Skipping update of mod file '{}' info since group could not be opened.", groupFilePath);
+						continue;
+					}
 
-				for(size_t l = 0; l < modGameVersion->numberOfFiles(); l++) {
-					std::shared_ptr<ModFile> modFile(modGameVersion->getFile(l));
+					groupFile = group->getFileWithName(modFile->getFileName());
 
-					if(skipPopulatedFiles && !modFile->getSHA1().empty() && modFile->getFileSize() != 0) {
+					if(groupFile == nullptr) {
+						spdlog::error("Mod file '{}' not found in group file '{}'.", modFile->getFileName(), groupFilePath);
 						continue;
 					}
 
-					std::string fileSHA1;
-					uint64_t fileSize = 0;
+					if(!skipPopulatedFiles || modFile->getSHA1().empty()) {
+						fileSHA1 = groupFile->getData().getSHA1();
+					}
 
-					if(gameVersion != nullptr && gameVersion->areScriptFilesReadFromGroup() && modFile->getType() != "zip" && modFile->getType() != "grp") {
-						if(!zipArchiveFilePath.empty()) {
-							if(zipArchive == nullptr) {
-								spdlog::error("Skipping update of mod file '{}' info since zip archive could not be opened.", zipArchiveFilePath);
-								continue;
-							}
+					if(!skipPopulatedFiles || modFile->getFileSize() == 0) {
+						fileSize = groupFile->getSize();
+					}
+				}
+			}
+			else {
+				modFilePath = getModFilePath(mod, modVersion, modGameVersion, *modFile, gameModsPath);
 
-							std::shared_ptr<ArchiveEntry> zipArchiveEntry(zipArchive->getEntry(modFile->getFileName(), false));
+				if(modFilePath.empty()) {
+					continue;
+				}
 
-							if(zipArchiveEntry == nullptr) {
-								spdlog::error("Mod file '{}' not found in zip file '{}'.", modFile->getFileName(), zipArchiveFilePath);
-								continue;
-							}
+				if(!std::filesystem::is_regular_file(std::filesystem::path(modFilePath))) {
+					spdlog::warn("Skipping update of missing '{}' mod file info: '{}'.", modVersionType.getFullName(), modFilePath);
+					continue;
+				}
 
-							if(!zipArchiveEntry->isFile()) {
-								spdlog::error("Mod file '{}' located in zip file '{}' is not a file.", modFile->getFileName(), zipArchiveFilePath);
-								continue;
-							}
+				if(!skipPopulatedFiles || modFile->getSHA1().empty()) {
+					fileSHA1 = getFileSHA1Hash(modFilePath);
+				}
 
-							if(!skipPopulatedFiles || modFile->getSHA1().empty()) {
-								std::unique_ptr<ByteBuffer> zipArchiveEntryData(zipArchiveEntry->getData());
+				if(!skipPopulatedFiles || modFile->getFileSize() == 0) {
+					std::error_code errorCode;
+					fileSize = std::filesystem::file_size(std::filesystem::path(modFilePath), errorCode);
 
-								if(zipArchiveEntryData == nullptr) {
-									spdlog::error("Failed to read zip entry '{}' from zip file '{}' into memory.", zipArchiveEntry->getName(), zipArchiveFilePath);
-									continue;
-								}
+					if(errorCode) {
+						spdlog::error("Failed to obtain '{}' mod file '{}' size: {}", mod.getName(), modFile->getFileName(), errorCode.message());
+						continue;
+					}
+				}
+			}
 
-								fileSHA1 = zipArchiveEntryData->getSHA1();
-							}
+			bool fileSHA1Updated = false;
+			bool fileSizeUpdated = false;
 
-							if(!skipPopulatedFiles || modFile->getFileSize() == 0) {
-								fileSize = zipArchiveEntry->getUncompressedSize();
+			if(!skipPopulatedFiles || modFile->getSHA1().empty()) {
+				if(!fileSHA1.empty()) {
+					if(modFile->getSHA1() != fileSHA1) {
+						spdlog::info("Updating '{}' mod file '{}' SHA1 hash from '{}' to '{}'.", modVersionType.getFullName(), modFile->getFileName(), modFile->getSHA1(), fileSHA1);
 
-								if(fileSize == 0) {
-									fileSize = zipArchiveEntry->getData()->getSize();
-								}
-							}
-						}
-						else if(!groupFilePath.empty()) {
-							if(group == nullptr) {
-								spdlog::error("Skipping update of mod file '{}' info since group could not be opened.", groupFilePath);
-								continue;
-							}
+						modFile->setSHA1(fileSHA1);
 
-							groupFile = group->getFileWithName(modFile->getFileName());
+						fileSHA1Updated = true;
+					}
+				}
+				else {
+					spdlog::error("Failed to hash '{}' mod file '{}'.", modVersionType.getFullName(), modFile->getFileName());
+				}
+			}
 
-							if(groupFile == nullptr) {
-								spdlog::error("Mod file '{}' not found in group file '{}'.", modFile->getFileName(), groupFilePath);
-								continue;
-							}
+			if(!skipPopulatedFiles || modFile->getFileSize() == 0) {
+				if(fileSize != 0) {
+					if(modFile->getFileSize() != fileSize) {
+						spdlog::info("Updating '{}' mod file '{}' size from {} to {} bytes.", modVersionType.getFullName(), modFile->getFileName(), modFile->getFileSize(), fileSize);
 
-							if(!skipPopulatedFiles || modFile->getSHA1().empty()) {
-								fileSHA1 = groupFile->getData().getSHA1();
-							}
+						modFile->setFileSize(fileSize);
 
-							if(!skipPopulatedFiles || modFile->getFileSize() == 0) {
-								fileSize = groupFile->getSize();
-							}
-						}
+						fileSizeUpdated = true;
 					}
-					else {
-						if(modGameVersion->isStandAlone()) {
-							if(settings->modSourceFilesDirectoryPath.empty()) {
-								continue;
-							}
+				}
+				else {
+					spdlog::error("Failed to obtain '{}' mod file '{}' size.", modVersionType.getFullName(), modFile->getFileName());
+				}
+			}
 
-							std::string downloadFileBasePath(Utilities::joinPaths(settings->modSourceFilesDirectoryPath, Utilities::getSafeDirectoryName(mod.getName()), Utilities::getSafeDirectoryName(modVersion->getVersion()), "Mod Manager Files", "Stand-Alone (Native)"));
+			if(fileSHA1Updated || fileSizeUpdated) {
+				numberOfFilesUpdated++;
+			}
+		}
+	});
 
-							modFilePath = Utilities::joinPaths(downloadFileBasePath, "Files", modFile->getFileName());
+	return numberOfFilesUpdated;
+}
 
-							if(!std::filesystem::is_regular_file(std::filesystem::path(modFilePath))) {
-								modFilePath = Utilities::joinPaths(downloadFileBasePath, "Game", modFile->getFileName());
-							}
-						}
-						else {
-							modFilePath = Utilities::joinPaths(gameModsPath, modFile->getFileName());
-						}
+std::string ModManager::getModDownloadFilePath(const Mod & mod, const ModDownload & modDownload, bool verbose) const {
+	SettingsManager * settings = SettingsManager::getInstance();
 
-						if(!std::filesystem::is_regular_file(std::filesystem::path(modFilePath))) {
-							spdlog::warn("Skipping update of missing '{}' mod file info: '{}'.", mod.getFullName(i, j), modFilePath);
-							continue;
-						}
+	if(modDownload.isModManagerFiles()) {
+		if(settings->modPackageDownloadsDirectoryPath.empty()) {
+			return {};
+		}
 
-						if(!skipPopulatedFiles || modFile->getSHA1().empty()) {
-							fileSHA1 = Utilities::getFileSHA1Hash(modFilePath);
-						}
+		std::string modDirectoryName;
 
-						if(!skipPopulatedFiles || modFile->getFileSize() == 0) {
-							std::error_code errorCode;
-							fileSize = std::filesystem::file_size(std::filesystem::path(modFilePath), errorCode);
+		if(modDownload.isStandAlone()) {
+			modDirectoryName = GameVersion::STANDALONE_DIRECTORY_NAME;
+		}
+		else if(modDownload.isForAllGameVersions()) {
+			modDirectoryName = GameVersion::ALL_VERSIONS_DIRECTORY_NAME;
+		}
+		else {
+			std::shared_ptr<GameVersion> gameVersion(getGameVersions()->getGameVersionWithID(modDownload.getInternedGameVersionID()));
 
-							if(errorCode) {
-								spdlog::error("Failed to obtain '{}' mod file '{}' size: {}", mod.getName(), modFile->getFileName(), errorCode.message());
-								continue;
-							}
-						}
-					}
+			if(gameVersion == nullptr) {
+				if(verbose) {
+					spdlog::warn("Could not find game configuration for game version '{}', skipping update of download file info: '{}'.", getGameVersions()->getLongNameOfGameVersionWithID(modDownload.getGameVersionID()), modDownload.getFileName());
+				}
 
-					bool fileSHA1Updated = false;
-					bool fileSizeUpdated = false;
+				return {};
+			}
 
-					if(!skipPopulatedFiles || modFile->getSHA1().empty()) {
-						if(!fileSHA1.empty()) {
-							if(modFile->getSHA1() != fileSHA1) {
-								spdlog::info("Updating '{}' mod file '{}' SHA1 hash from '{}' to '{}'.", mod.getFullName(i, j), modFile->getFileName(), modFile->getSHA1(), fileSHA1);
+			modDirectoryName = Utilities::toLowerCase(gameVersion->getModDirectoryName());
+		}
 
-								modFile->setSHA1(fileSHA1);
+		return Utilities::joinPaths(settings->modPackageDownloadsDirectoryPath, modDirectoryName, modDownload.getFileName());
+	}
 
-								fileSHA1Updated = true;
-							}
-						}
-						else {
-							spdlog::error("Failed to hash '{}' mod file '{}'.", mod.getFullName(i, j), modFile->getFileName());
-						}
-					}
+	if(settings->modSourceFilesDirectoryPath.empty()) {
+		return {};
+	}
 
-					if(!skipPopulatedFiles || modFile->getFileSize() == 0) {
-						if(fileSize != 0) {
-							if(modFile->getFileSize() != fileSize) {
-								spdlog::info("Updating '{}' mod file '{}' size from {} to {} bytes.", mod.getFullName(i, j), modFile->getFileName(), modFile->getFileSize(), fileSize);
+	std::string downloadFileBasePath(Utilities::joinPaths(settings->modSourceFilesDirectoryPath, Utilities::getSafeDirectoryName(mod.getName())));
+	std::string downloadFilePath(Utilities::joinPaths(downloadFileBasePath, Utilities::getSafeDirectoryName(modDownload.getVersion()), modDownload.getFileName()));
+
+	if(modDownload.getVersion().empty() && !std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
+		downloadFilePath = Utilities::joinPaths(downloadFileBasePath, "Full", modDownload.getFileName());
+	}
 
-								modFile->setFileSize(fileSize);
+	if(!modDownload.getVersionType().empty() && !std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
+		downloadFilePath = Utilities::joinPaths(downloadFileBasePath, modDownload.getVersionType(), modDownload.getFileName());
+	}
 
-								fileSizeUpdated = true;
-							}
-						}
-						else {
-							spdlog::error("Failed to obtain '{}' mod file '{}' size.", mod.getFullName(i, j), modFile->getFileName());
-						}
+	if(!modDownload.getVersion().empty() && !modDownload.getVersionType().empty() && !std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
+		downloadFilePath = Utilities::joinPaths(downloadFileBasePath, modDownload.getVersion(), modDownload.getVersionType(), modDownload.getFileName());
+	}
+
+	if(!modDownload.getSpecial().empty() && !std::filesystem::is_regular_file(std::filesystem::path(downloadFilePath))) {
+		downloadFilePath = Utilities::joinPaths(downloadFileBasePath, modDownload.getSpecial(), modDownload.getFileName());
+	}
+
+	return downloadFilePath;
+}
+
+std::string ModManager::getModScreenshotFilePath(const Mod & mod, const ModScreenshot & modScreenshot) const {
+	SettingsManager * settings = SettingsManager::getInstance();
+
+	if(settings->modImagesDirectoryPath.empty()) {
+		return {};
+	}
+
+	return Utilities::joinPaths(settings->modImagesDirectoryPath, mod.getID(), "screenshots", "lg", modScreenshot.getFileName());
+}
+
+std::string ModManager::getModImageFilePath(const Mod & mod, const ModImage & modImage) const {
+	SettingsManager * settings = SettingsManager::getInstance();
+
+	if(settings->modImagesDirectoryPath.empty()) {
+		return {};
+	}
+
+	std::string imageFilePath(Utilities::joinPaths(settings->modImagesDirectoryPath, mod.getID()));
+
+	if(!modImage.getSubfolder().empty()) {
+		imageFilePath = Utilities::joinPaths(imageFilePath, modImage.getSubfolder());
+	}
+
+	return Utilities::joinPaths(imageFilePath, modImage.getFileName());
+}
+
+std::string ModManager::getModFilePath(const Mod & mod, const ModVersion & modVersion, const ModGameVersion & modGameVersion, const ModFile & modFile, const std::string & gameModsPath) const {
+	if(!modGameVersion.isStandAlone()) {
+		return Utilities::joinPaths(gameModsPath, modFile.getFileName());
+	}
+
+	SettingsManager * settings = SettingsManager::getInstance();
+
+	if(settings->modSourceFilesDirectoryPath.empty()) {
+		return {};
+	}
+
+	std::string downloadFileBasePath(Utilities::joinPaths(settings->modSourceFilesDirectoryPath, Utilities::getSafeDirectoryName(mod.getName()), Utilities::getSafeDirectoryName(modVersion.getVersion()), "Mod Manager Files", "Stand-Alone (Native)"));
+	std::string modFilePath(Utilities::joinPaths(downloadFileBasePath, "Files", modFile.getFileName()));
+
+	if(!std::filesystem::is_regular_file(std::filesystem::path(modFilePath))) {
+		modFilePath = Utilities::joinPaths(downloadFileBasePath, "Game", modFile.getFileName());
+	}
+
+	return modFilePath;
+}
+
+size_t ModManager::addModFilesToHashService(const Mod & mod, bool skipPopulatedFiles, FileHashService & fileHashService) const {
+	if(skipPopulatedFiles && mod.isValid()) {
+		return 0;
+	}
+
+	size_t numberOfFilesAdded = 0;
+
+	std::function<void(const std::string &)> addFile([&fileHashService, &numberOfFilesAdded](const std::string & filePath) {
+		if(!filePath.empty() && std::filesystem::is_regular_file(std::filesystem::path(filePath)) && fileHashService.addFile(filePath)) {
+			numberOfFilesAdded++;
+		}
+	});
+
+	for(const std::shared_ptr<ModDownload> & modDownload : mod.getDownloads()) {
+		if(ModDownload::isValid(modDownload.get(), true) && (!skipPopulatedFiles || modDownload->getSHA1().empty())) {
+			addFile(getModDownloadFilePath(mod, *modDownload, false));
+		}
+	}
+
+	for(const std::shared_ptr<ModScreenshot> & modScreenshot : mod.getScreenshots()) {
+		if(ModScreenshot::isValid(modScreenshot.get(), true) && (!skipPopulatedFiles || modScreenshot->getSHA1().empty())) {
+			addFile(getModScreenshotFilePath(mod, *modScreenshot));
+		}
+	}
+
+	for(const std::shared_ptr<ModImage> & modImage : mod.getImages()) {
+		if(ModImage::isValid(modImage.get(), true) && (!skipPopulatedFiles || modImage->getSHA1().empty())) {
+			addFile(getModImageFilePath(mod, *modImage));
+		}
+	}
+
+	forEachModGameVersion(mod, {}, {}, false, [&mod, skipPopulatedFiles, &addFile, this](const ModVersion & modVersion, const ModVersionType & modVersionType, const ModGameVersion & modGameVersion, const std::shared_ptr<GameVersion> & gameVersion, const std::string & gameModsPath) {
+		for(size_t i = 0; i < modGameVersion.numberOfFiles(); i++) {
+			std::shared_ptr<ModFile> modFile(modGameVersion.getFile(i));
+
+			if(skipPopulatedFiles && !modFile->getSHA1().empty()) {
+				continue;
+			}
+
+			// files stored inside of a zip or group file are hashed from memory when the group is opened
+			if(isModFileReadFromGroup(gameVersion.get(), *modFile)) {
+				continue;
+			}
+
+			addFile(getModFilePath(mod, modVersion, modGameVersion, *modFile, gameModsPath));
+		}
+	});
+
+	return numberOfFilesAdded;
+}
+
+void ModManager::forEachModGameVersion(const Mod & mod, std::optional<size_t> versionIndex, std::optional<size_t> versionTypeIndex, bool verbose, const std::function<void(const ModVersion &, const ModVersionType &, const ModGameVersion &, const std::shared_ptr<GameVersion> &, const std::string &)> & function) const {
+	SettingsManager * settings = SettingsManager::getInstance();
+
+	for(size_t i = (versionIndex.has_value() ? versionIndex.value() : 0); i < (versionIndex.has_value() ? versionIndex.value() + 1 : mod.numberOfVersions()); i++) {
+		if(i >= mod.numberOfVersions()) {
+			break;
+		}
+
+		std::shared_ptr<ModVersion> modVersion(mod.getVersion(i));
+
+		for(size_t j = (versionTypeIndex.has_value() ? versionTypeIndex.value() : 0); j < (versionTypeIndex.has_value() ? versionTypeIndex.value() + 1 : modVersion->numberOfTypes()); j++) {
+			if(j >= modVersion->numberOfTypes()) {
+				break;
+			}
+
+			std::shared_ptr<ModVersionType> modVersionType(modVersion->getType(j));
+
+			for(size_t k = 0; k < modVersionType->numberOfGameVersions(); k++) {
+				std::shared_ptr<ModGameVersion> modGameVersion(modVersionType->getGameVersion(k));
+				std::shared_ptr<GameVersion> gameVersion;
+				std::string modDirectoryName;
+
+				if(modGameVersion->isForAllGameVersions()) {
+					modDirectoryName = GameVersion::ALL_VERSIONS_DIRECTORY_NAME;
+				}
+				else {
+					if(modVersionType->isStandAlone()) {
+						gameVersion = modGameVersion->getStandAloneGameVersion();
+					}
+					else {
+						gameVersion = getGameVersions()->getGameVersionWithID(modGameVersion->getInternedGameVersionID());
 					}
 
-					if(fileSHA1Updated || fileSizeUpdated) {
-						numberOfFilesUpdated++;
+					if(!GameVersion::isValid(gameVersion.get())) {
+						if(verbose) {
+							spdlog::warn("Mod '{}' game version #{} is not valid, skipping mod files.", mod.getFullName(i, j), k + 1);
+						}
+
+						continue;
 					}
-				}
 
-				if(zipArchive != nullptr) {
-					zipArchive.reset();
-				}
-				else if(group != nullptr) {
-					group.reset();
+					modDirectoryName = gameVersion->getModDirectoryName();
 				}
+
+				function(*modVersion, *modVersionType, *modGameVersion, gameVersion, Utilities::joinPaths(settings->modsDirectoryPath, modDirectoryName));
 			}
 		}
 	}
+}
 
-	return numberOfFilesUpdated;
+std::string ModManager::getFileSHA1Hash(const std::string & filePath) const {
+	if(m_fileHashService != nullptr) {
+		std::optional<std::string> optionalFileSHA1(m_fileHashService->getFileSHA1(filePath));
+
+		if(optionalFileSHA1.has_value()) {
+			return optionalFileSHA1.value();
+		}
+	}
+
+	return FileFingerprintCache::getInstance()->getFileSHA1Hash(filePath);
 }
 
 bool ModManager::testParsing() {
@@ -5459,6 +6832,403 @@ bool ModManager::testParsing() {
 	return true;
 }
 
+bool ModManager::benchmarkModDependencyResolution() const {
+	static constexpr size_t NUMBER_OF_BENCHMARK_ITERATIONS = 10;
+
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_initialized) {
+		return false;
+	}
+
+	std::shared_ptr<GameVersionCollection> gameVersions(getGameVersions());
+	std::shared_ptr<GameVersion> gameVersion;
+	size_t numberOfModGameVersions = 0;
+	size_t numberOfResolvedDependencies = 0;
+	size_t numberOfResolvedDependencyGroupFiles = 0;
+
+	std::chrono::time_point<std::chrono::steady_clock> benchmarkStartTimePoint(std::chrono::steady_clock::now());
+
+	for(size_t i = 0; i < NUMBER_OF_BENCHMARK_ITERATIONS; i++) {
+		for(const std::shared_ptr<Mod> & mod : m_mods->getMods()) {
+			for(const std::shared_ptr<ModVersion> & modVersion : mod->getVersions()) {
+				for(const std::shared_ptr<ModVersionType> & modVersionType : modVersion->getTypes()) {
+					if(!modVersionType->hasDependencies()) {
+						continue;
+					}
+
+					numberOfResolvedDependencies += m_mods->getModDependencyVersionTypes(*modVersionType).size();
+
+					for(const std::shared_ptr<ModGameVersion> & modGameVersion : modVersionType->getGameVersions()) {
+						gameVersion = gameVersions->getGameVersionWithID(modGameVersion->getInternedGameVersionID());
+
+						if(gameVersion == nullptr) {
+							continue;
+						}
+
+						numberOfModGameVersions++;
+						numberOfResolvedDependencyGroupFiles += m_mods->getModDependencyGroupFiles(*modGameVersion, *gameVersion, gameVersions.get(), true, true).size();
+					}
+				}
+			}
+		}
+	}
+
+	std::chrono::microseconds benchmarkDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - benchmarkStartTimePoint));
+
+	spdlog::info("Resolved {} mod dependencies and {} dependency group files for {} mod game versions across {} mods in {} us per iteration ({} iterations).", numberOfResolvedDependencies / NUMBER_OF_BENCHMARK_ITERATIONS, numberOfResolvedDependencyGroupFiles / NUMBER_OF_BENCHMARK_ITERATIONS, numberOfModGameVersions / NUMBER_OF_BENCHMARK_ITERATIONS, m_mods->numberOfMods(), benchmarkDuration.count() / NUMBER_OF_BENCHMARK_ITERATIONS, NUMBER_OF_BENCHMARK_ITERATIONS);
+
+	ModDependencyGraph dependencyGraph;
+
+	benchmarkStartTimePoint = std::chrono::steady_clock::now();
+
+	for(size_t i = 0; i < NUMBER_OF_BENCHMARK_ITERATIONS; i++) {
+		dependencyGraph.build(*m_mods);
+	}
+
+	benchmarkDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - benchmarkStartTimePoint);
+
+	spdlog::info("Built mod dependency graph with {} nodes, {} edges and {} unresolved dependencies{} in {} us per iteration ({} iterations).", dependencyGraph.numberOfNodes(), dependencyGraph.numberOfEdges(), dependencyGraph.numberOfUnresolvedDependencies(), dependencyGraph.hasCycles() ? " containing cycles" : "", benchmarkDuration.count() / NUMBER_OF_BENCHMARK_ITERATIONS, NUMBER_OF_BENCHMARK_ITERATIONS);
+
+	size_t numberOfDependencyQueries = 0;
+	size_t numberOfTransitiveDependencies = 0;
+
+	benchmarkStartTimePoint = std::chrono::steady_clock::now();
+
+	for(size_t i = 0; i < dependencyGraph.numberOfNodes(); i++) {
+		if(dependencyGraph.getDependencyNodeIDs(i).empty()) {
+			continue;
+		}
+
+		for(size_t j = 0; j < dependencyGraph.numberOfNodes(); j++) {
+			numberOfDependencyQueries++;
+
+			if(dependencyGraph.isDependencyOf(j, i, true)) {
+				numberOfTransitiveDependencies++;
+			}
+		}
+	}
+
+	benchmarkDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - benchmarkStartTimePoint);
+
+	spdlog::info("Answered {} transitive mod dependency queries with {} matches in {} us.", numberOfDependencyQueries, numberOfTransitiveDependencies, benchmarkDuration.count());
+
+	return true;
+}
+
+bool ModManager::benchmarkInternedStrings() const {
+	static constexpr size_t NUMBER_OF_BENCHMARK_ITERATIONS = 10;
+	static const std::string GROUP_FILE_TYPE("grp");
+	static const std::string ZIP_FILE_TYPE("zip");
+
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_initialized) {
+		return false;
+	}
+
+	std::shared_ptr<GameVersionCollection> gameVersions(getGameVersions());
+	std::vector<std::shared_ptr<ModGameVersion>> modGameVersions;
+	size_t numberOfModFiles = 0;
+
+	for(const std::shared_ptr<Mod> & mod : m_mods->getMods()) {
+		for(const std::shared_ptr<ModVersion> & modVersion : mod->getVersions()) {
+			for(const std::shared_ptr<ModVersionType> & modVersionType : modVersion->getTypes()) {
+				for(const std::shared_ptr<ModGameVersion> & modGameVersion : modVersionType->getGameVersions()) {
+					modGameVersions.push_back(modGameVersion);
+					numberOfModFiles += modGameVersion->numberOfFiles();
+				}
+			}
+		}
+	}
+
+	// baseline: case insensitive string comparisons against the un-interned values
+	size_t numberOfMatchingFiles = 0;
+	size_t numberOfResolvedGameVersions = 0;
+
+	std::chrono::time_point<std::chrono::steady_clock> stringComparisonStartTimePoint(std::chrono::steady_clock::now());
+
+	for(size_t i = 0; i < NUMBER_OF_BENCHMARK_ITERATIONS; i++) {
+		for(const std::shared_ptr<ModGameVersion> & modGameVersion : modGameVersions) {
+			for(const std::shared_ptr<ModFile> & modFile : modGameVersion->getFiles()) {
+				if(Utilities::areStringsEqualIgnoreCase(modFile->getType(), GROUP_FILE_TYPE) ||
+				   Utilities::areStringsEqualIgnoreCase(modFile->getType(), ZIP_FILE_TYPE)) {
+					numberOfMatchingFiles++;
+				}
+			}
+
+			if(gameVersions->getGameVersionWithID(modGameVersion->getGameVersionID()) != nullptr) {
+				numberOfResolvedGameVersions++;
+			}
+		}
+	}
+
+	std::chrono::microseconds stringComparisonDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - stringComparisonStartTimePoint));
+
+	size_t numberOfMatchingInternedFiles = 0;
+	size_t numberOfResolvedInternedGameVersions = 0;
+
+	std::chrono::time_point<std::chrono::steady_clock> internedStringComparisonStartTimePoint(std::chrono::steady_clock::now());
+
+	for(size_t i = 0; i < NUMBER_OF_BENCHMARK_ITERATIONS; i++) {
+		for(const std::shared_ptr<ModGameVersion> & modGameVersion : modGameVersions) {
+			numberOfMatchingInternedFiles += modGameVersion->numberOfFilesOfType(GROUP_FILE_TYPE, ZIP_FILE_TYPE);
+
+			if(gameVersions->getGameVersionWithID(modGameVersion->getInternedGameVersionID()) != nullptr) {
+				numberOfResolvedInternedGameVersions++;
+			}
+		}
+	}
+
+	std::chrono::microseconds internedStringComparisonDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - internedStringComparisonStartTimePoint));
+
+	InternedString::Statistics internedStringStatistics(InternedString::getStatistics());
+
+	spdlog::info("Interned {} strings occupying {} bytes from {} requests totalling {} bytes.", internedStringStatistics.numberOfInternedStrings, internedStringStatistics.numberOfInternedBytes, internedStringStatistics.numberOfRequests, internedStringStatistics.numberOfRequestedBytes);
+	spdlog::info("Filtered {} mod files by type and resolved game versions for {} mod game versions: case insensitive string comparison took {} us per iteration with {} matching files and {} resolved game versions, interned string comparison took {} us per iteration with {} matching files and {} resolved game versions ({} iterations).", numberOfModFiles, modGameVersions.size(), stringComparisonDuration.count() / NUMBER_OF_BENCHMARK_ITERATIONS, numberOfMatchingFiles / NUMBER_OF_BENCHMARK_ITERATIONS, numberOfResolvedGameVersions / NUMBER_OF_BENCHMARK_ITERATIONS, internedStringComparisonDuration.count() / NUMBER_OF_BENCHMARK_ITERATIONS, numberOfMatchingInternedFiles / NUMBER_OF_BENCHMARK_ITERATIONS, numberOfResolvedInternedGameVersions / NUMBER_OF_BENCHMARK_ITERATIONS, NUMBER_OF_BENCHMARK_ITERATIONS);
+
+	return true;
+}
+
+bool ModManager::benchmarkModListLoading() const {
+	static constexpr size_t NUMBER_OF_BENCHMARK_ITERATIONS = 10;
+	static const std::string BENCHMARK_FILE_NAME("Mod List Benchmark");
+
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_initialized) {
+		return false;
+	}
+
+	std::error_code errorCode;
+	std::filesystem::path temporaryDirectoryPath(std::filesystem::temp_directory_path(errorCode));
+
+	if(errorCode) {
+		spdlog::error("Failed to obtain temporary directory path for mod list loading benchmark: {}", errorCode.message());
+		return false;
+	}
+
+	std::string jsonModListFilePath((temporaryDirectoryPath / (BENCHMARK_FILE_NAME + ".json")).string());
+	std::string xmlModListFilePath((temporaryDirectoryPath / (BENCHMARK_FILE_NAME + ".xml")).string());
+
+	if(!m_mods->saveToJSON(jsonModListFilePath) || !m_mods->saveToXML(xmlModListFilePath)) {
+		spdlog::error("Failed to save mod list benchmark files to temporary directory: '{}'.", temporaryDirectoryPath.string());
+		return false;
+	}
+
+	size_t numberOfLoadedMods = 0;
+
+	std::chrono::time_point<std::chrono::steady_clock> benchmarkStartTimePoint(std::chrono::steady_clock::now());
+
+	for(size_t i = 0; i < NUMBER_OF_BENCHMARK_ITERATIONS; i++) {
+		ModCollection mods;
+
+		if(mods.loadFromJSON(jsonModListFilePath, nullptr, true)) {
+			numberOfLoadedMods += mods.numberOfMods();
+		}
+	}
+
+	std::chrono::microseconds inSituJSONDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - benchmarkStartTimePoint));
+
+	benchmarkStartTimePoint = std::chrono::steady_clock::now();
+
+	for(size_t i = 0; i < NUMBER_OF_BENCHMARK_ITERATIONS; i++) {
+		std::ifstream fileStream(jsonModListFilePath);
+		rapidjson::Document modsValue;
+		rapidjson::IStreamWrapper fileStreamWrapper(fileStream);
+
+		if(!modsValue.ParseStream(fileStreamWrapper).HasParseError()) {
+			std::unique_ptr<ModCollection> mods(ModCollection::parseFrom(modsValue, true));
+
+			if(mods != nullptr) {
+				numberOfLoadedMods += mods->numberOfMods();
+			}
+		}
+	}
+
+	std::chrono::microseconds streamedJSONDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - benchmarkStartTimePoint));
+
+	benchmarkStartTimePoint = std::chrono::steady_clock::now();
+
+	for(size_t i = 0; i < NUMBER_OF_BENCHMARK_ITERATIONS; i++) {
+		ModCollection mods;
+
+		if(mods.loadFromXML(xmlModListFilePath, nullptr, true)) {
+			numberOfLoadedMods += mods.numberOfMods();
+		}
+	}
+
+	std::chrono::microseconds xmlDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - benchmarkStartTimePoint));
+
+	uintmax_t jsonModListFileSize = std::filesystem::file_size(std::filesystem::path(jsonModListFilePath), errorCode);
+	uintmax_t xmlModListFileSize = std::filesystem::file_size(std::filesystem::path(xmlModListFilePath), errorCode);
+
+	std::filesystem::remove(std::filesystem::path(jsonModListFilePath), errorCode);
+	std::filesystem::remove(std::filesystem::path(xmlModListFilePath), errorCode);
+
+	spdlog::info("Loaded {} mods: in situ JSON ({} bytes) took {} us per iteration, streamed JSON took {} us per iteration, XML ({} bytes) took {} us per iteration ({} iterations, {} mods loaded in total).", m_mods->numberOfMods(), jsonModListFileSize, inSituJSONDuration.count() / NUMBER_OF_BENCHMARK_ITERATIONS, streamedJSONDuration.count() / NUMBER_OF_BENCHMARK_ITERATIONS, xmlModListFileSize, xmlDuration.count() / NUMBER_OF_BENCHMARK_ITERATIONS, NUMBER_OF_BENCHMARK_ITERATIONS, numberOfLoadedMods);
+
+	return true;
+}
+
+bool ModManager::benchmarkLaunchPlanning() {
+	static constexpr size_t NUMBER_OF_BENCHMARK_ITERATIONS = 5;
+	static const std::string BENCHMARK_DIRECTORY_NAME("Launch Plan Benchmark");
+
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+	if(!m_initialized) {
+		return false;
+	}
+
+	std::error_code errorCode;
+	std::filesystem::path benchmarkDirectoryPath(std::filesystem::temp_directory_path(errorCode) / BENCHMARK_DIRECTORY_NAME);
+
+	if(errorCode) {
+		spdlog::error("Failed to obtain temporary directory path for launch planning benchmark: {}", errorCode.message());
+		return false;
+	}
+
+	// plans are created against empty synthetic game installs so that the results do not depend on which games are actually installed
+	std::vector<std::shared_ptr<GameVersion>> syntheticGameVersions;
+
+	for(const std::shared_ptr<GameVersion> & gameVersion : getGameVersions()->getGameVersions()) {
+		if(!gameVersion->isValid() || gameVersion->isStandAlone()) {
+			continue;
+		}
+
+		std::shared_ptr<GameVersion> syntheticGameVersion(std::make_shared<GameVersion>(*gameVersion));
+		std::string syntheticGamePath((benchmarkDirectoryPath / "Games" / gameVersion->getID()).string());
+		std::string syntheticGameExecutableFilePath(Utilities::joinPaths(syntheticGamePath, syntheticGameVersion->getUnevaluatedGameExecutableDirectoryPath().value_or(""), syntheticGameVersion->getGameExecutableName()));
+
+		std::filesystem::create_directories(std::filesystem::path(syntheticGameExecutableFilePath).parent_path(), errorCode);
+
+		if(errorCode) {
+			spdlog::error("Failed to create synthetic '{}' game install directory: {}", gameVersion->getLongName(), errorCode.message());
+			continue;
+		}
+
+		std::ofstream syntheticGameExecutableFileStream(syntheticGameExecutableFilePath);
+
+		if(syntheticGameVersion->hasSetupExecutableName()) {
+			std::ofstream syntheticSetupExecutableFileStream(Utilities::joinPaths(syntheticGamePath, syntheticGameVersion->getSetupExecutableName().value()));
+		}
+
+		syntheticGameVersion->setGamePath(syntheticGamePath);
+		syntheticGameVersions.push_back(syntheticGameVersion);
+	}
+
+	// the selection and preferred DOSBox version are overwritten while planning, so they are restored however the benchmark exits
+	struct SelectionRestorer final {
+	public:
+		SelectionRestorer(ModManager & modManager)
+			: m_modManager(modManager)
+			, m_selectedMod(modManager.m_selectedMod)
+			, m_selectedModVersionIndex(modManager.m_selectedModVersionIndex)
+			, m_selectedModVersionTypeIndex(modManager.m_selectedModVersionTypeIndex)
+			, m_selectedModGameVersionIndex(modManager.m_selectedModGameVersionIndex)
+			, m_preferredDOSBoxVersion(modManager.m_preferredDOSBoxVersion) { }
+
+		~SelectionRestorer() {
+			m_modManager.m_selectedMod = m_selectedMod;
+			m_modManager.m_selectedModVersionIndex = m_selectedModVersionIndex;
+			m_modManager.m_selectedModVersionTypeIndex = m_selectedModVersionTypeIndex;
+			m_modManager.m_selectedModGameVersionIndex = m_selectedModGameVersionIndex;
+			m_modManager.m_preferredDOSBoxVersion = m_preferredDOSBoxVersion;
+		}
+
+	private:
+		ModManager & m_modManager;
+		std::shared_ptr<Mod> m_selectedMod;
+		size_t m_selectedModVersionIndex;
+		size_t m_selectedModVersionTypeIndex;
+		size_t m_selectedModGameVersionIndex;
+		std::shared_ptr<DOSBoxVersion> m_preferredDOSBoxVersion;
+	};
+
+	std::optional<SelectionRestorer> optionalSelectionRestorer(std::in_place, *this);
+	std::shared_ptr<DOSBoxVersion> preferredDOSBoxVersion(m_preferredDOSBoxVersion);
+
+	if(preferredDOSBoxVersion != nullptr && preferredDOSBoxVersion->isValid()) {
+		std::filesystem::path syntheticDOSBoxDirectoryPath(benchmarkDirectoryPath / "DOSBox" / preferredDOSBoxVersion->getID());
+
+		std::filesystem::create_directories(syntheticDOSBoxDirectoryPath, errorCode);
+
+		if(!errorCode) {
+			std::ofstream syntheticDOSBoxExecutableFileStream(syntheticDOSBoxDirectoryPath / preferredDOSBoxVersion->getExecutableName());
+
+			m_preferredDOSBoxVersion = std::make_shared<DOSBoxVersion>(*preferredDOSBoxVersion);
+			m_preferredDOSBoxVersion->setDirectoryPath(syntheticDOSBoxDirectoryPath.string());
+		}
+	}
+
+	// the selection is assigned directly so that background launch staging is not triggered for every planned mod
+	m_selectedModGameVersionIndex = std::numeric_limits<size_t>::max();
+
+	std::vector<std::chrono::microseconds> launchPlanDurations;
+	size_t numberOfFailedLaunchPlans = 0;
+	size_t totalCommandLength = 0;
+
+	std::chrono::time_point<std::chrono::steady_clock> benchmarkStartTimePoint(std::chrono::steady_clock::now());
+
+	for(size_t iteration = 0; iteration < NUMBER_OF_BENCHMARK_ITERATIONS; iteration++) {
+		for(const std::shared_ptr<Mod> & mod : m_mods->getMods()) {
+			m_selectedMod = mod;
+
+			for(size_t i = 0; i < mod->numberOfVersions(); i++) {
+				std::shared_ptr<ModVersion> modVersion(mod->getVersion(i));
+				m_selectedModVersionIndex = i;
+
+				for(size_t j = 0; j < modVersion->numberOfTypes(); j++) {
+					std::shared_ptr<ModVersionType> modVersionType(modVersion->getType(j));
+					m_selectedModVersionTypeIndex = j;
+
+					for(const std::shared_ptr<GameVersion> & syntheticGameVersion : syntheticGameVersions) {
+						std::vector<std::shared_ptr<ModGameVersion>> compatibleModGameVersions(syntheticGameVersion->getCompatibleModGameVersions(modVersionType->getGameVersions()));
+
+						if(compatibleModGameVersions.empty() || compatibleModGameVersions.back()->isStandAlone()) {
+							continue;
+						}
+
+						std::chrono::time_point<std::chrono::steady_clock> launchPlanStartTimePoint(std::chrono::steady_clock::now());
+
+						std::unique_ptr<LaunchPlan> launchPlan(createLaunchPlan(syntheticGameVersion, compatibleModGameVersions.back()));
+
+						launchPlanDurations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - launchPlanStartTimePoint));
+
+						if(launchPlan == nullptr) {
+							numberOfFailedLaunchPlans++;
+						}
+						else {
+							totalCommandLength += launchPlan->command.length();
+						}
+					}
+				}
+			}
+		}
+	}
+
+	std::chrono::microseconds benchmarkDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - benchmarkStartTimePoint));
+
+	optionalSelectionRestorer.reset();
+
+	std::filesystem::remove_all(benchmarkDirectoryPath, errorCode);
+
+	if(launchPlanDurations.empty()) {
+		spdlog::error("No launch plans were created for {} mods across {} synthetic game installs.", m_mods->numberOfMods(), syntheticGameVersions.size());
+		return false;
+	}
+
+	std::sort(launchPlanDurations.begin(), launchPlanDurations.end());
+
+	std::chrono::microseconds totalLaunchPlanDuration(std::accumulate(launchPlanDurations.cbegin(), launchPlanDurations.cend(), std::chrono::microseconds(0)));
+	double launchPlansPerSecond = benchmarkDuration.count() == 0 ? 0.0 : launchPlanDurations.size() / (benchmarkDuration.count() / 1000000.0);
+
+	spdlog::info("Created {} launch plans ({} failed, {} command characters) for {} mods across {} synthetic game installs per iteration: {:.1f} plans per second, {} us average latency, {} us median latency, {} us 99th percentile latency, {} us maximum latency ({} iterations).", launchPlanDurations.size() / NUMBER_OF_BENCHMARK_ITERATIONS, numberOfFailedLaunchPlans / NUMBER_OF_BENCHMARK_ITERATIONS, totalCommandLength / NUMBER_OF_BENCHMARK_ITERATIONS, m_mods->numberOfMods(), syntheticGameVersions.size(), launchPlansPerSecond, totalLaunchPlanDuration.count() / launchPlanDurations.size(), launchPlanDurations[launchPlanDurations.size() / 2].count(), launchPlanDurations[(launchPlanDurations.size() * 99) / 100].count(), launchPlanDurations.back().count(), NUMBER_OF_BENCHMARK_ITERATIONS);
+
+	return true;
+}
+
 std::string ModManager::getArgumentHelpInfo() {
 	std::stringstream argumentHelpStream;
 
@@ -5501,6 +7271,8 @@ std::string ModManager::getArgumentHelpInfo() {
 	argumentHelpStream << " --nomusic - disable music.\n";
 	argumentHelpStream << " --nm - alias for 'nomusic'.\n";
 	argumentHelpStream << " --local - runs the mod manager in local mode.\n";
+	argumentHelpStream << " --trace \"Trace.json\" - saves initialization and launch phase timings to a Chrome trace event file.\n";
+	argumentHelpStream << " --plan \"Launch Plan.json\" - saves the launch plan for the selected mod to a file instead of running it.\n";
 	argumentHelpStream << " -- <args> - specify arguments to pass through to the target game executable when executing.\n";
 	argumentHelpStream << " --help - displays this help message.\n";
 	argumentHelpStream << " -? - alias for 'help'.\n";
@@ -5717,7 +7489,7 @@ bool ModManager::removeSymlink(const std::string & symlinkName, const std::strin
 	return true;
 }
 
-bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVersion, const std::string & evaluatedGamePath, const std::string & modFilesInstallPath, bool shouldUseTemporaryDirectory, const std::vector<std::string> & sourceConFilePaths, const std::vector<std::string> & sourceDefFilePaths, const std::vector<std::string> & sourceGroupFilePaths, std::string_view customMapFilePath, bool doesRequireCombinedGroup, bool createTempSymlink, InstalledModInfo * installedModInfo) {
+bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVersion, const std::string & evaluatedGamePath, const std::string & modFilesInstallPath, bool shouldUseTemporaryDirectory, const std::vector<std::string> & sourceConFilePaths, const std::vector<std::string> & sourceDefFilePaths, const std::vector<std::string> & sourceGroupFilePaths, std::string_view customMapFilePath, bool doesRequireCombinedGroup, bool createTempSymlink, InstalledModInfo * installedModInfo, LaunchPlan * launchPlan) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
 	SettingsManager * settings = SettingsManager::getInstance();
@@ -5729,26 +7501,38 @@ bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVers
 	const std::string mapsDirectoryPath(getMapsDirectoryPath());
 
 	if(Utilities::areSymlinksSupported() && gameVersion.doesSupportSubdirectories()) {
-		bool result = true;
+		std::vector<LaunchPlan::Symlink> symlinks;
 
-		result &= createSymlink(evaluatedGamePath, settings->gameSymlinkName, std::filesystem::current_path().string());
+		symlinks.push_back(LaunchPlan::Symlink{ evaluatedGamePath, settings->gameSymlinkName, std::filesystem::current_path().string() });
 
 		if(createTempSymlink) {
-			result &= createSymlink(settings->appTempDirectoryPath, settings->tempSymlinkName, modFilesInstallPath);
+			symlinks.push_back(LaunchPlan::Symlink{ settings->appTempDirectoryPath, settings->tempSymlinkName, modFilesInstallPath });
 		}
 
-		result &= createSymlink(std::filesystem::current_path().string(), settings->appSymlinkName, modFilesInstallPath);
+		symlinks.push_back(LaunchPlan::Symlink{ std::filesystem::current_path().string(), settings->appSymlinkName, modFilesInstallPath });
 
-		result &= createSymlink(getModsDirectoryPath(), settings->modsSymlinkName, modFilesInstallPath);
+		symlinks.push_back(LaunchPlan::Symlink{ getModsDirectoryPath(), settings->modsSymlinkName, modFilesInstallPath });
 
 		if(!mapsDirectoryPath.empty()) {
-			result &= createSymlink(mapsDirectoryPath, settings->mapsSymlinkName, modFilesInstallPath);
+			symlinks.push_back(LaunchPlan::Symlink{ mapsDirectoryPath, settings->mapsSymlinkName, modFilesInstallPath });
+		}
+
+		if(launchPlan != nullptr) {
+			launchPlan->symlinks = std::move(symlinks);
+
+			return true;
+		}
+
+		bool result = true;
+
+		for(const LaunchPlan::Symlink & symlink : symlinks) {
+			result &= createSymlink(symlink.target, symlink.name, symlink.destinationDirectoryPath);
 		}
 
 		return result;
 	}
 
-	if(shouldUseTemporaryDirectory && !createGameTemporaryDirectory(modFilesInstallPath)) {
+	if(launchPlan == nullptr && shouldUseTemporaryDirectory && !createGameTemporaryDirectory(modFilesInstallPath)) {
 		return false;
 	}
 
@@ -5778,6 +7562,11 @@ bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVers
 			std::string relativeModFileDestinationFilePath(Utilities::joinPaths(relativeFileDestinationDirectoryPath, modFileFileName));
 			std::string absoluteModFileDestionationFilePath(Utilities::joinPaths(absoluteFileDestinationDirectoryPath, modFileFileName));
 
+			if(launchPlan != nullptr) {
+				launchPlan->stagedFiles.push_back(LaunchPlan::File{ sourceModFilePath, relativeModFileDestinationFilePath });
+				continue;
+			}
+
 			if(std::filesystem::is_regular_file(std::filesystem::path(absoluteModFileDestionationFilePath))) {
 				if(std::filesystem::is_regular_file(std::filesystem::path(absoluteModFileDestionationFilePath + DEFAULT_BACKUP_FILE_RENAME_SUFFIX))) {
 					spdlog::error("Cannot temporarily rename original '{}' mod file, original backup file already exists at path: '{}'. Please manually restore or remove this file.", gameVersion.getLongName(), absoluteModFileDestionationFilePath + DEFAULT_BACKUP_FILE_RENAME_SUFFIX);
@@ -5800,9 +7589,9 @@ bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVers
 			}
 
 			std::error_code errorCode;
-			std::filesystem::copy_file(std::filesystem::path(sourceModFilePath), std::filesystem::path(absoluteModFileDestionationFilePath), errorCode);
+			std::optional<FileStagingService::Method> optionalStagingMethod(m_fileStagingService->stageFile(sourceModFilePath, absoluteModFileDestionationFilePath, errorCode));
 
-			if(errorCode) {
+			if(!optionalStagingMethod.has_value()) {
 				spdlog::error("Failed to copy mod file '{}' from '{}' to directory '{}': {}", modFileFileName, Utilities::getFilePath(sourceModFilePath), absoluteFileDestinationDirectoryPath, errorCode.message());
 				return false;
 			}
@@ -5811,7 +7600,7 @@ bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVers
 				installedModInfo->addModFile(relativeModFileDestinationFilePath);
 			}
 
-			spdlog::debug("Copied mod file '{}' to directory '{}'.", sourceModFilePath, absoluteFileDestinationDirectoryPath);
+			spdlog::debug("Staged mod file '{}' in directory '{}' using '{}' method.", sourceModFilePath, absoluteFileDestinationDirectoryPath, magic_enum::enum_name(optionalStagingMethod.value()));
 		}
 	}
 
@@ -5820,6 +7609,11 @@ bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVers
 		std::string relativeCustomMapDestinationFilePath(Utilities::joinPaths(relativeFileDestinationDirectoryPath, customMapFileName));
 		std::string absoluteCustomMapDestinationFilePath(Utilities::joinPaths(absoluteFileDestinationDirectoryPath, customMapFileName));
 
+		if(launchPlan != nullptr) {
+			launchPlan->stagedFiles.push_back(LaunchPlan::File{ std::string(customMapFilePath), relativeCustomMapDestinationFilePath });
+			return true;
+		}
+
 		if(std::filesystem::is_regular_file(std::filesystem::path(absoluteCustomMapDestinationFilePath))) {
 			if(std::filesystem::is_regular_file(std::filesystem::path(absoluteCustomMapDestinationFilePath + DEFAULT_BACKUP_FILE_RENAME_SUFFIX))) {
 				spdlog::error("Cannot temporarily rename original '{}' map file, original backup file already exists at path: '{}'. Please manually restore or remove this file.", gameVersion.getLongName(), absoluteCustomMapDestinationFilePath + DEFAULT_BACKUP_FILE_RENAME_SUFFIX);
@@ -5842,9 +7636,9 @@ bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVers
 		}
 
 		std::error_code errorCode;
-		std::filesystem::copy_file(std::filesystem::path(customMapFilePath), std::filesystem::path(absoluteCustomMapDestinationFilePath), errorCode);
+		std::optional<FileStagingService::Method> optionalStagingMethod(m_fileStagingService->stageFile(std::string(customMapFilePath), absoluteCustomMapDestinationFilePath, errorCode));
 
-		if(errorCode) {
+		if(!optionalStagingMethod.has_value()) {
 			spdlog::error("Failed to copy map file '{}' to directory '{}': {}", customMapFileName, absoluteFileDestinationDirectoryPath, errorCode.message());
 			return false;
 		}
@@ -5853,7 +7647,7 @@ bool ModManager::createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVers
 			installedModInfo->addModFile(relativeCustomMapDestinationFilePath);
 		}
 
-		spdlog::debug("Copied map file '{}' to directory '{}'.", customMapFileName, absoluteFileDestinationDirectoryPath);
+		spdlog::debug("Staged map file '{}' in directory '{}' using '{}' method.", customMapFileName, absoluteFileDestinationDirectoryPath, magic_enum::enum_name(optionalStagingMethod.value()));
 	}
 
 	return true;
@@ -5931,7 +7725,7 @@ std::vector<std::string> ModManager::deleteFilesWithSuffix(const std::string & s
 	return deletedFilePaths;
 }
 
-std::vector<std::string> ModManager::renameFilesWithSuffixTo(const std::string & fromSuffix, const std::string & toSuffix, const std::string & path) {
+std::vector<std::string> ModManager::renameFilesWithSuffixTo(const std::string & fromSuffix, const std::string & toSuffix, const std::string & path, const std::vector<std::string> & excludedFileNames) {
 	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
 	if(fromSuffix.empty() || toSuffix.empty()) {
@@ -5944,6 +7738,14 @@ std::vector<std::string> ModManager::renameFilesWithSuffixTo(const std::string &
 
 	for(const std::filesystem::directory_entry & e : std::filesystem::directory_iterator(directoryPath)) {
 		if(e.is_regular_file() && Utilities::areStringsEqualIgnoreCase(Utilities::getFileExtension(e.path().string()), fromSuffix)) {
+			std::string fileName(e.path().filename().string());
+
+			if(std::find_if(excludedFileNames.cbegin(), excludedFileNames.cend(), [&fileName](const std::string & excludedFileName) {
+				return Utilities::areStringsEqualIgnoreCase(fileName, excludedFileName);
+			}) != excludedFileNames.cend()) {
+				continue;
+			}
+
 			newFilePath = Utilities::replaceFileExtension(e.path().string(), toSuffix);
 
 			spdlog::info("Renaming file: '{}' to '{}'.", e.path().string(), newFilePath);
@@ -6129,3 +7931,44 @@ void ModManager::onGameVersionCollectionItemModified(GameVersionCollection & gam
 		SettingsManager::getInstance()->preferredGameVersionID = gameVersion.getID();
 	}
 }
+
+bool ModManager::onWatchedDirectoriesChanged(std::vector<std::string> directoryPaths) {
+	// the watcher thread is stopped while the global mutex is held, so blocking on it here could deadlock, instead the change is reported again later
+	std::unique_lock<std::recursive_mutex> lock(m_mutex, std::try_to_lock);
+
+	if(!lock.owns_lock() || isVerifyingIntegrity()) {
+		return false;
+	}
+
+	if(!m_initialized) {
+		return true;
+	}
+
+	std::filesystem::path modsDirectoryPath(std::filesystem::path(getModsDirectoryPath()).lexically_normal());
+	std::vector<std::string> changedModDirectoryPaths;
+
+	for(const std::string & directoryPath : directoryPaths) {
+		spdlog::debug("Detected changes in directory: '{}'.", directoryPath);
+
+		m_directorySnapshotService->invalidate(directoryPath);
+
+		if(std::filesystem::path(directoryPath).lexically_normal().parent_path() == modsDirectoryPath) {
+			changedModDirectoryPaths.push_back(directoryPath);
+		}
+	}
+
+	if(changedModDirectoryPaths.empty()) {
+		return true;
+	}
+
+	if(m_localMode) {
+		updateMissingModFileState();
+	}
+	else {
+		for(const std::string & modDirectoryPath : changedModDirectoryPaths) {
+			removeCachedPackageFilesWithMissingFiles(modDirectoryPath);
+		}
+	}
+
+	return true;
+}
@@ -6,16 +6,19 @@
 
 #include <Analytics/Segment/SegmentAnalytics.h>
 #include <Application/Application.h>
+#include <Signal/SignalConnectionGroup.h>
 
 #include <boost/signals2.hpp>
 
 #include <cstdint>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_set>
 #include <vector>
 
 class ArgumentParser;
@@ -23,22 +26,35 @@ class DOSBoxConfiguration;
 class DOSBoxManager;
 class DOSBoxVersion;
 class DOSBoxVersionCollection;
+class DirectorySnapshotService;
 class DownloadManager;
 class FavouriteModCollection;
+class FileHashService;
+class FileStagingService;
 class GameManager;
 class GameVersion;
 class GameVersionCollection;
 class HTTPRequest;
 class InstalledModInfo;
+struct LaunchPlan;
+class LaunchStagingService;
 class Mod;
 class ModAuthorInformation;
 class ModCollection;
+class ModCollectionDelta;
+class ModDependencyGraph;
+class ModDownload;
+class ModFile;
 class ModGameVersion;
 class ModIdentifier;
+class ModImage;
 class ModMatch;
+class ModScreenshot;
+class ModSearchIndex;
 class ModVersion;
 class ModVersionType;
 class OrganizedModCollection;
+class PhaseProfiler;
 class Process;
 class Script;
 class ScriptArguments;
@@ -56,6 +72,12 @@ public:
 	bool initialize(int argc = 0, char * argv[] = nullptr, bool * aborted = nullptr);
 	bool initialize(std::shared_ptr<ArgumentParser> arguments, bool * aborted = nullptr);
 	bool uninitialize();
+	bool updateModList(bool force = false);
+	bool isVerifyingIntegrity() const;
+	bool verifyIntegrity();
+	void cancelIntegrityVerification();
+	bool doesModHaveMissingFiles(const std::string & modID) const;
+	size_t numberOfModsWithMissingFiles() const;
 
 	bool isUsingLocalMode() const;
 	bool didArgumentHandlingFail() const;
@@ -131,10 +153,10 @@ public:
 	bool selectRandomGameVersion();
 	bool selectRandomTeam();
 	bool selectRandomAuthor();
-	static std::vector<ModMatch> searchForMod(const std::vector<std::shared_ptr<Mod>> & mods, const std::string & query, bool autoPopulateVersion = false, bool autoPopulateVersionType = false);
+	static std::vector<ModMatch> searchForMod(const std::vector<std::shared_ptr<Mod>> & mods, const std::string & query, bool autoPopulateVersion = false, bool autoPopulateVersionType = false, const ModSearchIndex * searchIndex = nullptr, std::function<size_t(const Mod &)> indexOfModFunction = nullptr);
 	static std::vector<std::shared_ptr<ModIdentifier>> searchForFavouriteMod(const std::vector<std::shared_ptr<ModIdentifier>> & favouriteMods, const std::string & query);
-	static std::vector<std::shared_ptr<GameVersion>> searchForGameVersion(const std::vector<std::shared_ptr<GameVersion>> & gameVersions, const std::string & query);
-	static std::vector<std::shared_ptr<ModAuthorInformation>> searchForAuthor(const std::vector<std::shared_ptr<ModAuthorInformation>> & authors, const std::string & query);
+	static std::vector<std::shared_ptr<GameVersion>> searchForGameVersion(const std::vector<std::shared_ptr<GameVersion>> & gameVersions, const std::string & query, const GameVersionCollection * gameVersionCollection = nullptr);
+	static std::vector<std::shared_ptr<ModAuthorInformation>> searchForAuthor(const std::vector<std::shared_ptr<ModAuthorInformation>> & authors, const std::string & query, const ModSearchIndex * searchIndex = nullptr);
 	void clearSelectedMod();
 
 	bool isModSupportedOnSelectedGameVersion();
@@ -142,9 +164,13 @@ public:
 	bool uninstallModGameVersion(const ModGameVersion & modGameVersion);
 	bool shouldRunSelectedMod() const;
 	bool runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersion = nullptr, std::shared_ptr<ModGameVersion> alternateModGameVersion = nullptr);
+	// evaluates the launch of the selected mod without modifying any files or starting the game process
+	std::unique_ptr<LaunchPlan> createLaunchPlan(std::shared_ptr<GameVersion> alternateGameVersion = nullptr, std::shared_ptr<ModGameVersion> alternateModGameVersion = nullptr);
 	bool isGameProcessRunning() const;
 	std::shared_ptr<Process> getGameProcess() const;
 	bool terminateGameProcess();
+	// applies mod list and organized mod collection updates deferred by the launch worker thread, this should be called from the thread which owns the mod list display
+	void applyPendingLaunchUpdates();
 
 	static std::string getArgumentHelpInfo();
 
@@ -156,6 +182,9 @@ public:
 	boost::signals2::signal<bool (const ModGameVersion & /* modGameVersion */, HTTPRequest & /* request */, size_t /* numberOfBytesDownloaded */, size_t /* totalNumberOfBytes */)> modDownloadProgress;
 	boost::signals2::signal<void (uint64_t /* nativeExitCode */, bool /* forceTerminated */)> gameProcessTerminated;
 	boost::signals2::signal<void (std::shared_ptr<Mod> /* mod */, size_t /* modVersionIndex */, size_t /* modVersionTypeIndex */, size_t /* modGameVersionIndex */)> modSelectionChanged;
+	boost::signals2::signal<void (std::shared_ptr<Mod> /* mod */, size_t /* numberOfMissingFiles */)> modMissingFilesDetected;
+	boost::signals2::signal<void (size_t /* numberOfMissingExecutables */, size_t /* numberOfMissingModFiles */, size_t /* numberOfUnlinkedModFiles */, bool /* cancelled */)> integrityVerificationFinished;
+	boost::signals2::signal<void ()> missingModFilesChanged;
 	boost::signals2::signal<void (GameType /* gameType */)> gameTypeChanged;
 	boost::signals2::signal<void (std::shared_ptr<DOSBoxVersion> /* dosboxVersion */)> preferredDOSBoxVersionChanged;
 	boost::signals2::signal<void (std::shared_ptr<GameVersion> /* gameVersion */)> preferredGameVersionChanged;
@@ -172,27 +201,63 @@ public:
 	static const DOSBoxConfiguration DEFAULT_GENERAL_DOSBOX_CONFIGURATION;
 
 private:
+	struct IntegrityVerificationSnapshot {
+		std::vector<std::shared_ptr<Mod>> mods;
+		std::shared_ptr<const ModDependencyGraph> modDependencyGraph;
+		std::shared_ptr<const DOSBoxVersionCollection> dosboxVersions;
+		std::shared_ptr<const GameVersionCollection> gameVersions;
+		std::shared_ptr<const StandAloneModCollection> standAloneMods;
+		std::string modsDirectoryPath;
+		bool checkModFiles;
+	};
+
 	SignalConnectionGroup connectDownloadManagerSignals();
+	std::unique_ptr<ModCollectionDelta> createModListDelta(bool force = false);
+	bool applyModListDelta(const ModCollectionDelta & modListDelta);
+	void notifyLaunchStatus(const std::string & statusMessage);
 	void notifyLaunchError(const std::string & errorMessage);
 	bool notifyInitializationProgress(const std::string & description, bool * aborted = nullptr);
 	void notifyModSelectionChanged();
+	void savePhaseProfileTrace() const;
+	void stageSelectedModLaunch();
+	bool runSelectedMod(std::shared_ptr<GameVersion> alternateGameVersion, std::shared_ptr<ModGameVersion> alternateModGameVersion, LaunchPlan * launchPlan);
+	static std::string getCombinedGroupFileName(const std::vector<std::shared_ptr<ModFile>> & modGroupFiles, const std::vector<std::shared_ptr<ModFile>> & modConFiles, const std::vector<std::shared_ptr<ModFile>> & modDefFiles, bool combinedZip);
 	void assignPlatformFactories();
 	bool handleArguments(const ArgumentParser * args);
 	std::string generateCommand(std::shared_ptr<GameVersion> gameVersion, const std::string & evaluatedGamePath, const std::vector<std::string> & relativeConFilePaths, const std::vector<std::string> & relativeDefFilePaths, const std::vector<std::string> & relativeGroupFilePaths, ScriptArguments & scriptArgs, std::string_view relativeCombinedGroupFilePath = {}, std::string_view combinedDOSBoxConfigurationFilePath = {}, std::string_view relativeCustomMapFilePath = {}) const;
 	std::string generateDOSBoxCommand(const Script & script, const ScriptArguments & arguments, const DOSBoxVersion & dosboxVersion, const  std::string & dosboxArguments, bool showConsole, bool fullscreen, std::string_view combinedDOSBoxConfigurationFilePath = {}) const;
 	size_t checkForUnlinkedModFiles() const;
 	size_t checkForUnlinkedModFilesForGameVersion(const GameVersion & gameVersion) const;
+	size_t checkForUnlinkedModFilesForGameVersionWithoutLocking(const GameVersion & gameVersion, const std::vector<std::shared_ptr<Mod>> & mods, const ModDependencyGraph & modDependencyGraph, const std::string & modsDirectoryPath) const;
 	size_t checkModForMissingFiles(const std::string & modID, std::optional<size_t> versionIndex = {}, std::optional<size_t> versionTypeIndex = {}) const;
 	size_t checkModForMissingFiles(const Mod & mod, std::optional<size_t> versionIndex = {}, std::optional<size_t> versionTypeIndex = {}) const;
+	size_t checkModForMissingFilesUsingDirectorySnapshots(const Mod & mod, const GameVersionCollection & gameVersions, const std::string & modsDirectoryPath, std::optional<size_t> versionIndex = {}, std::optional<size_t> versionTypeIndex = {}, bool verbose = true) const;
 	size_t checkAllModsForMissingFiles() const;
 	size_t checkForMissingExecutables() const;
+	void runIntegrityVerification(IntegrityVerificationSnapshot snapshot);
+	void watchModDirectories();
+	size_t updateMissingModFileState();
+	size_t removeCachedPackageFilesWithMissingFiles(const std::string & modDirectoryPath);
 	size_t updateFileInfoForAllMods(bool save = true, bool skipPopulatedFiles = true);
 	size_t updateModFileInfo(Mod & mod, bool skipPopulatedFiles = true, std::optional<size_t> versionIndex = {}, std::optional<size_t> versionTypeIndex = {});
+	std::string getModDownloadFilePath(const Mod & mod, const ModDownload & modDownload, bool verbose = true) const;
+	std::string getModScreenshotFilePath(const Mod & mod, const ModScreenshot & modScreenshot) const;
+	std::string getModImageFilePath(const Mod & mod, const ModImage & modImage) const;
+	std::string getModFilePath(const Mod & mod, const ModVersion & modVersion, const ModGameVersion & modGameVersion, const ModFile & modFile, const std::string & gameModsPath) const;
+	size_t addModFilesToHashService(const Mod & mod, bool skipPopulatedFiles, FileHashService & fileHashService) const;
+	void forEachModGameVersion(const Mod & mod, std::optional<size_t> versionIndex, std::optional<size_t> versionTypeIndex, bool verbose, const std::function<void(const ModVersion &, const ModVersionType &, const ModGameVersion &, const std::shared_ptr<GameVersion> &, const std::string &)> & function) const;
+	std::string getFileSHA1Hash(const std::string & filePath) const;
 	static bool testParsing();
+	bool benchmarkModDependencyResolution() const;
+	bool benchmarkInternedStrings() const;
+	bool benchmarkModListLoading() const;
+	bool benchmarkLaunchPlanning();
 	static bool areModFilesPresentInDirectory(const std::string & modFilesInstallPath);
-	bool extractModFilesToDirectory(const std::string & modFilesInstallPath, const ModGameVersion & modGameVersion, const GameVersion & selectedGameVersion, const GameVersion & targetGameVersion, InstalledModInfo * installedModInfo = nullptr, const std::vector<std::string> & groupFilePaths = {});
+	bool extractModFilesToDirectory(const std::string & modFilesInstallPath, const ModGameVersion & modGameVersion, const GameVersion & selectedGameVersion, const GameVersion & targetGameVersion, InstalledModInfo * installedModInfo = nullptr, const std::vector<std::string> & groupFilePaths = {}, const InstalledModInfo * reusableInstalledModInfo = nullptr);
 	bool removeModFilesFromDirectory(const std::string & modFilesInstallPath);
 	bool removeModFilesFromDirectory(const std::string & modFilesInstallPath, const InstalledModInfo & installedModInfo);
+	bool retainReusableModFilesInDirectory(const std::string & modFilesInstallPath, const InstalledModInfo & installedModInfo);
+	std::unique_ptr<InstalledModInfo> reuseModFilesInDirectory(const std::string & modFilesInstallPath, const ModVersion & modVersion, const GameVersion & gameVersion);
 	bool createApplicationTemporaryDirectory();
 	void clearApplicationTemporaryDirectory();
 	bool createGameTemporaryDirectory(const std::string & modFilesInstallPath);
@@ -200,16 +265,17 @@ private:
 	bool areSymlinkSettingsValid() const;
 	static bool createSymlink(const std::string & symlinkName, const std::string & symlinkTarget, const std::string & symlinkDestinationDirectory);
 	static bool removeSymlink(const std::string & symlinkName, const std::string & symlinkDestinationDirectory);
-	bool createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVersion, const std::string & evaluatedGamePath, const std::string & modFilesInstallPath, bool shouldUseTemporaryDirectory, const std::vector<std::string> & sourceConFilePaths, const std::vector<std::string> & sourceDefFilePaths, const std::vector<std::string> & sourceGroupFilePaths, std::string_view customMapFilePath, bool doesRequireCombinedGroup, bool createTempSymlink = true, InstalledModInfo * installedModInfo = nullptr);
+	bool createSymlinksOrCopyTemporaryFiles(const GameVersion & gameVersion, const std::string & evaluatedGamePath, const std::string & modFilesInstallPath, bool shouldUseTemporaryDirectory, const std::vector<std::string> & sourceConFilePaths, const std::vector<std::string> & sourceDefFilePaths, const std::vector<std::string> & sourceGroupFilePaths, std::string_view customMapFilePath, bool doesRequireCombinedGroup, bool createTempSymlink = true, InstalledModInfo * installedModInfo = nullptr, LaunchPlan * launchPlan = nullptr);
 	bool removeSymlinks(const GameVersion & gameVersion, const std::string & modFilesInstallPath, bool shouldUseTemporaryDirectory);
 	std::vector<std::string> deleteFilesWithSuffix(const std::string & suffix, const std::string & path = "");
-	std::vector<std::string> renameFilesWithSuffixTo(const std::string & fromSuffix, const std::string & toSuffix, const std::string & path = "");
+	std::vector<std::string> renameFilesWithSuffixTo(const std::string & fromSuffix, const std::string & toSuffix, const std::string & path = "", const std::vector<std::string> & excludedFileNames = {});
 	void onSelectedModChanged(std::shared_ptr<Mod> mod);
 	void onSelectedFavouriteModChanged(std::shared_ptr<ModIdentifier> favouriteMod);
 	void onDOSBoxVersionCollectionSizeChanged(DOSBoxVersionCollection & dosboxVersionCollection);
 	void onDOSBoxVersionCollectionItemModified(DOSBoxVersionCollection & dosboxVersionCollection, DOSBoxVersion & dosboxVersion);
 	void onGameVersionCollectionSizeChanged(GameVersionCollection & gameVersionCollection);
 	void onGameVersionCollectionItemModified(GameVersionCollection & gameVersionCollection, GameVersion & gameVersion);
+	bool onWatchedDirectoriesChanged(std::vector<std::string> directoryPaths);
 	static size_t createDOSBoxTemplateCommandScriptFiles(bool overwrite = false);
 	static size_t createDOSBoxTemplateCommandScriptFiles(const std::string & directoryPath, bool overwrite = false);
 	static bool createDOSBoxTemplateCommandScriptFile(GameType gameType, const std::string & directoryPath, bool overwrite = false);
@@ -222,6 +288,7 @@ private:
 	bool m_localMode;
 	bool m_shouldRunSelectedMod;
 	bool m_demoRecordingEnabled;
+	bool m_planningLaunch;
 	bool m_argumentHandlingFailed;
 	std::shared_ptr<ArgumentParser> m_arguments;
 	std::shared_ptr<DownloadManager> m_downloadManager;
@@ -248,8 +315,23 @@ private:
 	std::shared_ptr<OrganizedModCollection> m_organizedMods;
 	boost::signals2::connection m_selectedModChangedConnection;
 	boost::signals2::connection m_selectedFavouriteModChangedConnection;
+	boost::signals2::connection m_watchedDirectoriesChangedConnection;
 	std::shared_ptr<Process> m_gameProcess;
+	std::shared_ptr<Mod> m_pendingDownloadStatusMod;
+	std::unique_ptr<ModCollectionDelta> m_pendingModListDelta;
+	std::unique_ptr<FileHashService> m_fileHashService;
+	std::unique_ptr<DirectorySnapshotService> m_directorySnapshotService;
+	std::unique_ptr<FileStagingService> m_fileStagingService;
+	std::unique_ptr<PhaseProfiler> m_phaseProfiler;
+	std::unique_ptr<LaunchStagingService> m_launchStagingService;
+	SignalConnectionGroup m_launchStagingConnections;
+	std::future<void> m_integrityVerificationFuture;
+	std::atomic<bool> m_integrityVerificationCancelled;
+	std::unordered_set<std::string> m_modIDsWithMissingFiles;
+	mutable std::mutex m_integrityVerificationMutex;
 	uint8_t m_initializationStep;
+	bool m_initializationAborted;
+	std::mutex m_initializationProgressMutex;
 	mutable std::recursive_mutex m_mutex;
 
 	ModManager(const ModManager &) = delete;
@@ -0,0 +1,436 @@
+#include "PhaseProfiler.h"
+
+#include <Utilities/FileUtilities.h>
+
+#include <fmt/core.h>
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/prettywriter.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <fstream>
+
+static constexpr const char * JSON_TRACE_EVENTS_PROPERTY_NAME = "traceEvents";
+static constexpr const char * JSON_DISPLAY_TIME_UNIT_PROPERTY_NAME = "displayTimeUnit";
+static constexpr const char * JSON_EVENT_NAME_PROPERTY_NAME = "name";
+static constexpr const char * JSON_EVENT_CATEGORY_PROPERTY_NAME = "cat";
+static constexpr const char * JSON_EVENT_PHASE_PROPERTY_NAME = "ph";
+static constexpr const char * JSON_EVENT_TIMESTAMP_PROPERTY_NAME = "ts";
+static constexpr const char * JSON_EVENT_DURATION_PROPERTY_NAME = "dur";
+static constexpr const char * JSON_EVENT_PROCESS_IDENTIFIER_PROPERTY_NAME = "pid";
+static constexpr const char * JSON_EVENT_THREAD_IDENTIFIER_PROPERTY_NAME = "tid";
+static constexpr const char * JSON_EVENT_ARGUMENTS_PROPERTY_NAME = "args";
+static constexpr const char * JSON_EVENT_BYTE_COUNT_PROPERTY_NAME = "bytes";
+static constexpr const char * JSON_EVENT_MEMORY_USAGE_PROPERTY_NAME = "memoryUsage";
+static constexpr const char * JSON_EVENT_PEAK_MEMORY_USAGE_PROPERTY_NAME = "peakMemoryUsage";
+
+static constexpr const char * COMPLETE_EVENT_PHASE = "X";
+static constexpr const char * COUNTER_EVENT_PHASE = "C";
+static constexpr const char * MEMORY_COUNTER_EVENT_NAME = "Memory";
+
+PhaseProfiler::Span::Span()
+	: m_profiler(nullptr)
+	, m_phaseIndex(NO_PARENT)
+	, m_generation(0)
+	, m_active(false) { }
+
+PhaseProfiler::Span::Span(PhaseProfiler * profiler, size_t phaseIndex, size_t generation)
+	: m_profiler(profiler)
+	, m_phaseIndex(phaseIndex)
+	, m_generation(generation)
+	, m_active(true) { }
+
+PhaseProfiler::Span::Span(Span && s) noexcept
+	: m_profiler(s.m_profiler)
+	, m_phaseIndex(s.m_phaseIndex)
+	, m_generation(s.m_generation)
+	, m_active(s.m_active) {
+	s.m_profiler = nullptr;
+	s.m_phaseIndex = NO_PARENT;
+	s.m_active = false;
+}
+
+PhaseProfiler::Span & PhaseProfiler::Span::operator = (Span && s) noexcept {
+	if(this != &s) {
+		end();
+
+		m_profiler = s.m_profiler;
+		m_phaseIndex = s.m_phaseIndex;
+		m_generation = s.m_generation;
+		m_active = s.m_active;
+
+		s.m_profiler = nullptr;
+		s.m_phaseIndex = NO_PARENT;
+		s.m_active = false;
+	}
+
+	return *this;
+}
+
+PhaseProfiler::Span::~Span() {
+	end();
+}
+
+bool PhaseProfiler::Span::isActive() const {
+	return m_active;
+}
+
+void PhaseProfiler::Span::setPhaseName(const std::string & phaseName) {
+	if(!m_active) {
+		return;
+	}
+
+	m_profiler->setPhaseName(*this, phaseName);
+}
+
+void PhaseProfiler::Span::addByteCount(uint64_t byteCount) {
+	if(!m_active) {
+		return;
+	}
+
+	m_profiler->addByteCount(*this, byteCount);
+}
+
+PhaseProfiler::Span PhaseProfiler::Span::beginChildPhase(const std::string & phaseName) {
+	if(!m_active) {
+		return Span();
+	}
+
+	return m_profiler->beginChildPhase(*this, phaseName);
+}
+
+void PhaseProfiler::Span::beginNextPhase(const std::string & phaseName) {
+	if(!m_active) {
+		return;
+	}
+
+	m_profiler->beginNextPhase(*this, phaseName);
+}
+
+void PhaseProfiler::Span::end() {
+	if(!m_active) {
+		return;
+	}
+
+	m_profiler->endPhase(*this);
+
+	// the phase stays associated with the span after it has ended so that its duration and summary can still be obtained
+	m_active = false;
+}
+
+PhaseProfiler::PhaseProfiler()
+	: m_creationTimePoint(std::chrono::steady_clock::now())
+	, m_generation(0) { }
+
+PhaseProfiler::~PhaseProfiler() = default;
+
+size_t PhaseProfiler::numberOfPhases() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return m_phases.size();
+}
+
+PhaseProfiler::Span PhaseProfiler::beginPhase(const std::string & phaseName) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	return Span(this, beginPhaseWithoutLocking(phaseName, NO_PARENT), m_generation);
+}
+
+std::optional<std::chrono::microseconds> PhaseProfiler::getPhaseDuration(const Span & span) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(!isSpanValidWithoutLocking(span)) {
+		return {};
+	}
+
+	const Phase & phase = m_phases[span.m_phaseIndex];
+
+	return std::chrono::duration_cast<std::chrono::microseconds>(phase.endTimePoint.value_or(std::chrono::steady_clock::now()) - phase.startTimePoint);
+}
+
+std::vector<std::string> PhaseProfiler::getSummary(const Span & span) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(!isSpanValidWithoutLocking(span)) {
+		return {};
+	}
+
+	// phases are stored in the order they were started, so children always follow their parent
+	std::unordered_map<size_t, std::vector<size_t>> childPhaseIndices;
+
+	for(size_t i = span.m_phaseIndex + 1; i < m_phases.size(); i++) {
+		if(m_phases[i].parentIndex != NO_PARENT) {
+			childPhaseIndices[m_phases[i].parentIndex].push_back(i);
+		}
+	}
+
+	std::vector<std::string> summary;
+
+	addSummaryLines(span.m_phaseIndex, m_phases[span.m_phaseIndex].depth, std::chrono::steady_clock::now(), childPhaseIndices, summary);
+
+	return summary;
+}
+
+rapidjson::Document PhaseProfiler::toChromeTraceJSON() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	rapidjson::Document traceDocument(rapidjson::kObjectType);
+	rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator> & allocator = traceDocument.GetAllocator();
+	std::chrono::time_point<std::chrono::steady_clock> currentTimePoint(std::chrono::steady_clock::now());
+
+	rapidjson::Value traceEventsValue(rapidjson::kArrayType);
+	traceEventsValue.Reserve(m_phases.size() * 2, allocator);
+
+	for(size_t i = 0; i < m_phases.size(); i++) {
+		const Phase & phase = m_phases[i];
+		std::chrono::time_point<std::chrono::steady_clock> endTimePoint(phase.endTimePoint.value_or(currentTimePoint));
+		int64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(phase.startTimePoint - m_creationTimePoint).count();
+		int64_t endTimestamp = std::chrono::duration_cast<std::chrono::microseconds>(endTimePoint - m_creationTimePoint).count();
+
+		rapidjson::Value phaseEventValue(rapidjson::kObjectType);
+
+		rapidjson::Value nameValue(phase.name.c_str(), allocator);
+		phaseEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_NAME_PROPERTY_NAME), nameValue, allocator);
+
+		rapidjson::Value categoryValue(getRootPhaseNameWithoutLocking(i).c_str(), allocator);
+		phaseEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_CATEGORY_PROPERTY_NAME), categoryValue, allocator);
+
+		phaseEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_PHASE_PROPERTY_NAME), rapidjson::StringRef(COMPLETE_EVENT_PHASE), allocator);
+		phaseEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_TIMESTAMP_PROPERTY_NAME), rapidjson::Value(timestamp), allocator);
+		phaseEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_DURATION_PROPERTY_NAME), rapidjson::Value(endTimestamp - timestamp), allocator);
+		phaseEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_PROCESS_IDENTIFIER_PROPERTY_NAME), rapidjson::Value(1), allocator);
+		phaseEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_THREAD_IDENTIFIER_PROPERTY_NAME), rapidjson::Value(static_cast<uint64_t>(phase.threadIndex + 1)), allocator);
+
+		rapidjson::Value argumentsValue(rapidjson::kObjectType);
+
+		if(phase.byteCount != 0) {
+			argumentsValue.AddMember(rapidjson::StringRef(JSON_EVENT_BYTE_COUNT_PROPERTY_NAME), rapidjson::Value(phase.byteCount), allocator);
+		}
+
+		if(phase.memoryUsage.has_value()) {
+			argumentsValue.AddMember(rapidjson::StringRef(JSON_EVENT_MEMORY_USAGE_PROPERTY_NAME), rapidjson::Value(phase.memoryUsage.value()), allocator);
+		}
+
+		if(phase.peakMemoryUsage.has_value()) {
+			argumentsValue.AddMember(rapidjson::StringRef(JSON_EVENT_PEAK_MEMORY_USAGE_PROPERTY_NAME), rapidjson::Value(phase.peakMemoryUsage.value()), allocator);
+		}
+
+		phaseEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_ARGUMENTS_PROPERTY_NAME), argumentsValue, allocator);
+
+		traceEventsValue.PushBack(phaseEventValue, allocator);
+
+		if(!phase.memoryUsage.has_value() && !phase.peakMemoryUsage.has_value()) {
+			continue;
+		}
+
+		// memory samples are taken when a phase ends and shown as a counter track
+		rapidjson::Value memoryEventValue(rapidjson::kObjectType);
+		memoryEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_NAME_PROPERTY_NAME), rapidjson::StringRef(MEMORY_COUNTER_EVENT_NAME), allocator);
+		memoryEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_PHASE_PROPERTY_NAME), rapidjson::StringRef(COUNTER_EVENT_PHASE), allocator);
+		memoryEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_TIMESTAMP_PROPERTY_NAME), rapidjson::Value(endTimestamp), allocator);
+		memoryEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_PROCESS_IDENTIFIER_PROPERTY_NAME), rapidjson::Value(1), allocator);
+
+		rapidjson::Value memoryArgumentsValue(rapidjson::kObjectType);
+
+		if(phase.memoryUsage.has_value()) {
+			memoryArgumentsValue.AddMember(rapidjson::StringRef(JSON_EVENT_MEMORY_USAGE_PROPERTY_NAME), rapidjson::Value(phase.memoryUsage.value()), allocator);
+		}
+
+		if(phase.peakMemoryUsage.has_value()) {
+			memoryArgumentsValue.AddMember(rapidjson::StringRef(JSON_EVENT_PEAK_MEMORY_USAGE_PROPERTY_NAME), rapidjson::Value(phase.peakMemoryUsage.value()), allocator);
+		}
+
+		memoryEventValue.AddMember(rapidjson::StringRef(JSON_EVENT_ARGUMENTS_PROPERTY_NAME), memoryArgumentsValue, allocator);
+
+		traceEventsValue.PushBack(memoryEventValue, allocator);
+	}
+
+	traceDocument.AddMember(rapidjson::StringRef(JSON_TRACE_EVENTS_PROPERTY_NAME), traceEventsValue, allocator);
+	traceDocument.AddMember(rapidjson::StringRef(JSON_DISPLAY_TIME_UNIT_PROPERTY_NAME), rapidjson::StringRef("ms"), allocator);
+
+	return traceDocument;
+}
+
+bool PhaseProfiler::saveChromeTraceTo(const std::string & filePath) const {
+	if(filePath.empty()) {
+		spdlog::error("Cannot save phase profile to empty trace file path.");
+		return false;
+	}
+
+	std::ofstream fileStream(filePath);
+
+	if(!fileStream.is_open()) {
+		spdlog::error("Failed to open phase profile trace file '{}' for writing.", filePath);
+		return false;
+	}
+
+	rapidjson::Document trace(toChromeTraceJSON());
+
+	rapidjson::OStreamWrapper fileStreamWrapper(fileStream);
+	rapidjson::PrettyWriter<rapidjson::OStreamWrapper> fileStreamWriter(fileStreamWrapper);
+	fileStreamWriter.SetIndent('\t', 1);
+	trace.Accept(fileStreamWriter);
+	fileStream.close();
+
+	spdlog::info("Saved phase profile trace to file: '{}'.", filePath);
+
+	return true;
+}
+
+void PhaseProfiler::clear() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_phases.clear();
+	m_activePhaseStacks.clear();
+	m_generation++;
+}
+
+PhaseProfiler::Span PhaseProfiler::beginChildPhase(const Span & parentSpan, const std::string & phaseName) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(!isSpanValidWithoutLocking(parentSpan)) {
+		return Span();
+	}
+
+	return Span(this, beginPhaseWithoutLocking(phaseName, parentSpan.m_phaseIndex), m_generation);
+}
+
+void PhaseProfiler::beginNextPhase(Span & span, const std::string & phaseName) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(!isSpanValidWithoutLocking(span)) {
+		span.m_active = false;
+		return;
+	}
+
+	size_t parentIndex = m_phases[span.m_phaseIndex].parentIndex;
+
+	endPhaseWithoutLocking(span.m_phaseIndex);
+
+	span.m_phaseIndex = beginPhaseWithoutLocking(phaseName, parentIndex);
+}
+
+void PhaseProfiler::endPhase(const Span & span) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(!isSpanValidWithoutLocking(span)) {
+		return;
+	}
+
+	endPhaseWithoutLocking(span.m_phaseIndex);
+}
+
+void PhaseProfiler::setPhaseName(const Span & span, const std::string & phaseName) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(!isSpanValidWithoutLocking(span)) {
+		return;
+	}
+
+	m_phases[span.m_phaseIndex].name = phaseName;
+}
+
+void PhaseProfiler::addByteCount(const Span & span, uint64_t byteCount) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if(!isSpanValidWithoutLocking(span)) {
+		return;
+	}
+
+	m_phases[span.m_phaseIndex].byteCount += byteCount;
+}
+
+bool PhaseProfiler::isSpanValidWithoutLocking(const Span & span) const {
+	return span.m_profiler == this &&
+		   span.m_generation == m_generation &&
+		   span.m_phaseIndex < m_phases.size();
+}
+
+size_t PhaseProfiler::beginPhaseWithoutLocking(const std::string & phaseName, size_t parentIndex) {
+	std::thread::id threadID(std::this_thread::get_id());
+	std::unordered_map<std::thread::id, size_t>::const_iterator threadIndexIterator(m_threadIndices.find(threadID));
+	size_t threadIndex = 0;
+
+	if(threadIndexIterator == m_threadIndices.cend()) {
+		threadIndex = m_threadIndices.size();
+		m_threadIndices.emplace(threadID, threadIndex);
+	}
+	else {
+		threadIndex = threadIndexIterator->second;
+	}
+
+	std::vector<size_t> & activePhaseStack = m_activePhaseStacks[threadIndex];
+
+	if(parentIndex == NO_PARENT && !activePhaseStack.empty()) {
+		parentIndex = activePhaseStack.back();
+	}
+
+	Phase phase;
+	phase.name = phaseName;
+	phase.parentIndex = parentIndex;
+	phase.depth = parentIndex == NO_PARENT ? 0 : m_phases[parentIndex].depth + 1;
+	phase.threadIndex = threadIndex;
+	phase.byteCount = 0;
+	phase.startTimePoint = std::chrono::steady_clock::now();
+
+	size_t phaseIndex = m_phases.size();
+
+	m_phases.push_back(std::move(phase));
+	activePhaseStack.push_back(phaseIndex);
+
+	return phaseIndex;
+}
+
+void PhaseProfiler::endPhaseWithoutLocking(size_t phaseIndex) {
+	if(phaseIndex >= m_phases.size() || m_phases[phaseIndex].endTimePoint.has_value()) {
+		return;
+	}
+
+	Phase & phase = m_phases[phaseIndex];
+
+	phase.endTimePoint = std::chrono::steady_clock::now();
+	phase.memoryUsage = getMemoryUsage();
+	phase.peakMemoryUsage = getPeakMemoryUsage();
+
+	// phases are not necessarily ended in the reverse order that they were begun in
+	std::vector<size_t> & activePhaseStack = m_activePhaseStacks[phase.threadIndex];
+	std::vector<size_t>::const_iterator activePhaseIterator(std::find(activePhaseStack.cbegin(), activePhaseStack.cend(), phaseIndex));
+
+	if(activePhaseIterator != activePhaseStack.cend()) {
+		activePhaseStack.erase(activePhaseIterator);
+	}
+}
+
+std::string PhaseProfiler::getRootPhaseNameWithoutLocking(size_t phaseIndex) const {
+	while(m_phases[phaseIndex].parentIndex != NO_PARENT) {
+		phaseIndex = m_phases[phaseIndex].parentIndex;
+	}
+
+	return m_phases[phaseIndex].name;
+}
+
+void PhaseProfiler::addSummaryLines(size_t phaseIndex, size_t rootDepth, std::chrono::time_point<std::chrono::steady_clock> currentTimePoint, const std::unordered_map<size_t, std::vector<size_t>> & childPhaseIndices, std::vector<std::string> & summary) const {
+	const Phase & phase = m_phases[phaseIndex];
+	std::chrono::milliseconds duration(std::chrono::duration_cast<std::chrono::milliseconds>(phase.endTimePoint.value_or(currentTimePoint) - phase.startTimePoint));
+	std::string details;
+
+	if(phase.byteCount != 0) {
+		details += fmt::format(", {}", Utilities::fileSizeToString(phase.byteCount));
+	}
+
+	if(phase.peakMemoryUsage.has_value()) {
+		details += fmt::format(", peak memory {}", Utilities::fileSizeToString(phase.peakMemoryUsage.value()));
+	}
+
+	summary.push_back(fmt::format("{}{}: {} ms{}{}", std::string((phase.depth - rootDepth) * 2, ' '), phase.name, duration.count(), details, phase.endTimePoint.has_value() ? "" : " (in progress)"));
+
+	std::unordered_map<size_t, std::vector<size_t>>::const_iterator childPhaseIndicesIterator(childPhaseIndices.find(phaseIndex));
+
+	if(childPhaseIndicesIterator == childPhaseIndices.cend()) {
+		return;
+	}
+
+	for(size_t childPhaseIndex : childPhaseIndicesIterator->second) {
+		addSummaryLines(childPhaseIndex, rootDepth, currentTimePoint, childPhaseIndices, summary);
+	}
+}
@@ -0,0 +1,101 @@
+#ifndef _PHASE_PROFILER_H_
+#define _PHASE_PROFILER_H_
+
+#include <rapidjson/document.h>
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class PhaseProfiler final {
+public:
+	class Span final {
+		friend class PhaseProfiler;
+
+	public:
+		Span();
+		Span(Span && s) noexcept;
+		Span & operator = (Span && s) noexcept;
+		~Span();
+
+		bool isActive() const;
+		void setPhaseName(const std::string & phaseName);
+		void addByteCount(uint64_t byteCount);
+		// phases begun through the profiler are nested under the innermost active phase on the calling thread, child phases can also be begun from other threads
+		Span beginChildPhase(const std::string & phaseName);
+		void beginNextPhase(const std::string & phaseName);
+		void end();
+
+	private:
+		Span(PhaseProfiler * profiler, size_t phaseIndex, size_t generation);
+
+		PhaseProfiler * m_profiler;
+		size_t m_phaseIndex;
+		size_t m_generation;
+		bool m_active;
+
+		Span(const Span &) = delete;
+		const Span & operator = (const Span &) = delete;
+	};
+
+	PhaseProfiler();
+	~PhaseProfiler();
+
+	size_t numberOfPhases() const;
+	Span beginPhase(const std::string & phaseName);
+	std::optional<std::chrono::microseconds> getPhaseDuration(const Span & span) const;
+	std::vector<std::string> getSummary(const Span & span) const;
+	rapidjson::Document toChromeTraceJSON() const;
+	bool saveChromeTraceTo(const std::string & filePath) const;
+	// spans begun before clearing are detached from the profiler and no longer record anything
+	void clear();
+
+	static std::optional<uint64_t> getMemoryUsage();
+	static std::optional<uint64_t> getPeakMemoryUsage();
+
+private:
+	static constexpr size_t NO_PARENT = std::numeric_limits<size_t>::max();
+
+	struct Phase {
+		std::string name;
+		size_t parentIndex;
+		size_t depth;
+		size_t threadIndex;
+		std::chrono::time_point<std::chrono::steady_clock> startTimePoint;
+		std::optional<std::chrono::time_point<std::chrono::steady_clock>> endTimePoint;
+		uint64_t byteCount;
+		std::optional<uint64_t> memoryUsage;
+		std::optional<uint64_t> peakMemoryUsage;
+	};
+
+	Span beginChildPhase(const Span & parentSpan, const std::string & phaseName);
+	void beginNextPhase(Span & span, const std::string & phaseName);
+	void endPhase(const Span & span);
+	void setPhaseName(const Span & span, const std::string & phaseName);
+	void addByteCount(const Span & span, uint64_t byteCount);
+	bool isSpanValidWithoutLocking(const Span & span) const;
+	size_t beginPhaseWithoutLocking(const std::string & phaseName, size_t parentIndex);
+	void endPhaseWithoutLocking(size_t phaseIndex);
+	std::string getRootPhaseNameWithoutLocking(size_t phaseIndex) const;
+	void addSummaryLines(size_t phaseIndex, size_t rootDepth, std::chrono::time_point<std::chrono::steady_clock> currentTimePoint, const std::unordered_map<size_t, std::vector<size_t>> & childPhaseIndices, std::vector<std::string> & summary) const;
+
+	std::chrono::time_point<std::chrono::steady_clock> m_creationTimePoint;
+	std::vector<Phase> m_phases;
+	std::unordered_map<std::thread::id, size_t> m_threadIndices;
+	std::unordered_map<size_t, std::vector<size_t>> m_activePhaseStacks;
+	size_t m_generation;
+	mutable std::mutex m_mutex;
+
+	PhaseProfiler(const PhaseProfiler &) = delete;
+	PhaseProfiler(PhaseProfiler &&) noexcept = delete;
+	const PhaseProfiler & operator = (const PhaseProfiler &) = delete;
+	const PhaseProfiler & operator = (PhaseProfiler &&) noexcept = delete;
+};
+
+#endif // _PHASE_PROFILER_H_
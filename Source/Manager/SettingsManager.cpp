@@ -1,6 +1,7 @@
 #include "SettingsManager.h"
 
 #include "Game/GameVersion.h"
+#include "Game/File/JSONFileReader.h"
 #include "ModManager.h"
 
 #include <Arguments/ArgumentParser.h>
@@ -41,6 +42,7 @@ static constexpr const char * TEMP_SYMLINK_NAME_PROPERTY_NAME = "tempSymlinkName
 static constexpr const char * GAME_SYMLINK_NAME_PROPERTY_NAME = "gameSymlinkName";
 static constexpr const char * LOCAL_MODE_PROPERTY_NAME = "localMode";
 static constexpr const char * DEMO_EXTRACTION_ENABLED_PROPERTY_NAME = "demoExtractionEnabled";
+static constexpr const char * REUSE_INSTALLED_MOD_FILES_PROPERTY_NAME = "reuseInstalledModFiles";
 
 static constexpr const char * GAME_VERSIONS_CATEGORY_NAME = "gameVersions";
 static constexpr const char * GAME_VERSIONS_LIST_FILE_PATH_PROPERTY_NAME = LIST_FILE_PATH;
@@ -72,6 +74,7 @@ static constexpr const char * GROUP_DOWNLOADS_DIRECTORY_NAME_PROPERTY_NAME = "gr
 
 static constexpr const char * CACHE_CATEGORY_NAME = "cache";
 static constexpr const char * CACHE_DIRECTORY_PATH_PROPERTY_NAME = DIRECTORY_PATH;
+static constexpr const char * FILE_FINGERPRINT_CACHE_FILE_NAME_PROPERTY_NAME = "fileFingerprintCacheFileName";
 
 static constexpr const char * DOSBOX_CATEGORY_NAME = "dosbox";
 static constexpr const char * DOSBOX_VERSIONS_LIST_FILE_PATH_PROPERTY_NAME = LIST_FILE_PATH;
@@ -160,6 +163,7 @@ const std::string SettingsManager::DEFAULT_GAME_DOWNLOADS_LIST_FILE_PATH("Duke N
 const std::string SettingsManager::DEFAULT_GAME_SYMLINK_NAME("Game");
 const bool SettingsManager::DEFAULT_LOCAL_MODE = false;
 const bool SettingsManager::DEFAULT_DEMO_EXTRACTION_ENABLED = false;
+const bool SettingsManager::DEFAULT_REUSE_INSTALLED_MOD_FILES = false;
 const std::string SettingsManager::DEFAULT_MODS_DIRECTORY_PATH("Mods");
 const std::string SettingsManager::DEFAULT_MODS_SYMLINK_NAME("DNMMMods");
 const std::string SettingsManager::DEFAULT_MOD_PACKAGE_DOWNLOADS_DIRECTORY_PATH("");
@@ -180,6 +184,7 @@ const std::string SettingsManager::DEFAULT_APP_SYMLINK_NAME("DNMMApp");
 const std::string SettingsManager::DEFAULT_GAME_TEMP_DIRECTORY_NAME("Temp");
 const std::string SettingsManager::DEFAULT_TEMP_SYMLINK_NAME("DNMMTemp");
 const std::string SettingsManager::DEFAULT_CACHE_DIRECTORY_PATH("Cache");
+const std::string SettingsManager::DEFAULT_FILE_FINGERPRINT_CACHE_FILE_NAME("File Fingerprint Cache.json");
 const std::string SettingsManager::DEFAULT_DOSBOX_ARGUMENTS("");
 const bool SettingsManager::DEFAULT_DOSBOX_SHOW_CONSOLE = false;
 const bool SettingsManager::DEFAULT_DOSBOX_FULLSCREEN = false;
@@ -332,6 +337,7 @@ SettingsManager::SettingsManager()
 	, gameSymlinkName(DEFAULT_GAME_SYMLINK_NAME)
 	, localMode(DEFAULT_LOCAL_MODE)
 	, demoExtractionEnabled(DEFAULT_DEMO_EXTRACTION_ENABLED)
+	, reuseInstalledModFiles(DEFAULT_REUSE_INSTALLED_MOD_FILES)
 	, modsDirectoryPath(DEFAULT_MODS_DIRECTORY_PATH)
 	, modsSymlinkName(DEFAULT_MODS_SYMLINK_NAME)
 	, modPackageDownloadsDirectoryPath(DEFAULT_MOD_PACKAGE_DOWNLOADS_DIRECTORY_PATH)
@@ -351,6 +357,7 @@ SettingsManager::SettingsManager()
 	, gameTempDirectoryName(DEFAULT_GAME_TEMP_DIRECTORY_NAME)
 	, tempSymlinkName(DEFAULT_TEMP_SYMLINK_NAME)
 	, cacheDirectoryPath(DEFAULT_CACHE_DIRECTORY_PATH)
+	, fileFingerprintCacheFileName(DEFAULT_FILE_FINGERPRINT_CACHE_FILE_NAME)
 	, dosboxArguments(DEFAULT_DOSBOX_ARGUMENTS)
 	, dosboxShowConsole(DEFAULT_DOSBOX_SHOW_CONSOLE)
 	, dosboxFullscreen(DEFAULT_DOSBOX_FULLSCREEN)
@@ -410,6 +417,7 @@ void SettingsManager::reset() {
 	gameSymlinkName = DEFAULT_GAME_SYMLINK_NAME;
 	localMode = DEFAULT_LOCAL_MODE;
 	demoExtractionEnabled = DEFAULT_DEMO_EXTRACTION_ENABLED;
+	reuseInstalledModFiles = DEFAULT_REUSE_INSTALLED_MOD_FILES;
 	modsDirectoryPath = DEFAULT_MODS_DIRECTORY_PATH;
 	modsSymlinkName = DEFAULT_MODS_SYMLINK_NAME;
 	modPackageDownloadsDirectoryPath = DEFAULT_MOD_PACKAGE_DOWNLOADS_DIRECTORY_PATH;
@@ -430,6 +438,7 @@ void SettingsManager::reset() {
 	gameTempDirectoryName = DEFAULT_GAME_TEMP_DIRECTORY_NAME;
 	tempSymlinkName = DEFAULT_TEMP_SYMLINK_NAME;
 	cacheDirectoryPath = DEFAULT_CACHE_DIRECTORY_PATH;
+	fileFingerprintCacheFileName = DEFAULT_FILE_FINGERPRINT_CACHE_FILE_NAME;
 	dosboxArguments = DEFAULT_DOSBOX_ARGUMENTS;
 	dosboxShowConsole = DEFAULT_DOSBOX_SHOW_CONSOLE;
 	dosboxFullscreen = DEFAULT_DOSBOX_FULLSCREEN;
@@ -508,6 +517,7 @@ rapidjson::Document SettingsManager::toJSON() const {
 	settingsDocument.AddMember(rapidjson::StringRef(GAME_SYMLINK_NAME_PROPERTY_NAME), gameSymlinkNameValue, allocator);
 	settingsDocument.AddMember(rapidjson::StringRef(LOCAL_MODE_PROPERTY_NAME), rapidjson::Value(localMode), allocator);
 	settingsDocument.AddMember(rapidjson::StringRef(DEMO_EXTRACTION_ENABLED_PROPERTY_NAME), rapidjson::Value(demoExtractionEnabled), allocator);
+	settingsDocument.AddMember(rapidjson::StringRef(REUSE_INSTALLED_MOD_FILES_PROPERTY_NAME), rapidjson::Value(reuseInstalledModFiles), allocator);
 
 	rapidjson::Value gameVersionsCategoryValue(rapidjson::kObjectType);
 
@@ -583,6 +593,9 @@ rapidjson::Document SettingsManager::toJSON() const {
 	rapidjson::Value cacheDirectoryPathValue(cacheDirectoryPath.c_str(), allocator);
 	cacheCategoryValue.AddMember(rapidjson::StringRef(CACHE_DIRECTORY_PATH_PROPERTY_NAME), cacheDirectoryPathValue, allocator);
 
+	rapidjson::Value fileFingerprintCacheFileNameValue(fileFingerprintCacheFileName.c_str(), allocator);
+	cacheCategoryValue.AddMember(rapidjson::StringRef(FILE_FINGERPRINT_CACHE_FILE_NAME_PROPERTY_NAME), fileFingerprintCacheFileNameValue, allocator);
+
 	settingsDocument.AddMember(rapidjson::StringRef(CACHE_CATEGORY_NAME), cacheCategoryValue, allocator);
 
 	rapidjson::Value dosboxCategoryValue(rapidjson::kObjectType);
@@ -817,6 +830,7 @@ bool SettingsManager::parseFrom(const rapidjson::Value & settingsDocument) {
 	assignStringSetting(gameSymlinkName, settingsDocument, GAME_SYMLINK_NAME_PROPERTY_NAME);
 	assignBooleanSetting(localMode, settingsDocument, LOCAL_MODE_PROPERTY_NAME);
 	assignBooleanSetting(demoExtractionEnabled, settingsDocument, DEMO_EXTRACTION_ENABLED_PROPERTY_NAME);
+	assignBooleanSetting(reuseInstalledModFiles, settingsDocument, REUSE_INSTALLED_MOD_FILES_PROPERTY_NAME);
 
 	if(settingsDocument.HasMember(GAME_VERSIONS_CATEGORY_NAME) && settingsDocument[GAME_VERSIONS_CATEGORY_NAME].IsObject()) {
 		const rapidjson::Value & gameVersionsCategoryValue = settingsDocument[GAME_VERSIONS_CATEGORY_NAME];
@@ -862,6 +876,7 @@ bool SettingsManager::parseFrom(const rapidjson::Value & settingsDocument) {
 		const rapidjson::Value & cacheCategoryValue = settingsDocument[CACHE_CATEGORY_NAME];
 
 		assignStringSetting(cacheDirectoryPath, cacheCategoryValue, CACHE_DIRECTORY_PATH_PROPERTY_NAME);
+		assignStringSetting(fileFingerprintCacheFileName, cacheCategoryValue, FILE_FINGERPRINT_CACHE_FILE_NAME_PROPERTY_NAME);
 	}
 
 	if(settingsDocument.HasMember(DOSBOX_CATEGORY_NAME) && settingsDocument[DOSBOX_CATEGORY_NAME].IsObject()) {
@@ -1059,23 +1074,20 @@ bool SettingsManager::loadFrom(const std::string & filePath, bool autoCreate) {
 		return false;
 	}
 
-	std::ifstream fileStream(filePath);
+	JSONFileReader fileReader;
 
-	if(!fileStream.is_open()) {
-		spdlog::error("Failed to open settings file '{}' for parsing!", filePath);
-		return false;
-	}
+	if(!fileReader.load(filePath)) {
+		if(fileReader.getDocument().HasParseError()) {
+			spdlog::error("Failed to parse settings file JSON data: {}", fileReader.getParseErrorMessage());
+		}
+		else {
+			spdlog::error("Failed to open settings file '{}' for parsing!", filePath);
+		}
 
-	rapidjson::Document settings;
-	rapidjson::IStreamWrapper fileStreamWrapper(fileStream);
-	if(settings.ParseStream(fileStreamWrapper).HasParseError()) {
-		spdlog::error("Failed to parse settings file JSON data!");
 		return false;
 	}
 
-	fileStream.close();
-
-	if(!parseFrom(settings)) {
+	if(!parseFrom(fileReader.getDocument())) {
 		spdlog::error("Failed to parse settings from file '{}'!", filePath);
 		return false;
 	}
@@ -42,6 +42,7 @@ public:
 	static const std::string DEFAULT_GAME_SYMLINK_NAME;
 	static const bool DEFAULT_LOCAL_MODE;
 	static const bool DEFAULT_DEMO_EXTRACTION_ENABLED;
+	static const bool DEFAULT_REUSE_INSTALLED_MOD_FILES;
 	static const std::string DEFAULT_MODS_DIRECTORY_PATH;
 	static const std::string DEFAULT_MODS_SYMLINK_NAME;
 	static const std::string DEFAULT_MOD_PACKAGE_DOWNLOADS_DIRECTORY_PATH;
@@ -62,6 +63,7 @@ public:
 	static const std::string DEFAULT_GAME_TEMP_DIRECTORY_NAME;
 	static const std::string DEFAULT_TEMP_SYMLINK_NAME;
 	static const std::string DEFAULT_CACHE_DIRECTORY_PATH;
+	static const std::string DEFAULT_FILE_FINGERPRINT_CACHE_FILE_NAME;
 	static const std::string DEFAULT_DOSBOX_ARGUMENTS;
 	static const bool DEFAULT_DOSBOX_SHOW_CONSOLE;
 	static const bool DEFAULT_DOSBOX_FULLSCREEN;
@@ -112,6 +114,7 @@ public:
 	std::string gameSymlinkName;
 	bool localMode;
 	bool demoExtractionEnabled;
+	bool reuseInstalledModFiles;
 	std::string modsDirectoryPath;
 	std::string modsSymlinkName;
 	std::string modPackageDownloadsDirectoryPath;
@@ -132,6 +135,7 @@ public:
 	std::string gameTempDirectoryName;
 	std::string tempSymlinkName;
 	std::string cacheDirectoryPath;
+	std::string fileFingerprintCacheFileName;
 	std::string dosboxArguments;
 	bool dosboxShowConsole;
 	bool dosboxFullscreen;
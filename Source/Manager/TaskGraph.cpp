@@ -0,0 +1,267 @@
+#include "TaskGraph.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+TaskGraph::TaskGraph(size_t numberOfThreads)
+	: m_numberOfThreads(numberOfThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : numberOfThreads) { }
+
+TaskGraph::~TaskGraph() = default;
+
+size_t TaskGraph::getNumberOfThreads() const {
+	return m_numberOfThreads;
+}
+
+size_t TaskGraph::numberOfTasks() const {
+	return m_tasks.size();
+}
+
+bool TaskGraph::hasTask(const std::string & taskName) const {
+	return m_taskIndices.find(taskName) != m_taskIndices.cend();
+}
+
+bool TaskGraph::addTask(const std::string & taskName, std::function<bool()> function, const std::vector<std::string> & dependencies) {
+	if(taskName.empty() || function == nullptr) {
+		return false;
+	}
+
+	if(hasTask(taskName)) {
+		spdlog::error("Task graph already contains a task named '{}'.", taskName);
+		return false;
+	}
+
+	Task task;
+	task.name = taskName;
+	task.function = std::move(function);
+	task.numberOfRemainingDependencies = 0;
+	task.completed = false;
+	task.duration = std::chrono::milliseconds(0);
+
+	for(const std::string & dependency : dependencies) {
+		std::unordered_map<std::string, size_t>::const_iterator dependencyIndexIterator(m_taskIndices.find(dependency));
+
+		if(dependencyIndexIterator == m_taskIndices.cend()) {
+			spdlog::error("Task '{}' depends on unknown task '{}'.", taskName, dependency);
+			return false;
+		}
+
+		if(std::find(task.dependencyIndices.cbegin(), task.dependencyIndices.cend(), dependencyIndexIterator->second) == task.dependencyIndices.cend()) {
+			task.dependencyIndices.push_back(dependencyIndexIterator->second);
+		}
+	}
+
+	size_t taskIndex = m_tasks.size();
+
+	for(size_t dependencyIndex : task.dependencyIndices) {
+		m_tasks[dependencyIndex].dependentIndices.push_back(taskIndex);
+	}
+
+	m_tasks.push_back(std::move(task));
+	m_taskIndices.emplace(taskName, taskIndex);
+
+	return true;
+}
+
+bool TaskGraph::run() {
+	if(m_tasks.empty()) {
+		return true;
+	}
+
+	std::deque<size_t> readyTaskIndices;
+
+	for(size_t i = 0; i < m_tasks.size(); i++) {
+		m_tasks[i].numberOfRemainingDependencies = m_tasks[i].dependencyIndices.size();
+		m_tasks[i].completed = false;
+		m_tasks[i].duration = std::chrono::milliseconds(0);
+
+		if(m_tasks[i].numberOfRemainingDependencies == 0) {
+			readyTaskIndices.push_back(i);
+		}
+	}
+
+	std::mutex taskMutex;
+	std::condition_variable taskCondition;
+	size_t numberOfCompletedTasks = 0;
+	bool failed = false;
+	std::vector<std::future<void>> workers;
+	size_t numberOfWorkers = std::min(m_numberOfThreads, m_tasks.size());
+
+	for(size_t i = 0; i < numberOfWorkers; i++) {
+		workers.push_back(std::async(std::launch::async, [this, &readyTaskIndices, &taskMutex, &taskCondition, &numberOfCompletedTasks, &failed]() {
+			std::unique_lock<std::mutex> lock(taskMutex);
+
+			while(true) {
+				taskCondition.wait(lock, [this, &readyTaskIndices, &numberOfCompletedTasks, &failed]() {
+					return failed || numberOfCompletedTasks == m_tasks.size() || !readyTaskIndices.empty();
+				});
+
+				// tasks which are already running are allowed to finish, but nothing new is started after a failure
+				if(failed || numberOfCompletedTasks == m_tasks.size()) {
+					break;
+				}
+
+				size_t taskIndex = readyTaskIndices.front();
+				readyTaskIndices.pop_front();
+
+				Task & task = m_tasks[taskIndex];
+
+				lock.unlock();
+
+				std::chrono::time_point<std::chrono::steady_clock> taskStartTimePoint(std::chrono::steady_clock::now());
+				bool taskSucceeded = false;
+
+				// an exception is treated like any other task failure, otherwise the remaining workers would wait forever
+				try {
+					taskSucceeded = task.function();
+				}
+				catch(const std::exception & exception) {
+					spdlog::error("Task '{}' failed: {}", task.name, exception.what());
+				}
+				catch(...) {
+					spdlog::error("Task '{}' failed with an unknown exception.", task.name);
+				}
+
+				std::chrono::milliseconds taskDuration(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - taskStartTimePoint));
+
+				lock.lock();
+
+				task.duration = taskDuration;
+
+				if(taskSucceeded) {
+					task.completed = true;
+					numberOfCompletedTasks++;
+
+					for(size_t dependentIndex : task.dependentIndices) {
+						if(--m_tasks[dependentIndex].numberOfRemainingDependencies == 0) {
+							readyTaskIndices.push_back(dependentIndex);
+						}
+					}
+				}
+				else {
+					failed = true;
+				}
+
+				taskCondition.notify_all();
+			}
+		}));
+	}
+
+	for(std::future<void> & worker : workers) {
+		worker.wait();
+	}
+
+	return !failed;
+}
+
+bool TaskGraph::isTaskCompleted(const std::string & taskName) const {
+	std::unordered_map<std::string, size_t>::const_iterator taskIndexIterator(m_taskIndices.find(taskName));
+
+	if(taskIndexIterator == m_taskIndices.cend()) {
+		return false;
+	}
+
+	return m_tasks[taskIndexIterator->second].completed;
+}
+
+std::optional<std::chrono::milliseconds> TaskGraph::getTaskDuration(const std::string & taskName) const {
+	std::unordered_map<std::string, size_t>::const_iterator taskIndexIterator(m_taskIndices.find(taskName));
+
+	if(taskIndexIterator == m_taskIndices.cend()) {
+		return {};
+	}
+
+	return m_tasks[taskIndexIterator->second].duration;
+}
+
+std::chrono::milliseconds TaskGraph::getTotalTaskDuration() const {
+	std::chrono::milliseconds totalTaskDuration(0);
+
+	for(const Task & task : m_tasks) {
+		totalTaskDuration += task.duration;
+	}
+
+	return totalTaskDuration;
+}
+
+std::chrono::milliseconds TaskGraph::getCriticalPathDuration() const {
+	std::vector<std::chrono::milliseconds> taskFinishDurations(getTaskFinishDurations());
+
+	if(taskFinishDurations.empty()) {
+		return std::chrono::milliseconds(0);
+	}
+
+	return *std::max_element(taskFinishDurations.cbegin(), taskFinishDurations.cend());
+}
+
+std::vector<std::string> TaskGraph::getCriticalPath() const {
+	std::vector<std::chrono::milliseconds> taskFinishDurations(getTaskFinishDurations());
+
+	if(taskFinishDurations.empty()) {
+		return {};
+	}
+
+	std::vector<std::string> criticalPath;
+	size_t taskIndex = std::max_element(taskFinishDurations.cbegin(), taskFinishDurations.cend()) - taskFinishDurations.cbegin();
+
+	while(true) {
+		const Task & task = m_tasks[taskIndex];
+
+		criticalPath.push_back(task.name);
+
+		if(task.dependencyIndices.empty()) {
+			break;
+		}
+
+		taskIndex = *std::max_element(task.dependencyIndices.cbegin(), task.dependencyIndices.cend(), [&taskFinishDurations](size_t a, size_t b) {
+			return taskFinishDurations[a] < taskFinishDurations[b];
+		});
+	}
+
+	std::reverse(criticalPath.begin(), criticalPath.end());
+
+	return criticalPath;
+}
+
+std::string TaskGraph::getCriticalPathAsString() const {
+	std::vector<std::string> criticalPath(getCriticalPath());
+	std::stringstream criticalPathStream;
+
+	for(size_t i = 0; i < criticalPath.size(); i++) {
+		if(i != 0) {
+			criticalPathStream << " -> ";
+		}
+
+		criticalPathStream << criticalPath[i];
+	}
+
+	return criticalPathStream.str();
+}
+
+void TaskGraph::clear() {
+	m_tasks.clear();
+	m_taskIndices.clear();
+}
+
+std::vector<std::chrono::milliseconds> TaskGraph::getTaskFinishDurations() const {
+	// tasks can only depend on previously added tasks, so they are already in topological order
+	std::vector<std::chrono::milliseconds> taskFinishDurations(m_tasks.size(), std::chrono::milliseconds(0));
+
+	for(size_t i = 0; i < m_tasks.size(); i++) {
+		std::chrono::milliseconds dependencyFinishDuration(0);
+
+		for(size_t dependencyIndex : m_tasks[i].dependencyIndices) {
+			dependencyFinishDuration = std::max(dependencyFinishDuration, taskFinishDurations[dependencyIndex]);
+		}
+
+		taskFinishDurations[i] = dependencyFinishDuration + m_tasks[i].duration;
+	}
+
+	return taskFinishDurations;
+}
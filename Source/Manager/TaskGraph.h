@@ -0,0 +1,53 @@
+#ifndef _TASK_GRAPH_H_
+#define _TASK_GRAPH_H_
+
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class TaskGraph final {
+public:
+	TaskGraph(size_t numberOfThreads = 0);
+	~TaskGraph();
+
+	size_t getNumberOfThreads() const;
+	size_t numberOfTasks() const;
+	bool hasTask(const std::string & taskName) const;
+	// dependencies must refer to tasks which were already added, which also keeps the graph free of cycles
+	bool addTask(const std::string & taskName, std::function<bool()> function, const std::vector<std::string> & dependencies = {});
+	bool run();
+	bool isTaskCompleted(const std::string & taskName) const;
+	std::optional<std::chrono::milliseconds> getTaskDuration(const std::string & taskName) const;
+	std::chrono::milliseconds getTotalTaskDuration() const;
+	std::chrono::milliseconds getCriticalPathDuration() const;
+	std::vector<std::string> getCriticalPath() const;
+	std::string getCriticalPathAsString() const;
+	void clear();
+
+private:
+	struct Task {
+		std::string name;
+		std::function<bool()> function;
+		std::vector<size_t> dependencyIndices;
+		std::vector<size_t> dependentIndices;
+		size_t numberOfRemainingDependencies;
+		bool completed;
+		std::chrono::milliseconds duration;
+	};
+
+	std::vector<std::chrono::milliseconds> getTaskFinishDurations() const;
+
+	size_t m_numberOfThreads;
+	std::vector<Task> m_tasks;
+	std::unordered_map<std::string, size_t> m_taskIndices;
+
+	TaskGraph(const TaskGraph &) = delete;
+	TaskGraph(TaskGraph &&) noexcept = delete;
+	const TaskGraph & operator = (const TaskGraph &) = delete;
+	const TaskGraph & operator = (TaskGraph &&) noexcept = delete;
+};
+
+#endif // _TASK_GRAPH_H_
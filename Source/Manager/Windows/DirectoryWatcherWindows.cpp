@@ -0,0 +1,127 @@
+#include "DirectoryWatcherWindows.h"
+
+#include <spdlog/spdlog.h>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+
+static constexpr DWORD DIRECTORY_CHANGE_NOTIFY_FILTER = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE;
+
+struct DirectoryWatcherWindows::DirectoryWatch final {
+	HANDLE directoryHandle = INVALID_HANDLE_VALUE;
+	OVERLAPPED overlapped = { };
+	bool readPending = false;
+	// only the fact that something changed is used, so the notification records themselves are never parsed
+	alignas(DWORD) std::array<uint8_t, 4096> buffer;
+
+	~DirectoryWatch() {
+		if(directoryHandle != INVALID_HANDLE_VALUE) {
+			if(readPending) {
+				CancelIo(directoryHandle);
+
+				// the buffer must stay alive until the cancelled read has completed
+				DWORD numberOfBytesTransferred = 0;
+				GetOverlappedResult(directoryHandle, &overlapped, &numberOfBytesTransferred, TRUE);
+			}
+
+			CloseHandle(directoryHandle);
+		}
+
+		if(overlapped.hEvent != nullptr) {
+			CloseHandle(overlapped.hEvent);
+		}
+	}
+
+	bool readChanges() {
+		readPending = ReadDirectoryChangesW(directoryHandle, buffer.data(), static_cast<DWORD>(buffer.size()), FALSE, DIRECTORY_CHANGE_NOTIFY_FILTER, nullptr, &overlapped, nullptr) != 0;
+
+		return readPending;
+	}
+};
+
+DirectoryWatcherWindows::DirectoryWatcherWindows()
+	: DirectoryWatcher() { }
+
+DirectoryWatcherWindows::~DirectoryWatcherWindows() {
+	unwatchAllDirectories();
+}
+
+bool DirectoryWatcherWindows::addPlatformWatch(const std::string & directoryPath) {
+	std::unique_ptr<DirectoryWatch> directoryWatch(std::make_unique<DirectoryWatch>());
+
+	directoryWatch->directoryHandle = CreateFileA(directoryPath.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+
+	if(directoryWatch->directoryHandle == INVALID_HANDLE_VALUE) {
+		spdlog::error("Failed to open directory '{}' for change notifications with error code: {}.", directoryPath, GetLastError());
+		return false;
+	}
+
+	directoryWatch->overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+
+	if(directoryWatch->overlapped.hEvent == nullptr) {
+		spdlog::error("Failed to create change notification event for directory '{}' with error code: {}.", directoryPath, GetLastError());
+		return false;
+	}
+
+	if(!directoryWatch->readChanges()) {
+		spdlog::error("Failed to request change notifications for directory '{}' with error code: {}.", directoryPath, GetLastError());
+		return false;
+	}
+
+	m_directoryWatches[directoryPath] = std::move(directoryWatch);
+
+	return true;
+}
+
+void DirectoryWatcherWindows::removePlatformWatch(const std::string & directoryPath) {
+	m_directoryWatches.erase(directoryPath);
+}
+
+std::vector<std::string> DirectoryWatcherWindows::waitForPlatformChanges(std::chrono::milliseconds timeout) {
+	std::vector<HANDLE> eventHandles;
+	eventHandles.reserve(std::min(m_directoryWatches.size(), static_cast<size_t>(MAXIMUM_WAIT_OBJECTS)));
+
+	for(std::map<std::string, std::unique_ptr<DirectoryWatch>>::const_iterator i = m_directoryWatches.cbegin(); i != m_directoryWatches.cend() && eventHandles.size() < MAXIMUM_WAIT_OBJECTS; ++i) {
+		if(i->second->readPending) {
+			eventHandles.push_back(i->second->overlapped.hEvent);
+		}
+	}
+
+	if(eventHandles.empty()) {
+		Sleep(static_cast<DWORD>(timeout.count()));
+	}
+	else if(WaitForMultipleObjects(static_cast<DWORD>(eventHandles.size()), eventHandles.data(), FALSE, static_cast<DWORD>(timeout.count())) == WAIT_TIMEOUT &&
+			m_directoryWatches.size() <= MAXIMUM_WAIT_OBJECTS) {
+		return {};
+	}
+
+	// more than one read may have completed, and watches beyond the wait limit are only ever polled here
+	std::vector<std::string> changedDirectoryPaths;
+	DWORD numberOfBytesTransferred = 0;
+
+	for(std::map<std::string, std::unique_ptr<DirectoryWatch>>::iterator i = m_directoryWatches.begin(); i != m_directoryWatches.end(); ++i) {
+		DirectoryWatch & directoryWatch = *i->second;
+
+		if(!directoryWatch.readPending || !HasOverlappedIoCompleted(&directoryWatch.overlapped)) {
+			continue;
+		}
+
+		directoryWatch.readPending = false;
+
+		if(GetOverlappedResult(directoryWatch.directoryHandle, &directoryWatch.overlapped, &numberOfBytesTransferred, FALSE) != 0) {
+			// zero bytes means the notification buffer overflowed, which still indicates a change
+			changedDirectoryPaths.push_back(i->first);
+		}
+		else {
+			spdlog::warn("Failed to read change notifications for directory '{}' with error code: {}.", i->first, GetLastError());
+		}
+
+		if(!directoryWatch.readChanges()) {
+			spdlog::warn("Stopped receiving change notifications for directory '{}', error code: {}.", i->first, GetLastError());
+		}
+	}
+
+	return changedDirectoryPaths;
+}
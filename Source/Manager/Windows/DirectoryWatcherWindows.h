@@ -0,0 +1,34 @@
+#ifndef _DIRECTORY_WATCHER_WINDOWS_H_
+#define _DIRECTORY_WATCHER_WINDOWS_H_
+
+#include "Manager/DirectoryWatcher.h"
+
+#include <map>
+#include <memory>
+
+class ModManager;
+
+class DirectoryWatcherWindows final : public DirectoryWatcher {
+	friend class ModManager;
+
+public:
+	~DirectoryWatcherWindows() override;
+
+protected:
+	// DirectoryWatcher Virtuals
+	bool addPlatformWatch(const std::string & directoryPath) override;
+	void removePlatformWatch(const std::string & directoryPath) override;
+	std::vector<std::string> waitForPlatformChanges(std::chrono::milliseconds timeout) override;
+
+private:
+	struct DirectoryWatch;
+
+	DirectoryWatcherWindows();
+
+	std::map<std::string, std::unique_ptr<DirectoryWatch>> m_directoryWatches;
+
+	DirectoryWatcherWindows(const DirectoryWatcherWindows &) = delete;
+	const DirectoryWatcherWindows & operator = (const DirectoryWatcherWindows &) = delete;
+};
+
+#endif // _DIRECTORY_WATCHER_WINDOWS_H_
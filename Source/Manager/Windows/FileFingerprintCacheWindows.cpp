@@ -0,0 +1,22 @@
+#include "Manager/FileFingerprintCache.h"
+
+#include <windows.h>
+
+std::optional<uint64_t> FileFingerprintCache::getFileIdentifier(const std::string & filePath) {
+	HANDLE fileHandle = CreateFileA(filePath.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if(fileHandle == INVALID_HANDLE_VALUE) {
+		return {};
+	}
+
+	BY_HANDLE_FILE_INFORMATION fileInformation;
+	bool fileInformationObtained = GetFileInformationByHandle(fileHandle, &fileInformation) != 0;
+
+	CloseHandle(fileHandle);
+
+	if(!fileInformationObtained) {
+		return {};
+	}
+
+	return (static_cast<uint64_t>(fileInformation.nFileIndexHigh) << 32) | static_cast<uint64_t>(fileInformation.nFileIndexLow);
+}
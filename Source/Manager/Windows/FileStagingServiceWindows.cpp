@@ -0,0 +1,100 @@
+#include "Manager/FileStagingService.h"
+
+#include <windows.h>
+#include <winioctl.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+
+bool FileStagingService::cloneFile(const std::string & sourceFilePath, const std::string & destinationFilePath, std::error_code & errorCode) {
+	errorCode.clear();
+
+	std::wstring wideSourceFilePath(std::filesystem::path(sourceFilePath).wstring());
+	HANDLE sourceFileHandle = CreateFileW(wideSourceFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if(sourceFileHandle == INVALID_HANDLE_VALUE) {
+		errorCode = std::error_code(GetLastError(), std::system_category());
+		return false;
+	}
+
+	// block cloning is only supported by file systems with reference counted clusters such as ReFS
+	DWORD fileSystemFlags = 0;
+	BY_HANDLE_FILE_INFORMATION sourceFileInformation;
+	wchar_t volumePath[MAX_PATH + 1];
+	DWORD sectorsPerCluster = 0;
+	DWORD bytesPerSector = 0;
+	DWORD numberOfFreeClusters = 0;
+	DWORD totalNumberOfClusters = 0;
+
+	if(!GetVolumeInformationByHandleW(sourceFileHandle, nullptr, 0, nullptr, nullptr, &fileSystemFlags, nullptr, 0) ||
+	   !(fileSystemFlags & FILE_SUPPORTS_BLOCK_REFCOUNTING) ||
+	   !GetFileInformationByHandle(sourceFileHandle, &sourceFileInformation) ||
+	   !GetVolumePathNameW(wideSourceFilePath.c_str(), volumePath, MAX_PATH + 1) ||
+	   !GetDiskFreeSpaceW(volumePath, &sectorsPerCluster, &bytesPerSector, &numberOfFreeClusters, &totalNumberOfClusters)) {
+		CloseHandle(sourceFileHandle);
+		errorCode = std::make_error_code(std::errc::operation_not_supported);
+		return false;
+	}
+
+	HANDLE destinationFileHandle = CreateFileW(std::filesystem::path(destinationFilePath).wstring().c_str(), GENERIC_READ | GENERIC_WRITE | DELETE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if(destinationFileHandle == INVALID_HANDLE_VALUE) {
+		errorCode = std::error_code(GetLastError(), std::system_category());
+		CloseHandle(sourceFileHandle);
+		return false;
+	}
+
+	bool cloned = true;
+	DWORD numberOfBytesReturned = 0;
+
+	// sparse source files can only be cloned into sparse destination files
+	if(sourceFileInformation.dwFileAttributes & FILE_ATTRIBUTE_SPARSE_FILE) {
+		cloned = DeviceIoControl(destinationFileHandle, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &numberOfBytesReturned, nullptr);
+	}
+
+	uint64_t fileSize = (static_cast<uint64_t>(sourceFileInformation.nFileSizeHigh) << 32) | sourceFileInformation.nFileSizeLow;
+	FILE_END_OF_FILE_INFO endOfFileInformation;
+	endOfFileInformation.EndOfFile.QuadPart = static_cast<LONGLONG>(fileSize);
+
+	if(cloned) {
+		cloned = SetFileInformationByHandle(destinationFileHandle, FileEndOfFileInfo, &endOfFileInformation, sizeof(endOfFileInformation));
+	}
+
+	// clone ranges must be cluster aligned and smaller than 4 GB, the final partial cluster is cloned in full and truncated by the end of file
+	uint64_t clusterSize = static_cast<uint64_t>(sectorsPerCluster) * bytesPerSector;
+	uint64_t alignedFileSize = ((fileSize + clusterSize - 1) / clusterSize) * clusterSize;
+	uint64_t maximumByteCount = (0x80000000ULL / clusterSize) * clusterSize;
+
+	for(uint64_t offset = 0; cloned && offset < alignedFileSize; offset += maximumByteCount) {
+		DUPLICATE_EXTENTS_DATA duplicateExtentsData;
+		duplicateExtentsData.FileHandle = sourceFileHandle;
+		duplicateExtentsData.SourceFileOffset.QuadPart = static_cast<LONGLONG>(offset);
+		duplicateExtentsData.TargetFileOffset.QuadPart = static_cast<LONGLONG>(offset);
+		duplicateExtentsData.ByteCount.QuadPart = static_cast<LONGLONG>(std::min(maximumByteCount, alignedFileSize - offset));
+
+		cloned = DeviceIoControl(destinationFileHandle, FSCTL_DUPLICATE_EXTENTS_TO_FILE, &duplicateExtentsData, sizeof(duplicateExtentsData), nullptr, 0, &numberOfBytesReturned, nullptr);
+	}
+
+	if(!cloned) {
+		errorCode = std::error_code(GetLastError(), std::system_category());
+
+		FILE_DISPOSITION_INFO dispositionInformation;
+		dispositionInformation.DeleteFile = TRUE;
+		SetFileInformationByHandle(destinationFileHandle, FileDispositionInfo, &dispositionInformation, sizeof(dispositionInformation));
+	}
+
+	CloseHandle(destinationFileHandle);
+	CloseHandle(sourceFileHandle);
+
+	return cloned;
+}
+
+bool FileStagingService::isUnsupportedMethodError(const std::error_code & errorCode) {
+	if(errorCode == std::errc::operation_not_supported || errorCode == std::errc::cross_device_link) {
+		return true;
+	}
+
+	return errorCode.category() == std::system_category() &&
+		   (errorCode.value() == ERROR_NOT_SAME_DEVICE || errorCode.value() == ERROR_INVALID_FUNCTION || errorCode.value() == ERROR_NOT_SUPPORTED);
+}
@@ -0,0 +1,8 @@
+#include "Manager/LaunchStagingService.h"
+
+#include <windows.h>
+
+void LaunchStagingService::setCurrentThreadBackgroundMode(bool backgroundMode) {
+	// background processing mode also lowers the disk and memory priority of the thread, not just its scheduling priority
+	SetThreadPriority(GetCurrentThread(), backgroundMode ? THREAD_MODE_BACKGROUND_BEGIN : THREAD_MODE_BACKGROUND_END);
+}
@@ -1,6 +1,7 @@
 #include "Manager/ModManager.h"
 
 #include "Game/Windows/GameLocatorWindows.h"
+#include "Manager/Windows/DirectoryWatcherWindows.h"
 
 #include <Factory/FactoryRegistry.h>
 
@@ -10,4 +11,8 @@ void ModManager::assignPlatformFactories() {
 	factoryRegistry.setFactory<GameLocator>([]() {
 		return std::unique_ptr<GameLocator>(new GameLocatorWindows());
 	});
+
+	factoryRegistry.setFactory<DirectoryWatcher>([]() {
+		return std::unique_ptr<DirectoryWatcher>(new DirectoryWatcherWindows());
+	});
 }
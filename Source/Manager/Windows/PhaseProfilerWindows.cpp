@@ -0,0 +1,24 @@
+#include "Manager/PhaseProfiler.h"
+
+#include <windows.h>
+#include <psapi.h>
+
+std::optional<uint64_t> PhaseProfiler::getMemoryUsage() {
+	PROCESS_MEMORY_COUNTERS processMemoryCounters;
+
+	if(!GetProcessMemoryInfo(GetCurrentProcess(), &processMemoryCounters, sizeof(processMemoryCounters))) {
+		return {};
+	}
+
+	return static_cast<uint64_t>(processMemoryCounters.WorkingSetSize);
+}
+
+std::optional<uint64_t> PhaseProfiler::getPeakMemoryUsage() {
+	PROCESS_MEMORY_COUNTERS processMemoryCounters;
+
+	if(!GetProcessMemoryInfo(GetCurrentProcess(), &processMemoryCounters, sizeof(processMemoryCounters))) {
+		return {};
+	}
+
+	return static_cast<uint64_t>(processMemoryCounters.PeakWorkingSetSize);
+}
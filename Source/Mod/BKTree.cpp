@@ -0,0 +1,264 @@
+#include "BKTree.h"
+
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+
+BKTree::BKTree() = default;
+
+BKTree::BKTree(BKTree && t) noexcept
+	: m_nodes(std::move(t.m_nodes)) { }
+
+BKTree::BKTree(const BKTree & t)
+	: m_nodes(t.m_nodes) { }
+
+BKTree & BKTree::operator = (BKTree && t) noexcept {
+	if(this != &t) {
+		m_nodes = std::move(t.m_nodes);
+	}
+
+	return *this;
+}
+
+BKTree & BKTree::operator = (const BKTree & t) {
+	m_nodes = t.m_nodes;
+
+	return *this;
+}
+
+BKTree::~BKTree() = default;
+
+size_t BKTree::numberOfKeys() const {
+	return m_nodes.size();
+}
+
+bool BKTree::isEmpty() const {
+	return m_nodes.empty();
+}
+
+void BKTree::insert(std::string_view key, size_t value) {
+	if(key.empty()) {
+		return;
+	}
+
+	if(m_nodes.empty()) {
+		m_nodes.push_back(Node({ std::string(key), { value }, {} }));
+		return;
+	}
+
+	size_t nodeIndex = 0;
+
+	while(true) {
+		size_t distance = calculateEditDistance(key, m_nodes[nodeIndex].key);
+
+		if(distance == 0) {
+			m_nodes[nodeIndex].values.push_back(value);
+			return;
+		}
+
+		std::vector<std::pair<size_t, size_t>>::const_iterator childIterator(std::find_if(m_nodes[nodeIndex].children.cbegin(), m_nodes[nodeIndex].children.cend(), [distance](const std::pair<size_t, size_t> & child) {
+			return child.first == distance;
+		}));
+
+		if(childIterator == m_nodes[nodeIndex].children.cend()) {
+			m_nodes[nodeIndex].children.emplace_back(distance, m_nodes.size());
+			m_nodes.push_back(Node({ std::string(key), { value }, {} }));
+			return;
+		}
+
+		nodeIndex = childIterator->second;
+	}
+}
+
+std::vector<BKTree::Match> BKTree::search(std::string_view key, size_t maximumDistance, size_t maximumNumberOfMatches) const {
+	std::vector<Match> matches;
+
+	if(m_nodes.empty() || key.empty() || maximumNumberOfMatches == 0) {
+		return matches;
+	}
+
+	std::vector<size_t> nodeIndices({ 0 });
+
+	while(!nodeIndices.empty()) {
+		const Node & node = m_nodes[nodeIndices.back()];
+		nodeIndices.pop_back();
+
+		size_t distance = calculateEditDistance(key, node.key);
+
+		if(distance <= maximumDistance) {
+			for(size_t value : node.values) {
+				matches.push_back(Match({ node.key, value, distance }));
+			}
+		}
+
+		for(const std::pair<size_t, size_t> & child : node.children) {
+			if(child.first + maximumDistance >= distance && child.first <= distance + maximumDistance) {
+				nodeIndices.push_back(child.second);
+			}
+		}
+	}
+
+	std::stable_sort(matches.begin(), matches.end(), [](const Match & matchA, const Match & matchB) {
+		return matchA.distance < matchB.distance;
+	});
+
+	if(matches.size() > maximumNumberOfMatches) {
+		matches.resize(maximumNumberOfMatches);
+	}
+
+	return matches;
+}
+
+void BKTree::insertName(std::string_view formattedName, size_t value) {
+	insert(formattedName, value);
+
+	// individual words are also indexed so that misspelled partial queries can match long names
+	std::vector<std::string_view> nameTokens(getNameTokens(formattedName));
+
+	if(nameTokens.size() == 1 && nameTokens.front().length() == formattedName.length()) {
+		return;
+	}
+
+	for(std::string_view nameToken : nameTokens) {
+		insert(nameToken, value);
+	}
+}
+
+std::vector<BKTree::ValueMatch> BKTree::searchNames(std::string_view formattedQuery, size_t maximumNumberOfMatches) const {
+	std::vector<ValueMatch> valueMatches;
+	size_t maximumEditDistance = getMaximumEditDistanceForLength(formattedQuery.length());
+
+	if(maximumEditDistance == 0 || maximumNumberOfMatches == 0) {
+		return valueMatches;
+	}
+
+	// values mapped to their smallest edit distance
+	std::unordered_map<size_t, size_t> valueDistances;
+
+	for(const Match & match : search(formattedQuery, maximumEditDistance)) {
+		valueDistances.emplace(match.value, match.distance);
+	}
+
+	std::vector<std::string_view> queryTokens(getNameTokens(formattedQuery));
+
+	if(queryTokens.size() > 1) {
+		// every word of a multiple word query must match a word of the name, with the distances of the words adding up
+		std::unordered_map<size_t, size_t> tokenValueDistances;
+		std::unordered_map<size_t, size_t> currentTokenValueDistances;
+
+		for(size_t i = 0; i < queryTokens.size(); i++) {
+			currentTokenValueDistances.clear();
+
+			for(const Match & match : search(queryTokens[i], getMaximumEditDistanceForLength(queryTokens[i].length()))) {
+				if(i != 0 && tokenValueDistances.find(match.value) == tokenValueDistances.cend()) {
+					continue;
+				}
+
+				currentTokenValueDistances.emplace(match.value, match.distance + (i == 0 ? 0 : tokenValueDistances[match.value]));
+			}
+
+			tokenValueDistances.swap(currentTokenValueDistances);
+
+			if(tokenValueDistances.empty()) {
+				break;
+			}
+		}
+
+		for(const std::pair<const size_t, size_t> & tokenValueDistance : tokenValueDistances) {
+			std::unordered_map<size_t, size_t>::iterator valueDistanceIterator(valueDistances.find(tokenValueDistance.first));
+
+			if(valueDistanceIterator == valueDistances.end()) {
+				valueDistances.emplace(tokenValueDistance.first, tokenValueDistance.second);
+			}
+			else {
+				valueDistanceIterator->second = std::min(valueDistanceIterator->second, tokenValueDistance.second);
+			}
+		}
+	}
+
+	valueMatches.reserve(valueDistances.size());
+
+	for(const std::pair<const size_t, size_t> & valueDistance : valueDistances) {
+		valueMatches.push_back(ValueMatch({ valueDistance.first, valueDistance.second }));
+	}
+
+	std::sort(valueMatches.begin(), valueMatches.end(), [](const ValueMatch & valueMatchA, const ValueMatch & valueMatchB) {
+		if(valueMatchA.distance != valueMatchB.distance) {
+			return valueMatchA.distance < valueMatchB.distance;
+		}
+
+		return valueMatchA.value < valueMatchB.value;
+	});
+
+	if(valueMatches.size() > maximumNumberOfMatches) {
+		valueMatches.resize(maximumNumberOfMatches);
+	}
+
+	return valueMatches;
+}
+
+void BKTree::clear() {
+	m_nodes.clear();
+}
+
+size_t BKTree::calculateEditDistance(std::string_view a, std::string_view b) {
+	if(a.length() < b.length()) {
+		std::swap(a, b);
+	}
+
+	std::vector<size_t> previousRow(b.length() + 1);
+	std::vector<size_t> currentRow(b.length() + 1);
+
+	for(size_t i = 0; i <= b.length(); i++) {
+		previousRow[i] = i;
+	}
+
+	for(size_t i = 1; i <= a.length(); i++) {
+		currentRow[0] = i;
+
+		for(size_t j = 1; j <= b.length(); j++) {
+			currentRow[j] = std::min({
+				previousRow[j] + 1,
+				currentRow[j - 1] + 1,
+				previousRow[j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1)
+			});
+		}
+
+		previousRow.swap(currentRow);
+	}
+
+	return previousRow[b.length()];
+}
+
+size_t BKTree::getMaximumEditDistanceForLength(size_t length) {
+	if(length <= 2) {
+		return 0;
+	}
+	else if(length <= 4) {
+		return 1;
+	}
+	else if(length <= 8) {
+		return 2;
+	}
+
+	return 3;
+}
+
+std::vector<std::string_view> BKTree::getNameTokens(std::string_view formattedName) {
+	std::vector<std::string_view> nameTokens;
+	size_t tokenStartIndex = 0;
+
+	for(size_t i = 0; i <= formattedName.length(); i++) {
+		if(i != formattedName.length() && std::isalnum(static_cast<unsigned char>(formattedName[i]))) {
+			continue;
+		}
+
+		if(i - tokenStartIndex >= MINIMUM_NAME_TOKEN_LENGTH) {
+			nameTokens.push_back(formattedName.substr(tokenStartIndex, i - tokenStartIndex));
+		}
+
+		tokenStartIndex = i + 1;
+	}
+
+	return nameTokens;
+}
@@ -0,0 +1,55 @@
+#ifndef _BK_TREE_H_
+#define _BK_TREE_H_
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class BKTree final {
+public:
+	struct Match {
+		std::string_view key;
+		size_t value;
+		size_t distance;
+	};
+
+	struct ValueMatch {
+		size_t value;
+		size_t distance;
+	};
+
+	BKTree();
+	BKTree(BKTree && t) noexcept;
+	BKTree(const BKTree & t);
+	BKTree & operator = (BKTree && t) noexcept;
+	BKTree & operator = (const BKTree & t);
+	~BKTree();
+
+	size_t numberOfKeys() const;
+	bool isEmpty() const;
+	void insert(std::string_view key, size_t value);
+	std::vector<Match> search(std::string_view key, size_t maximumDistance, size_t maximumNumberOfMatches = std::numeric_limits<size_t>::max()) const;
+	void insertName(std::string_view formattedName, size_t value);
+	std::vector<ValueMatch> searchNames(std::string_view formattedQuery, size_t maximumNumberOfMatches = std::numeric_limits<size_t>::max()) const;
+	void clear();
+
+	static size_t calculateEditDistance(std::string_view a, std::string_view b);
+	static size_t getMaximumEditDistanceForLength(size_t length);
+	static std::vector<std::string_view> getNameTokens(std::string_view formattedName);
+
+	static constexpr size_t MINIMUM_NAME_TOKEN_LENGTH = 3;
+
+private:
+	struct Node {
+		std::string key;
+		std::vector<size_t> values;
+		std::vector<std::pair<size_t, size_t>> children;
+	};
+
+	std::vector<Node> m_nodes;
+};
+
+#endif // _BK_TREE_H_
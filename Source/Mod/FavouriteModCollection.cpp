@@ -34,17 +34,21 @@ const uint32_t FavouriteModCollection::FILE_FORMAT_VERSION = 1;
 FavouriteModCollection::FavouriteModCollection() { }
 
 FavouriteModCollection::FavouriteModCollection(FavouriteModCollection && m) noexcept
-	: m_favourites(std::move(m.m_favourites)) { }
+	: m_favourites(std::move(m.m_favourites))
+	, m_favouriteIndicesByKey(std::move(m.m_favouriteIndicesByKey)) { }
 
 FavouriteModCollection::FavouriteModCollection(const FavouriteModCollection & m) {
 	for(std::vector<std::shared_ptr<ModIdentifier>>::const_iterator i = m.m_favourites.begin(); i != m.m_favourites.end(); ++i) {
 		m_favourites.push_back(std::make_shared<ModIdentifier>(**i));
 	}
+
+	rebuildIndices();
 }
 
 FavouriteModCollection & FavouriteModCollection::operator = (FavouriteModCollection && m) noexcept {
 	if(this != &m) {
 		m_favourites = std::move(m.m_favourites);
+		m_favouriteIndicesByKey = std::move(m.m_favouriteIndicesByKey);
 	}
 
 	updated(*this);
@@ -59,6 +63,8 @@ FavouriteModCollection & FavouriteModCollection::operator = (const FavouriteModC
 		m_favourites.push_back(std::make_shared<ModIdentifier>(**i));
 	}
 
+	rebuildIndices();
+
 	updated(*this);
 
 	return *this;
@@ -66,6 +72,36 @@ FavouriteModCollection & FavouriteModCollection::operator = (const FavouriteModC
 
 FavouriteModCollection::~FavouriteModCollection() = default;
 
+std::string FavouriteModCollection::getFavouriteKey(const ModIdentifier & favourite) {
+	// unset and empty versions / version types are distinct, so they are tagged separately
+	std::string key(Utilities::toLowerCase(favourite.getName()));
+
+	key.push_back('\n');
+
+	if(favourite.hasVersion()) {
+		key.push_back('+');
+		key.append(Utilities::toLowerCase(favourite.getVersion().value()));
+	}
+
+	key.push_back('\n');
+
+	if(favourite.hasVersionType()) {
+		key.push_back('+');
+		key.append(Utilities::toLowerCase(favourite.getVersionType().value()));
+	}
+
+	return key;
+}
+
+void FavouriteModCollection::rebuildIndices() {
+	m_favouriteIndicesByKey.clear();
+	m_favouriteIndicesByKey.reserve(m_favourites.size());
+
+	for(size_t i = 0; i < m_favourites.size(); i++) {
+		m_favouriteIndicesByKey.emplace(getFavouriteKey(*m_favourites[i]), i);
+	}
+}
+
 size_t FavouriteModCollection::numberOfFavourites() {
 	return m_favourites.size();
 }
@@ -87,15 +123,13 @@ size_t FavouriteModCollection::indexOfFavourite(const ModIdentifier & favourite)
 		return std::numeric_limits<size_t>::max();
 	}
 
-	std::vector<std::shared_ptr<ModIdentifier>>::const_iterator favouriteModIterator = std::find_if(m_favourites.cbegin(), m_favourites.cend(), [&favourite](const std::shared_ptr<ModIdentifier> & currentFavourite) {
-		return *currentFavourite == favourite;
-	});
+	std::unordered_map<std::string, size_t>::const_iterator favouriteIndexIterator(m_favouriteIndicesByKey.find(getFavouriteKey(favourite)));
 
-	if(favouriteModIterator == m_favourites.cend()) {
+	if(favouriteIndexIterator == m_favouriteIndicesByKey.cend()) {
 		return std::numeric_limits<size_t>::max();
 	}
 
-	return favouriteModIterator - m_favourites.cbegin();
+	return favouriteIndexIterator->second;
 }
 
 size_t FavouriteModCollection::indexOfFavourite(const ModMatch & favourite) const {
@@ -128,6 +162,7 @@ bool FavouriteModCollection::addFavourite(const ModIdentifier & favourite) {
 	}
 
 	m_favourites.push_back(std::make_shared<ModIdentifier>(favourite));
+	m_favouriteIndicesByKey.emplace(getFavouriteKey(*m_favourites.back()), m_favourites.size() - 1);
 
 	updated(*this);
 
@@ -164,6 +199,8 @@ bool FavouriteModCollection::removeFavourite(size_t index) {
 
 	m_favourites.erase(m_favourites.begin() + index);
 
+	rebuildIndices();
+
 	updated(*this);
 
 	if(SettingsManager::getInstance()->segmentAnalyticsEnabled) {
@@ -201,6 +238,7 @@ bool FavouriteModCollection::removeFavourite(const std::string & name, const std
 
 void FavouriteModCollection::clearFavourites() {
 	m_favourites.clear();
+	m_favouriteIndicesByKey.clear();
 
 	updated(*this);
 }
@@ -294,6 +332,8 @@ bool FavouriteModCollection::parseFrom(const rapidjson::Value & favouriteModsCol
 
 	m_favourites = newFavourites;
 
+	rebuildIndices();
+
 	updated(*this);
 
 	return true;
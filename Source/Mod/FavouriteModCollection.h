@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class ModIdentifier;
@@ -60,7 +61,11 @@ public:
 	static const uint32_t FILE_FORMAT_VERSION;
 
 private:
+	void rebuildIndices();
+	static std::string getFavouriteKey(const ModIdentifier & favourite);
+
 	std::vector<std::shared_ptr<ModIdentifier>> m_favourites;
+	std::unordered_map<std::string, size_t> m_favouriteIndicesByKey;
 };
 
 #endif // _FAVOURITE_MOD_COLLECTION_H_
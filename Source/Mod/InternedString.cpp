@@ -0,0 +1,176 @@
+#include "InternedString.h"
+
+#include <Utilities/StringUtilities.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+struct InternedString::Pool {
+	std::unordered_map<std::string_view, std::unique_ptr<Entry>> entries;
+	size_t numberOfInternedBytes = 0;
+	std::atomic<size_t> numberOfRequests = 0;
+	std::atomic<size_t> numberOfRequestedBytes = 0;
+	std::shared_mutex mutex;
+};
+
+InternedString::InternedString()
+	: m_entry(intern(std::string_view())) { }
+
+InternedString::InternedString(std::string_view value)
+	: m_entry(intern(value)) { }
+
+InternedString::InternedString(const std::string & value)
+	: m_entry(intern(value)) { }
+
+InternedString::InternedString(const char * value)
+	: m_entry(intern(value == nullptr ? std::string_view() : std::string_view(value))) { }
+
+InternedString::InternedString(const Entry * entry)
+	: m_entry(entry) { }
+
+InternedString::InternedString(InternedString && s) noexcept
+	: m_entry(s.m_entry) { }
+
+InternedString::InternedString(const InternedString & s)
+	: m_entry(s.m_entry) { }
+
+InternedString & InternedString::operator = (InternedString && s) noexcept {
+	m_entry = s.m_entry;
+
+	return *this;
+}
+
+InternedString & InternedString::operator = (const InternedString & s) {
+	m_entry = s.m_entry;
+
+	return *this;
+}
+
+InternedString::~InternedString() = default;
+
+const std::string & InternedString::get() const {
+	return m_entry->value;
+}
+
+const char * InternedString::c_str() const {
+	return m_entry->value.c_str();
+}
+
+size_t InternedString::length() const {
+	return m_entry->value.length();
+}
+
+bool InternedString::empty() const {
+	return m_entry->value.empty();
+}
+
+void InternedString::clear() {
+	m_entry = intern(std::string_view());
+}
+
+bool InternedString::equalsIgnoreCase(const InternedString & value) const {
+	return m_entry->lowerCaseEntry == value.m_entry->lowerCaseEntry;
+}
+
+bool InternedString::equalsIgnoreCase(std::string_view value) const {
+	return Utilities::areStringsEqualIgnoreCase(m_entry->value, value);
+}
+
+InternedString InternedString::toLowerCase() const {
+	return InternedString(m_entry->lowerCaseEntry);
+}
+
+size_t InternedString::hash() const {
+	return std::hash<const Entry *>()(m_entry);
+}
+
+InternedString::operator const std::string & () const {
+	return m_entry->value;
+}
+
+InternedString::operator std::string_view () const {
+	return m_entry->value;
+}
+
+bool InternedString::operator == (const InternedString & value) const {
+	return m_entry == value.m_entry;
+}
+
+bool InternedString::operator != (const InternedString & value) const {
+	return m_entry != value.m_entry;
+}
+
+InternedString::Statistics InternedString::getStatistics() {
+	Pool & pool = getPool();
+
+	std::shared_lock<std::shared_mutex> lock(pool.mutex);
+
+	return Statistics({
+		pool.entries.size(),
+		pool.numberOfInternedBytes,
+		pool.numberOfRequests.load(),
+		pool.numberOfRequestedBytes.load()
+	});
+}
+
+InternedString::Pool & InternedString::getPool() {
+	// intentionally never destroyed so that interned strings held by static objects remain valid during shutdown
+	static Pool * s_pool = new Pool();
+
+	return *s_pool;
+}
+
+const InternedString::Entry * InternedString::intern(std::string_view value, bool countRequest) {
+	static const Entry s_emptyEntry({ std::string(), &s_emptyEntry });
+
+	if(value.empty()) {
+		return &s_emptyEntry;
+	}
+
+	Pool & pool = getPool();
+
+	if(countRequest) {
+		pool.numberOfRequests++;
+		pool.numberOfRequestedBytes += value.length() + 1;
+	}
+
+	{
+		std::shared_lock<std::shared_mutex> lock(pool.mutex);
+
+		std::unordered_map<std::string_view, std::unique_ptr<Entry>>::const_iterator entryIterator(pool.entries.find(value));
+
+		if(entryIterator != pool.entries.cend()) {
+			return entryIterator->second.get();
+		}
+	}
+
+	std::string lowerCaseValue(Utilities::toLowerCase(value));
+	const Entry * lowerCaseEntry = lowerCaseValue == value ? nullptr : intern(lowerCaseValue, false);
+
+	std::unique_lock<std::shared_mutex> lock(pool.mutex);
+
+	std::unordered_map<std::string_view, std::unique_ptr<Entry>>::const_iterator entryIterator(pool.entries.find(value));
+
+	if(entryIterator != pool.entries.cend()) {
+		return entryIterator->second.get();
+	}
+
+	std::unique_ptr<Entry> entry(std::make_unique<Entry>(Entry({ std::string(value), lowerCaseEntry })));
+
+	if(entry->lowerCaseEntry == nullptr) {
+		entry->lowerCaseEntry = entry.get();
+	}
+
+	const Entry * internedEntry = entry.get();
+	pool.numberOfInternedBytes += internedEntry->value.length() + 1;
+	pool.entries.emplace(internedEntry->value, std::move(entry));
+
+	return internedEntry;
+}
+
+std::ostream & operator << (std::ostream & stream, const InternedString & value) {
+	return stream << value.get();
+}
@@ -0,0 +1,74 @@
+#ifndef _INTERNED_STRING_H_
+#define _INTERNED_STRING_H_
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+class InternedString final {
+public:
+	struct Statistics {
+		size_t numberOfInternedStrings;
+		size_t numberOfInternedBytes;
+		size_t numberOfRequests;
+		size_t numberOfRequestedBytes;
+	};
+
+	InternedString();
+	InternedString(std::string_view value);
+	InternedString(const std::string & value);
+	InternedString(const char * value);
+	InternedString(InternedString && s) noexcept;
+	InternedString(const InternedString & s);
+	InternedString & operator = (InternedString && s) noexcept;
+	InternedString & operator = (const InternedString & s);
+	~InternedString();
+
+	const std::string & get() const;
+	const char * c_str() const;
+	size_t length() const;
+	bool empty() const;
+	void clear();
+	bool equalsIgnoreCase(const InternedString & value) const;
+	bool equalsIgnoreCase(std::string_view value) const;
+	InternedString toLowerCase() const;
+	size_t hash() const;
+
+	operator const std::string & () const;
+	operator std::string_view () const;
+
+	bool operator == (const InternedString & value) const;
+	bool operator != (const InternedString & value) const;
+
+	static Statistics getStatistics();
+
+private:
+	struct Entry {
+		std::string value;
+		const Entry * lowerCaseEntry;
+	};
+
+	struct Pool;
+
+	InternedString(const Entry * entry);
+
+	static Pool & getPool();
+	static const Entry * intern(std::string_view value, bool countRequest = true);
+
+	const Entry * m_entry;
+};
+
+std::ostream & operator << (std::ostream & stream, const InternedString & value);
+
+namespace std {
+	template <>
+	struct hash<InternedString> {
+		size_t operator()(const InternedString & value) const noexcept {
+			return value.hash();
+		}
+	};
+}
+
+#endif // _INTERNED_STRING_H_
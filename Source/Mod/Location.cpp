@@ -347,9 +347,9 @@ bool Location::operator == (const Location & location) const {
 
 	return Utilities::areStringsEqual(m_town, location.m_town) &&
 		   Utilities::areStringsEqual(m_city, location.m_city) &&
-		   Utilities::areStringsEqual(m_province, location.m_province) &&
-		   Utilities::areStringsEqual(m_state, location.m_state) &&
-		   Utilities::areStringsEqual(m_country, location.m_country);
+		   m_province == location.m_province &&
+		   m_state == location.m_state &&
+		   m_country == location.m_country;
 }
 
 bool Location::operator != (const Location & location) const {
@@ -1,6 +1,8 @@
 #ifndef _LOCATION_H_
 #define _LOCATION_H_
 
+#include "InternedString.h"
+
 #include <rapidjson/document.h>
 
 #include <string>
@@ -48,9 +50,9 @@ public:
 private:
 	std::string m_town;
 	std::string m_city;
-	std::string m_province;
-	std::string m_state;
-	std::string m_country;
+	InternedString m_province;
+	InternedString m_state;
+	InternedString m_country;
 };
 
 #endif // _LOCATION_H_
@@ -18,10 +18,14 @@
 
 #include <fmt/core.h>
 #include <spdlog/spdlog.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <tinyxml2.h>
 
 #include <algorithm>
 #include <array>
+#include <functional>
+#include <mutex>
 #include <sstream>
 #include <string_view>
 
@@ -64,6 +68,15 @@ static const std::array<std::string_view, 18> JSON_MOD_PROPERTY_NAMES = {
 	JSON_MOD_SIMILAR_MODS_PROPERTY_NAME
 };
 
+static const std::array<std::string_view, 6> JSON_MOD_DETAIL_PROPERTY_NAMES = {
+	JSON_MOD_SCREENSHOTS_PROPERTY_NAME,
+	JSON_MOD_IMAGES_PROPERTY_NAME,
+	JSON_MOD_VIDEOS_PROPERTY_NAME,
+	JSON_MOD_NOTES_PROPERTY_NAME,
+	JSON_MOD_RELATED_MODS_PROPERTY_NAME,
+	JSON_MOD_SIMILAR_MODS_PROPERTY_NAME
+};
+
 static const std::string XML_MOD_ELEMENT_NAME("mod");
 static const std::string XML_MOD_TEAM_ELEMENT_NAME("team");
 static const std::string XML_VERSIONS_ELEMENT_NAME("versions");
@@ -114,10 +127,153 @@ static const std::string XML_SIMILAR_MOD_ID_ATTRIBUTE_NAME("id");
 
 const std::string Mod::OFFICIAL_EXPANSION_TYPE("Official Expansion");
 
+// hashes mod json values and xml elements directly, without writing them out to an intermediate string first
+class ModContentHasher final : public tinyxml2::XMLVisitor {
+public:
+	ModContentHasher()
+		: m_hash(0) { }
+
+	size_t getHash() const {
+		return m_hash;
+	}
+
+	bool Null() {
+		combine(1);
+
+		return true;
+	}
+
+	bool Bool(bool value) {
+		combine(value ? 2 : 3);
+
+		return true;
+	}
+
+	bool Int(int value) {
+		combine(4);
+		combine(static_cast<size_t>(value));
+
+		return true;
+	}
+
+	bool Uint(unsigned int value) {
+		combine(5);
+		combine(static_cast<size_t>(value));
+
+		return true;
+	}
+
+	bool Int64(int64_t value) {
+		combine(6);
+		combine(std::hash<int64_t>()(value));
+
+		return true;
+	}
+
+	bool Uint64(uint64_t value) {
+		combine(7);
+		combine(std::hash<uint64_t>()(value));
+
+		return true;
+	}
+
+	bool Double(double value) {
+		combine(8);
+		combine(std::hash<double>()(value));
+
+		return true;
+	}
+
+	bool RawNumber(const char * data, rapidjson::SizeType length, bool copy) {
+		combine(9);
+		combine(std::string_view(data, length));
+
+		return true;
+	}
+
+	bool String(const char * data, rapidjson::SizeType length, bool copy) {
+		combine(10);
+		combine(std::string_view(data, length));
+
+		return true;
+	}
+
+	bool StartObject() {
+		combine(11);
+
+		return true;
+	}
+
+	bool Key(const char * data, rapidjson::SizeType length, bool copy) {
+		combine(12);
+		combine(std::string_view(data, length));
+
+		return true;
+	}
+
+	bool EndObject(rapidjson::SizeType memberCount) {
+		combine(13);
+		combine(static_cast<size_t>(memberCount));
+
+		return true;
+	}
+
+	bool StartArray() {
+		combine(14);
+
+		return true;
+	}
+
+	bool EndArray(rapidjson::SizeType elementCount) {
+		combine(15);
+		combine(static_cast<size_t>(elementCount));
+
+		return true;
+	}
+
+	virtual bool VisitEnter(const tinyxml2::XMLElement & element, const tinyxml2::XMLAttribute * firstAttribute) override {
+		combine(16);
+		combine(std::string_view(element.Name()));
+
+		for(const tinyxml2::XMLAttribute * attribute = firstAttribute; attribute != nullptr; attribute = attribute->Next()) {
+			combine(std::string_view(attribute->Name()));
+			combine(std::string_view(attribute->Value()));
+		}
+
+		return true;
+	}
+
+	virtual bool VisitExit(const tinyxml2::XMLElement & element) override {
+		combine(17);
+
+		return true;
+	}
+
+	virtual bool Visit(const tinyxml2::XMLText & text) override {
+		combine(18);
+		combine(std::string_view(text.Value()));
+
+		return true;
+	}
+
+private:
+	void combine(std::string_view data) {
+		combine(std::hash<std::string_view>()(data));
+	}
+
+	void combine(size_t value) {
+		m_hash ^= value + static_cast<size_t>(0x9e3779b9) + (m_hash << 6) + (m_hash >> 2);
+	}
+
+	size_t m_hash;
+};
+
 Mod::Mod(const std::string & id, const std::string & name, const std::string & type)
 	: m_id(Utilities::trimString(id))
 	, m_name(Utilities::trimString(name))
-	, m_type(Utilities::trimString(type)) { }
+	, m_type(Utilities::trimString(type))
+	, m_contentHash(0)
+	, m_detailsLoaded(true) { }
 
 Mod::Mod(Mod && m) noexcept
 	: m_id(std::move(m.m_id))
@@ -137,7 +293,12 @@ Mod::Mod(Mod && m) noexcept
 	, m_videos(std::move(m.m_videos))
 	, m_notes(std::move(m.m_notes))
 	, m_relatedMods(std::move(m.m_relatedMods))
-	, m_similarMods(std::move(m.m_similarMods)) {
+	, m_similarMods(std::move(m.m_similarMods))
+	, m_contentHash(m.m_contentHash)
+	, m_unparsedDetails(std::move(m.m_unparsedDetails))
+	, m_detailsLoaded(m.m_detailsLoaded.load()) {
+	m.m_detailsLoaded = true;
+
 	updateParent();
 }
 
@@ -151,9 +312,8 @@ Mod::Mod(const Mod & m)
 	, m_website(m.m_website)
 	, m_moddbURL(m.m_moddbURL)
 	, m_repositoryURL(m.m_repositoryURL)
-	, m_notes(m.m_notes)
-	, m_relatedMods(m.m_relatedMods)
-	, m_similarMods(m.m_similarMods) {
+	, m_contentHash(m.m_contentHash)
+	, m_detailsLoaded(true) {
 	if(m.m_team != nullptr) {
 		m_team = std::make_shared<ModTeam>(*m.m_team);
 	}
@@ -166,17 +326,7 @@ Mod::Mod(const Mod & m)
 		m_downloads.push_back(std::make_shared<ModDownload>(**i));
 	}
 
-	for(std::vector<std::shared_ptr<ModScreenshot>>::const_iterator i = m.m_screenshots.begin(); i != m.m_screenshots.end(); ++i) {
-		m_screenshots.push_back(std::make_shared<ModScreenshot>(**i));
-	}
-
-	for(std::vector<std::shared_ptr<ModImage>>::const_iterator i = m.m_images.begin(); i != m.m_images.end(); ++i) {
-		m_images.push_back(std::make_shared<ModImage>(**i));
-	}
-
-	for(std::vector<std::shared_ptr<ModVideo>>::const_iterator i = m.m_videos.begin(); i != m.m_videos.end(); ++i) {
-		m_videos.push_back(std::make_shared<ModVideo>(**i));
-	}
+	copyDetailsFrom(m);
 
 	updateParent();
 }
@@ -201,6 +351,10 @@ Mod & Mod::operator = (Mod && m) noexcept {
 		m_notes = std::move(m.m_notes);
 		m_relatedMods = std::move(m.m_relatedMods);
 		m_similarMods = std::move(m.m_similarMods);
+		m_contentHash = m.m_contentHash;
+		m_unparsedDetails = std::move(m.m_unparsedDetails);
+		m_detailsLoaded = m.m_detailsLoaded.load();
+		m.m_detailsLoaded = true;
 
 		updateParent();
 	}
@@ -211,9 +365,6 @@ Mod & Mod::operator = (Mod && m) noexcept {
 Mod & Mod::operator = (const Mod & m) {
 	m_versions.clear();
 	m_downloads.clear();
-	m_screenshots.clear();
-	m_images.clear();
-	m_videos.clear();
 
 	m_id = m.m_id;
 	m_name = m.m_name;
@@ -224,10 +375,8 @@ Mod & Mod::operator = (const Mod & m) {
 	m_website = m.m_website;
 	m_moddbURL = m.m_moddbURL;
 	m_repositoryURL = m.m_repositoryURL;
+	m_contentHash = m.m_contentHash;
 	m_team = m.m_team == nullptr ? nullptr : std::make_shared<ModTeam>(*m.m_team);
-	m_notes = m.m_notes;
-	m_relatedMods = m.m_relatedMods;
-	m_similarMods = m.m_similarMods;
 
 	for(std::vector<std::shared_ptr<ModVersion>>::const_iterator i = m.m_versions.begin(); i != m.m_versions.end(); ++i) {
 		m_versions.push_back(std::make_shared<ModVersion>(**i));
@@ -237,17 +386,7 @@ Mod & Mod::operator = (const Mod & m) {
 		m_downloads.push_back(std::make_shared<ModDownload>(**i));
 	}
 
-	for(std::vector<std::shared_ptr<ModScreenshot>>::const_iterator i = m.m_screenshots.begin(); i != m.m_screenshots.end(); ++i) {
-		m_screenshots.push_back(std::make_shared<ModScreenshot>(**i));
-	}
-
-	for(std::vector<std::shared_ptr<ModImage>>::const_iterator i = m.m_images.begin(); i != m.m_images.end(); ++i) {
-		m_images.push_back(std::make_shared<ModImage>(**i));
-	}
-
-	for(std::vector<std::shared_ptr<ModVideo>>::const_iterator i = m.m_videos.begin(); i != m.m_videos.end(); ++i) {
-		m_videos.push_back(std::make_shared<ModVideo>(**i));
-	}
+	copyDetailsFrom(m);
 
 	updateParent();
 
@@ -487,6 +626,14 @@ bool Mod::copyHiddenPropertiesFrom(const Mod & mod) {
 	return true;
 }
 
+bool Mod::areDetailsLoaded() const {
+	return m_detailsLoaded;
+}
+
+size_t Mod::getContentHash() const {
+	return m_contentHash;
+}
+
 size_t Mod::numberOfVersions() const {
 	return m_versions.size();
 }
@@ -960,10 +1107,14 @@ void Mod::clearDownloads() {
 }
 
 size_t Mod::numberOfScreenshots() const {
+	loadDetails();
+
 	return m_screenshots.size();
 }
 
 bool Mod::hasScreenshot(const ModScreenshot & screenshot) const {
+	loadDetails();
+
 	for(std::vector<std::shared_ptr<ModScreenshot>>::const_iterator i = m_screenshots.begin(); i != m_screenshots.end(); ++i) {
 		if(Utilities::areStringsEqualIgnoreCase((*i)->getFileName(), screenshot.getFileName())) {
 			return true;
@@ -974,6 +1125,8 @@ bool Mod::hasScreenshot(const ModScreenshot & screenshot) const {
 }
 
 bool Mod::hasScreenshot(const std::string & fileName) const {
+	loadDetails();
+
 	if(fileName.empty()) {
 		return false;
 	}
@@ -988,6 +1141,8 @@ bool Mod::hasScreenshot(const std::string & fileName) const {
 }
 
 size_t Mod::indexOfScreenshot(const ModScreenshot & screenshot) const {
+	loadDetails();
+
 	for(size_t i = 0; i < m_screenshots.size(); i++) {
 		if(Utilities::areStringsEqualIgnoreCase(m_screenshots[i]->getFileName(), screenshot.getFileName())) {
 			return i;
@@ -998,6 +1153,8 @@ size_t Mod::indexOfScreenshot(const ModScreenshot & screenshot) const {
 }
 
 size_t Mod::indexOfScreenshot(const std::string & fileName) const {
+	loadDetails();
+
 	if(fileName.empty()) {
 		return std::numeric_limits<size_t>::max();
 	}
@@ -1012,6 +1169,8 @@ size_t Mod::indexOfScreenshot(const std::string & fileName) const {
 }
 
 std::shared_ptr<ModScreenshot> Mod::getScreenshot(size_t index) const {
+	loadDetails();
+
 	if(index >= m_screenshots.size()) {
 		return nullptr;
 	}
@@ -1020,6 +1179,8 @@ std::shared_ptr<ModScreenshot> Mod::getScreenshot(size_t index) const {
 }
 
 std::shared_ptr<ModScreenshot> Mod::getScreenshot(const std::string & fileName) const {
+	loadDetails();
+
 	if(fileName.empty()) {
 		return nullptr;
 	}
@@ -1034,10 +1195,14 @@ std::shared_ptr<ModScreenshot> Mod::getScreenshot(const std::string & fileName)
 }
 
 const std::vector<std::shared_ptr<ModScreenshot>> & Mod::getScreenshots() const {
+	loadDetails();
+
 	return m_screenshots;
 }
 
 bool Mod::addScreenshot(const ModScreenshot & screenshot) {
+	loadDetails();
+
 	if(!screenshot.isValid() || hasScreenshot(screenshot)) {
 		return false;
 	}
@@ -1051,6 +1216,8 @@ bool Mod::addScreenshot(const ModScreenshot & screenshot) {
 }
 
 bool Mod::removeScreenshot(size_t index) {
+	loadDetails();
+
 	if(index >= m_screenshots.size()) {
 		return false;
 	}
@@ -1062,6 +1229,8 @@ bool Mod::removeScreenshot(size_t index) {
 }
 
 bool Mod::removeScreenshot(const ModScreenshot & screenshot) {
+	loadDetails();
+
 	for(std::vector<std::shared_ptr<ModScreenshot>>::const_iterator i = m_screenshots.begin(); i != m_screenshots.end(); ++i) {
 		if(Utilities::areStringsEqualIgnoreCase((*i)->getFileName(), screenshot.getFileName())) {
 			(*i)->setParentMod(nullptr);
@@ -1075,6 +1244,8 @@ bool Mod::removeScreenshot(const ModScreenshot & screenshot) {
 }
 
 bool Mod::removeScreenshot(const std::string & fileName) {
+	loadDetails();
+
 	if(fileName.empty()) {
 		return false;
 	}
@@ -1092,14 +1263,20 @@ bool Mod::removeScreenshot(const std::string & fileName) {
 }
 
 void Mod::clearScreenshots() {
+	loadDetails();
+
 	m_screenshots.clear();
 }
 
 size_t Mod::numberOfImages() const {
+	loadDetails();
+
 	return m_images.size();
 }
 
 bool Mod::hasImage(const ModImage & image) const {
+	loadDetails();
+
 	for(std::vector<std::shared_ptr<ModImage>>::const_iterator i = m_images.begin(); i != m_images.end(); ++i) {
 		if(Utilities::areStringsEqualIgnoreCase((*i)->getFileName(), image.getFileName())) {
 			return true;
@@ -1110,6 +1287,8 @@ bool Mod::hasImage(const ModImage & image) const {
 }
 
 bool Mod::hasImage(const std::string & fileName) const {
+	loadDetails();
+
 	if(fileName.empty()) {
 		return false;
 	}
@@ -1124,6 +1303,8 @@ bool Mod::hasImage(const std::string & fileName) const {
 }
 
 size_t Mod::indexOfImage(const ModImage & image) const {
+	loadDetails();
+
 	for(size_t i = 0; i < m_images.size(); i++) {
 		if(Utilities::areStringsEqualIgnoreCase(m_images[i]->getFileName(), image.getFileName())) {
 			return i;
@@ -1134,6 +1315,8 @@ size_t Mod::indexOfImage(const ModImage & image) const {
 }
 
 size_t Mod::indexOfImage(const std::string & fileName) const {
+	loadDetails();
+
 	if(fileName.empty()) {
 		return std::numeric_limits<size_t>::max();
 	}
@@ -1148,6 +1331,8 @@ size_t Mod::indexOfImage(const std::string & fileName) const {
 }
 
 std::shared_ptr<ModImage> Mod::getImage(size_t index) const {
+	loadDetails();
+
 	if(index >= m_images.size()) {
 		return nullptr;
 	}
@@ -1156,6 +1341,8 @@ std::shared_ptr<ModImage> Mod::getImage(size_t index) const {
 }
 
 std::shared_ptr<ModImage> Mod::getImage(const std::string & fileName) const {
+	loadDetails();
+
 	if(fileName.empty()) {
 		return nullptr;
 	}
@@ -1170,10 +1357,14 @@ std::shared_ptr<ModImage> Mod::getImage(const std::string & fileName) const {
 }
 
 const std::vector<std::shared_ptr<ModImage>> & Mod::getImages() const {
+	loadDetails();
+
 	return m_images;
 }
 
 bool Mod::addImage(const ModImage & image) {
+	loadDetails();
+
 	if(!image.isValid() || hasImage(image)) {
 		return false;
 	}
@@ -1187,6 +1378,8 @@ bool Mod::addImage(const ModImage & image) {
 }
 
 bool Mod::removeImage(size_t index) {
+	loadDetails();
+
 	if(index >= m_images.size()) {
 		return false;
 	}
@@ -1198,6 +1391,8 @@ bool Mod::removeImage(size_t index) {
 }
 
 bool Mod::removeImage(const ModImage & image) {
+	loadDetails();
+
 	for(std::vector<std::shared_ptr<ModImage>>::const_iterator i = m_images.begin(); i != m_images.end(); ++i) {
 		if(Utilities::areStringsEqualIgnoreCase((*i)->getFileName(), image.getFileName())) {
 			(*i)->setParentMod(nullptr);
@@ -1211,6 +1406,8 @@ bool Mod::removeImage(const ModImage & image) {
 }
 
 bool Mod::removeImage(const std::string & fileName) {
+	loadDetails();
+
 	if(fileName.empty()) {
 		return false;
 	}
@@ -1228,14 +1425,20 @@ bool Mod::removeImage(const std::string & fileName) {
 }
 
 void Mod::clearImages() {
+	loadDetails();
+
 	m_images.clear();
 }
 
 size_t Mod::numberOfVideos() const {
+	loadDetails();
+
 	return m_videos.size();
 }
 
 bool Mod::hasVideo(const ModVideo & video) const {
+	loadDetails();
+
 	for(std::vector<std::shared_ptr<ModVideo>>::const_iterator i = m_videos.begin(); i != m_videos.end(); ++i) {
 		if(Utilities::areStringsEqualIgnoreCase((*i)->getURL(), video.getURL())) {
 			return true;
@@ -1246,6 +1449,8 @@ bool Mod::hasVideo(const ModVideo & video) const {
 }
 
 bool Mod::hasVideo(const std::string & url) const {
+	loadDetails();
+
 	if(url.empty()) {
 		return false;
 	}
@@ -1260,6 +1465,8 @@ bool Mod::hasVideo(const std::string & url) const {
 }
 
 size_t Mod::indexOfVideo(const ModVideo & video) const {
+	loadDetails();
+
 	for(size_t i = 0; i < m_videos.size(); i++) {
 		if(Utilities::areStringsEqualIgnoreCase(m_videos[i]->getURL(), video.getURL())) {
 			return i;
@@ -1270,6 +1477,8 @@ size_t Mod::indexOfVideo(const ModVideo & video) const {
 }
 
 size_t Mod::indexOfVideo(const std::string & url) const {
+	loadDetails();
+
 	if(url.empty()) {
 		return std::numeric_limits<size_t>::max();
 	}
@@ -1284,6 +1493,8 @@ size_t Mod::indexOfVideo(const std::string & url) const {
 }
 
 std::shared_ptr<ModVideo> Mod::getVideo(size_t index) const {
+	loadDetails();
+
 	if(index >= m_videos.size()) {
 		return nullptr;
 	}
@@ -1292,6 +1503,8 @@ std::shared_ptr<ModVideo> Mod::getVideo(size_t index) const {
 }
 
 std::shared_ptr<ModVideo> Mod::getVideo(const std::string & url) const {
+	loadDetails();
+
 	if(url.empty()) {
 		return nullptr;
 	}
@@ -1306,10 +1519,14 @@ std::shared_ptr<ModVideo> Mod::getVideo(const std::string & url) const {
 }
 
 const std::vector<std::shared_ptr<ModVideo>> & Mod::getVideos() const {
+	loadDetails();
+
 	return m_videos;
 }
 
 bool Mod::addVideo(const ModVideo & video) {
+	loadDetails();
+
 	if(!video.isValid() || hasVideo(video)) {
 		return false;
 	}
@@ -1323,6 +1540,8 @@ bool Mod::addVideo(const ModVideo & video) {
 }
 
 bool Mod::removeVideo(size_t index) {
+	loadDetails();
+
 	if(index >= m_videos.size()) {
 		return false;
 	}
@@ -1334,6 +1553,8 @@ bool Mod::removeVideo(size_t index) {
 }
 
 bool Mod::removeVideo(const ModVideo & video) {
+	loadDetails();
+
 	for(std::vector<std::shared_ptr<ModVideo>>::const_iterator i = m_videos.begin(); i != m_videos.end(); ++i) {
 		if(Utilities::areStringsEqualIgnoreCase((*i)->getURL(), video.getURL())) {
 			(*i)->setParentMod(nullptr);
@@ -1347,6 +1568,8 @@ bool Mod::removeVideo(const ModVideo & video) {
 }
 
 bool Mod::removeVideo(const std::string & url) {
+	loadDetails();
+
 	if(url.empty()) {
 		return false;
 	}
@@ -1364,14 +1587,20 @@ bool Mod::removeVideo(const std::string & url) {
 }
 
 void Mod::clearVideos() {
+	loadDetails();
+
 	m_videos.clear();
 }
 
 size_t Mod::numberOfNotes() const {
+	loadDetails();
+
 	return m_notes.size();
 }
 
 bool Mod::hasNote(const std::string & note) const {
+	loadDetails();
+
 	for(std::vector<std::string>::const_iterator i = m_notes.begin(); i != m_notes.end(); ++i) {
 		if(*i == note) {
 			return true;
@@ -1382,6 +1611,8 @@ bool Mod::hasNote(const std::string & note) const {
 }
 
 size_t Mod::indexOfNote(const std::string & note) const {
+	loadDetails();
+
 	for(size_t i = 0; i < m_notes.size(); i++) {
 		if(m_notes[i] == note) {
 			return i;
@@ -1392,6 +1623,8 @@ size_t Mod::indexOfNote(const std::string & note) const {
 }
 
 const std::string & Mod::getNote(size_t index) const {
+	loadDetails();
+
 	if(index >= m_notes.size()) {
 		return Utilities::emptyString;
 	}
@@ -1400,10 +1633,14 @@ const std::string & Mod::getNote(size_t index) const {
 }
 
 const std::vector<std::string> & Mod::getNotes() const {
+	loadDetails();
+
 	return m_notes;
 }
 
 bool Mod::addNote(const std::string & note) {
+	loadDetails();
+
 	if(note.empty() || hasNote(note)) {
 		return false;
 	}
@@ -1414,6 +1651,8 @@ bool Mod::addNote(const std::string & note) {
 }
 
 bool Mod::removeNote(size_t index) {
+	loadDetails();
+
 	if(index >= m_notes.size()) {
 		return false;
 	}
@@ -1424,6 +1663,8 @@ bool Mod::removeNote(size_t index) {
 }
 
 bool Mod::removeNote(const std::string & note) {
+	loadDetails();
+
 	for(std::vector<std::string>::const_iterator i = m_notes.begin(); i != m_notes.end(); ++i) {
 		if(*i == note) {
 			return true;
@@ -1434,14 +1675,20 @@ bool Mod::removeNote(const std::string & note) {
 }
 
 void Mod::clearNotes() {
+	loadDetails();
+
 	m_notes.clear();
 }
 
 size_t Mod::numberOfRelatedMods() const {
+	loadDetails();
+
 	return m_relatedMods.size();
 }
 
 bool Mod::hasRelatedMod(const std::string & relatedMod) const {
+	loadDetails();
+
 	for(std::vector<std::string>::const_iterator i = m_relatedMods.begin(); i != m_relatedMods.end(); ++i) {
 		if(*i == relatedMod) {
 			return true;
@@ -1452,6 +1699,8 @@ bool Mod::hasRelatedMod(const std::string & relatedMod) const {
 }
 
 size_t Mod::indexOfRelatedMod(const std::string & relatedMod) const {
+	loadDetails();
+
 	for(size_t i = 0; i < m_relatedMods.size(); i++) {
 		if(m_relatedMods[i] == relatedMod) {
 			return i;
@@ -1462,6 +1711,8 @@ size_t Mod::indexOfRelatedMod(const std::string & relatedMod) const {
 }
 
 const std::string & Mod::getRelatedMod(size_t index) const {
+	loadDetails();
+
 	if(index >= m_relatedMods.size()) {
 		return Utilities::emptyString;
 	}
@@ -1470,10 +1721,14 @@ const std::string & Mod::getRelatedMod(size_t index) const {
 }
 
 const std::vector<std::string> & Mod::getRelatedMods() const {
+	loadDetails();
+
 	return m_relatedMods;
 }
 
 bool Mod::addRelatedMod(const std::string & relatedMod) {
+	loadDetails();
+
 	if(relatedMod.empty() || hasRelatedMod(relatedMod)) {
 		return false;
 	}
@@ -1484,6 +1739,8 @@ bool Mod::addRelatedMod(const std::string & relatedMod) {
 }
 
 bool Mod::removeRelatedMod(size_t index) {
+	loadDetails();
+
 	if(index >= m_relatedMods.size()) {
 		return false;
 	}
@@ -1494,6 +1751,8 @@ bool Mod::removeRelatedMod(size_t index) {
 }
 
 bool Mod::removeRelatedMod(const std::string & relatedMod) {
+	loadDetails();
+
 	for(std::vector<std::string>::const_iterator i = m_relatedMods.begin(); i != m_relatedMods.end(); ++i) {
 		if(*i == relatedMod) {
 			return true;
@@ -1504,14 +1763,20 @@ bool Mod::removeRelatedMod(const std::string & relatedMod) {
 }
 
 void Mod::clearRelatedMods() {
+	loadDetails();
+
 	m_relatedMods.clear();
 }
 
 size_t Mod::numberOfSimilarMods() const {
+	loadDetails();
+
 	return m_similarMods.size();
 }
 
 bool Mod::hasSimilarMod(const std::string & similarMod) const {
+	loadDetails();
+
 	for(std::vector<std::string>::const_iterator i = m_similarMods.begin(); i != m_similarMods.end(); ++i) {
 		if(*i == similarMod) {
 			return true;
@@ -1522,6 +1787,8 @@ bool Mod::hasSimilarMod(const std::string & similarMod) const {
 }
 
 size_t Mod::indexOfSimilarMod(const std::string & similarMod) const {
+	loadDetails();
+
 	for(size_t i = 0; i < m_similarMods.size(); i++) {
 		if(m_similarMods[i] == similarMod) {
 			return i;
@@ -1532,6 +1799,8 @@ size_t Mod::indexOfSimilarMod(const std::string & similarMod) const {
 }
 
 const std::string & Mod::getSimilarMod(size_t index) const {
+	loadDetails();
+
 	if(index >= m_similarMods.size()) {
 		return Utilities::emptyString;
 	}
@@ -1540,10 +1809,14 @@ const std::string & Mod::getSimilarMod(size_t index) const {
 }
 
 const std::vector<std::string> & Mod::getSimilarMods() const {
+	loadDetails();
+
 	return m_similarMods;
 }
 
 bool Mod::addSimilarMod(const std::string & similarMod) {
+	loadDetails();
+
 	if(similarMod.empty() || hasSimilarMod(similarMod)) {
 		return false;
 	}
@@ -1554,6 +1827,8 @@ bool Mod::addSimilarMod(const std::string & similarMod) {
 }
 
 bool Mod::removeSimilarMod(size_t index) {
+	loadDetails();
+
 	if(index >= m_similarMods.size()) {
 		return false;
 	}
@@ -1564,6 +1839,8 @@ bool Mod::removeSimilarMod(size_t index) {
 }
 
 bool Mod::removeSimilarMod(const std::string & similarMod) {
+	loadDetails();
+
 	for(std::vector<std::string>::const_iterator i = m_similarMods.begin(); i != m_similarMods.end(); ++i) {
 		if(*i == similarMod) {
 			return true;
@@ -1574,6 +1851,8 @@ bool Mod::removeSimilarMod(const std::string & similarMod) {
 }
 
 void Mod::clearSimilarMods() {
+	loadDetails();
+
 	m_similarMods.clear();
 }
 
@@ -1642,6 +1921,22 @@ rapidjson::Value Mod::toJSON(rapidjson::MemoryPoolAllocator<rapidjson::CrtAlloca
 
 	modValue.AddMember(rapidjson::StringRef(JSON_MOD_DOWNLOADS_PROPERTY_NAME), downloadsValue, allocator);
 
+	std::shared_ptr<const UnparsedDetails> unparsedDetails(getUnparsedDetails());
+
+	// write details which have not been decoded back out as they are instead of decoding them first
+	if(unparsedDetails != nullptr) {
+		rapidjson::Document detailsDocument;
+		detailsDocument.Parse(unparsedDetails->json.c_str(), unparsedDetails->json.length());
+
+		if(detailsDocument.IsObject()) {
+			for(rapidjson::Value::ConstMemberIterator i = detailsDocument.MemberBegin(); i != detailsDocument.MemberEnd(); ++i) {
+				modValue.AddMember(rapidjson::Value(i->name, allocator), rapidjson::Value(i->value, allocator), allocator);
+			}
+		}
+
+		return modValue;
+	}
+
 	if(!m_screenshots.empty()) {
 		rapidjson::Value screenshotsValue(rapidjson::kArrayType);
 		screenshotsValue.Reserve(m_screenshots.size(), allocator);
@@ -1719,6 +2014,8 @@ tinyxml2::XMLElement * Mod::toXML(tinyxml2::XMLDocument * document) const {
 		return nullptr;
 	}
 
+	loadDetails();
+
 	tinyxml2::XMLElement * modElement = document->NewElement(XML_MOD_ELEMENT_NAME.c_str());
 
 	modElement->SetAttribute(XML_MOD_NAME_ATTRIBUTE_NAME.c_str(), m_name.c_str());
@@ -1929,6 +2226,10 @@ std::unique_ptr<Mod> Mod::parseFrom(const rapidjson::Value & modValue, bool skip
 	// initialize the mod
 	std::unique_ptr<Mod> newMod = std::make_unique<Mod>(modID, modName, modType);
 
+	ModContentHasher modContentHasher;
+	modValue.Accept(modContentHasher);
+	newMod->m_contentHash = modContentHasher.getHash();
+
 	// parse the mod alias property
 	if(modValue.HasMember(JSON_MOD_ALIAS_PROPERTY_NAME)) {
 		const rapidjson::Value & modAliasValue = modValue[JSON_MOD_ALIAS_PROPERTY_NAME];
@@ -2101,217 +2402,78 @@ std::unique_ptr<Mod> Mod::parseFrom(const rapidjson::Value & modValue, bool skip
 		newMod->m_downloads.push_back(newModDownload);
 	}
 
-	// parse the mod screenshots property
-	if(modValue.HasMember(JSON_MOD_SCREENSHOTS_PROPERTY_NAME)) {
-		const rapidjson::Value & modScreenshotsValue = modValue[JSON_MOD_SCREENSHOTS_PROPERTY_NAME];
+	// defer decoding of the mod detail properties until they are first accessed, only keeping a compact copy of them until then
+	rapidjson::StringBuffer detailsStringBuffer;
+	rapidjson::Writer<rapidjson::StringBuffer> detailsWriter(detailsStringBuffer);
+	bool hasDetails = false;
 
-		if(!modScreenshotsValue.IsArray()) {
-			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", modID, JSON_MOD_SCREENSHOTS_PROPERTY_NAME, Utilities::typeToString(modScreenshotsValue.GetType()));
-			return nullptr;
-		}
+	detailsWriter.StartObject();
 
-		std::shared_ptr<ModScreenshot> newModScreenshot;
+	for(const std::string_view detailPropertyName : JSON_MOD_DETAIL_PROPERTY_NAMES) {
+		rapidjson::Value::ConstMemberIterator detailMember = modValue.FindMember(detailPropertyName.data());
 
-		for(rapidjson::Value::ConstValueIterator i = modScreenshotsValue.Begin(); i != modScreenshotsValue.End(); ++i) {
-			newModScreenshot = ModScreenshot::parseFrom(*i, skipFileInfoValidation);
+		if(detailMember == modValue.MemberEnd()) {
+			continue;
+		}
 
-			if(newModScreenshot != nullptr) {
-				newModScreenshot->setParentMod(newMod.get());
-			}
+		if(!detailMember->value.IsArray()) {
+			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", modID, detailPropertyName, Utilities::typeToString(detailMember->value.GetType()));
+			return nullptr;
+		}
 
-			if(!ModScreenshot::isValid(newModScreenshot.get(), skipFileInfoValidation)) {
-				spdlog::error("Failed to parse mod screenshot #{} for mod with ID '{}'.", newMod->m_screenshots.size() + 1, modID);
-				return nullptr;
-			}
+		if(detailMember->value.Empty()) {
+			continue;
+		}
 
-			if(newMod->hasScreenshot(*newModScreenshot)) {
-				spdlog::error("Encountered duplicate mod screenshot #{} for mod with ID '{}'.", newMod->m_screenshots.size() + 1, modID);
-				return nullptr;
-			}
+		detailsWriter.Key(detailPropertyName.data(), static_cast<rapidjson::SizeType>(detailPropertyName.length()));
+		detailMember->value.Accept(detailsWriter);
+		hasDetails = true;
+	}
 
-			newMod->m_screenshots.push_back(newModScreenshot);
-		}
+	detailsWriter.EndObject();
+
+	if(hasDetails) {
+		newMod->m_unparsedDetails = std::make_shared<UnparsedDetails>(UnparsedDetails{ std::string(detailsStringBuffer.GetString(), detailsStringBuffer.GetSize()), skipFileInfoValidation });
+		newMod->m_detailsLoaded = false;
 	}
 
-	// parse the mod images property
-	if(modValue.HasMember(JSON_MOD_IMAGES_PROPERTY_NAME)) {
-		const rapidjson::Value & modImagesValue = modValue[JSON_MOD_IMAGES_PROPERTY_NAME];
+	return newMod;
+}
 
-		if(!modImagesValue.IsArray()) {
-			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", modID, JSON_MOD_IMAGES_PROPERTY_NAME, Utilities::typeToString(modImagesValue.GetType()));
-			return nullptr;
-		}
+std::unique_ptr<Mod> Mod::parseFrom(const tinyxml2::XMLElement * modElement, bool skipFileInfoValidation) {
+	if(modElement == nullptr) {
+		return nullptr;
+	}
 
-		std::shared_ptr<ModImage> newModImage;
+	// verify element name
+	if(modElement->Name() != XML_MOD_ELEMENT_NAME) {
+		spdlog::error("Invalid mod element name: '{}', expected '{}'.", modElement->Name(), XML_MOD_ELEMENT_NAME);
+		return nullptr;
+	}
 
-		for(rapidjson::Value::ConstValueIterator i = modImagesValue.Begin(); i != modImagesValue.End(); ++i) {
-			newModImage = ModImage::parseFrom(*i, skipFileInfoValidation);
+	// check for unhandled mod element attributes
+	bool attributeHandled = false;
+	const tinyxml2::XMLAttribute * modAttribute = modElement->FirstAttribute();
 
-			if(newModImage != nullptr) {
-				newModImage->setParentMod(newMod.get());
-			}
+	while(true) {
+		if(modAttribute == nullptr) {
+			break;
+		}
 
-			if(!ModImage::isValid(newModImage.get(), skipFileInfoValidation)) {
-				spdlog::error("Failed to parse mod image #{} for mod with ID '{}'.", newMod->m_images.size() + 1, modID);
-				return nullptr;
-			}
+		attributeHandled = false;
 
-			if(newMod->hasImage(*newModImage)) {
-				spdlog::error("Encountered duplicate mod image #{} for mod with ID '{}'.", newMod->m_images.size() + 1, modID);
-				return nullptr;
+		for(const std::string_view & attributeName : XML_MOD_ATTRIBUTE_NAMES) {
+			if(modAttribute->Name() == attributeName) {
+				attributeHandled = true;
+				break;
 			}
+		}
 
-			newMod->m_images.push_back(newModImage);
+		if(!attributeHandled) {
+			spdlog::warn("Element '{}' has unexpected attribute '{}'.", XML_MOD_ELEMENT_NAME, modAttribute->Name());
 		}
-	}
-
-	// parse the mod videos property
-	if(modValue.HasMember(JSON_MOD_VIDEOS_PROPERTY_NAME)) {
-		const rapidjson::Value & modVideosValue = modValue[JSON_MOD_VIDEOS_PROPERTY_NAME];
-
-		if(!modVideosValue.IsArray()) {
-			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", modID, JSON_MOD_VIDEOS_PROPERTY_NAME, Utilities::typeToString(modVideosValue.GetType()));
-			return nullptr;
-		}
-
-		std::shared_ptr<ModVideo> newModVideo;
-
-		for(rapidjson::Value::ConstValueIterator i = modVideosValue.Begin(); i != modVideosValue.End(); ++i) {
-			newModVideo = ModVideo::parseFrom(*i);
-
-			if(newModVideo != nullptr) {
-				newModVideo->setParentMod(newMod.get());
-			}
-
-			if(!ModVideo::isValid(newModVideo.get())) {
-				spdlog::error("Failed to parse mod video #{} for mod with ID '{}'.", newMod->m_videos.size() + 1, modID);
-				return nullptr;
-			}
-
-			if(newMod->hasVideo(*newModVideo)) {
-				spdlog::error("Encountered duplicate mod video #{} for mod with ID '{}'.", newMod->m_videos.size() + 1, modID);
-				return nullptr;
-			}
-
-			newMod->m_videos.push_back(newModVideo);
-		}
-	}
-
-	// parse the mod notes property
-	if(modValue.HasMember(JSON_MOD_NOTES_PROPERTY_NAME)) {
-		const rapidjson::Value & modNotesValue = modValue[JSON_MOD_NOTES_PROPERTY_NAME];
-
-		if(!modNotesValue.IsArray()) {
-			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", modID, JSON_MOD_NOTES_PROPERTY_NAME, Utilities::typeToString(modNotesValue.GetType()));
-			return nullptr;
-		}
-
-		for(rapidjson::Value::ConstValueIterator i = modNotesValue.Begin(); i != modNotesValue.End(); ++i) {
-			std::string note(Utilities::trimString((*i).GetString()));
-
-			if(note.empty()) {
-				spdlog::error("Encountered empty note #{} for mod with ID '{}'.", newMod->m_notes.size() + 1, modID);
-				return nullptr;
-			}
-
-			if(newMod->hasNote(note)) {
-				spdlog::error("Encountered duplicate mod note #{} for mod with ID '{}'.", newMod->m_notes.size() + 1, modID);
-				return nullptr;
-			}
-
-			newMod->m_notes.emplace_back(note);
-		}
-	}
-
-	// parse the mod related mods property
-	if(modValue.HasMember(JSON_MOD_RELATED_MODS_PROPERTY_NAME)) {
-		const rapidjson::Value & modRelatedModsValue = modValue[JSON_MOD_RELATED_MODS_PROPERTY_NAME];
-
-		if(!modRelatedModsValue.IsArray()) {
-			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", modID, JSON_MOD_RELATED_MODS_PROPERTY_NAME, Utilities::typeToString(modRelatedModsValue.GetType()));
-			return nullptr;
-		}
-
-		for(rapidjson::Value::ConstValueIterator i = modRelatedModsValue.Begin(); i != modRelatedModsValue.End(); ++i) {
-			std::string relatedMod(Utilities::trimString((*i).GetString()));
-
-			if(relatedMod.empty()) {
-				spdlog::error("Encountered empty related mod #{} for mod with ID '{}'.", newMod->m_relatedMods.size() + 1, modID);
-				return nullptr;
-			}
-
-			if(newMod->hasRelatedMod(relatedMod)) {
-				spdlog::error("Encountered duplicate mod related mod #{} for mod with ID '{}'.", newMod->m_relatedMods.size() + 1, modID);
-				return nullptr;
-			}
-
-			newMod->m_relatedMods.emplace_back(relatedMod);
-		}
-	}
-
-	// parse the mod similar mods property
-	if(modValue.HasMember(JSON_MOD_SIMILAR_MODS_PROPERTY_NAME)) {
-		const rapidjson::Value & modSimilarModsValue = modValue[JSON_MOD_SIMILAR_MODS_PROPERTY_NAME];
-
-		if(!modSimilarModsValue.IsArray()) {
-			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", modID, JSON_MOD_SIMILAR_MODS_PROPERTY_NAME, Utilities::typeToString(modSimilarModsValue.GetType()));
-			return nullptr;
-		}
-
-		for(rapidjson::Value::ConstValueIterator i = modSimilarModsValue.Begin(); i != modSimilarModsValue.End(); ++i) {
-			std::string similarMod(Utilities::trimString((*i).GetString()));
-
-			if(similarMod.empty()) {
-				spdlog::error("Encountered empty similar mod #{} for mod with ID '{}'.", newMod->m_similarMods.size() + 1, modID);
-				return nullptr;
-			}
-
-			if(newMod->hasSimilarMod(similarMod)) {
-				spdlog::error("Encountered duplicate mod similar mod #{} for mod with ID '{}'.", newMod->m_similarMods.size() + 1, modID);
-				return nullptr;
-			}
-
-			newMod->m_similarMods.emplace_back(similarMod);
-		}
-	}
-
-	return newMod;
-}
-
-std::unique_ptr<Mod> Mod::parseFrom(const tinyxml2::XMLElement * modElement, bool skipFileInfoValidation) {
-	if(modElement == nullptr) {
-		return nullptr;
-	}
-
-	// verify element name
-	if(modElement->Name() != XML_MOD_ELEMENT_NAME) {
-		spdlog::error("Invalid mod element name: '{}', expected '{}'.", modElement->Name(), XML_MOD_ELEMENT_NAME);
-		return nullptr;
-	}
-
-	// check for unhandled mod element attributes
-	bool attributeHandled = false;
-	const tinyxml2::XMLAttribute * modAttribute = modElement->FirstAttribute();
-
-	while(true) {
-		if(modAttribute == nullptr) {
-			break;
-		}
-
-		attributeHandled = false;
-
-		for(const std::string_view & attributeName : XML_MOD_ATTRIBUTE_NAMES) {
-			if(modAttribute->Name() == attributeName) {
-				attributeHandled = true;
-				break;
-			}
-		}
-
-		if(!attributeHandled) {
-			spdlog::warn("Element '{}' has unexpected attribute '{}'.", XML_MOD_ELEMENT_NAME, modAttribute->Name());
-		}
-
-		modAttribute = modAttribute->Next();
+
+		modAttribute = modAttribute->Next();
 	}
 
 	// check for unhandled mod element child elements
@@ -2384,6 +2546,10 @@ std::unique_ptr<Mod> Mod::parseFrom(const tinyxml2::XMLElement * modElement, boo
 	// initialize the mod
 	std::unique_ptr<Mod> mod = std::make_unique<Mod>(modID, modName, modType);
 
+	ModContentHasher modContentHasher;
+	modElement->Accept(&modContentHasher);
+	mod->m_contentHash = modContentHasher.getHash();
+
 	if(modAlias != nullptr) {
 		mod->setAlias(modAlias);
 	}
@@ -3113,6 +3279,7 @@ bool Mod::isValid(bool skipFileInfoValidation) const {
 		}
 	}
 
+	// screenshots, images and videos which are not decoded yet were already validated when the mod was parsed
 	for(std::vector<std::shared_ptr<ModScreenshot>>::const_iterator i = m_screenshots.begin(); i != m_screenshots.end(); ++i) {
 		if(!(*i)->isValid()) {
 			return false;
@@ -3207,11 +3374,301 @@ void Mod::updateParent() {
 	}
 }
 
+void Mod::copyDetailsFrom(const Mod & mod) {
+	m_screenshots.clear();
+	m_images.clear();
+	m_videos.clear();
+	m_notes.clear();
+	m_relatedMods.clear();
+	m_similarMods.clear();
+
+	std::lock_guard<std::mutex> detailsLock(mod.m_detailsMutex);
+
+	// details which are not decoded yet share the same compact copy instead of being decoded just to be copied
+	if(mod.m_unparsedDetails != nullptr) {
+		m_unparsedDetails = mod.m_unparsedDetails;
+		m_detailsLoaded = mod.m_detailsLoaded.load();
+
+		return;
+	}
+
+	m_unparsedDetails.reset();
+	m_detailsLoaded = true;
+	m_notes = mod.m_notes;
+	m_relatedMods = mod.m_relatedMods;
+	m_similarMods = mod.m_similarMods;
+
+	for(std::vector<std::shared_ptr<ModScreenshot>>::const_iterator i = mod.m_screenshots.begin(); i != mod.m_screenshots.end(); ++i) {
+		m_screenshots.push_back(std::make_shared<ModScreenshot>(**i));
+	}
+
+	for(std::vector<std::shared_ptr<ModImage>>::const_iterator i = mod.m_images.begin(); i != mod.m_images.end(); ++i) {
+		m_images.push_back(std::make_shared<ModImage>(**i));
+	}
+
+	for(std::vector<std::shared_ptr<ModVideo>>::const_iterator i = mod.m_videos.begin(); i != mod.m_videos.end(); ++i) {
+		m_videos.push_back(std::make_shared<ModVideo>(**i));
+	}
+}
+
+std::shared_ptr<const Mod::UnparsedDetails> Mod::getUnparsedDetails() const {
+	if(m_detailsLoaded && m_unparsedDetails == nullptr) {
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> detailsLock(m_detailsMutex);
+
+	return m_unparsedDetails;
+}
+
+void Mod::loadDetails() const {
+	if(m_detailsLoaded) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> detailsLock(m_detailsMutex);
+
+	if(m_detailsLoaded) {
+		return;
+	}
+
+	Mod details(m_id, m_name, m_type);
+	rapidjson::Document detailsDocument;
+
+	// on failure the compact copy is kept, so that the details are still written back out unchanged
+	if(detailsDocument.Parse(m_unparsedDetails->json.c_str(), m_unparsedDetails->json.length()).HasParseError() || !details.parseDetailsFrom(detailsDocument, m_unparsedDetails->skipFileInfoValidation)) {
+		spdlog::error("Failed to decode details for mod with ID '{}'.", m_id);
+		m_detailsLoaded = true;
+		return;
+	}
+
+	m_screenshots = std::move(details.m_screenshots);
+	m_images = std::move(details.m_images);
+	m_videos = std::move(details.m_videos);
+	m_notes = std::move(details.m_notes);
+	m_relatedMods = std::move(details.m_relatedMods);
+	m_similarMods = std::move(details.m_similarMods);
+
+	for(const std::shared_ptr<ModScreenshot> & screenshot : m_screenshots) {
+		screenshot->setParentMod(this);
+	}
+
+	for(const std::shared_ptr<ModImage> & image : m_images) {
+		image->setParentMod(this);
+	}
+
+	for(const std::shared_ptr<ModVideo> & video : m_videos) {
+		video->setParentMod(this);
+	}
+
+	m_unparsedDetails.reset();
+	m_detailsLoaded = true;
+}
+
+bool Mod::parseDetailsFrom(const rapidjson::Value & modValue, bool skipFileInfoValidation) {
+	if(!parseMediaFrom(modValue, skipFileInfoValidation)) {
+		return false;
+	}
+
+	// parse the mod notes property
+	if(modValue.HasMember(JSON_MOD_NOTES_PROPERTY_NAME)) {
+		const rapidjson::Value & modNotesValue = modValue[JSON_MOD_NOTES_PROPERTY_NAME];
+
+		if(!modNotesValue.IsArray()) {
+			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", m_id, JSON_MOD_NOTES_PROPERTY_NAME, Utilities::typeToString(modNotesValue.GetType()));
+			return false;
+		}
+
+		for(rapidjson::Value::ConstValueIterator i = modNotesValue.Begin(); i != modNotesValue.End(); ++i) {
+			std::string note(Utilities::trimString((*i).GetString()));
+
+			if(note.empty()) {
+				spdlog::error("Encountered empty note #{} for mod with ID '{}'.", m_notes.size() + 1, m_id);
+				return false;
+			}
+
+			if(hasNote(note)) {
+				spdlog::error("Encountered duplicate mod note #{} for mod with ID '{}'.", m_notes.size() + 1, m_id);
+				return false;
+			}
+
+			m_notes.emplace_back(note);
+		}
+	}
+
+	// parse the mod related mods property
+	if(modValue.HasMember(JSON_MOD_RELATED_MODS_PROPERTY_NAME)) {
+		const rapidjson::Value & modRelatedModsValue = modValue[JSON_MOD_RELATED_MODS_PROPERTY_NAME];
+
+		if(!modRelatedModsValue.IsArray()) {
+			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", m_id, JSON_MOD_RELATED_MODS_PROPERTY_NAME, Utilities::typeToString(modRelatedModsValue.GetType()));
+			return false;
+		}
+
+		for(rapidjson::Value::ConstValueIterator i = modRelatedModsValue.Begin(); i != modRelatedModsValue.End(); ++i) {
+			std::string relatedMod(Utilities::trimString((*i).GetString()));
+
+			if(relatedMod.empty()) {
+				spdlog::error("Encountered empty related mod #{} for mod with ID '{}'.", m_relatedMods.size() + 1, m_id);
+				return false;
+			}
+
+			if(Utilities::areStringsEqualIgnoreCase(m_id, relatedMod)) {
+				spdlog::error("Mod with ID '{}' cannot be related to itself.", m_id);
+				return false;
+			}
+
+			if(hasRelatedMod(relatedMod)) {
+				spdlog::error("Encountered duplicate mod related mod #{} for mod with ID '{}'.", m_relatedMods.size() + 1, m_id);
+				return false;
+			}
+
+			m_relatedMods.emplace_back(relatedMod);
+		}
+	}
+
+	// parse the mod similar mods property
+	if(modValue.HasMember(JSON_MOD_SIMILAR_MODS_PROPERTY_NAME)) {
+		const rapidjson::Value & modSimilarModsValue = modValue[JSON_MOD_SIMILAR_MODS_PROPERTY_NAME];
+
+		if(!modSimilarModsValue.IsArray()) {
+			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", m_id, JSON_MOD_SIMILAR_MODS_PROPERTY_NAME, Utilities::typeToString(modSimilarModsValue.GetType()));
+			return false;
+		}
+
+		for(rapidjson::Value::ConstValueIterator i = modSimilarModsValue.Begin(); i != modSimilarModsValue.End(); ++i) {
+			std::string similarMod(Utilities::trimString((*i).GetString()));
+
+			if(similarMod.empty()) {
+				spdlog::error("Encountered empty similar mod #{} for mod with ID '{}'.", m_similarMods.size() + 1, m_id);
+				return false;
+			}
+
+			if(Utilities::areStringsEqualIgnoreCase(m_id, similarMod)) {
+				spdlog::error("Mod with ID '{}' cannot be similar to itself.", m_id);
+				return false;
+			}
+
+			if(hasSimilarMod(similarMod)) {
+				spdlog::error("Encountered duplicate mod similar mod #{} for mod with ID '{}'.", m_similarMods.size() + 1, m_id);
+				return false;
+			}
+
+			m_similarMods.emplace_back(similarMod);
+		}
+	}
+
+	return true;
+}
+
+bool Mod::parseMediaFrom(const rapidjson::Value & modValue, bool skipFileInfoValidation) {
+	// parse the mod screenshots property
+	if(modValue.HasMember(JSON_MOD_SCREENSHOTS_PROPERTY_NAME)) {
+		const rapidjson::Value & modScreenshotsValue = modValue[JSON_MOD_SCREENSHOTS_PROPERTY_NAME];
+
+		if(!modScreenshotsValue.IsArray()) {
+			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", m_id, JSON_MOD_SCREENSHOTS_PROPERTY_NAME, Utilities::typeToString(modScreenshotsValue.GetType()));
+			return false;
+		}
+
+		std::shared_ptr<ModScreenshot> newModScreenshot;
+
+		for(rapidjson::Value::ConstValueIterator i = modScreenshotsValue.Begin(); i != modScreenshotsValue.End(); ++i) {
+			newModScreenshot = ModScreenshot::parseFrom(*i, skipFileInfoValidation);
+
+			if(newModScreenshot != nullptr) {
+				newModScreenshot->setParentMod(this);
+			}
+
+			if(!ModScreenshot::isValid(newModScreenshot.get(), skipFileInfoValidation)) {
+				spdlog::error("Failed to parse mod screenshot #{} for mod with ID '{}'.", m_screenshots.size() + 1, m_id);
+				return false;
+			}
+
+			if(hasScreenshot(*newModScreenshot)) {
+				spdlog::error("Encountered duplicate mod screenshot #{} for mod with ID '{}'.", m_screenshots.size() + 1, m_id);
+				return false;
+			}
+
+			m_screenshots.push_back(newModScreenshot);
+		}
+	}
+
+	// parse the mod images property
+	if(modValue.HasMember(JSON_MOD_IMAGES_PROPERTY_NAME)) {
+		const rapidjson::Value & modImagesValue = modValue[JSON_MOD_IMAGES_PROPERTY_NAME];
+
+		if(!modImagesValue.IsArray()) {
+			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", m_id, JSON_MOD_IMAGES_PROPERTY_NAME, Utilities::typeToString(modImagesValue.GetType()));
+			return false;
+		}
+
+		std::shared_ptr<ModImage> newModImage;
+
+		for(rapidjson::Value::ConstValueIterator i = modImagesValue.Begin(); i != modImagesValue.End(); ++i) {
+			newModImage = ModImage::parseFrom(*i, skipFileInfoValidation);
+
+			if(newModImage != nullptr) {
+				newModImage->setParentMod(this);
+			}
+
+			if(!ModImage::isValid(newModImage.get(), skipFileInfoValidation)) {
+				spdlog::error("Failed to parse mod image #{} for mod with ID '{}'.", m_images.size() + 1, m_id);
+				return false;
+			}
+
+			if(hasImage(*newModImage)) {
+				spdlog::error("Encountered duplicate mod image #{} for mod with ID '{}'.", m_images.size() + 1, m_id);
+				return false;
+			}
+
+			m_images.push_back(newModImage);
+		}
+	}
+
+	// parse the mod videos property
+	if(modValue.HasMember(JSON_MOD_VIDEOS_PROPERTY_NAME)) {
+		const rapidjson::Value & modVideosValue = modValue[JSON_MOD_VIDEOS_PROPERTY_NAME];
+
+		if(!modVideosValue.IsArray()) {
+			spdlog::error("Mod '{}' '{}' property has invalid type: '{}', expected 'array'.", m_id, JSON_MOD_VIDEOS_PROPERTY_NAME, Utilities::typeToString(modVideosValue.GetType()));
+			return false;
+		}
+
+		std::shared_ptr<ModVideo> newModVideo;
+
+		for(rapidjson::Value::ConstValueIterator i = modVideosValue.Begin(); i != modVideosValue.End(); ++i) {
+			newModVideo = ModVideo::parseFrom(*i);
+
+			if(newModVideo != nullptr) {
+				newModVideo->setParentMod(this);
+			}
+
+			if(!ModVideo::isValid(newModVideo.get())) {
+				spdlog::error("Failed to parse mod video #{} for mod with ID '{}'.", m_videos.size() + 1, m_id);
+				return false;
+			}
+
+			if(hasVideo(*newModVideo)) {
+				spdlog::error("Encountered duplicate mod video #{} for mod with ID '{}'.", m_videos.size() + 1, m_id);
+				return false;
+			}
+
+			m_videos.push_back(newModVideo);
+		}
+	}
+
+	return true;
+}
+
 bool Mod::operator == (const Mod & mod) const {
 	if(this == &mod) {
 		return true;
 	}
 
+	loadDetails();
+	mod.loadDetails();
+
 	if(!Utilities::areStringsEqualIgnoreCase(m_id, mod.m_id) ||
 	   !Utilities::areStringsEqualIgnoreCase(m_name, mod.m_name) ||
 	   !Utilities::areStringsEqualIgnoreCase(m_alias, mod.m_alias)||
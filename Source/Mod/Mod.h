@@ -5,8 +5,10 @@
 
 #include <rapidjson/document.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -75,6 +77,8 @@ public:
 	void removeTeam();
 	bool addTeamMember(const ModTeamMember & teamMember);
 	bool copyHiddenPropertiesFrom(const Mod & mod);
+	bool areDetailsLoaded() const;
+	size_t getContentHash() const;
 
 	size_t numberOfVersions() const;
 	bool hasVersion(const ModVersion & version) const;
@@ -226,6 +230,17 @@ public:
 
 private:
 	void updateParent();
+	void copyDetailsFrom(const Mod & mod);
+	void loadDetails() const;
+	bool parseDetailsFrom(const rapidjson::Value & modValue, bool skipFileInfoValidation);
+	bool parseMediaFrom(const rapidjson::Value & modValue, bool skipFileInfoValidation);
+
+	struct UnparsedDetails {
+		std::string json;
+		bool skipFileInfoValidation;
+	};
+
+	std::shared_ptr<const UnparsedDetails> getUnparsedDetails() const;
 
 	std::string m_id;
 	std::string m_name;
@@ -239,12 +254,20 @@ private:
 	std::shared_ptr<ModTeam> m_team;
 	std::vector<std::shared_ptr<ModVersion>> m_versions;
 	std::vector<std::shared_ptr<ModDownload>> m_downloads;
-	std::vector<std::shared_ptr<ModScreenshot>> m_screenshots;
-	std::vector<std::shared_ptr<ModImage>> m_images;
-	std::vector<std::shared_ptr<ModVideo>> m_videos;
-	std::vector<std::string> m_notes;
-	std::vector<std::string> m_relatedMods;
-	std::vector<std::string> m_similarMods;
+	mutable std::vector<std::shared_ptr<ModScreenshot>> m_screenshots;
+	mutable std::vector<std::shared_ptr<ModImage>> m_images;
+	mutable std::vector<std::shared_ptr<ModVideo>> m_videos;
+	mutable std::vector<std::string> m_notes;
+	mutable std::vector<std::string> m_relatedMods;
+	mutable std::vector<std::string> m_similarMods;
+
+	// hash of the source data the mod was parsed from, used to detect changed mods when the mod list is updated
+	size_t m_contentHash;
+
+	// screenshots, images, videos, notes, related and similar mods are only needed once a mod is viewed, so they are kept as compact json until first accessed
+	mutable std::shared_ptr<const UnparsedDetails> m_unparsedDetails;
+	mutable std::mutex m_detailsMutex;
+	mutable std::atomic<bool> m_detailsLoaded;
 };
 
 #endif // _MOD_H_
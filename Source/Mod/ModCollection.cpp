@@ -2,7 +2,10 @@
 
 #include "Game/GameVersion.h"
 #include "Game/GameVersionCollection.h"
+#include "Game/File/JSONFileReader.h"
+#include "Game/File/JSONFileWriter.h"
 #include "Mod.h"
+#include "ModCollectionDelta.h"
 #include "ModDependency.h"
 #include "ModDownload.h"
 #include "ModFile.h"
@@ -28,8 +31,10 @@
 #include <spdlog/spdlog.h>
 #include <tinyxml2.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 
 static const std::string XML_MODS_ELEMENT_NAME("mods");
 
@@ -53,19 +58,34 @@ ModCollection::ModCollection(uint32_t fileRevision)
 
 ModCollection::ModCollection(ModCollection && m) noexcept
 	: m_fileRevision(m.m_fileRevision)
-	, m_mods(std::move(m.m_mods)) { }
+	, m_mods(std::move(m.m_mods))
+	, m_modIndicesByID(std::move(m.m_modIndicesByID))
+	, m_modIndicesByName(std::move(m.m_modIndicesByName))
+	, m_modVersionTypesByKey(std::move(m.m_modVersionTypesByKey))
+	, m_searchIndex(std::move(m.m_searchIndex))
+	, m_dependencyGraph(std::move(m.m_dependencyGraph)) { }
 
 ModCollection::ModCollection(const ModCollection & m)
 	: m_fileRevision(m.m_fileRevision) {
 	for(std::vector<std::shared_ptr<Mod>>::const_iterator i = m.m_mods.begin(); i != m.m_mods.end(); ++i) {
 		m_mods.push_back(std::make_shared<Mod>(**i));
 	}
+
+	rebuildIndices();
+	rebuildSearchIndex();
 }
 
 ModCollection & ModCollection::operator = (ModCollection && m) noexcept {
 	if(this != &m) {
 		m_fileRevision = m.m_fileRevision;
 		m_mods = std::move(m.m_mods);
+		m_modIndicesByID = std::move(m.m_modIndicesByID);
+		m_modIndicesByName = std::move(m.m_modIndicesByName);
+		m_modVersionTypesByKey = std::move(m.m_modVersionTypesByKey);
+		m_searchIndex = std::move(m.m_searchIndex);
+
+		std::lock_guard<std::mutex> lock(m_dependencyGraphMutex);
+		m_dependencyGraph = std::move(m.m_dependencyGraph);
 	}
 
 	updated(*this);
@@ -82,6 +102,10 @@ ModCollection & ModCollection::operator = (const ModCollection & m) {
 		m_mods.push_back(std::make_shared<Mod>(**i));
 	}
 
+	rebuildIndices();
+	rebuildSearchIndex();
+	invalidateDependencyGraph();
+
 	updated(*this);
 
 	return *this;
@@ -89,6 +113,85 @@ ModCollection & ModCollection::operator = (const ModCollection & m) {
 
 ModCollection::~ModCollection() = default;
 
+std::string ModCollection::getModVersionTypeKey(const std::string & modID, const std::string & modVersion, const std::string & modVersionType) {
+	std::string key;
+	key.reserve(modID.length() + modVersion.length() + modVersionType.length() + 2);
+	key.append(Utilities::toLowerCase(modID));
+	key.push_back('\n');
+	key.append(Utilities::toLowerCase(modVersion));
+	key.push_back('\n');
+	key.append(Utilities::toLowerCase(modVersionType));
+
+	return key;
+}
+
+void ModCollection::addModToIndices(const std::shared_ptr<Mod> & mod, size_t index) {
+	// the first mod with a given id or name always takes precedence, matching the behaviour of a linear search
+	m_modIndicesByID.emplace(Utilities::toLowerCase(mod->getID()), index);
+	m_modIndicesByName.emplace(Utilities::toLowerCase(mod->getName()), index);
+
+	for(const std::shared_ptr<ModVersion> & modVersion : mod->getVersions()) {
+		for(const std::shared_ptr<ModVersionType> & modVersionType : modVersion->getTypes()) {
+			m_modVersionTypesByKey.emplace(getModVersionTypeKey(mod->getID(), modVersion->getVersion(), modVersionType->getType()), modVersionType);
+		}
+	}
+}
+
+void ModCollection::removeModFromIndices(const Mod & mod, size_t index) {
+	std::unordered_map<std::string, size_t>::const_iterator modIndexIterator(m_modIndicesByID.find(Utilities::toLowerCase(mod.getID())));
+
+	if(modIndexIterator != m_modIndicesByID.cend() && modIndexIterator->second == index) {
+		m_modIndicesByID.erase(modIndexIterator);
+	}
+
+	modIndexIterator = m_modIndicesByName.find(Utilities::toLowerCase(mod.getName()));
+
+	if(modIndexIterator != m_modIndicesByName.cend() && modIndexIterator->second == index) {
+		m_modIndicesByName.erase(modIndexIterator);
+	}
+
+	for(const std::shared_ptr<ModVersion> & modVersion : mod.getVersions()) {
+		for(const std::shared_ptr<ModVersionType> & modVersionType : modVersion->getTypes()) {
+			std::unordered_map<std::string, std::shared_ptr<ModVersionType>>::const_iterator modVersionTypeIterator(m_modVersionTypesByKey.find(getModVersionTypeKey(mod.getID(), modVersion->getVersion(), modVersionType->getType())));
+
+			if(modVersionTypeIterator != m_modVersionTypesByKey.cend() && modVersionTypeIterator->second == modVersionType) {
+				m_modVersionTypesByKey.erase(modVersionTypeIterator);
+			}
+		}
+	}
+}
+
+void ModCollection::rebuildIndices() {
+	clearIndices();
+
+	m_modIndicesByID.reserve(m_mods.size());
+	m_modIndicesByName.reserve(m_mods.size());
+
+	for(size_t i = 0; i < m_mods.size(); i++) {
+		addModToIndices(m_mods[i], i);
+	}
+}
+
+void ModCollection::clearIndices() {
+	m_modIndicesByID.clear();
+	m_modIndicesByName.clear();
+	m_modVersionTypesByKey.clear();
+}
+
+void ModCollection::rebuildSearchIndex() {
+	m_searchIndex.clear();
+
+	for(const std::shared_ptr<Mod> & mod : m_mods) {
+		m_searchIndex.addMod(*mod);
+	}
+}
+
+void ModCollection::invalidateDependencyGraph() {
+	std::lock_guard<std::mutex> lock(m_dependencyGraphMutex);
+
+	m_dependencyGraph.reset();
+}
+
 uint32_t ModCollection::getFileRevision() const {
 	return m_fileRevision;
 }
@@ -98,13 +201,7 @@ size_t ModCollection::numberOfMods() const {
 }
 
 bool ModCollection::hasMod(const Mod & mod) const {
-	for(std::vector<std::shared_ptr<Mod>>::const_iterator i = m_mods.begin(); i != m_mods.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getID(), mod.getID())) {
-			return true;
-		}
-	}
-
-	return false;
+	return indexOfMod(mod) != std::numeric_limits<size_t>::max();
 }
 
 bool ModCollection::hasModWithID(const std::string & id) const {
@@ -116,13 +213,13 @@ bool ModCollection::hasModWithName(const std::string & name) const {
 }
 
 size_t ModCollection::indexOfMod(const Mod & mod) const {
-	for(size_t i = 0; i < m_mods.size(); i++) {
-		if(Utilities::areStringsEqualIgnoreCase(m_mods[i]->getID(), mod.getID())) {
-			return i;
-		}
+	std::unordered_map<std::string, size_t>::const_iterator modIndexIterator(m_modIndicesByID.find(Utilities::toLowerCase(mod.getID())));
+
+	if(modIndexIterator == m_modIndicesByID.cend()) {
+		return std::numeric_limits<size_t>::max();
 	}
 
-	return std::numeric_limits<size_t>::max();
+	return modIndexIterator->second;
 }
 
 size_t ModCollection::indexOfModWithID(const std::string & id) const {
@@ -130,13 +227,13 @@ size_t ModCollection::indexOfModWithID(const std::string & id) const {
 		return std::numeric_limits<size_t>::max();
 	}
 
-	for(size_t i = 0; i < m_mods.size(); i++) {
-		if(Utilities::areStringsEqualIgnoreCase(m_mods[i]->getID(), id)) {
-			return i;
-		}
+	std::unordered_map<std::string, size_t>::const_iterator modIndexIterator(m_modIndicesByID.find(Utilities::toLowerCase(id)));
+
+	if(modIndexIterator == m_modIndicesByID.cend()) {
+		return std::numeric_limits<size_t>::max();
 	}
 
-	return std::numeric_limits<size_t>::max();
+	return modIndexIterator->second;
 }
 
 size_t ModCollection::indexOfModWithName(const std::string & name) const {
@@ -144,13 +241,13 @@ size_t ModCollection::indexOfModWithName(const std::string & name) const {
 		return std::numeric_limits<size_t>::max();
 	}
 
-	for(size_t i = 0; i < m_mods.size(); i++) {
-		if(Utilities::areStringsEqualIgnoreCase(m_mods[i]->getName(), name)) {
-			return i;
-		}
+	std::unordered_map<std::string, size_t>::const_iterator modIndexIterator(m_modIndicesByName.find(Utilities::toLowerCase(name)));
+
+	if(modIndexIterator == m_modIndicesByName.cend()) {
+		return std::numeric_limits<size_t>::max();
 	}
 
-	return std::numeric_limits<size_t>::max();
+	return modIndexIterator->second;
 }
 
 std::shared_ptr<Mod> ModCollection::getMod(size_t index) const {
@@ -160,17 +257,7 @@ std::shared_ptr<Mod> ModCollection::getMod(size_t index) const {
 }
 
 std::shared_ptr<Mod> ModCollection::getModWithID(const std::string & id) const {
-	if(id.empty()) {
-		return nullptr;
-	}
-
-	for(std::vector<std::shared_ptr<Mod>>::const_iterator i = m_mods.begin(); i != m_mods.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getID(), id)) {
-			return *i;
-		}
-	}
-
-	return nullptr;
+	return getMod(indexOfModWithID(id));
 }
 
 std::shared_ptr<ModVersion> ModCollection::getModVersionWithModID(const std::string & id, const std::string & version) const {
@@ -184,13 +271,17 @@ std::shared_ptr<ModVersion> ModCollection::getModVersionWithModID(const std::str
 }
 
 std::shared_ptr<ModVersionType> ModCollection::getModVersionTypeWithModID(const std::string & id, const std::string & version, const std::string & versionType) const {
-	std::shared_ptr<ModVersion> modVersion(getModVersionWithModID(id, version));
+	if(id.empty()) {
+		return nullptr;
+	}
 
-	if(modVersion == nullptr) {
+	std::unordered_map<std::string, std::shared_ptr<ModVersionType>>::const_iterator modVersionTypeIterator(m_modVersionTypesByKey.find(getModVersionTypeKey(id, version, versionType)));
+
+	if(modVersionTypeIterator == m_modVersionTypesByKey.cend()) {
 		return nullptr;
 	}
 
-	return modVersion->getType(versionType);
+	return modVersionTypeIterator->second;
 }
 
 std::shared_ptr<ModGameVersion> ModCollection::getModGameVersionByIDWithModID(const std::string & id, const std::string & version, const std::string & versionType, const std::string & gameVersionID) const {
@@ -204,17 +295,7 @@ std::shared_ptr<ModGameVersion> ModCollection::getModGameVersionByIDWithModID(co
 }
 
 std::shared_ptr<Mod> ModCollection::getModWithName(const std::string & name) const {
-	if(name.empty()) {
-		return nullptr;
-	}
-
-	for(std::vector<std::shared_ptr<Mod>>::const_iterator i = m_mods.begin(); i != m_mods.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			return *i;
-		}
-	}
-
-	return nullptr;
+	return getMod(indexOfModWithName(name));
 }
 
 std::shared_ptr<ModVersionType> ModCollection::getModVersionTypeFromDependency(const ModDependency & modDependency) const {
@@ -230,19 +311,35 @@ std::shared_ptr<ModVersion> ModCollection::getStandAloneModVersion(const StandAl
 		return nullptr;
 	}
 
-	for(const std::shared_ptr<Mod> & mod : m_mods) {
-		if(Utilities::areStringsEqualIgnoreCase(mod->getID(), standAloneMod.getID())) {
-			return mod->getVersion(standAloneMod.getVersion());
-		}
+	std::shared_ptr<Mod> mod(getModWithID(standAloneMod.getID()));
+
+	if(mod == nullptr) {
+		return nullptr;
 	}
 
-	return nullptr;
+	return mod->getVersion(standAloneMod.getVersion());
 }
 
 const std::vector<std::shared_ptr<Mod>> & ModCollection::getMods() const {
 	return m_mods;
 }
 
+const ModSearchIndex & ModCollection::getSearchIndex() const {
+	return m_searchIndex;
+}
+
+std::shared_ptr<const ModDependencyGraph> ModCollection::getDependencyGraph() const {
+	std::lock_guard<std::mutex> lock(m_dependencyGraphMutex);
+
+	if(m_dependencyGraph == nullptr) {
+		std::shared_ptr<ModDependencyGraph> dependencyGraph(std::make_shared<ModDependencyGraph>());
+		dependencyGraph->build(*this);
+		m_dependencyGraph = dependencyGraph;
+	}
+
+	return m_dependencyGraph;
+}
+
 bool ModCollection::addMod(const Mod & mod) {
 	if(!mod.isValid() || hasMod(mod)) {
 		return false;
@@ -250,6 +347,10 @@ bool ModCollection::addMod(const Mod & mod) {
 
 	m_mods.push_back(std::make_shared<Mod>(mod));
 
+	addModToIndices(m_mods.back(), m_mods.size() - 1);
+	m_searchIndex.addMod(*m_mods.back());
+	invalidateDependencyGraph();
+
 	updated(*this);
 
 	return true;
@@ -260,67 +361,121 @@ bool ModCollection::removeMod(size_t index) {
 		return false;
 	}
 
+	m_searchIndex.removeMod(*m_mods[index]);
 	m_mods.erase(m_mods.begin() + index);
 
+	rebuildIndices();
+	invalidateDependencyGraph();
+
 	updated(*this);
 
 	return true;
 }
 
 bool ModCollection::removeMod(const Mod & mod) {
-	for(std::vector<std::shared_ptr<Mod>>::const_iterator i = m_mods.begin(); i != m_mods.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getID(), mod.getID())) {
-			m_mods.erase(i);
+	return removeMod(indexOfMod(mod));
+}
+
+bool ModCollection::removeModWithID(const std::string & id) {
+	return removeMod(indexOfModWithID(id));
+}
 
-			updated(*this);
+bool ModCollection::removeModWithName(const std::string & name) {
+	return removeMod(indexOfModWithName(name));
+}
 
-			return true;
+void ModCollection::clearMods() {
+	m_mods.clear();
+
+	clearIndices();
+	m_searchIndex.clear();
+	invalidateDependencyGraph();
+
+	updated(*this);
+}
+
+bool ModCollection::applyDelta(const ModCollectionDelta & delta) {
+	for(const std::shared_ptr<Mod> & addedMod : delta.getAddedMods()) {
+		if(!addedMod->isValid()) {
+			spdlog::error("Failed to apply mod collection delta, added mod with ID '{}' is invalid.", addedMod->getID());
+			return false;
 		}
 	}
 
-	return false;
-}
+	for(const std::shared_ptr<Mod> & changedMod : delta.getChangedMods()) {
+		if(!changedMod->isValid() || !hasModWithID(changedMod->getID())) {
+			spdlog::error("Failed to apply mod collection delta, changed mod with ID '{}' is invalid or missing.", changedMod->getID());
+			return false;
+		}
+	}
 
-bool ModCollection::removeModWithID(const std::string & id) {
-	if(id.empty()) {
-		return false;
+	for(const std::shared_ptr<Mod> & changedMod : delta.getChangedMods()) {
+		size_t modIndex = indexOfModWithID(changedMod->getID());
+		std::shared_ptr<Mod> mod(m_mods[modIndex]);
+
+		m_searchIndex.removeMod(*mod);
+		removeModFromIndices(*mod, modIndex);
+
+		// changed mods are swapped in rather than assigned over, so that references held to the previous mod and its versions stay intact
+		m_mods[modIndex] = changedMod;
+
+		addModToIndices(changedMod, modIndex);
+		m_searchIndex.addMod(*changedMod);
 	}
 
-	for(std::vector<std::shared_ptr<Mod>>::const_iterator i = m_mods.begin(); i != m_mods.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getID(), id)) {
-			m_mods.erase(i);
+	if(delta.hasStructuralChanges()) {
+		std::vector<size_t> removedModIndices;
+		removedModIndices.reserve(delta.numberOfRemovedMods());
 
-			updated(*this);
+		for(const std::string & removedModID : delta.getRemovedModIDs()) {
+			size_t modIndex = indexOfModWithID(removedModID);
 
-			return true;
+			if(modIndex != std::numeric_limits<size_t>::max()) {
+				removedModIndices.push_back(modIndex);
+			}
 		}
-	}
 
-	return false;
-}
+		std::vector<std::shared_ptr<Mod>> addedMods;
+		addedMods.reserve(delta.numberOfAddedMods());
 
-bool ModCollection::removeModWithName(const std::string & name) {
-	if(name.empty()) {
-		return false;
-	}
+		for(const std::shared_ptr<Mod> & addedMod : delta.getAddedMods()) {
+			if(!hasModWithID(addedMod->getID())) {
+				addedMods.push_back(addedMod);
+			}
+		}
 
-	for(std::vector<std::shared_ptr<Mod>>::const_iterator i = m_mods.begin(); i != m_mods.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			m_mods.erase(i);
+		std::sort(removedModIndices.begin(), removedModIndices.end(), std::greater<size_t>());
 
-			updated(*this);
+		for(size_t modIndex : removedModIndices) {
+			m_searchIndex.removeMod(*m_mods[modIndex]);
+			m_mods.erase(m_mods.begin() + modIndex);
+		}
 
-			return true;
+		for(const std::shared_ptr<Mod> & addedMod : addedMods) {
+			m_mods.push_back(addedMod);
+			m_searchIndex.addMod(*addedMod);
 		}
+
+		rebuildIndices();
 	}
 
-	return false;
-}
+	m_fileRevision = delta.getFileRevision();
 
-void ModCollection::clearMods() {
-	m_mods.clear();
+	if(delta.hasStructuralChanges() || delta.numberOfChangedMods() != 0) {
+		invalidateDependencyGraph();
+	}
 
-	updated(*this);
+	if(delta.hasStructuralChanges()) {
+		updated(*this);
+	}
+	else {
+		// changed mods are new instances, listeners look them up by index to swap out the previous mods
+		for(const std::shared_ptr<Mod> & changedMod : delta.getChangedMods()) {
+			modModified(*this, *changedMod);
+		}
+	}
+
+	return true;
 }
 
 bool ModCollection::copyHiddenPropertiesFrom(const ModCollection & modCollection) {
@@ -342,25 +497,7 @@ std::shared_ptr<ModVersionType> ModCollection::getModDependencyVersionType(const
 		return nullptr;
 	}
 
-	std::shared_ptr<Mod> mod(getModWithID(modDependency.getID()));
-
-	if(mod == nullptr) {
-		return nullptr;
-	}
-
-	std::shared_ptr<ModVersion> modVersion(mod->getVersion(modDependency.getVersion()));
-
-	if(modVersion == nullptr) {
-		return nullptr;
-	}
-
-	std::shared_ptr<ModVersionType> modVersionType(modVersion->getType(modDependency.getVersionType()));
-
-	if(modVersionType == nullptr) {
-		return nullptr;
-	}
-
-	return modVersionType;
+	return getModVersionTypeWithModID(modDependency.getID(), modDependency.getVersion(), modDependency.getVersionType());
 }
 
 std::vector<std::shared_ptr<ModVersionType>> ModCollection::getModDependencyVersionTypes(const std::vector<std::shared_ptr<ModDependency>> & modDependencies) const {
@@ -435,7 +572,7 @@ std::shared_ptr<ModGameVersion> ModCollection::getModDependencyGameVersion(const
 	std::shared_ptr<ModGameVersion> compatibleModGameVersion;
 
 	for(std::vector<std::shared_ptr<GameVersion>>::const_reverse_iterator i = compatibleGameVersions.crbegin(); i != compatibleGameVersions.crend(); ++i) {
-		compatibleModGameVersion = modVersionType->getGameVersionWithID((*i)->getID());
+		compatibleModGameVersion = modVersionType->getGameVersionWithID((*i)->getInternedID());
 
 		if(compatibleModGameVersion == nullptr) {
 			continue;
@@ -614,6 +751,11 @@ std::vector<std::shared_ptr<ModFile>> ModCollection::getModDependencyGroupFiles(
 		return {};
 	}
 
+	if(recursive && getDependencyGraph()->hasCircularDependency(*modGameVersion.getParentModVersionType())) {
+		spdlog::error("Cannot resolve dependency group files for '{}' mod game version with circular dependencies.", modGameVersion.getFullName(false));
+		return {};
+	}
+
 	return getModDependencyGroupFiles(modGameVersion.getParentModVersionType()->getDependencies(), gameVersion, gameVersions, allowCompatibleGameVersions, recursive);
 }
 
@@ -643,6 +785,30 @@ rapidjson::Document ModCollection::toJSON() const {
 	return modsDocument;
 }
 
+bool ModCollection::writeJSON(JSONFileWriter & writer) const {
+	if(!writer.startObject() ||
+	   !writer.writeKey(JSON_GAME_ID_PROPERTY_NAME) ||
+	   !writer.writeString(GAME_ID) ||
+	   !writer.writeKey(JSON_FILE_TYPE_PROPERTY_NAME) ||
+	   !writer.writeString(FILE_TYPE) ||
+	   !writer.writeKey(JSON_FILE_FORMAT_VERSION_PROPERTY_NAME) ||
+	   !writer.writeValue(rapidjson::Value(FILE_FORMAT_VERSION)) ||
+	   !writer.writeKey(JSON_FILE_REVISION_PROPERTY_NAME) ||
+	   !writer.writeValue(rapidjson::Value(m_fileRevision)) ||
+	   !writer.writeKey(JSON_MODS_PROPERTY_NAME) ||
+	   !writer.startArray()) {
+		return false;
+	}
+
+	for(const std::shared_ptr<Mod> & mod : m_mods) {
+		if(!writer.writeJSONOf(*mod)) {
+			return false;
+		}
+	}
+
+	return writer.endArray() && writer.endObject();
+}
+
 tinyxml2::XMLElement * ModCollection::toXML(tinyxml2::XMLDocument * document) const {
 	if(document == nullptr) {
 		return nullptr;
@@ -776,6 +942,8 @@ std::unique_ptr<ModCollection> ModCollection::parseFrom(const rapidjson::Value &
 		}
 
 		newModCollection->m_mods.emplace_back(std::move(newMod));
+		newModCollection->addModToIndices(newModCollection->m_mods.back(), newModCollection->m_mods.size() - 1);
+		newModCollection->m_searchIndex.addMod(*newModCollection->m_mods.back());
 	}
 
 	return newModCollection;
@@ -882,6 +1050,8 @@ std::unique_ptr<ModCollection> ModCollection::parseFrom(const tinyxml2::XMLEleme
 		}
 
 		modCollection->m_mods.emplace_back(std::move(newMod));
+		modCollection->addModToIndices(modCollection->m_mods.back(), modCollection->m_mods.size() - 1);
+		modCollection->m_searchIndex.addMod(*modCollection->m_mods.back());
 
 		modElement = modElement->NextSiblingElement();
 	}
@@ -923,6 +1093,8 @@ bool ModCollection::loadFromXML(const std::string & filePath, const GameVersionC
 	}
 
 	m_mods.clear();
+	clearIndices();
+	m_searchIndex.clear();
 
 	std::unique_ptr<ModCollection> modCollection(parseFrom(modCollectionDocument.RootElement(), skipFileInfoValidation));
 
@@ -932,6 +1104,11 @@ bool ModCollection::loadFromXML(const std::string & filePath, const GameVersionC
 	}
 
 	m_mods = std::move(modCollection->m_mods);
+	m_modIndicesByID = std::move(modCollection->m_modIndicesByID);
+	m_modIndicesByName = std::move(modCollection->m_modIndicesByName);
+	m_modVersionTypesByKey = std::move(modCollection->m_modVersionTypesByKey);
+	m_searchIndex = std::move(modCollection->m_searchIndex);
+	invalidateDependencyGraph();
 
 	updated(*this);
 
@@ -943,21 +1120,14 @@ bool ModCollection::loadFromJSON(const std::string & filePath, const GameVersion
 		return false;
 	}
 
-	std::ifstream fileStream(filePath);
+	JSONFileReader fileReader;
 
-	if(!fileStream.is_open()) {
+	if(!fileReader.load(filePath)) {
+		spdlog::error("Failed to parse mod collection JSON file '{}': {}", filePath, fileReader.getParseErrorMessage());
 		return false;
 	}
 
-	rapidjson::Document modsValue;
-	rapidjson::IStreamWrapper fileStreamWrapper(fileStream);
-	if(modsValue.ParseStream(fileStreamWrapper).HasParseError()) {
-		return false;
-	}
-
-	fileStream.close();
-
-	std::unique_ptr<ModCollection> modCollection(parseFrom(modsValue, skipFileInfoValidation));
+	std::unique_ptr<ModCollection> modCollection(parseFrom(fileReader.getDocument(), skipFileInfoValidation));
 
 	if(!ModCollection::isValid(modCollection.get(), gameVersions, skipFileInfoValidation)) {
 		spdlog::error("Failed to parse mod collection from JSON file '{}'.", filePath);
@@ -965,6 +1135,11 @@ bool ModCollection::loadFromJSON(const std::string & filePath, const GameVersion
 	}
 
 	m_mods = std::move(modCollection->m_mods);
+	m_modIndicesByID = std::move(modCollection->m_modIndicesByID);
+	m_modIndicesByName = std::move(modCollection->m_modIndicesByName);
+	m_modVersionTypesByKey = std::move(modCollection->m_modVersionTypesByKey);
+	m_searchIndex = std::move(modCollection->m_searchIndex);
+	invalidateDependencyGraph();
 
 	updated(*this);
 
@@ -1017,21 +1192,20 @@ bool ModCollection::saveToJSON(const std::string & filePath, bool overwrite) con
 		return false;
 	}
 
-	std::ofstream fileStream(filePath);
+	JSONFileWriter fileWriter;
 
-	if(!fileStream.is_open()) {
+	if(!fileWriter.open(filePath, overwrite)) {
 		return false;
 	}
 
-	rapidjson::Document mods(toJSON());
+	if(!writeJSON(fileWriter)) {
+		fileWriter.close();
 
-	rapidjson::OStreamWrapper fileStreamWrapper(fileStream);
-	rapidjson::PrettyWriter<rapidjson::OStreamWrapper> fileStreamWriter(fileStreamWrapper);
-	fileStreamWriter.SetIndent('\t', 1);
-	mods.Accept(fileStreamWriter);
-	fileStream.close();
+		spdlog::error("Failed to save mod collection to JSON file '{}'.", filePath);
+		return false;
+	}
 
-	return true;
+	return fileWriter.close();
 }
 
 bool ModCollection::checkGameVersions(const GameVersionCollection & gameVersions, bool verbose) const {
@@ -1,17 +1,24 @@
 #ifndef _MOD_COLLECTION_H_
 #define _MOD_COLLECTION_H_
 
+#include "ModDependencyGraph.h"
+#include "ModSearchIndex.h"
+
 #include <boost/signals2.hpp>
 #include <rapidjson/document.h>
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class GameVersion;
 class GameVersionCollection;
+class JSONFileWriter;
 class Mod;
+class ModCollectionDelta;
 class ModDependency;
 class ModDownload;
 class ModFile;
@@ -52,12 +59,15 @@ public:
 	std::shared_ptr<ModVersionType> getModVersionTypeFromDependency(const ModDependency & modDependency) const;
 	std::shared_ptr<ModVersion> getStandAloneModVersion(const StandAloneMod & standAloneMod) const;
 	const std::vector<std::shared_ptr<Mod>> & getMods() const;
+	const ModSearchIndex & getSearchIndex() const;
+	std::shared_ptr<const ModDependencyGraph> getDependencyGraph() const;
 	bool addMod(const Mod & mod);
 	bool removeMod(size_t index);
 	bool removeMod(const Mod & mod);
 	bool removeModWithID(const std::string & id);
 	bool removeModWithName(const std::string & name);
 	void clearMods();
+	bool applyDelta(const ModCollectionDelta & delta);
 	bool copyHiddenPropertiesFrom(const ModCollection & modCollection);
 
 	std::shared_ptr<ModVersionType> getModDependencyVersionType(const ModDependency & modDependency) const;
@@ -75,6 +85,7 @@ public:
 	std::vector<std::shared_ptr<ModFile>> getModDependencyGroupFiles(const ModGameVersion & modGameVersion, const GameVersion & gameVersion, const GameVersionCollection * gameVersions = nullptr, bool allowCompatibleGameVersions = true, bool recursive = true) const;
 
 	rapidjson::Document toJSON() const;
+	bool writeJSON(JSONFileWriter & writer) const;
 	tinyxml2::XMLElement * toXML(tinyxml2::XMLDocument* document) const;
 	static std::unique_ptr<ModCollection> parseFrom(const rapidjson::Value & modCollectionValue, bool skipFileInfoValidation = false);
 	static std::unique_ptr<ModCollection> parseFrom(const tinyxml2::XMLElement * modsElement, bool skipFileInfoValidation = false);
@@ -95,14 +106,29 @@ public:
 	bool operator != (const ModCollection & m) const;
 
 	boost::signals2::signal<void (ModCollection & /* mods */)> updated;
+	boost::signals2::signal<void (ModCollection & /* mods */, Mod & /* mod */)> modModified;
 
 	static const std::string GAME_ID;
 	static const std::string FILE_TYPE;
 	static const uint32_t FILE_FORMAT_VERSION;
 
 private:
+	void addModToIndices(const std::shared_ptr<Mod> & mod, size_t index);
+	void removeModFromIndices(const Mod & mod, size_t index);
+	void rebuildIndices();
+	void clearIndices();
+	void rebuildSearchIndex();
+	void invalidateDependencyGraph();
+	static std::string getModVersionTypeKey(const std::string & modID, const std::string & modVersion, const std::string & modVersionType);
+
 	uint32_t m_fileRevision;
 	std::vector<std::shared_ptr<Mod>> m_mods;
+	std::unordered_map<std::string, size_t> m_modIndicesByID;
+	std::unordered_map<std::string, size_t> m_modIndicesByName;
+	std::unordered_map<std::string, std::shared_ptr<ModVersionType>> m_modVersionTypesByKey;
+	ModSearchIndex m_searchIndex;
+	mutable std::shared_ptr<const ModDependencyGraph> m_dependencyGraph;
+	mutable std::mutex m_dependencyGraphMutex;
 };
 
 #endif // _MOD_COLLECTION_H_
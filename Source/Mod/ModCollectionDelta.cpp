@@ -0,0 +1,139 @@
+#include "ModCollectionDelta.h"
+
+#include "Mod.h"
+#include "ModCollection.h"
+
+#include <limits>
+#include <unordered_set>
+
+ModCollectionDelta::ModCollectionDelta()
+	: m_previousFileRevision(0)
+	, m_fileRevision(0)
+	, m_numberOfUnchangedMods(0) { }
+
+ModCollectionDelta::ModCollectionDelta(ModCollectionDelta && d) noexcept
+	: m_previousFileRevision(d.m_previousFileRevision)
+	, m_fileRevision(d.m_fileRevision)
+	, m_addedMods(std::move(d.m_addedMods))
+	, m_removedModIDs(std::move(d.m_removedModIDs))
+	, m_changedMods(std::move(d.m_changedMods))
+	, m_numberOfUnchangedMods(d.m_numberOfUnchangedMods) { }
+
+ModCollectionDelta::ModCollectionDelta(const ModCollectionDelta & d)
+	: m_previousFileRevision(d.m_previousFileRevision)
+	, m_fileRevision(d.m_fileRevision)
+	, m_addedMods(d.m_addedMods)
+	, m_removedModIDs(d.m_removedModIDs)
+	, m_changedMods(d.m_changedMods)
+	, m_numberOfUnchangedMods(d.m_numberOfUnchangedMods) { }
+
+ModCollectionDelta & ModCollectionDelta::operator = (ModCollectionDelta && d) noexcept {
+	if(this != &d) {
+		m_previousFileRevision = d.m_previousFileRevision;
+		m_fileRevision = d.m_fileRevision;
+		m_addedMods = std::move(d.m_addedMods);
+		m_removedModIDs = std::move(d.m_removedModIDs);
+		m_changedMods = std::move(d.m_changedMods);
+		m_numberOfUnchangedMods = d.m_numberOfUnchangedMods;
+	}
+
+	return *this;
+}
+
+ModCollectionDelta & ModCollectionDelta::operator = (const ModCollectionDelta & d) {
+	m_previousFileRevision = d.m_previousFileRevision;
+	m_fileRevision = d.m_fileRevision;
+	m_addedMods = d.m_addedMods;
+	m_removedModIDs = d.m_removedModIDs;
+	m_changedMods = d.m_changedMods;
+	m_numberOfUnchangedMods = d.m_numberOfUnchangedMods;
+
+	return *this;
+}
+
+ModCollectionDelta::~ModCollectionDelta() = default;
+
+uint32_t ModCollectionDelta::getPreviousFileRevision() const {
+	return m_previousFileRevision;
+}
+
+uint32_t ModCollectionDelta::getFileRevision() const {
+	return m_fileRevision;
+}
+
+size_t ModCollectionDelta::numberOfAddedMods() const {
+	return m_addedMods.size();
+}
+
+size_t ModCollectionDelta::numberOfRemovedMods() const {
+	return m_removedModIDs.size();
+}
+
+size_t ModCollectionDelta::numberOfChangedMods() const {
+	return m_changedMods.size();
+}
+
+size_t ModCollectionDelta::numberOfUnchangedMods() const {
+	return m_numberOfUnchangedMods;
+}
+
+const std::vector<std::shared_ptr<Mod>> & ModCollectionDelta::getAddedMods() const {
+	return m_addedMods;
+}
+
+const std::vector<std::string> & ModCollectionDelta::getRemovedModIDs() const {
+	return m_removedModIDs;
+}
+
+const std::vector<std::shared_ptr<Mod>> & ModCollectionDelta::getChangedMods() const {
+	return m_changedMods;
+}
+
+bool ModCollectionDelta::hasStructuralChanges() const {
+	return !m_addedMods.empty() || !m_removedModIDs.empty();
+}
+
+bool ModCollectionDelta::isEmpty() const {
+	return m_addedMods.empty() &&
+		   m_removedModIDs.empty() &&
+		   m_changedMods.empty() &&
+		   m_previousFileRevision == m_fileRevision;
+}
+
+ModCollectionDelta ModCollectionDelta::create(const ModCollection & previousMods, const ModCollection & mods) {
+	ModCollectionDelta delta;
+	delta.m_previousFileRevision = previousMods.getFileRevision();
+	delta.m_fileRevision = mods.getFileRevision();
+
+	std::unordered_set<size_t> matchedPreviousModIndices;
+	matchedPreviousModIndices.reserve(previousMods.numberOfMods());
+
+	for(const std::shared_ptr<Mod> & mod : mods.getMods()) {
+		size_t previousModIndex = previousMods.indexOfModWithID(mod->getID());
+
+		if(previousModIndex == std::numeric_limits<size_t>::max()) {
+			delta.m_addedMods.push_back(mod);
+			continue;
+		}
+
+		matchedPreviousModIndices.insert(previousModIndex);
+
+		size_t previousModContentHash = previousMods.getMod(previousModIndex)->getContentHash();
+
+		// mods which were not parsed from a mod list have no content hash and are always treated as changed
+		if(previousModContentHash == 0 || previousModContentHash != mod->getContentHash()) {
+			delta.m_changedMods.push_back(mod);
+		}
+		else {
+			delta.m_numberOfUnchangedMods++;
+		}
+	}
+
+	for(size_t i = 0; i < previousMods.numberOfMods(); i++) {
+		if(matchedPreviousModIndices.find(i) == matchedPreviousModIndices.cend()) {
+			delta.m_removedModIDs.push_back(previousMods.getMod(i)->getID());
+		}
+	}
+
+	return delta;
+}
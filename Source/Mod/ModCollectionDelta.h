@@ -0,0 +1,45 @@
+#ifndef _MOD_COLLECTION_DELTA_H_
+#define _MOD_COLLECTION_DELTA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Mod;
+class ModCollection;
+
+class ModCollectionDelta final {
+public:
+	ModCollectionDelta();
+	ModCollectionDelta(ModCollectionDelta && d) noexcept;
+	ModCollectionDelta(const ModCollectionDelta & d);
+	ModCollectionDelta & operator = (ModCollectionDelta && d) noexcept;
+	ModCollectionDelta & operator = (const ModCollectionDelta & d);
+	~ModCollectionDelta();
+
+	uint32_t getPreviousFileRevision() const;
+	uint32_t getFileRevision() const;
+	size_t numberOfAddedMods() const;
+	size_t numberOfRemovedMods() const;
+	size_t numberOfChangedMods() const;
+	size_t numberOfUnchangedMods() const;
+	const std::vector<std::shared_ptr<Mod>> & getAddedMods() const;
+	const std::vector<std::string> & getRemovedModIDs() const;
+	const std::vector<std::shared_ptr<Mod>> & getChangedMods() const;
+	bool hasStructuralChanges() const;
+	bool isEmpty() const;
+
+	static ModCollectionDelta create(const ModCollection & previousMods, const ModCollection & mods);
+
+private:
+	uint32_t m_previousFileRevision;
+	uint32_t m_fileRevision;
+	std::vector<std::shared_ptr<Mod>> m_addedMods;
+	std::vector<std::string> m_removedModIDs;
+	std::vector<std::shared_ptr<Mod>> m_changedMods;
+	size_t m_numberOfUnchangedMods;
+};
+
+#endif // _MOD_COLLECTION_DELTA_H_
@@ -312,9 +312,9 @@ bool ModDependency::operator == (const ModDependency & dependency) const {
 		return true;
 	}
 
-	return Utilities::areStringsEqualIgnoreCase(m_id, dependency.m_id) &&
-		   Utilities::areStringsEqualIgnoreCase(m_version, dependency.m_version) &&
-		   Utilities::areStringsEqualIgnoreCase(m_versionType, dependency.m_versionType);
+	return m_id.equalsIgnoreCase(dependency.m_id) &&
+		   m_version.equalsIgnoreCase(dependency.m_version) &&
+		   m_versionType.equalsIgnoreCase(dependency.m_versionType);
 
 }
 
@@ -1,6 +1,8 @@
 #ifndef _MOD_DEPENDENCY_H_
 #define _MOD_DEPENDENCY_H_
 
+#include "InternedString.h"
+
 #include <rapidjson/document.h>
 
 #include <memory>
@@ -46,9 +48,9 @@ public:
 	bool operator != (const ModDependency & dependency) const;
 
 private:
-	std::string m_id;
-	std::string m_version;
-	std::string m_versionType;
+	InternedString m_id;
+	InternedString m_version;
+	InternedString m_versionType;
 };
 
 #endif // _MOD_DEPENDENCY_H_
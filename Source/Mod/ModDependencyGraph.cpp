@@ -0,0 +1,336 @@
+#include "ModDependencyGraph.h"
+
+#include "Mod.h"
+#include "ModCollection.h"
+#include "ModDependency.h"
+#include "ModVersion.h"
+#include "ModVersionType.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+ModDependencyGraph::ModDependencyGraph()
+	: m_numberOfClosureWords(0)
+	, m_numberOfEdges(0)
+	, m_numberOfUnresolvedDependencies(0)
+	, m_hasCycles(false) { }
+
+ModDependencyGraph::ModDependencyGraph(ModDependencyGraph && g) noexcept
+	: m_nodes(std::move(g.m_nodes))
+	, m_nodeIDs(std::move(g.m_nodeIDs))
+	, m_topologicalOrder(std::move(g.m_topologicalOrder))
+	, m_transitiveClosure(std::move(g.m_transitiveClosure))
+	, m_numberOfClosureWords(g.m_numberOfClosureWords)
+	, m_numberOfEdges(g.m_numberOfEdges)
+	, m_numberOfUnresolvedDependencies(g.m_numberOfUnresolvedDependencies)
+	, m_hasCycles(g.m_hasCycles) { }
+
+ModDependencyGraph::ModDependencyGraph(const ModDependencyGraph & g)
+	: m_nodes(g.m_nodes)
+	, m_nodeIDs(g.m_nodeIDs)
+	, m_topologicalOrder(g.m_topologicalOrder)
+	, m_transitiveClosure(g.m_transitiveClosure)
+	, m_numberOfClosureWords(g.m_numberOfClosureWords)
+	, m_numberOfEdges(g.m_numberOfEdges)
+	, m_numberOfUnresolvedDependencies(g.m_numberOfUnresolvedDependencies)
+	, m_hasCycles(g.m_hasCycles) { }
+
+ModDependencyGraph & ModDependencyGraph::operator = (ModDependencyGraph && g) noexcept {
+	if(this != &g) {
+		m_nodes = std::move(g.m_nodes);
+		m_nodeIDs = std::move(g.m_nodeIDs);
+		m_topologicalOrder = std::move(g.m_topologicalOrder);
+		m_transitiveClosure = std::move(g.m_transitiveClosure);
+		m_numberOfClosureWords = g.m_numberOfClosureWords;
+		m_numberOfEdges = g.m_numberOfEdges;
+		m_numberOfUnresolvedDependencies = g.m_numberOfUnresolvedDependencies;
+		m_hasCycles = g.m_hasCycles;
+	}
+
+	return *this;
+}
+
+ModDependencyGraph & ModDependencyGraph::operator = (const ModDependencyGraph & g) {
+	m_nodes = g.m_nodes;
+	m_nodeIDs = g.m_nodeIDs;
+	m_topologicalOrder = g.m_topologicalOrder;
+	m_transitiveClosure = g.m_transitiveClosure;
+	m_numberOfClosureWords = g.m_numberOfClosureWords;
+	m_numberOfEdges = g.m_numberOfEdges;
+	m_numberOfUnresolvedDependencies = g.m_numberOfUnresolvedDependencies;
+	m_hasCycles = g.m_hasCycles;
+
+	return *this;
+}
+
+ModDependencyGraph::~ModDependencyGraph() = default;
+
+size_t ModDependencyGraph::numberOfNodes() const {
+	return m_nodes.size();
+}
+
+size_t ModDependencyGraph::numberOfEdges() const {
+	return m_numberOfEdges;
+}
+
+size_t ModDependencyGraph::numberOfUnresolvedDependencies() const {
+	return m_numberOfUnresolvedDependencies;
+}
+
+bool ModDependencyGraph::isEmpty() const {
+	return m_nodes.empty();
+}
+
+bool ModDependencyGraph::hasNode(const ModVersionType & modVersionType) const {
+	return m_nodeIDs.find(&modVersionType) != m_nodeIDs.cend();
+}
+
+size_t ModDependencyGraph::getNodeID(const ModVersionType & modVersionType) const {
+	std::unordered_map<const ModVersionType *, size_t>::const_iterator nodeIDIterator(m_nodeIDs.find(&modVersionType));
+
+	if(nodeIDIterator == m_nodeIDs.cend()) {
+		return INVALID_NODE_ID;
+	}
+
+	return nodeIDIterator->second;
+}
+
+const ModVersionType * ModDependencyGraph::getModVersionType(size_t nodeID) const {
+	if(nodeID >= m_nodes.size()) {
+		return nullptr;
+	}
+
+	return m_nodes[nodeID].modVersionType;
+}
+
+const std::vector<size_t> & ModDependencyGraph::getDependencyNodeIDs(size_t nodeID) const {
+	static const std::vector<size_t> NO_DEPENDENCY_NODE_IDS;
+
+	if(nodeID >= m_nodes.size()) {
+		return NO_DEPENDENCY_NODE_IDS;
+	}
+
+	return m_nodes[nodeID].dependencyNodeIDs;
+}
+
+const std::vector<size_t> & ModDependencyGraph::getTopologicalOrder() const {
+	return m_topologicalOrder;
+}
+
+bool ModDependencyGraph::hasCycles() const {
+	return m_hasCycles;
+}
+
+bool ModDependencyGraph::isNodeInCycle(size_t nodeID) const {
+	if(nodeID >= m_nodes.size()) {
+		return false;
+	}
+
+	return m_nodes[nodeID].inCycle;
+}
+
+bool ModDependencyGraph::hasCircularDependency(size_t nodeID) const {
+	if(nodeID >= m_nodes.size()) {
+		return false;
+	}
+
+	return m_nodes[nodeID].reachesCycle;
+}
+
+bool ModDependencyGraph::hasCircularDependency(const ModVersionType & modVersionType) const {
+	return hasCircularDependency(getNodeID(modVersionType));
+}
+
+bool ModDependencyGraph::isDependencyOf(size_t dependencyNodeID, size_t nodeID, bool recursive) const {
+	if(dependencyNodeID >= m_nodes.size() || nodeID >= m_nodes.size()) {
+		return false;
+	}
+
+	if(!recursive) {
+		const std::vector<size_t> & dependencyNodeIDs = m_nodes[nodeID].dependencyNodeIDs;
+
+		return std::find(dependencyNodeIDs.cbegin(), dependencyNodeIDs.cend(), dependencyNodeID) != dependencyNodeIDs.cend();
+	}
+
+	return (m_transitiveClosure[(nodeID * m_numberOfClosureWords) + (dependencyNodeID / 64)] & (uint64_t(1) << (dependencyNodeID % 64))) != 0;
+}
+
+bool ModDependencyGraph::isDependencyOf(const ModVersionType & dependency, const ModVersionType & modVersionType, bool recursive) const {
+	return isDependencyOf(getNodeID(dependency), getNodeID(modVersionType), recursive);
+}
+
+std::vector<const ModVersionType *> ModDependencyGraph::getTransitiveDependencies(const ModVersionType & modVersionType) const {
+	size_t nodeID = getNodeID(modVersionType);
+
+	if(nodeID == INVALID_NODE_ID) {
+		return {};
+	}
+
+	std::vector<const ModVersionType *> transitiveDependencies;
+
+	for(size_t dependencyNodeID : m_topologicalOrder) {
+		if(dependencyNodeID != nodeID && isDependencyOf(dependencyNodeID, nodeID, true)) {
+			transitiveDependencies.push_back(m_nodes[dependencyNodeID].modVersionType);
+		}
+	}
+
+	return transitiveDependencies;
+}
+
+bool ModDependencyGraph::build(const ModCollection & mods) {
+	clear();
+
+	for(const std::shared_ptr<Mod> & mod : mods.getMods()) {
+		for(const std::shared_ptr<ModVersion> & modVersion : mod->getVersions()) {
+			for(const std::shared_ptr<ModVersionType> & modVersionType : modVersion->getTypes()) {
+				m_nodeIDs.emplace(modVersionType.get(), m_nodes.size());
+				m_nodes.push_back(Node({ modVersionType.get(), {}, false, false }));
+			}
+		}
+	}
+
+	std::shared_ptr<ModVersionType> dependencyModVersionType;
+
+	for(Node & node : m_nodes) {
+		for(const std::shared_ptr<ModDependency> & modDependency : node.modVersionType->getDependencies()) {
+			dependencyModVersionType = mods.getModDependencyVersionType(*modDependency);
+
+			if(dependencyModVersionType == nullptr) {
+				m_numberOfUnresolvedDependencies++;
+				continue;
+			}
+
+			size_t dependencyNodeID = getNodeID(*dependencyModVersionType);
+
+			if(dependencyNodeID == INVALID_NODE_ID || std::find(node.dependencyNodeIDs.cbegin(), node.dependencyNodeIDs.cend(), dependencyNodeID) != node.dependencyNodeIDs.cend()) {
+				continue;
+			}
+
+			node.dependencyNodeIDs.push_back(dependencyNodeID);
+			m_numberOfEdges++;
+		}
+	}
+
+	buildTopologicalOrder();
+	buildTransitiveClosure();
+
+	if(m_hasCycles) {
+		size_t numberOfNodesInCycles = std::count_if(m_nodes.cbegin(), m_nodes.cend(), [](const Node & node) {
+			return node.inCycle;
+		});
+
+		spdlog::warn("Found {} mod version type{} with circular dependencies.", numberOfNodesInCycles, numberOfNodesInCycles == 1 ? "" : "s");
+	}
+
+	return true;
+}
+
+void ModDependencyGraph::clear() {
+	m_nodes.clear();
+	m_nodeIDs.clear();
+	m_topologicalOrder.clear();
+	m_transitiveClosure.clear();
+	m_numberOfClosureWords = 0;
+	m_numberOfEdges = 0;
+	m_numberOfUnresolvedDependencies = 0;
+	m_hasCycles = false;
+}
+
+void ModDependencyGraph::buildTopologicalOrder() {
+	std::vector<size_t> numberOfUnorderedDependencies(m_nodes.size());
+	std::vector<std::vector<size_t>> dependentNodeIDs(m_nodes.size());
+
+	for(size_t i = 0; i < m_nodes.size(); i++) {
+		numberOfUnorderedDependencies[i] = m_nodes[i].dependencyNodeIDs.size();
+
+		for(size_t dependencyNodeID : m_nodes[i].dependencyNodeIDs) {
+			dependentNodeIDs[dependencyNodeID].push_back(i);
+		}
+	}
+
+	m_topologicalOrder.clear();
+	m_topologicalOrder.reserve(m_nodes.size());
+
+	for(size_t i = 0; i < m_nodes.size(); i++) {
+		if(numberOfUnorderedDependencies[i] == 0) {
+			m_topologicalOrder.push_back(i);
+		}
+	}
+
+	for(size_t i = 0; i < m_topologicalOrder.size(); i++) {
+		for(size_t dependentNodeID : dependentNodeIDs[m_topologicalOrder[i]]) {
+			if(--numberOfUnorderedDependencies[dependentNodeID] == 0) {
+				m_topologicalOrder.push_back(dependentNodeID);
+			}
+		}
+	}
+
+	// nodes which are part of or depend on a cycle can never be ordered, so they are appended at the end
+	m_hasCycles = m_topologicalOrder.size() != m_nodes.size();
+
+	if(m_hasCycles) {
+		for(size_t i = 0; i < m_nodes.size(); i++) {
+			if(numberOfUnorderedDependencies[i] != 0) {
+				m_topologicalOrder.push_back(i);
+			}
+		}
+	}
+}
+
+void ModDependencyGraph::buildTransitiveClosure() {
+	m_numberOfClosureWords = (m_nodes.size() + 63) / 64;
+	m_transitiveClosure.assign(m_nodes.size() * m_numberOfClosureWords, 0);
+
+	bool closureChanged = true;
+
+	// a single pass in topological order is sufficient for acyclic graphs, cycles require iterating until the closure stops changing
+	while(closureChanged) {
+		closureChanged = false;
+
+		for(size_t nodeID : m_topologicalOrder) {
+			uint64_t * closure = m_transitiveClosure.data() + (nodeID * m_numberOfClosureWords);
+
+			for(size_t dependencyNodeID : m_nodes[nodeID].dependencyNodeIDs) {
+				const uint64_t * dependencyClosure = m_transitiveClosure.data() + (dependencyNodeID * m_numberOfClosureWords);
+				uint64_t dependencyBit = uint64_t(1) << (dependencyNodeID % 64);
+
+				if((closure[dependencyNodeID / 64] & dependencyBit) == 0) {
+					closure[dependencyNodeID / 64] |= dependencyBit;
+					closureChanged = true;
+				}
+
+				for(size_t i = 0; i < m_numberOfClosureWords; i++) {
+					if((closure[i] | dependencyClosure[i]) != closure[i]) {
+						closure[i] |= dependencyClosure[i];
+						closureChanged = true;
+					}
+				}
+			}
+		}
+
+		if(!m_hasCycles) {
+			break;
+		}
+	}
+
+	if(!m_hasCycles) {
+		return;
+	}
+
+	std::vector<size_t> cycleNodeIDs;
+
+	for(size_t i = 0; i < m_nodes.size(); i++) {
+		m_nodes[i].inCycle = isDependencyOf(i, i, true);
+
+		if(m_nodes[i].inCycle) {
+			cycleNodeIDs.push_back(i);
+		}
+	}
+
+	for(size_t i = 0; i < m_nodes.size(); i++) {
+		m_nodes[i].reachesCycle = std::any_of(cycleNodeIDs.cbegin(), cycleNodeIDs.cend(), [this, i](size_t cycleNodeID) {
+			return isDependencyOf(cycleNodeID, i, true);
+		});
+	}
+}
@@ -0,0 +1,64 @@
+#ifndef _MOD_DEPENDENCY_GRAPH_H_
+#define _MOD_DEPENDENCY_GRAPH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+class ModCollection;
+class ModVersionType;
+
+class ModDependencyGraph final {
+public:
+	ModDependencyGraph();
+	ModDependencyGraph(ModDependencyGraph && g) noexcept;
+	ModDependencyGraph(const ModDependencyGraph & g);
+	ModDependencyGraph & operator = (ModDependencyGraph && g) noexcept;
+	ModDependencyGraph & operator = (const ModDependencyGraph & g);
+	~ModDependencyGraph();
+
+	size_t numberOfNodes() const;
+	size_t numberOfEdges() const;
+	size_t numberOfUnresolvedDependencies() const;
+	bool isEmpty() const;
+	bool hasNode(const ModVersionType & modVersionType) const;
+	size_t getNodeID(const ModVersionType & modVersionType) const;
+	const ModVersionType * getModVersionType(size_t nodeID) const;
+	const std::vector<size_t> & getDependencyNodeIDs(size_t nodeID) const;
+	const std::vector<size_t> & getTopologicalOrder() const;
+	bool hasCycles() const;
+	bool isNodeInCycle(size_t nodeID) const;
+	bool hasCircularDependency(size_t nodeID) const;
+	bool hasCircularDependency(const ModVersionType & modVersionType) const;
+	bool isDependencyOf(size_t dependencyNodeID, size_t nodeID, bool recursive = true) const;
+	bool isDependencyOf(const ModVersionType & dependency, const ModVersionType & modVersionType, bool recursive = true) const;
+	std::vector<const ModVersionType *> getTransitiveDependencies(const ModVersionType & modVersionType) const;
+	bool build(const ModCollection & mods);
+	void clear();
+
+	static constexpr size_t INVALID_NODE_ID = std::numeric_limits<size_t>::max();
+
+private:
+	struct Node {
+		const ModVersionType * modVersionType;
+		std::vector<size_t> dependencyNodeIDs;
+		bool inCycle;
+		bool reachesCycle;
+	};
+
+	void buildTopologicalOrder();
+	void buildTransitiveClosure();
+
+	std::vector<Node> m_nodes;
+	std::unordered_map<const ModVersionType *, size_t> m_nodeIDs;
+	std::vector<size_t> m_topologicalOrder;
+	std::vector<uint64_t> m_transitiveClosure;
+	size_t m_numberOfClosureWords;
+	size_t m_numberOfEdges;
+	size_t m_numberOfUnresolvedDependencies;
+	bool m_hasCycles;
+};
+
+#endif // _MOD_DEPENDENCY_GRAPH_H_
@@ -203,16 +203,28 @@ const std::string & ModDownload::getGameVersionID() const {
 	return m_gameVersionID;
 }
 
+const InternedString & ModDownload::getInternedGameVersionID() const {
+	return m_gameVersionID;
+}
+
 const std::string & ModDownload::getType() const {
 	return m_type;
 }
 
+const InternedString & ModDownload::getInternedType() const {
+	return m_type;
+}
+
 bool ModDownload::isOriginalFiles() const {
-	return Utilities::areStringsEqualIgnoreCase(m_type, ORIGINAL_FILES_TYPE);
+	static const InternedString INTERNED_ORIGINAL_FILES_TYPE(ORIGINAL_FILES_TYPE);
+
+	return m_type.equalsIgnoreCase(INTERNED_ORIGINAL_FILES_TYPE);
 }
 
 bool ModDownload::isModManagerFiles() const {
-	return Utilities::areStringsEqualIgnoreCase(m_type, MOD_MANAGER_FILES_TYPE);
+	static const InternedString INTERNED_MOD_MANAGER_FILES_TYPE(MOD_MANAGER_FILES_TYPE);
+
+	return m_type.equalsIgnoreCase(INTERNED_MOD_MANAGER_FILES_TYPE);
 }
 
 const std::string & ModDownload::getSubfolder() const {
@@ -234,11 +246,15 @@ const std::string & ModDownload::getSHA1() const {
 }
 
 bool ModDownload::isStandAlone() const {
-	return Utilities::areStringsEqualIgnoreCase(m_gameVersionID, GameVersion::STANDALONE);
+	static const InternedString STANDALONE(GameVersion::STANDALONE);
+
+	return m_gameVersionID.equalsIgnoreCase(STANDALONE);
 }
 
 bool ModDownload::isForAllGameVersions() const {
-	return Utilities::areStringsEqualIgnoreCase(m_gameVersionID, GameVersion::ALL_VERSIONS);
+	static const InternedString ALL_VERSIONS(GameVersion::ALL_VERSIONS);
+
+	return m_gameVersionID.equalsIgnoreCase(ALL_VERSIONS);
 }
 
 bool ModDownload::isConverted() const {
@@ -919,11 +935,11 @@ bool ModDownload::operator == (const ModDownload & modDownload) const {
 		   m_corrupted == modDownload.m_corrupted &&
 		   m_repaired == modDownload.m_repaired &&
 		   Utilities::areStringsEqualIgnoreCase(m_fileName, modDownload.m_fileName) &&
-		   Utilities::areStringsEqualIgnoreCase(m_version, modDownload.m_version) &&
-		   Utilities::areStringsEqualIgnoreCase(m_versionType, modDownload.m_versionType) &&
-		   Utilities::areStringsEqualIgnoreCase(m_special, modDownload.m_special) &&
-		   Utilities::areStringsEqualIgnoreCase(m_gameVersionID, modDownload.m_gameVersionID) &&
-		   Utilities::areStringsEqualIgnoreCase(m_type, modDownload.m_type) &&
+		   m_version.equalsIgnoreCase(modDownload.m_version) &&
+		   m_versionType.equalsIgnoreCase(modDownload.m_versionType) &&
+		   m_special.equalsIgnoreCase(modDownload.m_special) &&
+		   m_gameVersionID.equalsIgnoreCase(modDownload.m_gameVersionID) &&
+		   m_type.equalsIgnoreCase(modDownload.m_type) &&
 		   m_sha1 == modDownload.m_sha1;
 }
 
@@ -1,6 +1,8 @@
 #ifndef _MOD_DOWNLOAD_H_
 #define _MOD_DOWNLOAD_H_
 
+#include "InternedString.h"
+
 #include <rapidjson/document.h>
 
 #include <cstdint>
@@ -39,7 +41,9 @@ public:
 	const std::string & getSpecial() const;
 	bool hasGameVersionID() const;
 	const std::string & getGameVersionID() const;
+	const InternedString & getInternedGameVersionID() const;
 	const std::string & getType() const;
+	const InternedString & getInternedType() const;
 	bool isOriginalFiles() const;
 	bool isModManagerFiles() const;
 	const std::string & getSubfolder() const;
@@ -95,11 +99,11 @@ private:
 	uint64_t m_fileSize;
 	uint8_t m_partNumber;
 	uint8_t m_partCount;
-	std::string m_version;
-	std::string m_versionType;
-	std::string m_special;
-	std::string m_gameVersionID;
-	std::string m_type;
+	InternedString m_version;
+	InternedString m_versionType;
+	InternedString m_special;
+	InternedString m_gameVersionID;
+	InternedString m_type;
 	std::string m_sha1;
 	std::optional<bool> m_converted;
 	std::optional<bool> m_corrupted;
@@ -124,6 +124,10 @@ const std::string & ModFile::getType() const {
 	return m_type;
 }
 
+const InternedString & ModFile::getInternedType() const {
+	return m_type;
+}
+
 const std::string & ModFile::getSHA1() const {
 	return m_sha1;
 }
@@ -548,7 +552,7 @@ bool ModFile::operator == (const ModFile & modFile) const {
 		   m_shared == modFile.m_shared &&
 		   m_usedByAllGameVersions == m_usedByAllGameVersions &&
 		   Utilities::areStringsEqualIgnoreCase(m_fileName, modFile.m_fileName) &&
-		   Utilities::areStringsEqualIgnoreCase(m_type, modFile.m_type) &&
+		   m_type.equalsIgnoreCase(modFile.m_type) &&
 		   m_sha1 == modFile.m_sha1;
 }
 
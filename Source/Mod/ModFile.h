@@ -1,6 +1,8 @@
 #ifndef _MOD_FILE_H_
 #define _MOD_FILE_H_
 
+#include "InternedString.h"
+
 #include <rapidjson/document.h>
 
 #include <memory>
@@ -33,6 +35,7 @@ public:
 	std::string_view getFileExtension() const;
 	uint64_t getFileSize() const;
 	const std::string & getType() const;
+	const InternedString & getInternedType() const;
 	const std::string & getSHA1() const;
 	bool isShared() const;
 	std::optional<bool> getShared() const;
@@ -70,7 +73,7 @@ private:
 	std::string m_fileName;
 	uint64_t m_fileSize;
 	bool m_hadFileSizeAttribute;
-	std::string m_type;
+	InternedString m_type;
 	std::string m_sha1;
 	std::optional<bool> m_shared;
 	std::optional<bool> m_usedByAllGameVersions;
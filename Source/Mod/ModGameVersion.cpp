@@ -234,6 +234,10 @@ const std::string & ModGameVersion::getGameVersionID() const {
 	return m_gameVersionID;
 }
 
+const InternedString & ModGameVersion::getInternedGameVersionID() const {
+	return m_gameVersionID;
+}
+
 std::shared_ptr<GameVersion> ModGameVersion::getStandAloneGameVersion() const {
 	return m_standAloneGameVersion;
 }
@@ -269,7 +273,9 @@ bool ModGameVersion::isStandAlone() const {
 }
 
 bool ModGameVersion::isForAllGameVersions() const {
-	return Utilities::areStringsEqualIgnoreCase(m_gameVersionID, GameVersion::ALL_VERSIONS);
+	static const InternedString ALL_VERSIONS(GameVersion::ALL_VERSIONS);
+
+	return m_gameVersionID.equalsIgnoreCase(ALL_VERSIONS);
 }
 
 bool ModGameVersion::isConverted() const {
@@ -321,8 +327,10 @@ size_t ModGameVersion::numberOfFilesOfType(const std::string & fileType) {
 
 	size_t fileCount = 0;
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_iterator i = m_files.begin(); i != m_files.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			fileCount++;
 		}
 	}
@@ -359,8 +367,10 @@ bool ModGameVersion::hasFileOfType(const std::string & fileType) const {
 		return false;
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_iterator i = m_files.begin(); i != m_files.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			return true;
 		}
 	}
@@ -397,8 +407,10 @@ size_t ModGameVersion::indexOfFirstFileOfType(const std::string & fileType) cons
 		return std::numeric_limits<size_t>::max();
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(size_t i = 0; i < m_files.size(); i++) {
-		if(Utilities::areStringsEqualIgnoreCase(m_files[i]->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase(m_files[i]->getInternedType())) {
 			return i;
 		}
 	}
@@ -411,8 +423,10 @@ size_t ModGameVersion::indexOfLastFileOfType(const std::string & fileType) const
 		return std::numeric_limits<size_t>::max();
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_reverse_iterator i = m_files.crbegin(); i != m_files.crend(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			return m_files.crend() - i - 1;
 		}
 	}
@@ -447,8 +461,10 @@ std::shared_ptr<ModFile> ModGameVersion::getFirstFileOfType(const std::string &
 		return nullptr;
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_iterator i = m_files.begin(); i != m_files.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			return *i;
 		}
 	}
@@ -461,8 +477,10 @@ std::shared_ptr<ModFile> ModGameVersion::getLastFileOfType(const std::string & f
 		return nullptr;
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_reverse_iterator i = m_files.crbegin(); i != m_files.crend(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			return *i;
 		}
 	}
@@ -477,8 +495,10 @@ std::vector<std::shared_ptr<ModFile>> ModGameVersion::getFilesOfType(const std::
 		return files;
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_iterator i = m_files.begin(); i != m_files.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			files.push_back(*i);
 		}
 	}
@@ -491,8 +511,10 @@ std::optional<std::string> ModGameVersion::getFirstFileNameOfType(const std::str
 		return {};
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_iterator i = m_files.begin(); i != m_files.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			return (*i)->getFileName();
 		}
 	}
@@ -505,8 +527,10 @@ std::optional<std::string> ModGameVersion::getLastFileNameOfType(const std::stri
 		return {};
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_reverse_iterator i = m_files.crbegin(); i != m_files.crend(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			return (*i)->getFileName();
 		}
 	}
@@ -521,8 +545,10 @@ std::vector<std::string> ModGameVersion::getFileNamesOfType(const std::string &
 		return fileNames;
 	}
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_iterator i = m_files.begin(); i != m_files.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			fileNames.emplace_back((*i)->getFileName());
 		}
 	}
@@ -606,8 +632,10 @@ size_t ModGameVersion::removeFilesOfType(const std::string & fileType) {
 	std::vector<std::shared_ptr<ModFile>> modFilesToRemove;
 	size_t numberOfFilesRemoved = 0;
 
+	const InternedString internedFileType(fileType);
+
 	for(std::vector<std::shared_ptr<ModFile>>::const_iterator i = m_files.begin(); i != m_files.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+		if(internedFileType.equalsIgnoreCase((*i)->getInternedType())) {
 			modFilesToRemove.push_back(*i);
 		}
 	}
@@ -1756,7 +1784,7 @@ bool ModGameVersion::isGameVersionSupported(const GameVersion & gameVersion) con
 	}
 
 	return gameVersion.isValid() &&
-		   Utilities::areStringsEqualIgnoreCase(m_gameVersionID, gameVersion.getID());
+		   m_gameVersionID.equalsIgnoreCase(gameVersion.getInternedID());
 }
 
 bool ModGameVersion::isGameVersionCompatible(const GameVersion & gameVersion) const {
@@ -1819,7 +1847,7 @@ bool ModGameVersion::operator == (const ModGameVersion & modGameVersion) const {
 	}
 
 	if(m_files.size() != modGameVersion.m_files.size() ||
-	   !Utilities::areStringsEqualIgnoreCase(m_gameVersionID, modGameVersion.m_gameVersionID) ||
+	   !m_gameVersionID.equalsIgnoreCase(modGameVersion.m_gameVersionID) ||
 	   m_converted != modGameVersion.m_converted) {
 		return false;
 	}
@@ -1,6 +1,7 @@
 #ifndef _MOD_GAME_VERSION_H_
 #define _MOD_GAME_VERSION_H_
 
+#include "InternedString.h"
 #include "ModFile.h"
 
 #include <Utilities/StringUtilities.h>
@@ -36,6 +37,7 @@ public:
 	~ModGameVersion();
 
 	const std::string & getGameVersionID() const;
+	const InternedString & getInternedGameVersionID() const;
 	std::shared_ptr<GameVersion> getStandAloneGameVersion() const;
 	std::string getFullName(bool includeGameVersionID) const;
 	bool isStandAlone() const;
@@ -114,7 +116,7 @@ protected:
 	void updateParent();
 
 private:
-	std::string m_gameVersionID;
+	InternedString m_gameVersionID;
 	std::shared_ptr<GameVersion> m_standAloneGameVersion;
 	bool m_converted;
 	std::vector<std::shared_ptr<ModFile>> m_files;
@@ -123,14 +125,14 @@ private:
 
 template <typename ...Arguments, typename>
 size_t ModGameVersion::numberOfFilesOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 	size_t fileCount = 0;
 
 	for(const std::shared_ptr<ModFile> & modFile : m_files) {
 		for(size_t i = 0; i < sizeof...(arguments); i++) {
-			const std::string_view & fileType = unpackedArguments[i];
+			const InternedString & fileType = unpackedArguments[i];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase(modFile->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase(modFile->getInternedType())) {
 				fileCount++;
 			}
 		}
@@ -141,13 +143,13 @@ size_t ModGameVersion::numberOfFilesOfType(Arguments &&... arguments) const {
 
 template <typename ...Arguments, typename>
 bool ModGameVersion::hasFileOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 
 	for(const std::shared_ptr<ModFile> & modFile : m_files) {
 		for(size_t i = 0; i < sizeof...(arguments); i++) {
-			const std::string_view & fileType = unpackedArguments[i];
+			const InternedString & fileType = unpackedArguments[i];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase(modFile->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase(modFile->getInternedType())) {
 				return true;
 			}
 		}
@@ -158,13 +160,13 @@ bool ModGameVersion::hasFileOfType(Arguments &&... arguments) const {
 
 template <typename ...Arguments, typename>
 size_t ModGameVersion::indexOfFirstFileOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 
 	for(const std::shared_ptr<ModFile> & modFile : m_files) {
 		for(size_t i = 0; i < sizeof...(arguments); i++) {
-			const std::string_view & fileType = unpackedArguments[i];
+			const InternedString & fileType = unpackedArguments[i];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase(modFile->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase(modFile->getInternedType())) {
 				return i;
 			}
 		}
@@ -175,13 +177,13 @@ size_t ModGameVersion::indexOfFirstFileOfType(Arguments &&... arguments) const {
 
 template <typename ...Arguments, typename>
 size_t ModGameVersion::indexOfLastFileOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 
 	for(std::vector<std::shared_ptr<ModFile>>::const_reverse_iterator i = m_files.crbegin(); i != m_files.crend(); ++i) {
 		for(size_t j = 0; j < sizeof...(arguments); j++) {
-			const std::string_view & fileType = unpackedArguments[j];
+			const InternedString & fileType = unpackedArguments[j];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase((*i)->getInternedType())) {
 				return m_files.crend() - i - 1;
 			}
 		}
@@ -192,13 +194,13 @@ size_t ModGameVersion::indexOfLastFileOfType(Arguments &&... arguments) const {
 
 template <typename ...Arguments, typename>
 std::shared_ptr<ModFile> ModGameVersion::getFirstFileOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 
 	for(const std::shared_ptr<ModFile> & modFile : m_files) {
 		for(size_t i = 0; i < sizeof...(arguments); i++) {
-			const std::string_view & fileType = unpackedArguments[i];
+			const InternedString & fileType = unpackedArguments[i];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase(modFile->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase(modFile->getInternedType())) {
 				return modFile;
 			}
 		}
@@ -209,13 +211,13 @@ std::shared_ptr<ModFile> ModGameVersion::getFirstFileOfType(Arguments &&... argu
 
 template <typename ...Arguments, typename>
 std::shared_ptr<ModFile> ModGameVersion::getLastFileOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 
 	for(std::vector<std::shared_ptr<ModFile>>::const_reverse_iterator i = m_files.crbegin(); i != m_files.crend(); ++i) {
 		for(size_t j = 0; j < sizeof...(arguments); j++) {
-			const std::string_view & fileType = unpackedArguments[j];
+			const InternedString & fileType = unpackedArguments[j];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase((*i)->getInternedType())) {
 				return *i;
 			}
 		}
@@ -226,14 +228,14 @@ std::shared_ptr<ModFile> ModGameVersion::getLastFileOfType(Arguments &&... argum
 
 template <typename ...Arguments, typename>
 std::vector<std::shared_ptr<ModFile>> ModGameVersion::getFilesOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 	std::vector<std::shared_ptr<ModFile>> files;
 
 	for(const std::shared_ptr<ModFile> & modFile : m_files) {
 		for(size_t i = 0; i < sizeof...(arguments); i++) {
-			const std::string_view & fileType = unpackedArguments[i];
+			const InternedString & fileType = unpackedArguments[i];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase(modFile->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase(modFile->getInternedType())) {
 				files.push_back(modFile);
 			}
 		}
@@ -244,13 +246,13 @@ std::vector<std::shared_ptr<ModFile>> ModGameVersion::getFilesOfType(Arguments &
 
 template <typename ...Arguments, typename>
 std::optional<std::string> ModGameVersion::getFirstFileNameOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 
 	for(const std::shared_ptr<ModFile> & modFile : m_files) {
 		for(size_t i = 0; i < sizeof...(arguments); i++) {
-			const std::string_view & fileType = unpackedArguments[i];
+			const InternedString & fileType = unpackedArguments[i];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase(modFile->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase(modFile->getInternedType())) {
 				return modFile->getFileName();
 			}
 		}
@@ -261,13 +263,13 @@ std::optional<std::string> ModGameVersion::getFirstFileNameOfType(Arguments &&..
 
 template <typename ...Arguments, typename>
 std::optional<std::string> ModGameVersion::getLastFileNameOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 
 	for(std::vector<std::shared_ptr<ModFile>>::const_reverse_iterator i = m_files.crbegin(); i != m_files.crend(); ++i) {
 		for(size_t j = 0; j < sizeof...(arguments); j++) {
-			const std::string_view & fileType = unpackedArguments[j];
+			const InternedString & fileType = unpackedArguments[j];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase((*i)->getInternedType())) {
 				return (*i)->getFileName();
 			}
 		}
@@ -278,14 +280,14 @@ std::optional<std::string> ModGameVersion::getLastFileNameOfType(Arguments &&...
 
 template <typename ...Arguments, typename>
 std::vector<std::string> ModGameVersion::getFileNamesOfType(Arguments &&... arguments) const {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 	std::vector<std::string> fileNames;
 
 	for(const std::shared_ptr<ModFile> & modFile : m_files) {
 		for(size_t i = 0; i < sizeof...(arguments); i++) {
-			const std::string_view & fileType = unpackedArguments[i];
+			const InternedString & fileType = unpackedArguments[i];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase(modFile->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase(modFile->getInternedType())) {
 				fileNames.push_back(modFile->getFileName());
 			}
 		}
@@ -296,15 +298,15 @@ std::vector<std::string> ModGameVersion::getFileNamesOfType(Arguments &&... argu
 
 template <typename ...Arguments, typename>
 size_t ModGameVersion::removeFilesOfType(Arguments &&... arguments) {
-	std::string_view unpackedArguments[sizeof...(arguments)] = {arguments...};
+	const InternedString unpackedArguments[sizeof...(arguments)] = {InternedString(arguments)...};
 	std::vector<std::shared_ptr<ModFile>> modFilesToRemove;
 	size_t numberOfFilesRemoved = 0;
 
 	for(std::vector<std::shared_ptr<ModFile>>::const_iterator i = m_files.begin(); i != m_files.end(); ++i) {
 		for(size_t j = 0; j < sizeof...(arguments); j++) {
-			const std::string_view & fileType = unpackedArguments[j];
+			const InternedString & fileType = unpackedArguments[j];
 
-			if(!fileType.empty() && Utilities::areStringsEqualIgnoreCase((*i)->getType(), fileType)) {
+			if(!fileType.empty() && fileType.equalsIgnoreCase((*i)->getInternedType())) {
 				modFilesToRemove.push_back(*i);
 			}
 		}
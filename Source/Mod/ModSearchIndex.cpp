@@ -0,0 +1,366 @@
+#include "ModSearchIndex.h"
+
+#include "Mod.h"
+#include "ModTeam.h"
+#include "ModTeamMember.h"
+#include "ModVersion.h"
+#include "ModVersionType.h"
+
+#include <Utilities/StringUtilities.h>
+
+#include <algorithm>
+#include <iterator>
+
+ModSearchIndex::ModSearchIndex()
+	: m_numberOfRemovedFuzzyNameMods(0) { }
+
+ModSearchIndex::ModSearchIndex(ModSearchIndex && i) noexcept
+	: m_entries(std::move(i.m_entries))
+	, m_postings(std::move(i.m_postings))
+	, m_fuzzyNameTree(std::move(i.m_fuzzyNameTree))
+	, m_fuzzyNameMods(std::move(i.m_fuzzyNameMods))
+	, m_fuzzyNameModIndices(std::move(i.m_fuzzyNameModIndices))
+	, m_fuzzyAuthorNameTree(std::move(i.m_fuzzyAuthorNameTree))
+	, m_fuzzyAuthorNames(std::move(i.m_fuzzyAuthorNames))
+	, m_fuzzyAuthorNameIndices(std::move(i.m_fuzzyAuthorNameIndices))
+	, m_numberOfRemovedFuzzyNameMods(i.m_numberOfRemovedFuzzyNameMods) { }
+
+ModSearchIndex::ModSearchIndex(const ModSearchIndex & i)
+	: m_entries(i.m_entries)
+	, m_postings(i.m_postings)
+	, m_fuzzyNameTree(i.m_fuzzyNameTree)
+	, m_fuzzyNameMods(i.m_fuzzyNameMods)
+	, m_fuzzyNameModIndices(i.m_fuzzyNameModIndices)
+	, m_fuzzyAuthorNameTree(i.m_fuzzyAuthorNameTree)
+	, m_fuzzyAuthorNames(i.m_fuzzyAuthorNames)
+	, m_fuzzyAuthorNameIndices(i.m_fuzzyAuthorNameIndices)
+	, m_numberOfRemovedFuzzyNameMods(i.m_numberOfRemovedFuzzyNameMods) { }
+
+ModSearchIndex & ModSearchIndex::operator = (ModSearchIndex && i) noexcept {
+	if(this != &i) {
+		m_entries = std::move(i.m_entries);
+		m_postings = std::move(i.m_postings);
+		m_fuzzyNameTree = std::move(i.m_fuzzyNameTree);
+		m_fuzzyNameMods = std::move(i.m_fuzzyNameMods);
+		m_fuzzyNameModIndices = std::move(i.m_fuzzyNameModIndices);
+		m_fuzzyAuthorNameTree = std::move(i.m_fuzzyAuthorNameTree);
+		m_fuzzyAuthorNames = std::move(i.m_fuzzyAuthorNames);
+		m_fuzzyAuthorNameIndices = std::move(i.m_fuzzyAuthorNameIndices);
+		m_numberOfRemovedFuzzyNameMods = i.m_numberOfRemovedFuzzyNameMods;
+	}
+
+	return *this;
+}
+
+ModSearchIndex & ModSearchIndex::operator = (const ModSearchIndex & i) {
+	m_entries = i.m_entries;
+	m_postings = i.m_postings;
+	m_fuzzyNameTree = i.m_fuzzyNameTree;
+	m_fuzzyNameMods = i.m_fuzzyNameMods;
+	m_fuzzyNameModIndices = i.m_fuzzyNameModIndices;
+	m_fuzzyAuthorNameTree = i.m_fuzzyAuthorNameTree;
+	m_fuzzyAuthorNames = i.m_fuzzyAuthorNames;
+	m_fuzzyAuthorNameIndices = i.m_fuzzyAuthorNameIndices;
+	m_numberOfRemovedFuzzyNameMods = i.m_numberOfRemovedFuzzyNameMods;
+
+	return *this;
+}
+
+ModSearchIndex::~ModSearchIndex() = default;
+
+size_t ModSearchIndex::numberOfMods() const {
+	return m_entries.size();
+}
+
+bool ModSearchIndex::hasMod(const Mod & mod) const {
+	return m_entries.find(&mod) != m_entries.cend();
+}
+
+const ModSearchIndex::Entry * ModSearchIndex::getEntry(const Mod & mod) const {
+	std::unordered_map<const Mod *, Entry>::const_iterator entryIterator(m_entries.find(&mod));
+
+	if(entryIterator == m_entries.cend()) {
+		return nullptr;
+	}
+
+	return &entryIterator->second;
+}
+
+std::optional<std::vector<const Mod *>> ModSearchIndex::getCandidateMods(std::string_view formattedQuery) const {
+	if(formattedQuery.length() < TRIGRAM_LENGTH) {
+		return {};
+	}
+
+	std::vector<uint32_t> queryTrigrams;
+	addTrigrams(formattedQuery, queryTrigrams);
+	std::sort(queryTrigrams.begin(), queryTrigrams.end());
+	queryTrigrams.erase(std::unique(queryTrigrams.begin(), queryTrigrams.end()), queryTrigrams.end());
+
+	std::vector<const std::vector<const Mod *> *> postings;
+	postings.reserve(queryTrigrams.size());
+
+	for(uint32_t trigram : queryTrigrams) {
+		std::unordered_map<uint32_t, std::vector<const Mod *>>::const_iterator postingIterator(m_postings.find(trigram));
+
+		if(postingIterator == m_postings.cend()) {
+			return std::vector<const Mod *>();
+		}
+
+		postings.push_back(&postingIterator->second);
+	}
+
+	std::sort(postings.begin(), postings.end(), [](const std::vector<const Mod *> * postingA, const std::vector<const Mod *> * postingB) {
+		return postingA->size() < postingB->size();
+	});
+
+	std::vector<const Mod *> candidateMods(*postings.front());
+	std::vector<const Mod *> intersectedCandidateMods;
+
+	for(size_t i = 1; i < postings.size() && !candidateMods.empty(); i++) {
+		intersectedCandidateMods.clear();
+		std::set_intersection(candidateMods.cbegin(), candidateMods.cend(), postings[i]->cbegin(), postings[i]->cend(), std::back_inserter(intersectedCandidateMods));
+		candidateMods.swap(intersectedCandidateMods);
+	}
+
+	return candidateMods;
+}
+
+std::vector<std::pair<const Mod *, size_t>> ModSearchIndex::getFuzzyMatchingMods(std::string_view formattedQuery, size_t maximumNumberOfMatches) const {
+	std::vector<std::pair<const Mod *, size_t>> fuzzyMatchingMods;
+	const Mod * mod = nullptr;
+
+	for(const BKTree::ValueMatch & match : m_fuzzyNameTree.searchNames(formattedQuery)) {
+		mod = m_fuzzyNameMods[match.value];
+
+		if(mod == nullptr) {
+			continue;
+		}
+
+		fuzzyMatchingMods.emplace_back(mod, match.distance);
+
+		if(fuzzyMatchingMods.size() >= maximumNumberOfMatches) {
+			break;
+		}
+	}
+
+	return fuzzyMatchingMods;
+}
+
+std::vector<std::pair<std::string_view, size_t>> ModSearchIndex::getFuzzyMatchingAuthorNames(std::string_view formattedQuery, size_t maximumNumberOfMatches) const {
+	std::vector<std::pair<std::string_view, size_t>> fuzzyMatchingAuthorNames;
+
+	// author names of removed mods remain until the next rebuild, so callers only keep names which are still listed
+	for(const BKTree::ValueMatch & match : m_fuzzyAuthorNameTree.searchNames(formattedQuery, maximumNumberOfMatches)) {
+		fuzzyMatchingAuthorNames.emplace_back(m_fuzzyAuthorNames[match.value], match.distance);
+	}
+
+	return fuzzyMatchingAuthorNames;
+}
+
+void ModSearchIndex::addMod(const Mod & mod) {
+	if(hasMod(mod)) {
+		removeMod(mod);
+	}
+
+	Entry entry(createEntry(mod));
+
+	for(uint32_t trigram : getTrigrams(entry)) {
+		std::vector<const Mod *> & posting = m_postings[trigram];
+		posting.insert(std::lower_bound(posting.begin(), posting.end(), &mod), &mod);
+	}
+
+	addFuzzyNames(mod, entry);
+
+	m_entries.emplace(&mod, std::move(entry));
+}
+
+bool ModSearchIndex::removeMod(const Mod & mod) {
+	std::unordered_map<const Mod *, Entry>::const_iterator entryIterator(m_entries.find(&mod));
+
+	if(entryIterator == m_entries.cend()) {
+		return false;
+	}
+
+	for(uint32_t trigram : getTrigrams(entryIterator->second)) {
+		std::unordered_map<uint32_t, std::vector<const Mod *>>::iterator postingIterator(m_postings.find(trigram));
+
+		if(postingIterator == m_postings.end()) {
+			continue;
+		}
+
+		std::vector<const Mod *> & posting = postingIterator->second;
+		std::vector<const Mod *>::const_iterator modIterator(std::lower_bound(posting.cbegin(), posting.cend(), &mod));
+
+		if(modIterator != posting.cend() && *modIterator == &mod) {
+			posting.erase(modIterator);
+		}
+
+		if(posting.empty()) {
+			m_postings.erase(postingIterator);
+		}
+	}
+
+	m_entries.erase(entryIterator);
+
+	// the fuzzy name tree does not support removal, so removed mods are skipped until enough of them accumulate to warrant a rebuild
+	std::unordered_map<const Mod *, size_t>::const_iterator fuzzyNameModIndexIterator(m_fuzzyNameModIndices.find(&mod));
+
+	if(fuzzyNameModIndexIterator != m_fuzzyNameModIndices.cend()) {
+		m_fuzzyNameMods[fuzzyNameModIndexIterator->second] = nullptr;
+		m_fuzzyNameModIndices.erase(fuzzyNameModIndexIterator);
+		m_numberOfRemovedFuzzyNameMods++;
+
+		if(m_numberOfRemovedFuzzyNameMods > m_fuzzyNameModIndices.size()) {
+			rebuildFuzzyNameTree();
+		}
+	}
+
+	return true;
+}
+
+void ModSearchIndex::updateMod(const Mod & mod) {
+	removeMod(mod);
+	addMod(mod);
+}
+
+void ModSearchIndex::clear() {
+	m_entries.clear();
+	m_postings.clear();
+	m_fuzzyNameTree.clear();
+	m_fuzzyNameMods.clear();
+	m_fuzzyNameModIndices.clear();
+	m_fuzzyAuthorNameTree.clear();
+	m_fuzzyAuthorNames.clear();
+	m_fuzzyAuthorNameIndices.clear();
+	m_numberOfRemovedFuzzyNameMods = 0;
+}
+
+ModSearchIndex::Entry ModSearchIndex::createEntry(const Mod & mod) {
+	Entry entry;
+	entry.formattedName = Utilities::toLowerCase(mod.getName());
+	entry.formattedVersionNames.reserve(mod.numberOfVersions());
+	entry.formattedVersionTypeNames.reserve(mod.numberOfVersions());
+
+	for(const std::shared_ptr<ModVersion> & modVersion : mod.getVersions()) {
+		entry.formattedVersionNames.push_back(Utilities::toLowerCase(modVersion->getFullName()));
+
+		std::vector<std::string> & formattedVersionTypeNames = entry.formattedVersionTypeNames.emplace_back();
+		formattedVersionTypeNames.reserve(modVersion->numberOfTypes());
+
+		for(const std::shared_ptr<ModVersionType> & modVersionType : modVersion->getTypes()) {
+			formattedVersionTypeNames.push_back(Utilities::toLowerCase(modVersionType->getFullName()));
+		}
+	}
+
+	if(mod.hasAlias()) {
+		entry.formattedAuthorNames.push_back(Utilities::toLowerCase(mod.getAlias()));
+	}
+
+	std::shared_ptr<ModTeam> team(mod.getTeam());
+
+	if(team != nullptr) {
+		if(team->hasName()) {
+			entry.formattedAuthorNames.push_back(Utilities::toLowerCase(team->getName()));
+		}
+
+		for(const std::shared_ptr<ModTeamMember> & member : team->getMembers()) {
+			entry.formattedAuthorNames.push_back(Utilities::toLowerCase(member->getName()));
+
+			if(member->hasAlias()) {
+				entry.formattedAuthorNames.push_back(Utilities::toLowerCase(member->getAlias()));
+			}
+		}
+	}
+
+	return entry;
+}
+
+bool ModSearchIndex::isCandidate(const std::vector<const Mod *> & candidateMods, const Mod & mod) {
+	return std::binary_search(candidateMods.cbegin(), candidateMods.cend(), &mod);
+}
+
+bool ModSearchIndex::isEntryCurrent(const Entry & entry, const Mod & mod) {
+	if(entry.formattedVersionNames.size() != mod.numberOfVersions() ||
+	   entry.formattedVersionTypeNames.size() != mod.numberOfVersions()) {
+		return false;
+	}
+
+	for(size_t i = 0; i < mod.numberOfVersions(); i++) {
+		if(entry.formattedVersionTypeNames[i].size() != mod.getVersion(i)->numberOfTypes()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void ModSearchIndex::addTrigrams(std::string_view formattedValue, std::vector<uint32_t> & trigrams) {
+	if(formattedValue.length() < TRIGRAM_LENGTH) {
+		return;
+	}
+
+	for(size_t i = 0; i <= formattedValue.length() - TRIGRAM_LENGTH; i++) {
+		trigrams.push_back(static_cast<uint32_t>(static_cast<uint8_t>(formattedValue[i])) << 16 |
+						   static_cast<uint32_t>(static_cast<uint8_t>(formattedValue[i + 1])) << 8 |
+						   static_cast<uint32_t>(static_cast<uint8_t>(formattedValue[i + 2])));
+	}
+}
+
+std::vector<uint32_t> ModSearchIndex::getTrigrams(const Entry & entry) {
+	std::vector<uint32_t> trigrams;
+
+	addTrigrams(entry.formattedName, trigrams);
+
+	for(const std::string & formattedVersionName : entry.formattedVersionNames) {
+		addTrigrams(formattedVersionName, trigrams);
+	}
+
+	for(const std::vector<std::string> & formattedVersionTypeNames : entry.formattedVersionTypeNames) {
+		for(const std::string & formattedVersionTypeName : formattedVersionTypeNames) {
+			addTrigrams(formattedVersionTypeName, trigrams);
+		}
+	}
+
+	for(const std::string & formattedAuthorName : entry.formattedAuthorNames) {
+		addTrigrams(formattedAuthorName, trigrams);
+	}
+
+	std::sort(trigrams.begin(), trigrams.end());
+	trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+	return trigrams;
+}
+
+void ModSearchIndex::addFuzzyNames(const Mod & mod, const Entry & entry) {
+	size_t fuzzyNameModIndex = m_fuzzyNameMods.size();
+	m_fuzzyNameMods.push_back(&mod);
+	m_fuzzyNameModIndices[&mod] = fuzzyNameModIndex;
+
+	m_fuzzyNameTree.insertName(entry.formattedName, fuzzyNameModIndex);
+
+	for(const std::string & formattedAuthorName : entry.formattedAuthorNames) {
+		m_fuzzyNameTree.insertName(formattedAuthorName, fuzzyNameModIndex);
+
+		if(m_fuzzyAuthorNameIndices.find(formattedAuthorName) != m_fuzzyAuthorNameIndices.cend()) {
+			continue;
+		}
+
+		m_fuzzyAuthorNameIndices.emplace(formattedAuthorName, m_fuzzyAuthorNames.size());
+		m_fuzzyAuthorNameTree.insertName(formattedAuthorName, m_fuzzyAuthorNames.size());
+		m_fuzzyAuthorNames.push_back(formattedAuthorName);
+	}
+}
+
+void ModSearchIndex::rebuildFuzzyNameTree() {
+	m_fuzzyNameTree.clear();
+	m_fuzzyNameMods.clear();
+	m_fuzzyNameModIndices.clear();
+	m_fuzzyAuthorNameTree.clear();
+	m_fuzzyAuthorNames.clear();
+	m_fuzzyAuthorNameIndices.clear();
+	m_numberOfRemovedFuzzyNameMods = 0;
+
+	for(const std::pair<const Mod * const, Entry> & entry : m_entries) {
+		addFuzzyNames(*entry.first, entry.second);
+	}
+}
@@ -0,0 +1,66 @@
+#ifndef _MOD_SEARCH_INDEX_H_
+#define _MOD_SEARCH_INDEX_H_
+
+#include "BKTree.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class Mod;
+
+class ModSearchIndex final {
+public:
+	struct Entry {
+		std::string formattedName;
+		std::vector<std::string> formattedVersionNames;
+		std::vector<std::vector<std::string>> formattedVersionTypeNames;
+		std::vector<std::string> formattedAuthorNames;
+	};
+
+	ModSearchIndex();
+	ModSearchIndex(ModSearchIndex && i) noexcept;
+	ModSearchIndex(const ModSearchIndex & i);
+	ModSearchIndex & operator = (ModSearchIndex && i) noexcept;
+	ModSearchIndex & operator = (const ModSearchIndex & i);
+	~ModSearchIndex();
+
+	size_t numberOfMods() const;
+	bool hasMod(const Mod & mod) const;
+	const Entry * getEntry(const Mod & mod) const;
+	std::optional<std::vector<const Mod *>> getCandidateMods(std::string_view formattedQuery) const;
+	std::vector<std::pair<const Mod *, size_t>> getFuzzyMatchingMods(std::string_view formattedQuery, size_t maximumNumberOfMatches) const;
+	std::vector<std::pair<std::string_view, size_t>> getFuzzyMatchingAuthorNames(std::string_view formattedQuery, size_t maximumNumberOfMatches) const;
+	void addMod(const Mod & mod);
+	bool removeMod(const Mod & mod);
+	void updateMod(const Mod & mod);
+	void clear();
+
+	static Entry createEntry(const Mod & mod);
+	static bool isCandidate(const std::vector<const Mod *> & candidateMods, const Mod & mod);
+	static bool isEntryCurrent(const Entry & entry, const Mod & mod);
+
+	static constexpr size_t TRIGRAM_LENGTH = 3;
+
+private:
+	static void addTrigrams(std::string_view formattedValue, std::vector<uint32_t> & trigrams);
+	static std::vector<uint32_t> getTrigrams(const Entry & entry);
+	void addFuzzyNames(const Mod & mod, const Entry & entry);
+	void rebuildFuzzyNameTree();
+
+	std::unordered_map<const Mod *, Entry> m_entries;
+	std::unordered_map<uint32_t, std::vector<const Mod *>> m_postings;
+	BKTree m_fuzzyNameTree;
+	std::vector<const Mod *> m_fuzzyNameMods;
+	std::unordered_map<const Mod *, size_t> m_fuzzyNameModIndices;
+	BKTree m_fuzzyAuthorNameTree;
+	std::vector<std::string> m_fuzzyAuthorNames;
+	std::unordered_map<std::string, size_t> m_fuzzyAuthorNameIndices;
+	size_t m_numberOfRemovedFuzzyNameMods;
+};
+
+#endif // _MOD_SEARCH_INDEX_H_
@@ -714,7 +714,7 @@ bool ModTeam::operator == (const ModTeam & modTeam) const {
 		return true;
 	}
 
-	if(!Utilities::areStringsEqual(m_name, modTeam.m_name) ||
+	if(m_name != modTeam.m_name ||
 	   !Utilities::areStringsEqual(m_website, modTeam.m_website) ||
 	   !Utilities::areStringsEqual(m_moddbURL, modTeam.m_moddbURL) ||
 	   !Utilities::areStringsEqual(m_email, modTeam.m_email) ||
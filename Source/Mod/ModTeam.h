@@ -1,6 +1,7 @@
 #ifndef _MOD_TEAM_H_
 #define _MOD_TEAM_H_
 
+#include "InternedString.h"
 #include "Location.h"
 #include "ModTeamMember.h"
 
@@ -78,7 +79,7 @@ protected:
 	void updateParent();
 
 private:
-	std::string m_name;
+	InternedString m_name;
 	std::string m_website;
 	std::string m_moddbURL;
 	std::string m_email;
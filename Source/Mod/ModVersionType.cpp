@@ -214,7 +214,7 @@ size_t ModVersionType::indexOfGameVersionWithID(const std::string & gameVersionI
 
 size_t ModVersionType::indexOfGameVersion(const ModGameVersion & gameVersion) const {
 	for(size_t i = 0; i < m_gameVersions.size(); i++) {
-		if(Utilities::areStringsEqualIgnoreCase(m_gameVersions[i]->getGameVersionID(), gameVersion.getGameVersionID())) {
+		if(m_gameVersions[i]->getInternedGameVersionID().equalsIgnoreCase(gameVersion.getInternedGameVersionID())) {
 			return i;
 		}
 	}
@@ -244,6 +244,20 @@ std::shared_ptr<ModGameVersion> ModVersionType::getGameVersionWithID(const std::
 	return nullptr;
 }
 
+std::shared_ptr<ModGameVersion> ModVersionType::getGameVersionWithID(const InternedString & gameVersionID) const {
+	if(gameVersionID.empty()) {
+		return nullptr;
+	}
+
+	for(std::vector<std::shared_ptr<ModGameVersion>>::const_iterator i = m_gameVersions.begin(); i != m_gameVersions.end(); ++i) {
+		if((*i)->getInternedGameVersionID().equalsIgnoreCase(gameVersionID)) {
+			return *i;
+		}
+	}
+
+	return nullptr;
+}
+
 const std::vector<std::shared_ptr<ModGameVersion>> & ModVersionType::getGameVersions() const {
 	return m_gameVersions;
 }
@@ -330,6 +344,14 @@ bool ModVersionType::isDependencyOf(const ModVersionType & modVersionType, const
 	}
 
 	if(recursiveCheck) {
+		if(mods != nullptr) {
+			std::shared_ptr<const ModDependencyGraph> dependencyGraph(mods->getDependencyGraph());
+
+			if(dependencyGraph->hasNode(*this) && dependencyGraph->hasNode(modVersionType)) {
+				return dependencyGraph->isDependencyOf(*this, modVersionType, true);
+			}
+		}
+
 		if(!ModCollection::isValid(mods, nullptr, true)) {
 			spdlog::warn("Cannot recursively check mod version type dependencies, invalid mod collection provided.");
 			return false;
@@ -1,6 +1,8 @@
 #ifndef _MOD_VERSION_TYPE_H_
 #define _MOD_VERSION_TYPE_H_
 
+#include "InternedString.h"
+
 #include <rapidjson/document.h>
 
 #include <cstdint>
@@ -49,6 +51,7 @@ public:
 	size_t indexOfGameVersion(const ModGameVersion & gameVersion) const;
 	std::shared_ptr<ModGameVersion> getGameVersion(size_t index) const;
 	std::shared_ptr<ModGameVersion> getGameVersionWithID(const std::string & gameVersionID) const;
+	std::shared_ptr<ModGameVersion> getGameVersionWithID(const InternedString & gameVersionID) const;
 	const std::vector<std::shared_ptr<ModGameVersion>> & getGameVersions() const;
 	bool addGameVersion(const ModGameVersion & gameVersion);
 	bool removeGameVersion(size_t index);
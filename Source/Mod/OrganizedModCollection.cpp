@@ -18,12 +18,22 @@
 
 #include <magic_enum/magic_enum.hpp>
 
+#include <algorithm>
+#include <bitset>
+#include <numeric>
 #include <sstream>
 
 const OrganizedModCollection::FilterType OrganizedModCollection::DEFAULT_FILTER_TYPE = FilterType::None;
 const OrganizedModCollection::SortType OrganizedModCollection::DEFAULT_SORT_TYPE = SortType::Name;
 const OrganizedModCollection::SortDirection OrganizedModCollection::DEFAULT_SORT_DIRECTION = SortDirection::Ascending;
 
+template <typename T>
+static void shuffleItems(std::vector<T> & items) {
+	for(size_t i = items.size(); i > 1; i--) {
+		std::swap(items[i - 1], items[Utilities::randomInteger(0, static_cast<int>(i - 1))]);
+	}
+}
+
 OrganizedModCollection::OrganizedModCollection(std::shared_ptr<ModCollection> mods, std::shared_ptr<FavouriteModCollection> favourites, std::shared_ptr<GameVersionCollection> gameVersions)
 	: m_localMode(false)
 	, m_filterType(OrganizedModCollection::DEFAULT_FILTER_TYPE)
@@ -34,10 +44,12 @@ OrganizedModCollection::OrganizedModCollection(std::shared_ptr<ModCollection> mo
 	, m_gameVersions(gameVersions) {
 	if(m_mods != nullptr) {
 		m_modCollectionUpdatedConnection = m_mods->updated.connect(std::bind(&OrganizedModCollection::onModCollectionUpdated, this, std::placeholders::_1));
+		m_modCollectionModModifiedConnection = m_mods->modModified.connect(std::bind(&OrganizedModCollection::onModCollectionModModified, this, std::placeholders::_1, std::placeholders::_2));
 
 		updateGameVersionList();
 		updateTeamList();
 		updateAuthorList();
+		updateModSortKeys();
 	}
 
 	if(m_favouriteMods != nullptr) {
@@ -62,13 +74,25 @@ OrganizedModCollection::OrganizedModCollection(OrganizedModCollection && m) noex
 	, m_favouriteMods(m.m_favouriteMods == nullptr ? nullptr : std::move(m.m_favouriteMods))
 	, m_gameVersions(m.m_gameVersions == nullptr ? nullptr : std::move(m.m_gameVersions))
 	, m_organizedMods(std::move(m.m_organizedMods))
+	, m_organizedModIndices(std::move(m.m_organizedModIndices))
+	, m_modSortKeys(std::move(m.m_modSortKeys))
+	, m_modFilterMask(std::move(m.m_modFilterMask))
+	, m_sortedModIndices(std::move(m.m_sortedModIndices))
 	, m_organizedGameVersions(std::move(m.m_organizedGameVersions))
 	, m_teams(std::move(m.m_teams))
 	, m_authors(std::move(m.m_authors))
+	, m_teamIndex(std::move(m.m_teamIndex))
+	, m_authorIndex(std::move(m.m_authorIndex))
+	, m_modTeamKeys(std::move(m.m_modTeamKeys))
+	, m_modAuthorKeys(std::move(m.m_modAuthorKeys))
+	, m_gameVersionModBitsets(std::move(m.m_gameVersionModBitsets))
+	, m_gameVersionSupportedModCountMap(std::move(m.m_gameVersionSupportedModCountMap))
+	, m_gameVersionCompatibleModCountMap(std::move(m.m_gameVersionCompatibleModCountMap))
 	, m_selectedTeam(m.m_selectedTeam == nullptr ? nullptr : std::move(m.m_selectedTeam))
 	, m_selectedAuthor(m.m_selectedAuthor == nullptr ? nullptr : std::move(m.m_selectedAuthor)) {
 	if(m_mods != nullptr) {
 		m_modCollectionUpdatedConnection = m_mods->updated.connect(std::bind(&OrganizedModCollection::onModCollectionUpdated, this, std::placeholders::_1));
+		m_modCollectionModModifiedConnection = m_mods->modModified.connect(std::bind(&OrganizedModCollection::onModCollectionModModified, this, std::placeholders::_1, std::placeholders::_2));
 	}
 
 	if(m_favouriteMods != nullptr) {
@@ -92,10 +116,12 @@ OrganizedModCollection::OrganizedModCollection(const OrganizedModCollection & m)
 	, m_gameVersions(m.m_gameVersions) {
 	if(m_mods != nullptr) {
 		m_modCollectionUpdatedConnection = m_mods->updated.connect(std::bind(&OrganizedModCollection::onModCollectionUpdated, this, std::placeholders::_1));
+		m_modCollectionModModifiedConnection = m_mods->modModified.connect(std::bind(&OrganizedModCollection::onModCollectionModModified, this, std::placeholders::_1, std::placeholders::_2));
 
 		updateGameVersionList();
 		updateTeamList();
 		updateAuthorList();
+		updateModSortKeys();
 
 		m_selectedTeam = m.m_selectedTeam == nullptr ? nullptr : getTeamInfo(m.m_selectedTeam->getName());
 		m_selectedAuthor = m.m_selectedAuthor == nullptr ? nullptr : getAuthorInfo(m.m_selectedAuthor->getName());
@@ -116,6 +142,7 @@ OrganizedModCollection::OrganizedModCollection(const OrganizedModCollection & m)
 OrganizedModCollection & OrganizedModCollection::operator = (OrganizedModCollection && m) noexcept {
 	if(this != &m) {
 		m_modCollectionUpdatedConnection.disconnect();
+		m_modCollectionModModifiedConnection.disconnect();
 		m_favouriteModCollectionUpdatedConnection.disconnect();
 		m_gameVersionCollectionSizeChangedConnection.disconnect();
 		m_gameVersionCollectionItemModifiedConnection.disconnect();
@@ -130,11 +157,22 @@ OrganizedModCollection & OrganizedModCollection::operator = (OrganizedModCollect
 		m_gameVersions = m.m_gameVersions == nullptr ? nullptr : std::move(m.m_gameVersions);
 		m_teams = std::move(m.m_teams);
 		m_authors = std::move(m.m_authors);
+		m_teamIndex = std::move(m.m_teamIndex);
+		m_authorIndex = std::move(m.m_authorIndex);
+		m_modTeamKeys = std::move(m.m_modTeamKeys);
+		m_modAuthorKeys = std::move(m.m_modAuthorKeys);
+		m_modSortKeys = std::move(m.m_modSortKeys);
+		m_modFilterMask = std::move(m.m_modFilterMask);
+		m_sortedModIndices = std::move(m.m_sortedModIndices);
+		m_gameVersionModBitsets = std::move(m.m_gameVersionModBitsets);
+		m_gameVersionSupportedModCountMap = std::move(m.m_gameVersionSupportedModCountMap);
+		m_gameVersionCompatibleModCountMap = std::move(m.m_gameVersionCompatibleModCountMap);
 		m_selectedTeam = m.m_selectedTeam == nullptr ? nullptr : std::move(m.m_selectedTeam);
 		m_selectedAuthor = m.m_selectedAuthor == nullptr ? nullptr : std::move(m.m_selectedAuthor);
 
 		if(m_mods != nullptr) {
 			m_modCollectionUpdatedConnection = m_mods->updated.connect(std::bind(&OrganizedModCollection::onModCollectionUpdated, this, std::placeholders::_1));
+			m_modCollectionModModifiedConnection = m_mods->modModified.connect(std::bind(&OrganizedModCollection::onModCollectionModModified, this, std::placeholders::_1, std::placeholders::_2));
 		}
 
 		if(m_favouriteMods != nullptr) {
@@ -152,12 +190,17 @@ OrganizedModCollection & OrganizedModCollection::operator = (OrganizedModCollect
 
 OrganizedModCollection & OrganizedModCollection::operator = (const OrganizedModCollection & m) {
 	m_modCollectionUpdatedConnection.disconnect();
+	m_modCollectionModModifiedConnection.disconnect();
 	m_favouriteModCollectionUpdatedConnection.disconnect();
 	m_gameVersionCollectionSizeChangedConnection.disconnect();
 	m_gameVersionCollectionItemModifiedConnection.disconnect();
 
 	m_teams.clear();
 	m_authors.clear();
+	m_teamIndex.clear();
+	m_authorIndex.clear();
+	m_modTeamKeys.clear();
+	m_modAuthorKeys.clear();
 
 	m_localMode = m.m_localMode;
 	m_filterType = m.m_filterType;
@@ -172,10 +215,12 @@ OrganizedModCollection & OrganizedModCollection::operator = (const OrganizedModC
 
 	if(m_mods != nullptr) {
 		m_modCollectionUpdatedConnection = m_mods->updated.connect(std::bind(&OrganizedModCollection::onModCollectionUpdated, this, std::placeholders::_1));
+		m_modCollectionModModifiedConnection = m_mods->modModified.connect(std::bind(&OrganizedModCollection::onModCollectionModModified, this, std::placeholders::_1, std::placeholders::_2));
 
 		updateGameVersionList();
 		updateTeamList();
 		updateAuthorList();
+		updateModSortKeys();
 
 		if(m.m_selectedTeam != nullptr) {
 			m_selectedTeam = getTeamInfo(m.m_selectedTeam->getName());
@@ -202,6 +247,7 @@ OrganizedModCollection & OrganizedModCollection::operator = (const OrganizedModC
 
 OrganizedModCollection::~OrganizedModCollection() {
 	m_modCollectionUpdatedConnection.disconnect();
+	m_modCollectionModModifiedConnection.disconnect();
 	m_favouriteModCollectionUpdatedConnection.disconnect();
 	m_gameVersionCollectionSizeChangedConnection.disconnect();
 	m_gameVersionCollectionItemModifiedConnection.disconnect();
@@ -376,15 +422,18 @@ void OrganizedModCollection::setModCollection(std::shared_ptr<ModCollection> mod
 	bool shouldOrganize = m_mods != mods;
 
 	m_modCollectionUpdatedConnection.disconnect();
+	m_modCollectionModModifiedConnection.disconnect();
 
 	m_mods = mods;
 
 	if(m_mods != nullptr) {
 		m_modCollectionUpdatedConnection = m_mods->updated.connect(std::bind(&OrganizedModCollection::onModCollectionUpdated, this, std::placeholders::_1));
+		m_modCollectionModModifiedConnection = m_mods->modModified.connect(std::bind(&OrganizedModCollection::onModCollectionModModified, this, std::placeholders::_1, std::placeholders::_2));
 
 		updateGameVersionList();
 		updateTeamList();
 		updateAuthorList();
+		updateModSortKeys();
 	}
 
 	if(shouldOrganize) {
@@ -429,6 +478,8 @@ void OrganizedModCollection::setGameVersionCollection(std::shared_ptr<GameVersio
 		m_gameVersionCollectionItemModifiedConnection = gameVersions->itemModified.connect(std::bind(&OrganizedModCollection::onGameVersionCollectionItemModified, this, std::placeholders::_1, std::placeholders::_2));
 	}
 
+	updateGameVersionModCounts();
+
 	if(shouldOrganize) {
 		organize();
 	}
@@ -822,6 +873,18 @@ size_t OrganizedModCollection::indexOfMod(const Mod & mod) const {
 	return std::numeric_limits<size_t>::max();
 }
 
+size_t OrganizedModCollection::indexOfOrganizedMod(const Mod & mod) const {
+	std::unordered_map<const Mod *, size_t>::const_iterator organizedModIndexIterator(m_organizedModIndices.find(&mod));
+
+	if(organizedModIndexIterator == m_organizedModIndices.cend() ||
+	   organizedModIndexIterator->second >= m_organizedMods.size() ||
+	   m_organizedMods[organizedModIndexIterator->second].get() != &mod) {
+		return std::numeric_limits<size_t>::max();
+	}
+
+	return organizedModIndexIterator->second;
+}
+
 size_t OrganizedModCollection::indexOfModWithID(const std::string & id) const {
 	if(id.empty()) {
 		return std::numeric_limits<size_t>::max();
@@ -1197,13 +1260,7 @@ bool OrganizedModCollection::hasTeamInfo(const std::string & name) const {
 		return false;
 	}
 
-	for(std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator i = m_teams.begin(); i != m_teams.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			return true;
-		}
-	}
-
-	return false;
+	return m_teamIndex.find(createModAuthorIndexKey(name)) != m_teamIndex.cend();
 }
 
 size_t OrganizedModCollection::indexOfTeamInfo(const ModAuthorInformation & teamInfo) const {
@@ -1211,13 +1268,19 @@ size_t OrganizedModCollection::indexOfTeamInfo(const ModAuthorInformation & team
 }
 
 size_t OrganizedModCollection::indexOfTeamInfo(const std::string & name) const {
-	for(std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator i = m_teams.begin(); i != m_teams.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			return i - m_teams.begin();
-		}
+	std::shared_ptr<ModAuthorInformation> teamInfo(getTeamInfo(name));
+
+	if(teamInfo == nullptr) {
+		return std::numeric_limits<size_t>::max();
 	}
 
-	return std::numeric_limits<size_t>::max();
+	std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator teamInfoIterator(std::find(m_teams.cbegin(), m_teams.cend(), teamInfo));
+
+	if(teamInfoIterator == m_teams.cend()) {
+		return std::numeric_limits<size_t>::max();
+	}
+
+	return teamInfoIterator - m_teams.cbegin();
 }
 
 std::shared_ptr<ModAuthorInformation> OrganizedModCollection::getTeamInfo(size_t index) const {
@@ -1233,13 +1296,13 @@ std::shared_ptr<ModAuthorInformation> OrganizedModCollection::getTeamInfo(const
 		return nullptr;
 	}
 
-	for(std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator i = m_teams.begin(); i != m_teams.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			return *i;
-		}
+	std::unordered_map<InternedString, ModAuthorIndexEntry>::const_iterator teamIndexEntryIterator(m_teamIndex.find(createModAuthorIndexKey(name)));
+
+	if(teamIndexEntryIterator == m_teamIndex.cend()) {
+		return nullptr;
 	}
 
-	return nullptr;
+	return teamIndexEntryIterator->second.information;
 }
 
 void OrganizedModCollection::incrementTeamModCount(size_t index) {
@@ -1255,14 +1318,15 @@ void OrganizedModCollection::incrementTeamModCount(const std::string & name) {
 		return;
 	}
 
-	for(std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator i = m_teams.begin(); i != m_teams.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			(*i)->incrementModCount();
-			return;
-		}
+	ModAuthorIndexEntry & teamIndexEntry = m_teamIndex[createModAuthorIndexKey(name)];
+
+	if(teamIndexEntry.information != nullptr) {
+		teamIndexEntry.information->incrementModCount();
+		return;
 	}
 
-	m_teams.push_back(std::make_shared<ModAuthorInformation>(name));
+	teamIndexEntry.information = std::make_shared<ModAuthorInformation>(name);
+	m_teams.push_back(teamIndexEntry.information);
 }
 
 bool OrganizedModCollection::hasSelectedTeam() const {
@@ -1374,13 +1438,7 @@ bool OrganizedModCollection::hasAuthorInfo(const std::string & name) const {
 		return false;
 	}
 
-	for(std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator i = m_authors.begin(); i != m_authors.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			return true;
-		}
-	}
-
-	return false;
+	return m_authorIndex.find(createModAuthorIndexKey(name)) != m_authorIndex.cend();
 }
 
 size_t OrganizedModCollection::indexOfAuthorInfo(const ModAuthorInformation & authorInfo) const {
@@ -1388,13 +1446,19 @@ size_t OrganizedModCollection::indexOfAuthorInfo(const ModAuthorInformation & au
 }
 
 size_t OrganizedModCollection::indexOfAuthorInfo(const std::string & name) const {
-	for(std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator i = m_authors.begin(); i != m_authors.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			return i - m_authors.begin();
-		}
+	std::shared_ptr<ModAuthorInformation> authorInfo(getAuthorInfo(name));
+
+	if(authorInfo == nullptr) {
+		return std::numeric_limits<size_t>::max();
 	}
 
-	return std::numeric_limits<size_t>::max();
+	std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator authorInfoIterator(std::find(m_authors.cbegin(), m_authors.cend(), authorInfo));
+
+	if(authorInfoIterator == m_authors.cend()) {
+		return std::numeric_limits<size_t>::max();
+	}
+
+	return authorInfoIterator - m_authors.cbegin();
 }
 
 std::shared_ptr<ModAuthorInformation> OrganizedModCollection::getAuthorInfo(size_t index) const {
@@ -1410,13 +1474,13 @@ std::shared_ptr<ModAuthorInformation> OrganizedModCollection::getAuthorInfo(cons
 		return nullptr;
 	}
 
-	for(std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator i = m_authors.begin(); i != m_authors.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			return *i;
-		}
+	std::unordered_map<InternedString, ModAuthorIndexEntry>::const_iterator authorIndexEntryIterator(m_authorIndex.find(createModAuthorIndexKey(name)));
+
+	if(authorIndexEntryIterator == m_authorIndex.cend()) {
+		return nullptr;
 	}
 
-	return nullptr;
+	return authorIndexEntryIterator->second.information;
 }
 
 void OrganizedModCollection::incrementAuthorModCount(size_t index) {
@@ -1432,15 +1496,15 @@ void OrganizedModCollection::incrementAuthorModCount(const std::string & name) {
 		return;
 	}
 
-	for(std::vector<std::shared_ptr<ModAuthorInformation>>::const_iterator i = m_authors.begin(); i != m_authors.end(); ++i) {
-		if(Utilities::areStringsEqualIgnoreCase((*i)->getName(), name)) {
-			(*i)->incrementModCount();
+	ModAuthorIndexEntry & authorIndexEntry = m_authorIndex[createModAuthorIndexKey(name)];
 
-			return;
-		}
+	if(authorIndexEntry.information != nullptr) {
+		authorIndexEntry.information->incrementModCount();
+		return;
 	}
 
-	m_authors.push_back(std::make_shared<ModAuthorInformation>(name));
+	authorIndexEntry.information = std::make_shared<ModAuthorInformation>(name);
+	m_authors.push_back(authorIndexEntry.information);
 }
 
 bool OrganizedModCollection::hasSelectedAuthor() const {
@@ -1547,10 +1611,15 @@ void OrganizedModCollection::onModCollectionUpdated(ModCollection & mods) {
 	updateGameVersionModCounts();
 	updateTeamList();
 	updateAuthorList();
+	updateModSortKeys();
 
 	organize();
 }
 
+void OrganizedModCollection::onModCollectionModModified(ModCollection & mods, Mod & mod) {
+	updateMod(mod);
+}
+
 void OrganizedModCollection::onFavouriteModCollectionUpdated(FavouriteModCollection & favouriteMods) {
 	if(m_filterType == FilterType::Favourites) {
 		organize();
@@ -1583,13 +1652,113 @@ void OrganizedModCollection::organize() {
 	sort();
 }
 
+void OrganizedModCollection::updateMod(const Mod & mod) {
+	if(m_mods == nullptr) {
+		return;
+	}
+
+	size_t modIndex = m_mods->indexOfMod(mod);
+
+	if(modIndex == std::numeric_limits<size_t>::max()) {
+		return;
+	}
+
+	if(m_selectedMod != nullptr && m_selectedMod.get() != &mod && Utilities::areStringsEqualIgnoreCase(m_selectedMod->getID(), mod.getID())) {
+		// the mod was swapped out for a new instance, the selection still refers to the same mod
+		m_selectedMod = m_mods->getMod(modIndex);
+	}
+
+	updateGameVersionModBitsetsForMod(mod, modIndex);
+	updateModAuthorIndices(mod, modIndex);
+
+	if(m_modSortKeys.size() != m_mods->numberOfMods()) {
+		updateModSortKeys();
+	}
+	else {
+		m_modSortKeys[modIndex] = createModSortKey(mod);
+
+		for(std::pair<const std::pair<SortType, SortDirection>, std::vector<size_t>> & sortedModIndices : m_sortedModIndices) {
+			std::vector<size_t>::iterator sortedModIndexIterator(std::find(sortedModIndices.second.begin(), sortedModIndices.second.end(), modIndex));
+
+			if(sortedModIndexIterator == sortedModIndices.second.end()) {
+				continue;
+			}
+
+			sortedModIndices.second.erase(sortedModIndexIterator);
+
+			sortedModIndices.second.insert(std::upper_bound(sortedModIndices.second.begin(), sortedModIndices.second.end(), modIndex, [this, &sortedModIndices](size_t modIndexA, size_t modIndexB) {
+				return isModSortedBefore(modIndexA, modIndexB, sortedModIndices.first.first, sortedModIndices.first.second);
+			}), modIndex);
+		}
+	}
+
+	updateOrganizedMod(mod, modIndex);
+}
+
+void OrganizedModCollection::updateModDownloadStatus(const Mod & mod) {
+	if(m_mods == nullptr || m_filterType != FilterType::Downloaded) {
+		return;
+	}
+
+	size_t modIndex = m_mods->indexOfMod(mod);
+
+	if(modIndex == std::numeric_limits<size_t>::max()) {
+		return;
+	}
+
+	updateOrganizedMod(mod, modIndex);
+}
+
+void OrganizedModCollection::updateOrganizedMod(const Mod & mod, size_t modIndex) {
+	if(m_filterType == FilterType::Favourites || !shouldDisplayMods()) {
+		return;
+	}
+
+	if(m_modFilterMask.size() != m_mods->numberOfMods()) {
+		organize();
+		return;
+	}
+
+	bool modIncluded = isModIncludedByFilter(mod, modIndex);
+
+	if(m_sortType == SortType::Random) {
+		// match by identifier rather than by instance, since the mod may have been swapped out for a new instance
+		std::vector<std::shared_ptr<Mod>>::iterator organizedModIterator(std::find_if(m_organizedMods.begin(), m_organizedMods.end(), [&mod](const std::shared_ptr<Mod> & organizedMod) {
+			return organizedMod.get() == &mod || Utilities::areStringsEqualIgnoreCase(organizedMod->getID(), mod.getID());
+		}));
+
+		if(!modIncluded && organizedModIterator != m_organizedMods.end()) {
+			m_organizedMods.erase(organizedModIterator);
+		}
+		else if(modIncluded && organizedModIterator == m_organizedMods.end()) {
+			m_organizedMods.push_back(m_mods->getMod(modIndex));
+		}
+		else if(modIncluded) {
+			*organizedModIterator = m_mods->getMod(modIndex);
+		}
+
+		updateOrganizedModIndices();
+
+		m_modFilterMask[modIndex] = modIncluded;
+	}
+	else {
+		m_modFilterMask[modIndex] = modIncluded;
+
+		sortMods();
+	}
+
+	organizedModCollectionChanged(m_organizedMods);
+}
+
 void OrganizedModCollection::applyFilter() {
 	if(m_mods == nullptr) {
 		return;
 	}
 
 	m_organizedMods.clear();
+	m_organizedModIndices.clear();
 	m_organizedFavouriteMods.clear();
+	m_modFilterMask.assign(m_mods->numberOfMods(), false);
 
 	if(m_filterType == FilterType::Favourites &&
 	   (m_favouriteMods == nullptr || m_favouriteMods->numberOfFavourites() == 0)) {
@@ -1601,151 +1770,148 @@ void OrganizedModCollection::applyFilter() {
 		return;
 	}
 
-	switch(m_filterType) {
-		case FilterType::None: {
-			for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-				m_organizedMods.push_back(m_mods->getMod(i));
-			}
-
-			break;
-		}
+	const std::vector<uint64_t> * gameVersionModBitset = nullptr;
 
-		case FilterType::Favourites: {
-			for(size_t i = 0; i < m_favouriteMods->numberOfFavourites(); i++) {
-				m_organizedFavouriteMods.push_back(m_favouriteMods->getFavourite(i));
-			}
+	if(m_selectedGameVersion != nullptr && (m_filterType == FilterType::SupportedGameVersions || m_filterType == FilterType::CompatibleGameVersions)) {
+		gameVersionModBitset = getGameVersionModBitset(*m_selectedGameVersion, m_filterType == FilterType::CompatibleGameVersions);
+	}
 
-			break;
-		}
+	bool useModAuthorIndex = isModAuthorIndexCurrent() && ((m_filterType == FilterType::Teams && m_selectedTeam != nullptr) || (m_filterType == FilterType::Authors && m_selectedAuthor != nullptr));
+	const std::vector<size_t> * indexedModIndices = nullptr;
 
-		case FilterType::Downloaded: {
-			if(m_localMode || m_downloadManager != nullptr) {
-				std::shared_ptr<Mod> mod;
+	if(useModAuthorIndex) {
+		indexedModIndices = m_filterType == FilterType::Teams ? getIndexedModIndices(m_teamIndex, m_selectedTeam->getName()) : getIndexedModIndices(m_authorIndex, m_selectedAuthor->getName());
+	}
 
-				for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-					mod = m_mods->getMod(i);
+	if(m_filterType == FilterType::Favourites) {
+		for(size_t i = 0; i < m_favouriteMods->numberOfFavourites(); i++) {
+			m_organizedFavouriteMods.push_back(m_favouriteMods->getFavourite(i));
+		}
+	}
+	else if(gameVersionModBitset != nullptr) {
+		for(size_t i = 0; i < gameVersionModBitset->size(); i++) {
+			uint64_t modBits = (*gameVersionModBitset)[i];
 
-					if(m_localMode || m_downloadManager->isModDownloaded(*mod)) {
-						m_organizedMods.push_back(mod);
-					}
+			for(size_t j = 0; modBits != 0; j++, modBits >>= 1) {
+				if((modBits & 1) != 0) {
+					m_modFilterMask[(i * 64) + j] = true;
+					m_organizedMods.push_back(m_mods->getMod((i * 64) + j));
 				}
 			}
+		}
+	}
+	else if(useModAuthorIndex) {
+		if(indexedModIndices != nullptr) {
+			for(size_t modIndex : *indexedModIndices) {
+				m_modFilterMask[modIndex] = true;
+				m_organizedMods.push_back(m_mods->getMod(modIndex));
+			}
+		}
+	}
+	else {
+		std::shared_ptr<Mod> mod;
 
-			break;
+		for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
+			mod = m_mods->getMod(i);
+
+			if(isModIncludedByFilter(*mod, i)) {
+				m_modFilterMask[i] = true;
+				m_organizedMods.push_back(mod);
+			}
 		}
+	}
 
-		case FilterType::SupportedGameVersions: {
-			if(m_selectedGameVersion != nullptr) {
-				std::shared_ptr<Mod> mod;
+	updateOrganizedModIndices();
 
-				for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-					mod = m_mods->getMod(i);
+	organizedModCollectionChanged(m_organizedMods);
+}
 
-					if(mod->isGameVersionSupported(*m_selectedGameVersion)) {
-						m_organizedMods.push_back(mod);
-					}
-				}
-			}
+bool OrganizedModCollection::isModIncludedByFilter(const Mod & mod, size_t modIndex) const {
+	switch(m_filterType) {
+		case FilterType::None: {
+			return true;
+		}
 
-			break;
+		case FilterType::Favourites: {
+			return false;
 		}
 
+		case FilterType::Downloaded: {
+			return m_localMode || (m_downloadManager != nullptr && m_downloadManager->isModDownloaded(mod));
+		}
+
+		case FilterType::SupportedGameVersions:
 		case FilterType::CompatibleGameVersions: {
-			if(m_selectedGameVersion != nullptr) {
-				std::shared_ptr<Mod> mod;
+			if(m_selectedGameVersion == nullptr) {
+				return false;
+			}
 
-				for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-					mod = m_mods->getMod(i);
+			bool compatible = m_filterType == FilterType::CompatibleGameVersions;
+			const std::vector<uint64_t> * gameVersionModBitset = getGameVersionModBitset(*m_selectedGameVersion, compatible);
 
-					if(mod->isGameVersionCompatible(*m_selectedGameVersion)) {
-						m_organizedMods.push_back(mod);
-					}
-				}
+			if(gameVersionModBitset != nullptr) {
+				return isModBitSet(*gameVersionModBitset, modIndex);
 			}
 
-			break;
+			return compatible ? mod.isGameVersionCompatible(*m_selectedGameVersion) : mod.isGameVersionSupported(*m_selectedGameVersion);
 		}
 
 		case FilterType::StandAlone: {
-			std::shared_ptr<Mod> mod;
-
-			for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-				mod = m_mods->getMod(i);
-
-				if(mod->isStandAlone()) {
-					m_organizedMods.push_back(mod);
-				}
-			}
-
-			break;
+			return mod.isStandAlone();
 		}
 
 		case FilterType::HasDependencies: {
-			std::shared_ptr<Mod> mod;
-
-			for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-				mod = m_mods->getMod(i);
-
-				if(mod->hasDependencies()) {
-					m_organizedMods.push_back(mod);
-				}
-			}
-
-			break;
+			return mod.hasDependencies();
 		}
 
 		case FilterType::OfficialExpansion: {
-			std::shared_ptr<Mod> mod;
+			return mod.isOfficialExpansion();
+		}
 
-			for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-				mod = m_mods->getMod(i);
+		case FilterType::Teams: {
+			if(m_selectedTeam == nullptr) {
+				return false;
+			}
 
-				if(mod->isOfficialExpansion()) {
-					m_organizedMods.push_back(mod);
-				}
+			if(isModAuthorIndexCurrent()) {
+				const std::vector<size_t> * teamModIndices = getIndexedModIndices(m_teamIndex, m_selectedTeam->getName());
+
+				return teamModIndices != nullptr && std::binary_search(teamModIndices->cbegin(), teamModIndices->cend(), modIndex);
 			}
 
-			break;
+			std::shared_ptr<ModTeam> team(mod.getTeam());
+
+			return team != nullptr && Utilities::areStringsEqual(team->getName(), m_selectedTeam->getName());
 		}
 
-		case FilterType::Teams: {
-			if(m_selectedTeam != nullptr) {
-				std::shared_ptr<ModTeam> team;
+		case FilterType::Authors: {
+			if(m_selectedAuthor == nullptr) {
+				return false;
+			}
 
-				for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-					team = m_mods->getMod(i)->getTeam();
+			if(isModAuthorIndexCurrent()) {
+				const std::vector<size_t> * authorModIndices = getIndexedModIndices(m_authorIndex, m_selectedAuthor->getName());
 
-					if(team != nullptr && Utilities::areStringsEqual(team->getName(), m_selectedTeam->getName())) {
-						m_organizedMods.push_back(m_mods->getMod(i));
-					}
-				}
+				return authorModIndices != nullptr && std::binary_search(authorModIndices->cbegin(), authorModIndices->cend(), modIndex);
 			}
 
-			break;
-		}
+			std::shared_ptr<ModTeam> team(mod.getTeam());
 
-		case FilterType::Authors: {
-			if(m_selectedAuthor != nullptr) {
-				std::shared_ptr<ModTeam> team;
-
-				for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-					team = m_mods->getMod(i)->getTeam();
-
-					if(team != nullptr && team->numberOfMembers() != 0) {
-						for(size_t j=0;j<team->numberOfMembers();j++) {
-							if(Utilities::areStringsEqual(team->getMember(j)->getName(), m_selectedAuthor->getName())) {
-								m_organizedMods.push_back(m_mods->getMod(i));
-							}
-						}
-					}
+			if(team == nullptr) {
+				return false;
+			}
+
+			for(size_t i = 0; i < team->numberOfMembers(); i++) {
+				if(Utilities::areStringsEqual(team->getMember(i)->getName(), m_selectedAuthor->getName())) {
+					return true;
 				}
 			}
 
-			break;
+			return false;
 		}
 	}
 
-	organizedModCollectionChanged(m_organizedMods);
+	return false;
 }
 
 void OrganizedModCollection::sort() {
@@ -1761,8 +1927,8 @@ void OrganizedModCollection::sort() {
 		case FilterType::StandAlone:
 		case FilterType::HasDependencies:
 		case FilterType::OfficialExpansion: {
-			m_organizedMods = mergeSortMods(m_organizedMods);
-			m_organizedGameVersions = mergeSortGameVersions(m_organizedGameVersions);
+			sortMods();
+			sortGameVersions();
 
 			organizedModCollectionChanged(m_organizedMods);
 			organizedModGameVersionCollectionChanged(m_organizedGameVersions);
@@ -1770,7 +1936,7 @@ void OrganizedModCollection::sort() {
 			break;
 		}
 		case FilterType::Favourites: {
-			m_organizedFavouriteMods = mergeSortModIdentifiers(m_organizedFavouriteMods);
+			sortModIdentifiers();
 
 			organizedFavouriteModCollectionChanged(m_organizedFavouriteMods);
 
@@ -1778,12 +1944,12 @@ void OrganizedModCollection::sort() {
 		}
 		case FilterType::Teams: {
 			if(m_selectedTeam == nullptr) {
-				m_teams = mergeSortAuthors(m_teams);
+				sortAuthors(m_teams);
 
 				organizedModTeamCollectionChanged(m_teams);
 			}
 			else {
-				m_organizedMods = mergeSortMods(m_organizedMods);
+				sortMods();
 
 				organizedModCollectionChanged(m_organizedMods);
 			}
@@ -1792,12 +1958,12 @@ void OrganizedModCollection::sort() {
 		}
 		case FilterType::Authors: {
 			if(m_selectedAuthor == nullptr) {
-				m_authors = mergeSortAuthors(m_authors);
+				sortAuthors(m_authors);
 
 				organizedModAuthorCollectionChanged(m_authors);
 			}
 			else {
-				m_organizedMods = mergeSortMods(m_organizedMods);
+				sortMods();
 
 				organizedModCollectionChanged(m_organizedMods);
 			}
@@ -1807,558 +1973,664 @@ void OrganizedModCollection::sort() {
 	}
 }
 
-void OrganizedModCollection::updateGameVersionList() {
-	if(m_gameVersions == nullptr) {
+void OrganizedModCollection::updateModSortKeys() {
+	m_modSortKeys.clear();
+	m_sortedModIndices.clear();
+
+	if(m_mods == nullptr) {
 		return;
 	}
 
-	m_organizedGameVersions.clear();
+	m_modSortKeys.reserve(m_mods->numberOfMods());
 
-	for(size_t i = 0; i < m_gameVersions->numberOfGameVersions(); i++) {
-		m_organizedGameVersions.push_back(m_gameVersions->getGameVersion(i));
+	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
+		m_modSortKeys.push_back(createModSortKey(*m_mods->getMod(i)));
 	}
+}
 
-	updateGameVersionModCounts();
-
-	organizedModGameVersionCollectionChanged(m_organizedGameVersions);
+OrganizedModCollection::ModSortKey OrganizedModCollection::createModSortKey(const Mod & mod) {
+	return ModSortKey({
+		Utilities::toLowerCase(mod.getName()),
+		mod.getInitialReleaseDate(),
+		mod.getLatestReleaseDate(),
+		mod.numberOfVersions()
+	});
 }
 
-void OrganizedModCollection::updateTeamList() {
-	if(m_mods == nullptr) {
-		return;
+const std::vector<size_t> & OrganizedModCollection::getSortedModIndices() {
+	if(m_modSortKeys.size() != m_mods->numberOfMods()) {
+		updateModSortKeys();
 	}
 
-	m_teams.clear();
-
-	std::shared_ptr<ModTeam> team;
+	std::vector<size_t> & sortedModIndices = m_sortedModIndices[std::make_pair(m_sortType, m_sortDirection)];
 
-	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-		team = m_mods->getMod(i)->getTeam();
+	if(sortedModIndices.size() != m_modSortKeys.size()) {
+		sortedModIndices.resize(m_modSortKeys.size());
+		std::iota(sortedModIndices.begin(), sortedModIndices.end(), 0);
 
-		if(team != nullptr) {
-			incrementTeamModCount(team->getName());
-		}
+		std::stable_sort(sortedModIndices.begin(), sortedModIndices.end(), [this](size_t modIndexA, size_t modIndexB) {
+			return isModSortedBefore(modIndexA, modIndexB, m_sortType, m_sortDirection);
+		});
 	}
 
-	organizedModTeamCollectionChanged(m_teams);
+	return sortedModIndices;
 }
 
-void OrganizedModCollection::updateAuthorList() {
-	if(m_mods == nullptr) {
-		return;
-	}
-
-	m_authors.clear();
+bool OrganizedModCollection::isModSortedBefore(size_t modIndexA, size_t modIndexB, SortType sortType, SortDirection sortDirection) const {
+	const ModSortKey & modSortKeyA = m_modSortKeys[modIndexA];
+	const ModSortKey & modSortKeyB = m_modSortKeys[modIndexB];
 
-	std::shared_ptr<ModTeam> team;
+	switch(sortType) {
+		case SortType::Name: {
+			return sortDirection == SortDirection::Ascending ? modSortKeyA.formattedName < modSortKeyB.formattedName : modSortKeyA.formattedName > modSortKeyB.formattedName;
+		}
 
-	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
-		team = m_mods->getMod(i)->getTeam();
+		case SortType::InitialReleaseDate:
+		case SortType::LatestReleaseDate: {
+			const std::optional<Date> & releaseDateA = sortType == SortType::InitialReleaseDate ? modSortKeyA.initialReleaseDate : modSortKeyA.latestReleaseDate;
+			const std::optional<Date> & releaseDateB = sortType == SortType::InitialReleaseDate ? modSortKeyB.initialReleaseDate : modSortKeyB.latestReleaseDate;
 
-		if(team != nullptr) {
-			for(size_t j = 0; j < team->numberOfMembers(); j++) {
-				incrementAuthorModCount(team->getMember(j)->getName());
+			if(!releaseDateA.has_value()) {
+				return false;
 			}
+			else if(!releaseDateB.has_value()) {
+				return true;
+			}
+
+			return sortDirection == SortDirection::Ascending ? releaseDateA.value() < releaseDateB.value() : releaseDateA.value() > releaseDateB.value();
 		}
-	}
 
-	organizedModAuthorCollectionChanged(m_authors);
-}
+		case SortType::NumberOfVersions: {
+			return sortDirection == SortDirection::Ascending ? modSortKeyA.numberOfVersions < modSortKeyB.numberOfVersions : modSortKeyA.numberOfVersions > modSortKeyB.numberOfVersions;
+		}
 
-void OrganizedModCollection::updateGameVersionModCounts() {
-	updateGameVersionSupportedModCounts();
-	updateGameVersionCompatibleModCounts();
+		default: {
+			return false;
+		}
+	}
 }
 
-void OrganizedModCollection::updateGameVersionSupportedModCounts() {
-	if(m_gameVersions == nullptr) {
+void OrganizedModCollection::sortMods() {
+	if(m_sortType == SortType::Random) {
+		shuffleItems(m_organizedMods);
+		updateOrganizedModIndices();
 		return;
 	}
 
-	std::shared_ptr<Mod> mod;
-	std::shared_ptr<GameVersion> gameVersion;
+	if(m_modFilterMask.size() != m_mods->numberOfMods()) {
+		return;
+	}
 
-	m_gameVersionSupportedModCountMap.clear();
+	m_organizedMods.clear();
 
-	for(size_t i = 0; i < m_gameVersions->numberOfGameVersions(); i++) {
-		gameVersion = m_gameVersions->getGameVersion(i);
+	if(m_sortType == SortType::Unsorted) {
+		for(size_t i = 0; i < m_modFilterMask.size(); i++) {
+			if(m_modFilterMask[i]) {
+				m_organizedMods.push_back(m_mods->getMod(i));
+			}
+		}
 
-		m_gameVersionSupportedModCountMap[gameVersion->getID()] = 0;
-
-		for(size_t j = 0; j < m_mods->numberOfMods(); j++) {
-			mod = m_mods->getMod(j);
+		updateOrganizedModIndices();
+		return;
+	}
 
-			if(mod->isGameVersionSupported(*gameVersion)) {
-				m_gameVersionSupportedModCountMap[gameVersion->getID()]++;
-			}
+	for(size_t modIndex : getSortedModIndices()) {
+		if(m_modFilterMask[modIndex]) {
+			m_organizedMods.push_back(m_mods->getMod(modIndex));
 		}
 	}
-}
 
-void OrganizedModCollection::updateGameVersionCompatibleModCounts() {
-	if(m_gameVersions == nullptr) {
-		return;
-	}
+	updateOrganizedModIndices();
+}
 
-	std::shared_ptr<Mod> mod;
-	std::shared_ptr<GameVersion> gameVersion;
+void OrganizedModCollection::updateOrganizedModIndices() {
+	m_organizedModIndices.clear();
+	m_organizedModIndices.reserve(m_organizedMods.size());
 
-	m_gameVersionCompatibleModCountMap.clear();
+	for(size_t i = 0; i < m_organizedMods.size(); i++) {
+		m_organizedModIndices.emplace(m_organizedMods[i].get(), i);
+	}
+}
 
-	for(size_t i = 0; i < m_gameVersions->numberOfGameVersions(); i++) {
-		gameVersion = m_gameVersions->getGameVersion(i);
+void OrganizedModCollection::sortModIdentifiers() {
+	if(m_sortType == SortType::Random) {
+		shuffleItems(m_organizedFavouriteMods);
+		return;
+	}
 
-		m_gameVersionCompatibleModCountMap[gameVersion->getID()] = 0;
+	if(m_sortType != SortType::Name) {
+		return;
+	}
 
-		for(size_t j = 0; j < m_mods->numberOfMods(); j++) {
-			mod = m_mods->getMod(j);
+	std::stable_sort(m_organizedFavouriteMods.begin(), m_organizedFavouriteMods.end(), [this](const std::shared_ptr<ModIdentifier> & modIdentifierA, const std::shared_ptr<ModIdentifier> & modIdentifierB) {
+		int32_t nameComparison = Utilities::compareStringsIgnoreCase(modIdentifierA->getName(), modIdentifierB->getName());
 
-			if(mod->isGameVersionCompatible(*gameVersion)) {
-				m_gameVersionCompatibleModCountMap[gameVersion->getID()]++;
-			}
+		if(nameComparison != 0) {
+			return m_sortDirection == SortDirection::Ascending ? nameComparison < 0 : nameComparison > 0;
 		}
-	}
-}
 
-size_t OrganizedModCollection::indexOfCurrentSortType() const {
-	return indexOfSortType(m_sortType);
-}
+		if(!modIdentifierA->hasVersion()) {
+			return false;
+		}
+		else if(!modIdentifierB->hasVersion()) {
+			return true;
+		}
 
-size_t OrganizedModCollection::indexOfSortType(SortType sortType) const {
-	const auto & sortTypes = magic_enum::enum_values<SortType>();
-	size_t sortTypeIndex = 0;
+		int32_t versionComparison = Utilities::compareStringsIgnoreCase(modIdentifierA->getVersion().value(), modIdentifierB->getVersion().value());
 
-	for(SortType currentSortType : sortTypes) {
-		if(!areSortOptionsValidInCurrentContext(currentSortType, m_filterType)) {
-			continue;
+		if(versionComparison != 0) {
+			return m_sortDirection == SortDirection::Ascending ? versionComparison < 0 : versionComparison > 0;
 		}
 
-		if(currentSortType == sortType) {
-			return sortTypeIndex;
+		if(!modIdentifierA->hasVersionType()) {
+			return false;
+		}
+		else if(!modIdentifierB->hasVersionType()) {
+			return true;
 		}
 
-		sortTypeIndex++;
-	}
+		int32_t versionTypeComparison = Utilities::compareStringsIgnoreCase(modIdentifierA->getVersionType().value(), modIdentifierB->getVersionType().value());
 
-	return std::numeric_limits<size_t>::max();
+		return m_sortDirection == SortDirection::Ascending ? versionTypeComparison < 0 : versionTypeComparison > 0;
+	});
 }
 
-std::vector<OrganizedModCollection::SortType> OrganizedModCollection::getValidSortTypesInCurrentContext() const {
-	const auto & sortTypes = magic_enum::enum_values<SortType>();
-	std::vector<SortType> validSortTypes;
+void OrganizedModCollection::sortGameVersions() {
+	if(m_sortType == SortType::Random) {
+		shuffleItems(m_organizedGameVersions);
+		return;
+	}
 
-	for(SortType sortType : sortTypes) {
-		if(areSortOptionsValidInContext(sortType, m_filterType, m_selectedGameVersion != nullptr, m_selectedTeam != nullptr, m_selectedAuthor != nullptr)) {
-			validSortTypes.push_back(sortType);
-		}
+	if(m_sortType == SortType::Name) {
+		std::stable_sort(m_organizedGameVersions.begin(), m_organizedGameVersions.end(), [this](const std::shared_ptr<GameVersion> & gameVersionA, const std::shared_ptr<GameVersion> & gameVersionB) {
+			int32_t nameComparison = Utilities::compareStringsIgnoreCase(gameVersionA->getLongName(), gameVersionB->getLongName());
+
+			return m_sortDirection == SortDirection::Ascending ? nameComparison < 0 : nameComparison > 0;
+		});
 	}
+	else if(m_sortType == SortType::NumberOfSupportedMods || m_sortType == SortType::NumberOfCompatibleMods) {
+		const std::map<std::string, size_t> & gameVersionModCountMap = m_sortType == SortType::NumberOfSupportedMods ? m_gameVersionSupportedModCountMap : m_gameVersionCompatibleModCountMap;
+		std::vector<std::pair<size_t, std::shared_ptr<GameVersion>>> gameVersionModCounts;
+		gameVersionModCounts.reserve(m_organizedGameVersions.size());
 
-	return validSortTypes;
-}
+		for(std::shared_ptr<GameVersion> & gameVersion : m_organizedGameVersions) {
+			std::map<std::string, size_t>::const_iterator gameVersionModCountIterator(gameVersionModCountMap.find(gameVersion->getID()));
 
-std::vector<OrganizedModCollection::SortType> OrganizedModCollection::getInvalidSortTypesInCurrentContext() const {
-	const auto & sortTypes = magic_enum::enum_values<SortType>();
-	std::vector<SortType> invalidSortTypes;
+			gameVersionModCounts.emplace_back(gameVersionModCountIterator == gameVersionModCountMap.cend() ? 0 : gameVersionModCountIterator->second, std::move(gameVersion));
+		}
 
-	for(SortType sortType : sortTypes) {
-		if(!areSortOptionsValidInContext(sortType, m_filterType, m_selectedGameVersion != nullptr, m_selectedTeam != nullptr, m_selectedAuthor != nullptr)) {
-			invalidSortTypes.push_back(sortType);
+		std::stable_sort(gameVersionModCounts.begin(), gameVersionModCounts.end(), [this](const std::pair<size_t, std::shared_ptr<GameVersion>> & gameVersionModCountA, const std::pair<size_t, std::shared_ptr<GameVersion>> & gameVersionModCountB) {
+			return m_sortDirection == SortDirection::Ascending ? gameVersionModCountA.first < gameVersionModCountB.first : gameVersionModCountA.first > gameVersionModCountB.first;
+		});
+
+		for(size_t i = 0; i < gameVersionModCounts.size(); i++) {
+			m_organizedGameVersions[i] = std::move(gameVersionModCounts[i].second);
 		}
 	}
-
-	return invalidSortTypes;
 }
 
-bool OrganizedModCollection::areCurrentSortOptionsValidInCurrentContext() const {
-	return areSortOptionsValidInContext(m_sortType, m_filterType, m_selectedGameVersion != nullptr, m_selectedTeam != nullptr, m_selectedAuthor != nullptr);
-}
+void OrganizedModCollection::sortAuthors(std::vector<std::shared_ptr<ModAuthorInformation>> & authors) {
+	if(m_sortType == SortType::Random) {
+		shuffleItems(authors);
+		return;
+	}
 
-bool OrganizedModCollection::areSortOptionsValidInCurrentContext(SortType sortType, FilterType filterType) const {
-	return areSortOptionsValidInContext(sortType, filterType, m_selectedGameVersion != nullptr, m_selectedTeam != nullptr, m_selectedAuthor != nullptr);
-}
+	if(m_sortType == SortType::Name) {
+		std::stable_sort(authors.begin(), authors.end(), [this](const std::shared_ptr<ModAuthorInformation> & authorA, const std::shared_ptr<ModAuthorInformation> & authorB) {
+			int32_t nameComparison = Utilities::compareStringsIgnoreCase(authorA->getName(), authorB->getName());
 
-bool OrganizedModCollection::areSortOptionsValidInContext(SortType sortType, FilterType filterType, bool hasSelectedGameVersion, bool hasSelectedTeam, bool hasSelectedAuthor) {
-	if(sortType == SortType::Unsorted ||
-	   sortType == SortType::Name ||
-	   sortType == SortType::Random) {
-		return true;
+			return m_sortDirection == SortDirection::Ascending ? nameComparison < 0 : nameComparison > 0;
+		});
 	}
-
-	if(  filterType == FilterType::None ||
-		 filterType == FilterType::Downloaded ||
-	   ((filterType == FilterType::SupportedGameVersions || filterType == FilterType::CompatibleGameVersions) && hasSelectedGameVersion) ||
-	     filterType == FilterType::StandAlone ||
-	     filterType == FilterType::HasDependencies ||
-	     filterType == FilterType::OfficialExpansion ||
-	    (filterType == FilterType::Teams && hasSelectedTeam) ||
-	    (filterType == FilterType::Authors && hasSelectedAuthor)) {
-		return sortType == SortType::InitialReleaseDate ||
-			   sortType == SortType::LatestReleaseDate ||
-			   sortType == SortType::NumberOfVersions;
+	else if(m_sortType == SortType::NumberOfMods) {
+		std::stable_sort(authors.begin(), authors.end(), [this](const std::shared_ptr<ModAuthorInformation> & authorA, const std::shared_ptr<ModAuthorInformation> & authorB) {
+			return m_sortDirection == SortDirection::Ascending ? authorA->getModCount() < authorB->getModCount() : authorA->getModCount() > authorB->getModCount();
+		});
 	}
-	else if((filterType == FilterType::SupportedGameVersions || filterType == FilterType::CompatibleGameVersions) && !hasSelectedGameVersion) {
-		return sortType == SortType::NumberOfSupportedMods ||
-			   sortType == SortType::NumberOfCompatibleMods;
+}
+
+void OrganizedModCollection::updateGameVersionList() {
+	if(m_gameVersions == nullptr) {
+		return;
 	}
-	else if((filterType == FilterType::Teams && !hasSelectedTeam) ||
-			(filterType == FilterType::Authors && !hasSelectedAuthor)) {
-		return sortType == SortType::NumberOfMods;
+
+	m_organizedGameVersions.clear();
+
+	for(size_t i = 0; i < m_gameVersions->numberOfGameVersions(); i++) {
+		m_organizedGameVersions.push_back(m_gameVersions->getGameVersion(i));
 	}
 
-	return false;
+	updateGameVersionModCounts();
+
+	organizedModGameVersionCollectionChanged(m_organizedGameVersions);
 }
 
-std::vector<std::shared_ptr<Mod>> OrganizedModCollection::mergeSortMods(std::vector<std::shared_ptr<Mod>> mods) {
-	if(mods.size() <= 1) {
-		return mods;
+void OrganizedModCollection::updateTeamList() {
+	if(m_mods == nullptr) {
+		return;
 	}
 
-	std::vector<std::shared_ptr<Mod>> left;
-	std::vector<std::shared_ptr<Mod>> right;
+	m_teams.clear();
+	m_teamIndex.clear();
+	m_modTeamKeys.assign(m_mods->numberOfMods(), InternedString());
+
+	std::shared_ptr<ModTeam> team;
+
+	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
+		team = m_mods->getMod(i)->getTeam();
 
-	size_t mid = mods.size() / 2;
+		if(team != nullptr && !team->getName().empty()) {
+			m_modTeamKeys[i] = createModAuthorIndexKey(team->getName());
 
-	for(size_t i = 0; i < mid; i++) {
-		left.push_back(mods[i]);
+			addModToAuthorIndex(m_teamIndex, m_teams, m_modTeamKeys[i], team->getName(), i);
+		}
 	}
 
-	for(size_t i=mid;i<mods.size();i++) {
-		right.push_back(mods[i]);
+	organizedModTeamCollectionChanged(m_teams);
+}
+
+void OrganizedModCollection::updateAuthorList() {
+	if(m_mods == nullptr) {
+		return;
 	}
 
-	left = mergeSortMods(left);
-	right = mergeSortMods(right);
+	m_authors.clear();
+	m_authorIndex.clear();
+	m_modAuthorKeys.assign(m_mods->numberOfMods(), std::vector<InternedString>());
 
-	return mergeMods(left, right);
-}
+	std::shared_ptr<ModTeam> team;
 
-std::vector<std::shared_ptr<Mod>> OrganizedModCollection::mergeMods(std::vector<std::shared_ptr<Mod>> left, std::vector<std::shared_ptr<Mod>> right) {
-	std::vector<std::shared_ptr<Mod>> result;
+	for(size_t i = 0; i < m_mods->numberOfMods(); i++) {
+		team = m_mods->getMod(i)->getTeam();
+
+		if(team == nullptr) {
+			continue;
+		}
 
-	bool pushLeft = true;
+		for(size_t j = 0; j < team->numberOfMembers(); j++) {
+			const std::string & authorName = team->getMember(j)->getName();
 
-	while(!left.empty() && !right.empty()) {
-		if(m_sortType == SortType::Name) {
-			if(m_sortDirection == SortDirection::Ascending) {
-				pushLeft = Utilities::compareStringsIgnoreCase(left[0]->getName(), right[0]->getName()) <= 0;
+			if(authorName.empty()) {
+				continue;
 			}
-			else {
-				pushLeft = Utilities::compareStringsIgnoreCase(left[0]->getName(), right[0]->getName()) > 0;
+
+			InternedString authorKey(createModAuthorIndexKey(authorName));
+
+			if(std::find(m_modAuthorKeys[i].cbegin(), m_modAuthorKeys[i].cend(), authorKey) != m_modAuthorKeys[i].cend()) {
+				continue;
 			}
+
+			m_modAuthorKeys[i].push_back(authorKey);
+
+			addModToAuthorIndex(m_authorIndex, m_authors, authorKey, authorName, i);
 		}
-		else if(m_sortType == SortType::InitialReleaseDate || m_sortType == SortType::LatestReleaseDate) {
-			std::optional<Date> leftReleaseDate(m_sortType == SortType::InitialReleaseDate ? left[0]->getInitialReleaseDate() : left[0]->getLatestReleaseDate());
-			std::optional<Date> rightReleaseDate(m_sortType == SortType::InitialReleaseDate ? right[0]->getInitialReleaseDate() : right[0]->getLatestReleaseDate());
+	}
 
-			if(m_sortDirection == SortDirection::Ascending) {
-				if(!leftReleaseDate.has_value()) {
-					pushLeft = false;
-				}
-				else if(!rightReleaseDate.has_value()) {
-					pushLeft = true;
-				}
-				else {
-					pushLeft = leftReleaseDate <= rightReleaseDate;
-				}
-			}
-			else {
-				if(!leftReleaseDate.has_value()) {
-					pushLeft = false;
-				}
-				else if(!rightReleaseDate.has_value()) {
-					pushLeft = true;
-				}
-				else {
-					pushLeft = leftReleaseDate > rightReleaseDate;
-				}
-			}
+	organizedModAuthorCollectionChanged(m_authors);
+}
+
+void OrganizedModCollection::updateModAuthorIndices(const Mod & mod, size_t modIndex) {
+	if(!isModAuthorIndexCurrent()) {
+		updateTeamList();
+		updateAuthorList();
+		return;
+	}
+
+	std::shared_ptr<ModTeam> team(mod.getTeam());
+	InternedString teamKey;
+	std::vector<InternedString> authorKeys;
+	std::vector<const std::string *> authorNames;
+
+	if(team != nullptr) {
+		if(!team->getName().empty()) {
+			teamKey = createModAuthorIndexKey(team->getName());
 		}
-		else if(m_sortType == SortType::NumberOfVersions) {
-			if(m_sortDirection == SortDirection::Ascending) {
-				pushLeft = left[0]->numberOfVersions() <= right[0]->numberOfVersions();
+
+		for(size_t i = 0; i < team->numberOfMembers(); i++) {
+			const std::string & authorName = team->getMember(i)->getName();
+
+			if(authorName.empty()) {
+				continue;
 			}
-			else {
-				pushLeft = left[0]->numberOfVersions() > right[0]->numberOfVersions();
+
+			InternedString authorKey(createModAuthorIndexKey(authorName));
+
+			if(std::find(authorKeys.cbegin(), authorKeys.cend(), authorKey) != authorKeys.cend()) {
+				continue;
 			}
+
+			authorKeys.push_back(authorKey);
+			authorNames.push_back(&authorName);
 		}
-		else if(m_sortType == SortType::Random) {
-			pushLeft = Utilities::randomInteger(0, 1) == 0;
-		}
+	}
 
-		if(pushLeft) {
-			result.push_back(left[0]);
-			left.erase(left.begin());
+	if(teamKey != m_modTeamKeys[modIndex]) {
+		if(!m_modTeamKeys[modIndex].empty()) {
+			removeModFromAuthorIndex(m_teamIndex, m_teams, m_modTeamKeys[modIndex], modIndex);
 		}
-		else {
-			result.push_back(right[0]);
-			right.erase(right.begin());
+
+		if(!teamKey.empty()) {
+			addModToAuthorIndex(m_teamIndex, m_teams, teamKey, team->getName(), modIndex);
 		}
-	}
 
-	for(size_t i = 0; i < left.size(); i++) {
-		result.push_back(left[i]);
+		m_modTeamKeys[modIndex] = teamKey;
+
+		organizedModTeamCollectionChanged(m_teams);
 	}
 
-	for(size_t i = 0; i < right.size(); i++) {
-		result.push_back(right[i]);
+	if(authorKeys != m_modAuthorKeys[modIndex]) {
+		for(const InternedString & previousAuthorKey : m_modAuthorKeys[modIndex]) {
+			removeModFromAuthorIndex(m_authorIndex, m_authors, previousAuthorKey, modIndex);
+		}
+
+		for(size_t i = 0; i < authorKeys.size(); i++) {
+			addModToAuthorIndex(m_authorIndex, m_authors, authorKeys[i], *authorNames[i], modIndex);
+		}
+
+		m_modAuthorKeys[modIndex] = std::move(authorKeys);
+
+		organizedModAuthorCollectionChanged(m_authors);
 	}
+}
 
-	return result;
+bool OrganizedModCollection::isModAuthorIndexCurrent() const {
+	return m_mods != nullptr &&
+		   m_modTeamKeys.size() == m_mods->numberOfMods() &&
+		   m_modAuthorKeys.size() == m_mods->numberOfMods();
 }
 
-std::vector<std::shared_ptr<ModIdentifier>> OrganizedModCollection::mergeSortModIdentifiers(std::vector<std::shared_ptr<ModIdentifier>> modIdentifiers) {
-	if(modIdentifiers.size() <= 1) {
-		return modIdentifiers;
+InternedString OrganizedModCollection::createModAuthorIndexKey(const std::string & name) {
+	return InternedString(name).toLowerCase();
+}
+
+const std::vector<size_t> * OrganizedModCollection::getIndexedModIndices(const std::unordered_map<InternedString, ModAuthorIndexEntry> & modAuthorIndex, const std::string & name) {
+	std::unordered_map<InternedString, ModAuthorIndexEntry>::const_iterator modAuthorIndexEntryIterator(modAuthorIndex.find(createModAuthorIndexKey(name)));
+
+	if(modAuthorIndexEntryIterator == modAuthorIndex.cend()) {
+		return nullptr;
 	}
 
-	std::vector<std::shared_ptr<ModIdentifier>> left;
-	std::vector<std::shared_ptr<ModIdentifier>> right;
+	return &modAuthorIndexEntryIterator->second.modIndices;
+}
 
-	size_t mid = modIdentifiers.size() / 2;
+void OrganizedModCollection::addModToAuthorIndex(std::unordered_map<InternedString, ModAuthorIndexEntry> & modAuthorIndex, std::vector<std::shared_ptr<ModAuthorInformation>> & authors, const InternedString & key, const std::string & name, size_t modIndex) {
+	ModAuthorIndexEntry & modAuthorIndexEntry = modAuthorIndex[key];
 
-	for(size_t i = 0; i < mid; i++) {
-		left.push_back(modIdentifiers[i]);
+	if(modAuthorIndexEntry.information == nullptr) {
+		modAuthorIndexEntry.information = std::make_shared<ModAuthorInformation>(name);
+		modAuthorIndexEntry.modIndices.push_back(modIndex);
+		authors.push_back(modAuthorIndexEntry.information);
+		return;
 	}
 
-	for(size_t i = mid; i < modIdentifiers.size(); i++) {
-		right.push_back(modIdentifiers[i]);
-	}
+	std::vector<size_t>::iterator modIndexIterator(std::lower_bound(modAuthorIndexEntry.modIndices.begin(), modAuthorIndexEntry.modIndices.end(), modIndex));
 
-	left = mergeSortModIdentifiers(left);
-	right = mergeSortModIdentifiers(right);
+	if(modIndexIterator != modAuthorIndexEntry.modIndices.end() && *modIndexIterator == modIndex) {
+		return;
+	}
 
-	return mergeModIdentifiers(left, right);
+	modAuthorIndexEntry.modIndices.insert(modIndexIterator, modIndex);
+	modAuthorIndexEntry.information->incrementModCount();
 }
 
-std::vector<std::shared_ptr<ModIdentifier>> OrganizedModCollection::mergeModIdentifiers(std::vector<std::shared_ptr<ModIdentifier>> left, std::vector<std::shared_ptr<ModIdentifier>> right) {
-	std::vector<std::shared_ptr<ModIdentifier>> result;
-
-	bool pushLeft = true;
+void OrganizedModCollection::removeModFromAuthorIndex(std::unordered_map<InternedString, ModAuthorIndexEntry> & modAuthorIndex, std::vector<std::shared_ptr<ModAuthorInformation>> & authors, const InternedString & key, size_t modIndex) {
+	std::unordered_map<InternedString, ModAuthorIndexEntry>::iterator modAuthorIndexEntryIterator(modAuthorIndex.find(key));
 
-	while(!left.empty() && !right.empty()) {
-		if(m_sortType == SortType::Name) {
-			int32_t nameComparison = Utilities::compareStringsIgnoreCase(left[0]->getName(), right[0]->getName());
+	if(modAuthorIndexEntryIterator == modAuthorIndex.end()) {
+		return;
+	}
 
-			if(nameComparison != 0) {
-				if(m_sortDirection == SortDirection::Ascending) {
-					pushLeft = nameComparison < 0;
-				}
-				else {
-					pushLeft = nameComparison > 0;
-				}
-			}
-			else {
-				if(!left[0]->hasVersion()) {
-					pushLeft = false;
-				}
-				else if(!right[0]->hasVersion()) {
-					pushLeft = true;
-				}
-				else {
-					int32_t versionComparison = Utilities::compareStringsIgnoreCase(left[0]->getVersion().value(), right[0]->getVersion().value());
-
-					if(versionComparison != 0) {
-						if(m_sortDirection == SortDirection::Ascending) {
-							pushLeft = versionComparison < 0;
-						}
-						else {
-							pushLeft = versionComparison > 0;
-						}
-					}
-					else {
-						if(!left[0]->hasVersionType()) {
-							pushLeft = false;
-						}
-						else if(!right[0]->hasVersionType()) {
-							pushLeft = true;
-						}
-						else {
-							int32_t versionTypeComparison = Utilities::compareStringsIgnoreCase(left[0]->getVersionType().value(), right[0]->getVersionType().value());
-
-							if(m_sortDirection == SortDirection::Ascending) {
-								pushLeft = versionTypeComparison <= 0;
-							}
-							else {
-								pushLeft = versionTypeComparison > 0;
-							}
-						}
-					}
-				}
-			}
-		}
-		else if(m_sortType == SortType::Random) {
-			pushLeft = Utilities::randomInteger(0, 1) == 0;
-		}
+	ModAuthorIndexEntry & modAuthorIndexEntry = modAuthorIndexEntryIterator->second;
+	std::vector<size_t>::iterator modIndexIterator(std::lower_bound(modAuthorIndexEntry.modIndices.begin(), modAuthorIndexEntry.modIndices.end(), modIndex));
 
-		if(pushLeft) {
-			result.push_back(left[0]);
-			left.erase(left.begin());
-		}
-		else {
-			result.push_back(right[0]);
-			right.erase(right.begin());
-		}
+	if(modIndexIterator == modAuthorIndexEntry.modIndices.end() || *modIndexIterator != modIndex) {
+		return;
 	}
 
-	for(size_t i = 0; i < left.size(); i++) {
-		result.push_back(left[i]);
-	}
+	modAuthorIndexEntry.modIndices.erase(modIndexIterator);
 
-	for(size_t i = 0; i < right.size(); i++) {
-		result.push_back(right[i]);
+	if(!modAuthorIndexEntry.modIndices.empty()) {
+		modAuthorIndexEntry.information->setModCount(static_cast<uint8_t>(modAuthorIndexEntry.information->getModCount() - 1));
+		return;
 	}
 
-	return result;
+	authors.erase(std::remove(authors.begin(), authors.end(), modAuthorIndexEntry.information), authors.end());
+	modAuthorIndex.erase(modAuthorIndexEntryIterator);
+}
+
+void OrganizedModCollection::updateGameVersionModCounts() {
+	updateGameVersionModBitsets();
+	updateGameVersionSupportedModCounts();
+	updateGameVersionCompatibleModCounts();
 }
 
-std::vector<std::shared_ptr<GameVersion>> OrganizedModCollection::mergeSortGameVersions(std::vector<std::shared_ptr<GameVersion>> gameVersions) {
-	if(gameVersions.size() <= 1) {
-		return gameVersions;
+void OrganizedModCollection::updateGameVersionSupportedModCounts() {
+	if(m_gameVersions == nullptr) {
+		return;
 	}
 
-	std::vector<std::shared_ptr<GameVersion>> left;
-	std::vector<std::shared_ptr<GameVersion>> right;
+	std::shared_ptr<GameVersion> gameVersion;
+	const std::vector<uint64_t> * supportedModBitset = nullptr;
 
-	size_t mid = gameVersions.size() / 2;
+	m_gameVersionSupportedModCountMap.clear();
 
-	for(size_t i = 0; i < mid; i++) {
-		left.push_back(gameVersions[i]);
+	for(size_t i = 0; i < m_gameVersions->numberOfGameVersions(); i++) {
+		gameVersion = m_gameVersions->getGameVersion(i);
+		supportedModBitset = getGameVersionModBitset(*gameVersion, false);
+
+		m_gameVersionSupportedModCountMap[gameVersion->getID()] = supportedModBitset == nullptr ? 0 : countModBits(*supportedModBitset);
 	}
+}
 
-	for(size_t i = mid; i < gameVersions.size(); i++) {
-		right.push_back(gameVersions[i]);
+void OrganizedModCollection::updateGameVersionCompatibleModCounts() {
+	if(m_gameVersions == nullptr) {
+		return;
 	}
 
-	left = mergeSortGameVersions(left);
-	right = mergeSortGameVersions(right);
+	std::shared_ptr<GameVersion> gameVersion;
+	const std::vector<uint64_t> * compatibleModBitset = nullptr;
 
-	return mergeGameVersions(left, right);
+	m_gameVersionCompatibleModCountMap.clear();
+
+	for(size_t i = 0; i < m_gameVersions->numberOfGameVersions(); i++) {
+		gameVersion = m_gameVersions->getGameVersion(i);
+		compatibleModBitset = getGameVersionModBitset(*gameVersion, true);
+
+		m_gameVersionCompatibleModCountMap[gameVersion->getID()] = compatibleModBitset == nullptr ? 0 : countModBits(*compatibleModBitset);
+	}
 }
 
-std::vector<std::shared_ptr<GameVersion>> OrganizedModCollection::mergeGameVersions(std::vector<std::shared_ptr<GameVersion>> left, std::vector<std::shared_ptr<GameVersion>> right) {
-	std::vector<std::shared_ptr<GameVersion>> result;
+void OrganizedModCollection::updateGameVersionModBitsets() {
+	if(m_gameVersions == nullptr || m_mods == nullptr) {
+		m_gameVersionModBitsets.clear();
+		return;
+	}
 
-	bool pushLeft = true;
+	size_t numberOfModBitsetWords = (m_mods->numberOfMods() + 63) / 64;
 
-	while(!left.empty() && !right.empty()) {
-		if(m_sortType == SortType::Name) {
-			if(m_sortDirection == SortDirection::Ascending) {
-				pushLeft = Utilities::compareStringsIgnoreCase(left[0]->getLongName(), right[0]->getLongName()) <= 0;
-			}
-			else {
-				pushLeft = Utilities::compareStringsIgnoreCase(left[0]->getLongName(), right[0]->getLongName()) > 0;
-			}
-		}
-		else if(m_sortType == SortType::NumberOfSupportedMods) {
-			if(m_sortDirection == SortDirection::Ascending) {
-				pushLeft = getSupportedModCountForGameVersionWithID(left[0]->getID()) <= getSupportedModCountForGameVersionWithID(right[0]->getID());
-			}
-			else {
-				pushLeft = getSupportedModCountForGameVersionWithID(left[0]->getID()) > getSupportedModCountForGameVersionWithID(right[0]->getID());
-			}
-		}
-		else if(m_sortType == SortType::NumberOfCompatibleMods) {
-			if(m_sortDirection == SortDirection::Ascending) {
-				pushLeft = getCompatibleModCountForGameVersionWithID(left[0]->getID()) <= getCompatibleModCountForGameVersionWithID(right[0]->getID());
+	m_gameVersionModBitsets.resize(m_gameVersions->numberOfGameVersions());
+
+	for(GameVersionModBitsets & gameVersionModBitsets : m_gameVersionModBitsets) {
+		gameVersionModBitsets.supported.assign(numberOfModBitsetWords, 0);
+		gameVersionModBitsets.compatible.assign(numberOfModBitsetWords, 0);
+	}
+
+	std::shared_ptr<Mod> mod;
+	std::shared_ptr<GameVersion> gameVersion;
+
+	for(size_t i = 0; i < m_gameVersions->numberOfGameVersions(); i++) {
+		gameVersion = m_gameVersions->getGameVersion(i);
+		GameVersionModBitsets & gameVersionModBitsets = m_gameVersionModBitsets[i];
+
+		for(size_t j = 0; j < m_mods->numberOfMods(); j++) {
+			mod = m_mods->getMod(j);
+
+			if(mod->isGameVersionSupported(*gameVersion)) {
+				setModBit(gameVersionModBitsets.supported, j, true);
 			}
-			else {
-				pushLeft = getCompatibleModCountForGameVersionWithID(left[0]->getID()) > getCompatibleModCountForGameVersionWithID(right[0]->getID());
+
+			if(mod->isGameVersionCompatible(*gameVersion)) {
+				setModBit(gameVersionModBitsets.compatible, j, true);
 			}
 		}
-		else if(m_sortType == SortType::Random) {
-			pushLeft = Utilities::randomInteger(0, 1) == 0;
-		}
+	}
+}
 
-		if(pushLeft) {
-			result.push_back(left[0]);
-			left.erase(left.begin());
-		}
-		else {
-			result.push_back(right[0]);
-			right.erase(right.begin());
-		}
+void OrganizedModCollection::updateGameVersionModBitsetsForMod(const Mod & mod, size_t modIndex) {
+	if(m_gameVersions == nullptr || m_mods == nullptr) {
+		return;
 	}
 
-	for(size_t i = 0; i < left.size(); i++) {
-		result.push_back(left[i]);
+	size_t numberOfModBitsetWords = (m_mods->numberOfMods() + 63) / 64;
+
+	if(m_gameVersionModBitsets.size() != m_gameVersions->numberOfGameVersions() ||
+	   (!m_gameVersionModBitsets.empty() && m_gameVersionModBitsets.front().supported.size() != numberOfModBitsetWords)) {
+		updateGameVersionModCounts();
+		return;
 	}
 
-	for(size_t i = 0; i < right.size(); i++) {
-		result.push_back(right[i]);
+	std::shared_ptr<GameVersion> gameVersion;
+
+	for(size_t i = 0; i < m_gameVersions->numberOfGameVersions(); i++) {
+		gameVersion = m_gameVersions->getGameVersion(i);
+
+		setModBit(m_gameVersionModBitsets[i].supported, modIndex, mod.isGameVersionSupported(*gameVersion));
+		setModBit(m_gameVersionModBitsets[i].compatible, modIndex, mod.isGameVersionCompatible(*gameVersion));
 	}
 
-	return result;
+	updateGameVersionSupportedModCounts();
+	updateGameVersionCompatibleModCounts();
 }
 
-std::vector<std::shared_ptr<ModAuthorInformation>> OrganizedModCollection::mergeSortAuthors(std::vector<std::shared_ptr<ModAuthorInformation>> authors) {
-	if(authors.size() <= 1) {
-		return authors;
+const std::vector<uint64_t> * OrganizedModCollection::getGameVersionModBitset(const GameVersion & gameVersion, bool compatible) const {
+	if(m_gameVersions == nullptr || m_mods == nullptr) {
+		return nullptr;
 	}
 
-	std::vector<std::shared_ptr<ModAuthorInformation>> left;
-	std::vector<std::shared_ptr<ModAuthorInformation>> right;
+	size_t gameVersionIndex = m_gameVersions->indexOfGameVersion(gameVersion);
 
-	size_t mid = authors.size() / 2;
+	if(gameVersionIndex >= m_gameVersionModBitsets.size()) {
+		return nullptr;
+	}
+
+	const std::vector<uint64_t> & gameVersionModBitset = compatible ? m_gameVersionModBitsets[gameVersionIndex].compatible : m_gameVersionModBitsets[gameVersionIndex].supported;
 
-	for(size_t i = 0; i < mid; i++) {
-		left.push_back(authors[i]);
+	if(gameVersionModBitset.size() != (m_mods->numberOfMods() + 63) / 64) {
+		return nullptr;
 	}
 
-	for(size_t i = mid; i < authors.size(); i++) {
-		right.push_back(authors[i]);
+	return &gameVersionModBitset;
+}
+
+bool OrganizedModCollection::isModBitSet(const std::vector<uint64_t> & modBitset, size_t modIndex) {
+	return (modBitset[modIndex / 64] & (uint64_t(1) << (modIndex % 64))) != 0;
+}
+
+void OrganizedModCollection::setModBit(std::vector<uint64_t> & modBitset, size_t modIndex, bool value) {
+	if(value) {
+		modBitset[modIndex / 64] |= uint64_t(1) << (modIndex % 64);
+	}
+	else {
+		modBitset[modIndex / 64] &= ~(uint64_t(1) << (modIndex % 64));
 	}
+}
+
+size_t OrganizedModCollection::countModBits(const std::vector<uint64_t> & modBitset) {
+	size_t numberOfModBits = 0;
 
-	left = mergeSortAuthors(left);
-	right = mergeSortAuthors(right);
+	for(uint64_t modBits : modBitset) {
+		numberOfModBits += std::bitset<64>(modBits).count();
+	}
 
-	return mergeAuthors(left, right);
+	return numberOfModBits;
 }
 
-std::vector<std::shared_ptr<ModAuthorInformation>> OrganizedModCollection::mergeAuthors(std::vector<std::shared_ptr<ModAuthorInformation>> left, std::vector<std::shared_ptr<ModAuthorInformation>> right) {
-	std::vector<std::shared_ptr<ModAuthorInformation>> result;
+size_t OrganizedModCollection::indexOfCurrentSortType() const {
+	return indexOfSortType(m_sortType);
+}
 
-	bool pushLeft = true;
+size_t OrganizedModCollection::indexOfSortType(SortType sortType) const {
+	const auto & sortTypes = magic_enum::enum_values<SortType>();
+	size_t sortTypeIndex = 0;
 
-	while(!left.empty() && !right.empty()) {
-		if(m_sortType == SortType::Name) {
-			if(m_sortDirection == SortDirection::Ascending) {
-				pushLeft = Utilities::compareStringsIgnoreCase(left[0]->getName(), right[0]->getName()) <= 0;
-			}
-			else {
-				pushLeft = Utilities::compareStringsIgnoreCase(left[0]->getName(), right[0]->getName()) > 0;
-			}
-		}
-		else if(m_sortType == SortType::NumberOfMods) {
-			if(m_sortDirection == SortDirection::Ascending) {
-				pushLeft = left[0]->getModCount() <= right[0]->getModCount();
-			}
-			else {
-				pushLeft = left[0]->getModCount() > right[0]->getModCount();
-			}
+	for(SortType currentSortType : sortTypes) {
+		if(!areSortOptionsValidInCurrentContext(currentSortType, m_filterType)) {
+			continue;
 		}
-		else if(m_sortType == SortType::Random) {
-			pushLeft = Utilities::randomInteger(0, 1) == 0;
+
+		if(currentSortType == sortType) {
+			return sortTypeIndex;
 		}
 
-		if(pushLeft) {
-			result.push_back(left[0]);
-			left.erase(left.begin());
+		sortTypeIndex++;
+	}
+
+	return std::numeric_limits<size_t>::max();
+}
+
+std::vector<OrganizedModCollection::SortType> OrganizedModCollection::getValidSortTypesInCurrentContext() const {
+	const auto & sortTypes = magic_enum::enum_values<SortType>();
+	std::vector<SortType> validSortTypes;
+
+	for(SortType sortType : sortTypes) {
+		if(areSortOptionsValidInContext(sortType, m_filterType, m_selectedGameVersion != nullptr, m_selectedTeam != nullptr, m_selectedAuthor != nullptr)) {
+			validSortTypes.push_back(sortType);
 		}
-		else {
-			result.push_back(right[0]);
-			right.erase(right.begin());
+	}
+
+	return validSortTypes;
+}
+
+std::vector<OrganizedModCollection::SortType> OrganizedModCollection::getInvalidSortTypesInCurrentContext() const {
+	const auto & sortTypes = magic_enum::enum_values<SortType>();
+	std::vector<SortType> invalidSortTypes;
+
+	for(SortType sortType : sortTypes) {
+		if(!areSortOptionsValidInContext(sortType, m_filterType, m_selectedGameVersion != nullptr, m_selectedTeam != nullptr, m_selectedAuthor != nullptr)) {
+			invalidSortTypes.push_back(sortType);
 		}
 	}
 
-	for(size_t i = 0; i < left.size(); i++) {
-		result.push_back(left[i]);
+	return invalidSortTypes;
+}
+
+bool OrganizedModCollection::areCurrentSortOptionsValidInCurrentContext() const {
+	return areSortOptionsValidInContext(m_sortType, m_filterType, m_selectedGameVersion != nullptr, m_selectedTeam != nullptr, m_selectedAuthor != nullptr);
+}
+
+bool OrganizedModCollection::areSortOptionsValidInCurrentContext(SortType sortType, FilterType filterType) const {
+	return areSortOptionsValidInContext(sortType, filterType, m_selectedGameVersion != nullptr, m_selectedTeam != nullptr, m_selectedAuthor != nullptr);
+}
+
+bool OrganizedModCollection::areSortOptionsValidInContext(SortType sortType, FilterType filterType, bool hasSelectedGameVersion, bool hasSelectedTeam, bool hasSelectedAuthor) {
+	if(sortType == SortType::Unsorted ||
+	   sortType == SortType::Name ||
+	   sortType == SortType::Random) {
+		return true;
 	}
 
-	for(size_t i = 0; i < right.size(); i++) {
-		result.push_back(right[i]);
+	if(  filterType == FilterType::None ||
+		 filterType == FilterType::Downloaded ||
+	   ((filterType == FilterType::SupportedGameVersions || filterType == FilterType::CompatibleGameVersions) && hasSelectedGameVersion) ||
+	     filterType == FilterType::StandAlone ||
+	     filterType == FilterType::HasDependencies ||
+	     filterType == FilterType::OfficialExpansion ||
+	    (filterType == FilterType::Teams && hasSelectedTeam) ||
+	    (filterType == FilterType::Authors && hasSelectedAuthor)) {
+		return sortType == SortType::InitialReleaseDate ||
+			   sortType == SortType::LatestReleaseDate ||
+			   sortType == SortType::NumberOfVersions;
+	}
+	else if((filterType == FilterType::SupportedGameVersions || filterType == FilterType::CompatibleGameVersions) && !hasSelectedGameVersion) {
+		return sortType == SortType::NumberOfSupportedMods ||
+			   sortType == SortType::NumberOfCompatibleMods;
+	}
+	else if((filterType == FilterType::Teams && !hasSelectedTeam) ||
+			(filterType == FilterType::Authors && !hasSelectedAuthor)) {
+		return sortType == SortType::NumberOfMods;
 	}
 
-	return result;
+	return false;
 }
 
 bool OrganizedModCollection::operator == (const OrganizedModCollection & organizedModCollection) const {
@@ -1,12 +1,19 @@
 #ifndef _ORGANIZED_MOD_COLLECTION_H_
 #define _ORGANIZED_MOD_COLLECTION_H_
 
+#include "InternedString.h"
+
+#include <Date.h>
+
 #include <boost/signals2.hpp>
 
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 class DownloadManager;
@@ -98,6 +105,7 @@ public:
 	bool hasModWithID(const std::string & id) const;
 	bool hasModWithName(const std::string & name) const;
 	size_t indexOfMod(const Mod & mod) const;
+	size_t indexOfOrganizedMod(const Mod & mod) const;
 	size_t indexOfModWithID(const std::string & id) const;
 	size_t indexOfModWithName(const std::string & name) const;
 	std::shared_ptr<Mod> getMod(size_t index) const;
@@ -177,6 +185,8 @@ public:
 	void clearSelectedAuthor();
 
 	void organize();
+	void updateMod(const Mod & mod);
+	void updateModDownloadStatus(const Mod & mod);
 
 	size_t indexOfCurrentSortType() const;
 	size_t indexOfSortType(SortType sortType) const;
@@ -207,34 +217,67 @@ public:
 	static const SortDirection DEFAULT_SORT_DIRECTION;
 
 private:
+	struct GameVersionModBitsets {
+		std::vector<uint64_t> supported;
+		std::vector<uint64_t> compatible;
+	};
+
+	struct ModAuthorIndexEntry {
+		std::shared_ptr<ModAuthorInformation> information;
+		std::vector<size_t> modIndices;
+	};
+
+	struct ModSortKey {
+		std::string formattedName;
+		std::optional<Date> initialReleaseDate;
+		std::optional<Date> latestReleaseDate;
+		size_t numberOfVersions;
+	};
+
 	void applyFilter();
 	void sort();
+	bool isModIncludedByFilter(const Mod & mod, size_t modIndex) const;
+	void updateModSortKeys();
+	static ModSortKey createModSortKey(const Mod & mod);
+	const std::vector<size_t> & getSortedModIndices();
+	bool isModSortedBefore(size_t modIndexA, size_t modIndexB, SortType sortType, SortDirection sortDirection) const;
+	void sortMods();
+	void updateOrganizedModIndices();
+	void updateOrganizedMod(const Mod & mod, size_t modIndex);
+	void sortModIdentifiers();
+	void sortGameVersions();
+	void sortAuthors(std::vector<std::shared_ptr<ModAuthorInformation>> & authors);
 	void updateGameVersionList();
 	void updateTeamList();
 	void updateAuthorList();
+	void updateModAuthorIndices(const Mod & mod, size_t modIndex);
+	bool isModAuthorIndexCurrent() const;
+	static InternedString createModAuthorIndexKey(const std::string & name);
+	static const std::vector<size_t> * getIndexedModIndices(const std::unordered_map<InternedString, ModAuthorIndexEntry> & modAuthorIndex, const std::string & name);
+	static void addModToAuthorIndex(std::unordered_map<InternedString, ModAuthorIndexEntry> & modAuthorIndex, std::vector<std::shared_ptr<ModAuthorInformation>> & authors, const InternedString & key, const std::string & name, size_t modIndex);
+	static void removeModFromAuthorIndex(std::unordered_map<InternedString, ModAuthorIndexEntry> & modAuthorIndex, std::vector<std::shared_ptr<ModAuthorInformation>> & authors, const InternedString & key, size_t modIndex);
 	void updateGameVersionModCounts();
 	void updateGameVersionSupportedModCounts();
 	void updateGameVersionCompatibleModCounts();
+	void updateGameVersionModBitsets();
+	void updateGameVersionModBitsetsForMod(const Mod & mod, size_t modIndex);
+	const std::vector<uint64_t> * getGameVersionModBitset(const GameVersion & gameVersion, bool compatible) const;
+	static bool isModBitSet(const std::vector<uint64_t> & modBitset, size_t modIndex);
+	static void setModBit(std::vector<uint64_t> & modBitset, size_t modIndex, bool value);
+	static size_t countModBits(const std::vector<uint64_t> & modBitset);
 	void onModCollectionUpdated(ModCollection & mods);
+	void onModCollectionModModified(ModCollection & mods, Mod & mod);
 	void onFavouriteModCollectionUpdated(FavouriteModCollection & favouriteMods);
 	void onGameVersionCollectionSizeChanged(GameVersionCollection & gameVersionCollection);
 	void onGameVersionCollectionItemModified(GameVersionCollection & gameVersionCollection, GameVersion & gameVersion);
 
-	std::vector<std::shared_ptr<Mod>> mergeSortMods(std::vector<std::shared_ptr<Mod>> mods);
-	std::vector<std::shared_ptr<Mod>> mergeMods(std::vector<std::shared_ptr<Mod>> left, std::vector<std::shared_ptr<Mod>> right);
-	std::vector<std::shared_ptr<ModIdentifier>> mergeSortModIdentifiers(std::vector<std::shared_ptr<ModIdentifier>> authors);
-	std::vector<std::shared_ptr<ModIdentifier>> mergeModIdentifiers(std::vector<std::shared_ptr<ModIdentifier>> left, std::vector<std::shared_ptr<ModIdentifier>> right);
-	std::vector<std::shared_ptr<GameVersion>> mergeSortGameVersions(std::vector<std::shared_ptr<GameVersion>> gameVersions);
-	std::vector<std::shared_ptr<GameVersion>> mergeGameVersions(std::vector<std::shared_ptr<GameVersion>> left, std::vector<std::shared_ptr<GameVersion>> right);
-	std::vector<std::shared_ptr<ModAuthorInformation>> mergeSortAuthors(std::vector<std::shared_ptr<ModAuthorInformation>> authors);
-	std::vector<std::shared_ptr<ModAuthorInformation>> mergeAuthors(std::vector<std::shared_ptr<ModAuthorInformation>> left, std::vector<std::shared_ptr<ModAuthorInformation>> right);
-
 	bool m_localMode;
 	FilterType m_filterType;
 	SortType m_sortType;
 	SortDirection m_sortDirection;
 	std::shared_ptr<ModCollection> m_mods;
 	boost::signals2::connection m_modCollectionUpdatedConnection;
+	boost::signals2::connection m_modCollectionModModifiedConnection;
 	std::shared_ptr<FavouriteModCollection> m_favouriteMods;
 	boost::signals2::connection m_favouriteModCollectionUpdatedConnection;
 	std::shared_ptr<DownloadManager> m_downloadManager;
@@ -242,10 +285,19 @@ private:
 	boost::signals2::connection m_gameVersionCollectionSizeChangedConnection;
 	boost::signals2::connection m_gameVersionCollectionItemModifiedConnection;
 	std::vector<std::shared_ptr<Mod>> m_organizedMods;
+	std::unordered_map<const Mod *, size_t> m_organizedModIndices;
+	std::vector<ModSortKey> m_modSortKeys;
+	std::vector<bool> m_modFilterMask;
+	std::map<std::pair<SortType, SortDirection>, std::vector<size_t>> m_sortedModIndices;
 	std::vector<std::shared_ptr<ModIdentifier>> m_organizedFavouriteMods;
 	std::vector<std::shared_ptr<GameVersion>> m_organizedGameVersions;
 	std::vector<std::shared_ptr<ModAuthorInformation>> m_teams;
 	std::vector<std::shared_ptr<ModAuthorInformation>> m_authors;
+	std::unordered_map<InternedString, ModAuthorIndexEntry> m_teamIndex;
+	std::unordered_map<InternedString, ModAuthorIndexEntry> m_authorIndex;
+	std::vector<InternedString> m_modTeamKeys;
+	std::vector<std::vector<InternedString>> m_modAuthorKeys;
+	std::vector<GameVersionModBitsets> m_gameVersionModBitsets;
 	std::map<std::string, size_t> m_gameVersionSupportedModCountMap;
 	std::map<std::string, size_t> m_gameVersionCompatibleModCountMap;
 	std::shared_ptr<Mod> m_selectedMod;
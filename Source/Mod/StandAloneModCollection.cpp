@@ -27,32 +27,57 @@ const uint32_t StandAloneModCollection::FILE_FORMAT_VERSION = 1;
 StandAloneModCollection::StandAloneModCollection() { }
 
 StandAloneModCollection::StandAloneModCollection(StandAloneModCollection && standAloneMods) noexcept
-	: m_standAloneMods(std::move(standAloneMods.m_standAloneMods)) { }
+	: m_standAloneMods(std::move(standAloneMods.m_standAloneMods))
+	, m_standAloneModIndicesByKey(std::move(standAloneMods.m_standAloneModIndicesByKey)) { }
 
 StandAloneModCollection::StandAloneModCollection(const StandAloneModCollection & standAloneMods) {
 	for(const std::shared_ptr<StandAloneMod> standAloneMod : standAloneMods.m_standAloneMods) {
 		m_standAloneMods.push_back(std::make_shared<StandAloneMod>(*standAloneMod));
 	}
+
+	rebuildIndices();
 }
 
 StandAloneModCollection & StandAloneModCollection::operator = (StandAloneModCollection && standAloneMods) noexcept {
 	if(this != &standAloneMods) {
 		m_standAloneMods = std::move(standAloneMods.m_standAloneMods);
+		m_standAloneModIndicesByKey = std::move(standAloneMods.m_standAloneModIndicesByKey);
 	}
 
 	return *this;
 }
 
 StandAloneModCollection & StandAloneModCollection::operator = (const StandAloneModCollection & standAloneMods) {
+	m_standAloneMods.clear();
+
 	for(const std::shared_ptr<StandAloneMod> standAloneMod : standAloneMods.m_standAloneMods) {
 		m_standAloneMods.push_back(std::make_shared<StandAloneMod>(*standAloneMod));
 	}
 
+	rebuildIndices();
+
 	return *this;
 }
 
 StandAloneModCollection::~StandAloneModCollection() = default;
 
+std::string StandAloneModCollection::getStandAloneModKey(const std::string & modID, const std::string & modVersion) {
+	std::string key(Utilities::toLowerCase(modID));
+	key.push_back('\n');
+	key.append(Utilities::toLowerCase(modVersion));
+
+	return key;
+}
+
+void StandAloneModCollection::rebuildIndices() {
+	m_standAloneModIndicesByKey.clear();
+	m_standAloneModIndicesByKey.reserve(m_standAloneMods.size());
+
+	for(size_t i = 0; i < m_standAloneMods.size(); i++) {
+		m_standAloneModIndicesByKey.emplace(getStandAloneModKey(m_standAloneMods[i]->getID(), m_standAloneMods[i]->getVersion()), i);
+	}
+}
+
 size_t StandAloneModCollection::numberOfStandAloneMods() const {
 	return m_standAloneMods.size();
 }
@@ -104,28 +129,23 @@ size_t StandAloneModCollection::indexOfStandAloneMod(const std::string & modID,
 		return std::numeric_limits<size_t>::max();
 	}
 
-	auto standAloneModIterator = std::find_if(m_standAloneMods.cbegin(), m_standAloneMods.cend(), [&modID, &modVersion](const std::shared_ptr<StandAloneMod> & currentStandAloneMod) {
-		return Utilities::areStringsEqualIgnoreCase(currentStandAloneMod->getID(), modID) &&
-			   Utilities::areStringsEqualIgnoreCase(currentStandAloneMod->getVersion(), modVersion);
-	});
+	std::unordered_map<std::string, size_t>::const_iterator standAloneModIndexIterator(m_standAloneModIndicesByKey.find(getStandAloneModKey(modID, modVersion)));
 
-	if(standAloneModIterator == m_standAloneMods.cend()) {
+	if(standAloneModIndexIterator == m_standAloneModIndicesByKey.cend()) {
 		return std::numeric_limits<size_t>::max();
 	}
 
-	return standAloneModIterator - m_standAloneMods.cbegin();
+	return standAloneModIndexIterator->second;
 }
 
 size_t StandAloneModCollection::indexOfStandAloneMod(const StandAloneMod & standAloneMod) const {
-	auto standAloneModIterator = std::find_if(m_standAloneMods.cbegin(), m_standAloneMods.cend(), [&standAloneMod](const std::shared_ptr<StandAloneMod> & currentStandAloneMod) {
-		return &standAloneMod == currentStandAloneMod.get();
-	});
+	size_t standAloneModIndex = indexOfStandAloneMod(standAloneMod.getID(), standAloneMod.getVersion());
 
-	if(standAloneModIterator == m_standAloneMods.cend()) {
+	if(standAloneModIndex == std::numeric_limits<size_t>::max() || m_standAloneMods[standAloneModIndex].get() != &standAloneMod) {
 		return std::numeric_limits<size_t>::max();
 	}
 
-	return standAloneModIterator - m_standAloneMods.cbegin();
+	return standAloneModIndex;
 }
 
 size_t StandAloneModCollection::indexOfStandAloneMod(const ModVersion & modVersion) const {
@@ -193,6 +213,7 @@ bool StandAloneModCollection::addStandAloneMod(const StandAloneMod & standAloneM
 	}
 
 	m_standAloneMods.emplace_back(std::make_shared<StandAloneMod>(standAloneMod));
+	m_standAloneModIndicesByKey.emplace(getStandAloneModKey(standAloneMod.getID(), standAloneMod.getVersion()), m_standAloneMods.size() - 1);
 
 	return true;
 }
@@ -203,6 +224,7 @@ bool StandAloneModCollection::addStandAloneMod(std::shared_ptr<StandAloneMod> st
 	}
 
 	m_standAloneMods.push_back(standAloneMod);
+	m_standAloneModIndicesByKey.emplace(getStandAloneModKey(standAloneMod->getID(), standAloneMod->getVersion()), m_standAloneMods.size() - 1);
 
 	return true;
 }
@@ -214,6 +236,8 @@ bool StandAloneModCollection::removeStandAloneMod(size_t index) {
 
 	m_standAloneMods.erase(m_standAloneMods.begin() + index);
 
+	rebuildIndices();
+
 	return true;
 }
 
@@ -235,6 +259,7 @@ bool StandAloneModCollection::removeStandAloneMod(const ModGameVersion & modGame
 
 void StandAloneModCollection::clearStandAloneMods() {
 	m_standAloneMods.clear();
+	m_standAloneModIndicesByKey.clear();
 }
 
 size_t StandAloneModCollection::checkForMissingExecutables() const {
@@ -342,6 +367,7 @@ std::unique_ptr<StandAloneModCollection> StandAloneModCollection::parseFrom(cons
 		}
 
 		newStandAloneModCollection->m_standAloneMods.emplace_back(std::move(newStandAloneMod));
+		newStandAloneModCollection->m_standAloneModIndicesByKey.emplace(getStandAloneModKey(newStandAloneModCollection->m_standAloneMods.back()->getID(), newStandAloneModCollection->m_standAloneMods.back()->getVersion()), newStandAloneModCollection->m_standAloneMods.size() - 1);
 	}
 
 	return newStandAloneModCollection;
@@ -396,7 +422,8 @@ bool StandAloneModCollection::loadFromJSON(const std::string & filePath, bool au
 		return false;
 	}
 
-	m_standAloneMods = standAloneModCollection->m_standAloneMods;
+	m_standAloneMods = std::move(standAloneModCollection->m_standAloneMods);
+	m_standAloneModIndicesByKey = std::move(standAloneModCollection->m_standAloneModIndicesByKey);
 
 	return true;
 }
@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class ModGameVersion;
@@ -68,7 +69,11 @@ public:
 	static const uint32_t FILE_FORMAT_VERSION;
 
 private:
+	void rebuildIndices();
+	static std::string getStandAloneModKey(const std::string & modID, const std::string & modVersion);
+
 	std::vector<std::shared_ptr<StandAloneMod>> m_standAloneMods;
+	std::unordered_map<std::string, size_t> m_standAloneModIndicesByKey;
 };
 
 #endif // _STAND_ALONE_MOD_COLLECTION_H_